@@ -87,10 +87,17 @@ extern uint32_t SystemCoreClock;
 #define configUSE_DAEMON_TASK_STARTUP_HOOK      1
 
 /* Run time and task stats gathering related definitions. */
-#define configGENERATE_RUN_TIME_STATS           0
+#define configGENERATE_RUN_TIME_STATS           1
 #define configUSE_TRACE_FACILITY                1
 #define configUSE_STATS_FORMATTING_FUNCTIONS    0
 
+/* The run time counter is in microseconds, from the DWT cycle counter. It is
+ * read by the console to report the CPU load of each task, see console.c. */
+extern void console_start_run_time(void);
+extern uint32_t console_get_run_time(void);
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()    console_start_run_time()
+#define portGET_RUN_TIME_COUNTER_VALUE()            console_get_run_time()
+
 /* Co-routine related definitions. */
 #define configUSE_CO_ROUTINES                   0
 #define configMAX_CO_ROUTINE_PRIORITIES         1
@@ -64,7 +64,7 @@ cy_rslt_t cy_fifo_write(cy_fifo_t *obj, void *buffer, uint32_t count)
     {
         while (count > 0)
         {
-            memcpy((void *) ((uint32_t) obj->pool + (obj->write_offset*obj->item_size)), buf_ptr, obj->item_size);
+            memcpy((void *) ((uintptr_t) obj->pool + (obj->write_offset*obj->item_size)), buf_ptr, obj->item_size);
             buf_ptr += obj->item_size;
             count--;
             obj->write_offset++;
@@ -101,7 +101,7 @@ cy_rslt_t cy_fifo_read(cy_fifo_t *obj, void *buffer, uint32_t count)
     {
         while (count > 0)
         {
-            memcpy(buf_ptr, (const void *) ((uint32_t) obj->pool + (obj->read_offset*obj->item_size)), obj->item_size);
+            memcpy(buf_ptr, (const void *) ((uintptr_t) obj->pool + (obj->read_offset*obj->item_size)), obj->item_size);
             buf_ptr += obj->item_size;
             count--;
             obj->read_offset++;
@@ -126,7 +126,7 @@ cy_rslt_t cy_fifo_read_silent(cy_fifo_t *obj, void *buffer, uint32_t count)
     {
         while (count > 0)
         {
-            memcpy(buf_ptr, (const void *) ((uint32_t) obj->pool + (read_offset*obj->item_size)), obj->item_size);
+            memcpy(buf_ptr, (const void *) ((uintptr_t) obj->pool + (read_offset*obj->item_size)), obj->item_size);
             buf_ptr += obj->item_size;
             count--;
             read_offset++;
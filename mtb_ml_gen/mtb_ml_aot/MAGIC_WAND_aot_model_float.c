@@ -0,0 +1,1608 @@
+/***************************************************************************//**
+* \file MAGIC_WAND_aot_model_float.c
+*
+* \brief
+* Autogenerated with train/aot_compile.py from MAGIC_WAND_float.tflite, this file
+* contains the MAGIC_WAND model compiled to straight-line C.
+*******************************************************************************/
+
+#include "MAGIC_WAND_aot_model_float.h"
+
+#include <stdint.h>
+#include <string.h>
+#include <float.h>
+#include <math.h>
+
+/* The products and sums are rounded one by one, as in the TFLM kernels */
+#pragma GCC optimize ("fp-contract=off")
+
+static const float MAGIC_WAND_aot_stage0_weights[144] =
+{
+    1.634605415e-02f, -2.973079681e-01f, 3.382417262e-01f, 2.866752446e-01f,
+    -1.471448392e-01f, 1.235704869e-01f, 1.984807551e-01f, -1.511234939e-01f,
+    -3.742313012e-02f, 9.836230427e-02f, -1.253584623e-01f, 3.596392572e-01f,
+    5.833800137e-02f, -1.315283924e-01f, 2.402107418e-01f, 2.503567934e-01f,
+    -7.200574875e-02f, 1.488898546e-01f, 1.348281186e-02f, -1.219176725e-01f,
+    -1.499002576e-01f, 1.648439467e-01f, -2.125117481e-01f, -2.378065735e-01f,
+    2.535330355e-01f, -3.745109960e-02f, -2.181451619e-01f, 1.667507887e-01f,
+    3.194840550e-01f, 2.990221977e-01f, -5.662899464e-02f, 2.127657682e-01f,
+    1.003637314e-01f, 4.913026094e-02f, 1.933837086e-01f, 9.431485087e-02f,
+    2.677367926e-01f, 1.164499968e-01f, 4.622763991e-01f, 2.693158984e-01f,
+    7.545878645e-03f, 3.684018850e-01f, 3.484113514e-01f, 1.006928012e-01f,
+    2.982398868e-01f, -4.219085872e-01f, 2.942156605e-02f, -2.050647587e-01f,
+    3.648027778e-02f, -7.477583736e-02f, -1.044627428e-01f, -7.303762436e-02f,
+    1.854125224e-02f, 4.911388829e-02f, 1.162925437e-01f, -9.994905442e-02f,
+    -2.447811961e-01f, 1.164185554e-01f, -5.819453672e-02f, -8.360638469e-02f,
+    1.400620192e-01f, -7.411930710e-02f, -1.892198622e-01f, -2.300808877e-01f,
+    6.528346986e-02f, 2.060027122e-01f, -1.460861266e-01f, 2.048386633e-01f,
+    3.883956373e-02f, -6.563033164e-02f, 2.836300135e-01f, 2.073602378e-01f,
+    3.596526980e-01f, -8.818064630e-02f, -3.020740487e-02f, 4.899679422e-01f,
+    -1.116097346e-01f, -2.291343808e-01f, 2.790483832e-01f, 1.563798338e-01f,
+    -2.862068713e-01f, 4.260701686e-02f, 2.284536064e-01f, -2.245536596e-01f,
+    8.732564747e-02f, -4.520245269e-02f, -4.824872315e-01f, -4.506665841e-02f,
+    1.051034480e-01f, -2.963142097e-01f, 6.192172319e-02f, 3.834998012e-01f,
+    -2.400913835e-01f, 2.531825937e-02f, 1.651655734e-01f, -8.569826186e-02f,
+    -2.097851932e-01f, 1.680910289e-01f, 1.107324138e-01f, -1.198873110e-02f,
+    1.705442518e-01f, -3.512107432e-01f, -6.521852314e-02f, 5.014009401e-02f,
+    -2.638736367e-01f, 1.138596833e-01f, -1.119163334e-01f, -4.557984471e-01f,
+    4.662383348e-02f, 4.167118669e-01f, 3.190924525e-01f, 1.952853985e-02f,
+    3.734748363e-01f, 1.502906531e-01f, 6.046725437e-02f, 4.671547413e-01f,
+    8.966274559e-02f, 2.112103999e-02f, 7.405763119e-02f, -9.617473930e-02f,
+    -2.688056529e-01f, 3.981914837e-03f, 1.325397491e-01f, -2.491912544e-01f,
+    -1.977635175e-01f, -9.898006916e-02f, 2.097579837e-01f, 1.705629751e-02f,
+    -2.913819849e-01f, 1.395746619e-01f, 2.151430994e-01f, -1.493526250e-01f,
+    1.271634400e-01f, 2.938279510e-01f, -2.931300700e-01f, 2.075130492e-01f,
+    7.848919369e-03f, -3.536970913e-02f, 9.930181503e-02f, -3.188582361e-01f,
+    -5.216747895e-02f, 2.633427978e-01f, 8.119588345e-02f, -7.424535602e-02f
+};
+
+static const float MAGIC_WAND_aot_stage0_bias[16] =
+{
+    4.570894409e-03f, -5.622539297e-02f, 1.637651585e-02f, 8.296239376e-02f,
+    8.036934771e-03f, 3.291097656e-02f, 1.216418669e-02f, 5.455952138e-02f,
+    1.120610237e-01f, 4.334842379e-04f, 1.911335997e-02f, 5.627275910e-03f,
+    -9.606498497e-05f, 9.136763215e-02f, 1.099859849e-01f, 1.893369108e-02f
+};
+
+static const float MAGIC_WAND_aot_stage0_mul0[16] =
+{
+    1.708215714e+01f, 3.491924667e+01f, 2.068947792e+01f, 2.487935829e+01f,
+    2.721785164e+01f, 2.087138367e+01f, 2.512832642e+01f, 2.038978004e+01f,
+    2.315809441e+01f, 2.247176933e+01f, 2.619836617e+01f, 2.155488968e+01f,
+    1.933078003e+01f, 1.935623550e+01f, 2.389137840e+01f, 2.761908913e+01f
+};
+
+static const float MAGIC_WAND_aot_stage0_add1[16] =
+{
+    -1.581409812e+00f, -6.572647095e-01f, -1.638710380e+00f, -2.340359688e+00f,
+    -8.848076463e-01f, -2.152668715e+00f, -1.448365450e+00f, -2.527714729e+00f,
+    -3.702567101e+00f, -6.801788211e-01f, -1.466901541e+00f, -8.394357562e-01f,
+    -6.494932771e-01f, -3.187629223e+00f, -3.145092964e+00f, -1.755614042e+00f
+};
+
+static const float MAGIC_WAND_aot_stage1_weights[4608] =
+{
+    -1.591422595e-02f, -2.331185620e-03f, -6.321842968e-02f, -2.598800659e-01f,
+    -1.304904222e-01f, -4.600025713e-03f, -3.777359799e-02f, 2.678695880e-02f,
+    -2.181418687e-01f, 1.829066128e-01f, 3.251365200e-02f, 2.860318124e-01f,
+    -2.367413044e-01f, -5.919113010e-02f, 5.138122290e-02f, -2.438277937e-02f,
+    -1.381272227e-01f, 8.551390469e-02f, -8.057937771e-02f, -1.452047080e-01f,
+    -2.820235863e-02f, 2.161919838e-03f, -2.473229915e-02f, 2.534236759e-03f,
+    -2.327023633e-02f, 1.423437297e-01f, 2.061682492e-01f, 1.143851504e-01f,
+    -1.700686216e-01f, 1.741371863e-02f, -1.727852374e-01f, -8.589290082e-03f,
+    9.505698830e-02f, 3.980211169e-02f, 6.751003861e-02f, -1.509093642e-01f,
+    -1.091141626e-01f, 2.285693735e-01f, 1.188220680e-01f, 1.524148136e-01f,
+    4.112861678e-02f, 1.617779955e-02f, 7.227707654e-02f, 3.870723397e-02f,
+    -1.699135005e-01f, 2.383776568e-02f, -1.819405556e-01f, 3.813893721e-02f,
+    1.398056746e-01f, 2.470018156e-02f, -2.637990564e-02f, -1.249706447e-01f,
+    -1.662121713e-02f, 2.545189671e-02f, 4.680870101e-02f, 4.239129275e-02f,
+    6.341429800e-02f, 1.794738919e-01f, 9.955886751e-02f, 8.409386873e-02f,
+    -6.458988786e-02f, 1.265100986e-01f, 1.366928369e-01f, 1.318682581e-01f,
+    -3.483855352e-02f, 7.869254798e-02f, -7.183822803e-03f, -1.682243496e-01f,
+    -4.582421854e-02f, 7.714224607e-02f, 6.430146098e-02f, 2.235007584e-01f,
+    -8.499979973e-02f, 5.798720196e-02f, 1.038326621e-01f, 1.991791278e-01f,
+    -8.263127506e-02f, 4.787124228e-03f, -1.070948411e-02f, -1.750984415e-02f,
+    4.071240500e-02f, 1.269593555e-02f, 4.277003929e-02f, -1.589575112e-01f,
+    -2.088147104e-01f, 7.064270228e-02f, 8.018950373e-02f, 1.087750569e-01f,
+    1.178466529e-01f, -3.846085444e-02f, 1.726151630e-02f, 6.765021477e-03f,
+    -2.518579662e-01f, 5.795411766e-02f, -2.158806473e-01f, -2.664334141e-02f,
+    3.448349237e-02f, 1.362797618e-01f, 1.600996107e-01f, -2.718584053e-02f,
+    1.292777210e-01f, 1.024050042e-01f, 1.247083172e-01f, 2.623777688e-01f,
+    6.160431355e-02f, 1.920330673e-01f, 5.672343075e-02f, 8.626217395e-02f,
+    -2.755769063e-03f, 2.159685194e-01f, 5.820483714e-02f, 1.977619380e-01f,
+    7.634366304e-02f, 2.118742913e-01f, 1.581573933e-01f, -5.737583339e-02f,
+    -3.995833173e-02f, 1.490837485e-01f, 1.905266643e-01f, 2.716079056e-01f,
+    -7.255665958e-02f, 1.245797276e-01f, 9.554615617e-02f, -1.319895592e-02f,
+    -1.175112650e-01f, 7.634285092e-02f, 5.224759504e-02f, 1.963481456e-01f,
+    2.735421062e-02f, 5.097671598e-02f, 2.954062074e-02f, -1.618113518e-01f,
+    -1.594956368e-01f, 1.193468347e-01f, 1.651155651e-01f, -3.128412366e-02f,
+    1.892431676e-01f, -6.363774091e-02f, 1.254651546e-01f, -1.713932008e-01f,
+    -2.473084927e-01f, -8.490044624e-03f, -2.709969878e-01f, 7.273711264e-02f,
+    2.666437253e-02f, -6.165109575e-02f, -1.675415225e-02f, 1.060662791e-01f,
+    -8.867361397e-02f, 5.487965792e-02f, 5.071467534e-02f, 5.439301953e-02f,
+    -3.944691718e-01f, 1.217711717e-01f, 4.944236949e-02f, 1.082770154e-01f,
+    1.463002115e-01f, 4.869540408e-02f, -1.138052437e-03f, -2.645397186e-02f,
+    3.531843424e-02f, -1.423933208e-01f, 5.656892806e-02f, 2.818001434e-02f,
+    2.180702053e-03f, -1.810520142e-02f, -3.003109619e-02f, 9.493470937e-02f,
+    2.477854490e-03f, 4.865615815e-02f, 1.053047702e-01f, -9.184267372e-02f,
+    4.831627384e-02f, -6.007904932e-02f, 8.583690971e-02f, 6.282656640e-02f,
+    2.162504010e-02f, -7.028456032e-02f, -7.638818771e-02f, -1.391715650e-02f,
+    1.235278547e-01f, -4.092225805e-02f, -3.672028705e-02f, -1.249018088e-01f,
+    5.600594729e-02f, -1.051522419e-01f, 7.751240581e-02f, -1.152536198e-01f,
+    7.662580349e-03f, -6.644391268e-02f, -6.507170200e-02f, 8.482191712e-02f,
+    2.477347292e-02f, -3.678865731e-02f, -6.929429621e-02f, -3.509231284e-02f,
+    1.081055403e-01f, 1.420883089e-01f, -6.057312340e-02f, -1.625121012e-02f,
+    -3.662616313e-01f, 2.338796854e-01f, 9.182720631e-02f, 1.634900272e-01f,
+    -1.909267902e-02f, 1.029673293e-01f, -1.162835676e-02f, -4.702887684e-02f,
+    -2.271303535e-02f, -2.277123928e-01f, 4.952617455e-03f, -1.505010296e-02f,
+    2.437379956e-02f, -3.506173939e-02f, -2.356694266e-02f, 1.161372960e-01f,
+    -1.146037597e-02f, 6.525648385e-02f, 1.249071136e-01f, 5.376087129e-02f,
+    1.091273502e-01f, 6.071551144e-02f, 1.348971725e-01f, -4.552406026e-04f,
+    -2.863375098e-02f, -2.483583800e-02f, -4.186493531e-02f, -1.062162891e-01f,
+    1.865146905e-01f, -8.876062930e-03f, -2.214096719e-03f, -1.394319683e-01f,
+    1.444312632e-01f, -9.116040170e-02f, 3.089748882e-02f, -8.137381822e-02f,
+    -1.037258804e-01f, -9.036550671e-02f, -4.849109333e-03f, 1.224750057e-01f,
+    6.468310487e-03f, -4.421335831e-02f, 8.738838136e-03f, -5.582166091e-02f,
+    5.461595953e-02f, 5.389635451e-03f, 6.456213072e-03f, -1.627891557e-03f,
+    -3.924262822e-01f, 1.150921658e-01f, 7.240275294e-02f, 1.130120307e-01f,
+    1.288809348e-02f, 1.031132713e-01f, 4.337230697e-03f, 8.936833590e-03f,
+    1.306105219e-02f, -1.984427124e-01f, -4.997786134e-02f, -2.236542292e-02f,
+    -5.173038319e-02f, -2.448963933e-02f, -7.326596230e-02f, 8.251237869e-02f,
+    -9.037619829e-02f, 2.251253696e-03f, 1.585714370e-01f, -1.080430970e-01f,
+    -5.715132505e-02f, 2.806311846e-02f, -9.202419780e-03f, -5.900821462e-02f,
+    -1.292536780e-02f, -2.697313949e-02f, -5.364783108e-02f, 1.268581152e-01f,
+    2.122746557e-01f, -6.043182686e-02f, 6.789924228e-04f, -9.203615040e-02f,
+    2.125326395e-01f, -7.426257432e-02f, 4.649929330e-02f, -1.785552204e-01f,
+    3.634336218e-02f, -1.061360911e-01f, 6.453841180e-02f, 9.036657214e-02f,
+    -4.721950740e-02f, -9.447545558e-02f, -1.253465116e-01f, 8.037367463e-02f,
+    1.623895615e-01f, 3.569008783e-02f, -1.121640205e-02f, 3.341552243e-02f,
+    -3.618721962e-01f, -8.564380929e-03f, -1.098208576e-01f, 3.038648516e-02f,
+    1.197201908e-01f, -5.333818123e-02f, -9.268947691e-02f, -1.743330806e-01f,
+    -3.065076843e-02f, -6.606832892e-02f, 3.260805458e-02f, 1.385181844e-01f,
+    9.100699425e-02f, -3.907206282e-02f, -5.499564484e-02f, 2.331218868e-02f,
+    -3.417021409e-02f, -2.802572399e-02f, 5.815416202e-02f, -1.678705961e-01f,
+    3.307823837e-02f, 2.498544008e-02f, 1.732815504e-01f, -3.672808409e-02f,
+    3.099210747e-02f, 3.269985691e-02f, 9.351670742e-03f, 1.846707426e-02f,
+    6.778454036e-02f, -1.427693665e-01f, 1.131998468e-02f, 1.243950427e-02f,
+    7.564387470e-02f, -1.941974610e-01f, 7.749250531e-02f, -3.340047225e-02f,
+    -1.961231790e-02f, -7.134591788e-02f, -4.006557539e-02f, -6.667238474e-02f,
+    -1.604426838e-02f, -6.174954399e-02f, -9.307262301e-02f, -9.626791626e-02f,
+    8.792743832e-02f, 6.516736001e-02f, 4.116861150e-02f, 4.088916630e-02f,
+    -4.133996069e-01f, 6.000391766e-02f, 1.355740335e-02f, 1.360565424e-01f,
+    -1.817536540e-02f, -1.828984823e-03f, -1.601699591e-01f, -1.368958503e-01f,
+    -3.312482685e-02f, -1.101154089e-01f, -3.515323857e-03f, 1.417920291e-01f,
+    1.300640218e-02f, 3.599876538e-02f, -1.122229453e-02f, 1.255771220e-01f,
+    -1.418626010e-01f, 5.819752440e-02f, 1.171734780e-01f, 4.126530513e-02f,
+    4.439520463e-02f, 6.467124075e-02f, 1.409753505e-02f, 2.044787258e-02f,
+    1.297373325e-01f, -1.383326054e-01f, -2.076579630e-02f, 8.756566048e-02f,
+    1.755548120e-01f, -5.337989703e-02f, -7.537268102e-03f, -8.745893091e-02f,
+    2.549246848e-01f, -3.027800284e-02f, 5.781978369e-02f, -1.501543820e-01f,
+    -4.213206843e-02f, -1.290359795e-01f, 1.265308261e-01f, 4.601817112e-03f,
+    -1.574866474e-02f, -5.271668732e-02f, -4.325003177e-02f, -4.453846440e-02f,
+    -1.975054108e-02f, 9.674181044e-02f, -8.983131498e-03f, 2.130816281e-01f,
+    -2.489823848e-01f, 1.870930642e-01f, 5.434160680e-02f, 1.738283187e-01f,
+    8.612800390e-02f, 5.441177636e-02f, -5.937206000e-02f, -2.455291152e-02f,
+    -1.242803782e-02f, -1.519040912e-01f, 7.386092097e-02f, -5.454682186e-02f,
+    -4.401414469e-02f, 4.784610868e-02f, 5.598132685e-02f, 1.905573159e-01f,
+    -1.134294719e-01f, 8.123318106e-02f, 2.034747750e-01f, 1.152887642e-01f,
+    -1.263693273e-01f, 8.380838670e-03f, -1.179903522e-01f, -3.307668865e-02f,
+    -4.771617055e-02f, -1.681548953e-01f, 3.040462919e-02f, -9.317922592e-02f,
+    1.605410576e-01f, 6.900511216e-03f, -1.572720520e-02f, -6.568998098e-02f,
+    1.929146796e-01f, -1.549763978e-01f, 8.832527697e-02f, -1.078796908e-01f,
+    -8.504757285e-02f, 8.860107511e-03f, -4.125513509e-02f, 1.042249575e-01f,
+    4.845650122e-02f, 6.765706465e-03f, 1.192818806e-01f, 2.079291455e-02f,
+    -2.243383229e-02f, 1.192598864e-01f, 2.270477414e-01f, -4.791732132e-02f,
+    4.850354791e-01f, -3.477259874e-01f, -1.758053303e-01f, -2.183825970e-01f,
+    1.084204763e-01f, -2.767656744e-02f, -1.385428105e-02f, 1.820970923e-01f,
+    1.728207320e-01f, 1.971416175e-01f, 1.009509638e-01f, 1.386867166e-01f,
+    1.616676599e-01f, 7.297416031e-02f, 7.342076302e-02f, 1.703464091e-01f,
+    1.610551029e-01f, -1.114132479e-01f, -4.052938148e-02f, -7.479125168e-03f,
+    4.265037179e-02f, 5.703889579e-02f, 7.134315372e-02f, 2.755178809e-01f,
+    1.361488402e-01f, 1.011508331e-01f, -4.208336025e-02f, -2.093822211e-01f,
+    -1.283121556e-01f, 2.188895829e-02f, 1.038321704e-01f, 5.456370302e-03f,
+    -5.918403342e-02f, -1.296621710e-01f, 1.842580363e-02f, -7.692677528e-02f,
+    -2.619517744e-01f, 1.457285509e-02f, -2.709716260e-01f, -4.436028004e-02f,
+    -1.823826730e-01f, -1.610261798e-01f, -3.584560007e-02f, -4.680026905e-04f,
+    -5.275081471e-02f, -4.708327726e-02f, -4.396145418e-02f, -4.778710753e-02f,
+    5.115259290e-01f, -1.837276071e-01f, 2.409366705e-02f, -2.331948839e-03f,
+    3.626761958e-02f, -1.792243421e-01f, -5.146091804e-02f, 5.311539397e-02f,
+    -4.308633506e-02f, 1.010379717e-01f, 8.314999193e-02f, 1.076937988e-01f,
+    2.267348170e-01f, 1.910134777e-02f, 1.439807117e-01f, -9.071101993e-02f,
+    3.246261925e-02f, -1.138427183e-01f, -1.411228999e-02f, 1.018963382e-01f,
+    1.607044786e-02f, -7.463599741e-02f, 5.627843738e-02f, 5.474757403e-02f,
+    1.107023750e-02f, 1.844459325e-01f, 8.879227936e-02f, -2.422387749e-01f,
+    -9.910848737e-02f, 8.519452065e-02f, -6.390657276e-02f, 1.848058216e-02f,
+    -1.347663105e-01f, -1.284405440e-01f, -1.575113237e-01f, -1.168903038e-01f,
+    -2.021408975e-01f, 3.259152174e-02f, -1.765654683e-01f, 1.369611081e-02f,
+    -3.575910628e-01f, 5.454697087e-02f, -1.868127584e-01f, -8.692208678e-02f,
+    -1.751109809e-01f, -2.537565529e-01f, -1.709980667e-01f, -1.216979623e-01f,
+    4.184640348e-01f, -1.384288887e-03f, -2.028400302e-01f, 6.800469011e-02f,
+    1.165674031e-01f, -2.497406751e-01f, -6.476306915e-02f, -2.069676816e-01f,
+    2.382494323e-02f, -5.960446969e-02f, 2.246957459e-02f, 6.830899417e-02f,
+    5.521791056e-02f, -2.663464984e-04f, 1.707663760e-02f, 1.410384476e-01f,
+    1.883727014e-01f, -1.984813809e-01f, 5.692220107e-02f, -1.343867928e-01f,
+    1.145765483e-01f, 4.324878380e-02f, 6.735441089e-02f, -8.433017135e-02f,
+    3.600574285e-02f, 2.141608447e-01f, -6.493740529e-02f, -2.105113864e-01f,
+    -5.587685108e-02f, -4.843436182e-02f, 1.051199716e-02f, 1.493495554e-01f,
+    -2.210897654e-01f, -2.370973229e-01f, -8.312169462e-02f, -9.300233424e-02f,
+    -2.727717459e-01f, 6.344815716e-03f, -1.763649136e-01f, -1.486314111e-03f,
+    -7.944612205e-02f, 1.317728460e-01f, -1.315522194e-02f, -9.897039272e-03f,
+    -1.194291413e-01f, -1.052550822e-01f, -1.766671799e-02f, -2.025022954e-01f,
+    3.326818645e-01f, 8.276359737e-02f, -5.431521311e-02f, 4.339371249e-02f,
+    -1.556989700e-01f, 1.627043821e-02f, -9.384766966e-02f, -4.518631846e-03f,
+    -1.383122802e-01f, 7.823540270e-02f, -2.654397488e-01f, 9.769251198e-02f,
+    -9.200278670e-02f, -5.291179940e-02f, -2.046020329e-01f, -1.308703125e-01f,
+    4.317742214e-02f, 1.224721968e-01f, 2.138437629e-01f, 2.885574996e-01f,
+    1.106683463e-01f, -9.018760920e-02f, 1.469171047e-01f, -2.417602539e-01f,
+    -2.224213481e-01f, -1.359913647e-01f, -1.582889408e-01f, 5.605171993e-02f,
+    -1.043689251e-01f, -5.570434779e-02f, -3.143200278e-02f, -5.309249088e-02f,
+    -2.205259800e-01f, 1.211729273e-02f, -1.199251711e-01f, -8.300025365e-04f,
+    6.544191390e-02f, -7.137440890e-02f, -2.205567807e-01f, -2.535733879e-01f,
+    4.006560147e-02f, -2.845712472e-03f, -2.281193621e-02f, -2.404691465e-02f,
+    -9.096138179e-02f, -1.447232217e-01f, -1.677006036e-01f, -1.624558121e-01f,
+    3.573080897e-01f, -4.610770568e-02f, 1.580587626e-01f, 4.472021759e-02f,
+    -4.243197665e-02f, -1.586758345e-01f, 2.894936688e-02f, 3.366088122e-02f,
+    -9.539958835e-02f, 2.281539887e-02f, -1.279769987e-01f, 2.361841351e-01f,
+    1.949399337e-02f, -1.934284717e-01f, -2.140943110e-01f, -7.923857123e-02f,
+    1.592570567e-03f, 2.067168206e-01f, 8.860265464e-02f, 9.277612716e-02f,
+    1.105629727e-01f, -8.870777488e-02f, 7.125291228e-02f, -1.560754329e-01f,
+    -1.329433266e-02f, -2.182078920e-02f, -6.342145801e-02f, -1.345714647e-02f,
+    -1.082195342e-01f, 4.353309050e-02f, -5.239602923e-02f, -1.173782721e-01f,
+    -1.325295866e-01f, 1.806065142e-01f, -1.523865461e-01f, 1.977460831e-01f,
+    2.194632310e-03f, -6.026204303e-02f, -8.971353620e-02f, -1.256760508e-01f,
+    -7.455839217e-02f, -1.080084778e-02f, -5.192873627e-02f, 1.685594954e-02f,
+    -2.069798112e-01f, -1.566389501e-01f, -1.535603851e-01f, -2.484979182e-01f,
+    2.836501598e-01f, -1.944750175e-02f, 3.531951830e-02f, 2.058574371e-02f,
+    -1.107330099e-01f, -7.089465111e-02f, 8.714482188e-02f, -3.705524281e-02f,
+    -5.388991162e-02f, 4.413352534e-02f, -1.339594722e-01f, 2.785777748e-01f,
+    -9.814646840e-02f, -1.181071177e-01f, -1.166898981e-01f, -1.427546740e-01f,
+    1.673274860e-02f, 9.519451112e-02f, 1.095356494e-01f, 1.252415627e-01f,
+    1.117145121e-01f, -8.508995175e-02f, 2.363868356e-01f, -1.203430071e-01f,
+    -3.088941798e-02f, 2.428470366e-02f, 3.482655808e-02f, -2.739067376e-01f,
+    -1.276691109e-01f, -1.331155561e-02f, -1.685745269e-01f, -1.323692948e-01f,
+    -1.156382263e-01f, 1.398037970e-01f, -3.076334298e-02f, 2.431101501e-01f,
+    -1.127933711e-01f, -1.628766023e-02f, -5.219874904e-02f, 3.841174394e-02f,
+    -1.068119109e-01f, -2.560685575e-02f, 4.314411432e-02f, 5.589146540e-02f,
+    2.024588436e-01f, -2.979706787e-02f, -1.153295487e-01f, -1.100117415e-01f,
+    1.470195651e-01f, -1.432670355e-01f, -1.237875149e-01f, -1.984014362e-01f,
+    4.035390168e-02f, -1.159603591e-03f, -1.585071981e-01f, 2.739755437e-02f,
+    3.398588672e-02f, -1.420934647e-01f, 7.559665293e-02f, -3.170466423e-02f,
+    5.913978443e-03f, -1.858749613e-02f, -1.274568960e-02f, -1.769996807e-02f,
+    -3.272922337e-02f, -4.457086697e-02f, -6.107106432e-02f, -9.488434345e-02f,
+    -7.841173559e-02f, -6.803617626e-02f, 7.895003259e-02f, 5.861318856e-02f,
+    -4.030442238e-02f, 8.998788148e-02f, -1.952050813e-02f, -2.120219767e-01f,
+    -2.364429981e-01f, 1.344122142e-01f, 1.235558912e-01f, -5.160635710e-02f,
+    -6.065525115e-02f, 4.760784656e-02f, -6.050709635e-02f, -6.694190204e-02f,
+    -1.193625703e-01f, 6.604254991e-02f, -2.523889206e-02f, 4.591085948e-03f,
+    6.436292827e-02f, 4.293009639e-02f, 4.591327533e-02f, -1.113165766e-01f,
+    1.251314729e-01f, 4.880295321e-02f, 5.002126470e-02f, -4.579592496e-02f,
+    2.539432943e-01f, -1.926961988e-01f, -2.015457451e-01f, -6.134683266e-02f,
+    1.533277631e-01f, -2.357915789e-02f, -4.054757208e-02f, 9.715437144e-02f,
+    -1.473482847e-01f, -6.566813588e-02f, 1.442146301e-01f, -1.039434746e-01f,
+    8.443394303e-02f, 1.131378859e-02f, 1.928055882e-01f, -3.963285312e-02f,
+    -7.678242028e-02f, -2.690456249e-02f, -1.103514209e-01f, -6.128368154e-02f,
+    -2.622131072e-02f, -6.170118228e-02f, 1.960206404e-02f, -5.185178667e-02f,
+    -1.690455526e-02f, 4.819681868e-02f, 7.857592404e-02f, -9.825567156e-02f,
+    -1.088904589e-01f, 7.149109244e-02f, 9.779439121e-02f, 6.736360490e-02f,
+    -1.354628801e-01f, -2.683957852e-02f, 5.996730179e-03f, -1.764757186e-01f,
+    -1.161456183e-01f, 4.946421087e-02f, -1.812020391e-01f, 5.846714601e-02f,
+    -5.830549169e-03f, -4.984396324e-02f, -3.227663413e-02f, -9.000368416e-02f,
+    2.253708094e-01f, 6.257236004e-02f, -1.093054190e-01f, -1.323669851e-01f,
+    1.777797788e-01f, -2.203575820e-01f, -8.066484332e-02f, -1.951028109e-01f,
+    1.100332960e-01f, 4.612213373e-02f, 6.813690811e-02f, 3.144692630e-02f,
+    -7.003629208e-02f, -1.483787410e-02f, 6.420326978e-02f, -4.560348764e-02f,
+    -7.098792493e-02f, -9.141062200e-02f, 1.731407940e-01f, -8.682292700e-02f,
+    8.144696802e-02f, 3.019686230e-02f, -9.248466790e-02f, -1.569033251e-03f,
+    1.249584835e-02f, -6.787602603e-02f, -1.409445051e-02f, 6.906820834e-02f,
+    3.694243729e-02f, -3.969964758e-02f, 4.304957017e-02f, -1.028994694e-01f,
+    -2.209227681e-01f, 1.201235726e-01f, 6.166466698e-02f, 1.477637738e-01f,
+    -1.090613902e-01f, -1.835960001e-01f, -1.030075401e-01f, -1.499338299e-01f,
+    1.950614154e-02f, -9.273664653e-02f, -1.020123437e-01f, 3.105354682e-02f,
+    4.717473313e-02f, 9.833207726e-02f, -2.132652253e-01f, 1.625348330e-01f,
+    4.882472381e-02f, -1.451531798e-01f, -2.563286126e-01f, 6.904549152e-02f,
+    2.853026092e-01f, 1.926273108e-01f, 1.620673388e-01f, 1.276075542e-01f,
+    2.010577545e-02f, -1.810735762e-01f, 2.178166062e-01f, -1.333519816e-01f,
+    -1.143356320e-02f, -9.395142645e-02f, -9.235990047e-02f, -2.894801795e-01f,
+    -1.735257059e-01f, 8.540554345e-02f, 2.796171792e-02f, -2.035870403e-01f,
+    4.825932905e-02f, 1.045199484e-01f, -2.296428084e-01f, 6.581651419e-02f,
+    -1.677668281e-02f, 9.790351242e-02f, -2.446092367e-01f, 1.193165183e-01f,
+    1.035888214e-02f, 8.357417770e-03f, -7.724693418e-02f, 4.277544022e-01f,
+    2.258164436e-01f, 5.622596294e-02f, -4.040044174e-02f, 3.716426203e-03f,
+    -3.925933316e-02f, 1.495169997e-01f, -4.252950475e-02f, 1.992249675e-02f,
+    2.270833403e-01f, 1.201891750e-01f, 8.757847548e-02f, 3.736248612e-02f,
+    9.205933660e-02f, 7.102850825e-02f, -2.066583186e-01f, -4.689147696e-02f,
+    9.687952697e-02f, -1.456935406e-01f, -2.843819559e-01f, 9.573753178e-02f,
+    1.806215495e-01f, 9.596668929e-02f, -4.466474429e-02f, 9.850513935e-02f,
+    -4.861809313e-02f, -1.352464221e-02f, 1.005595177e-01f, -1.396579444e-01f,
+    9.291809052e-02f, -1.068691984e-01f, -1.154446676e-01f, -2.018010616e-01f,
+    -1.707061082e-01f, -3.644699976e-02f, -2.020177990e-02f, -1.706026793e-01f,
+    4.960305616e-02f, 1.113465279e-01f, 1.901609264e-02f, -1.798578538e-02f,
+    -1.619805098e-01f, -1.041886979e-03f, 1.186963163e-05f, -7.542221248e-02f,
+    -3.470252827e-02f, -5.500494689e-02f, -6.232792139e-02f, 4.757891297e-01f,
+    1.739499271e-01f, 5.865285173e-02f, -9.783814102e-02f, -8.559983969e-02f,
+    -1.220714748e-01f, 7.404012233e-02f, 9.918143600e-02f, -2.310568094e-02f,
+    2.998935580e-01f, -1.015442982e-01f, 9.500417858e-02f, -6.294260174e-02f,
+    3.259491175e-02f, 1.872338057e-01f, -1.851367950e-01f, 1.233713999e-01f,
+    1.880726404e-02f, -6.493712962e-02f, -1.792766303e-01f, 1.964956224e-01f,
+    9.053776041e-03f, 8.516537398e-02f, -1.637878269e-02f, -6.016083807e-02f,
+    1.828576177e-01f, 1.138794329e-02f, 3.396570086e-01f, -1.135985553e-01f,
+    -6.786800176e-02f, -2.087105811e-01f, -1.065998971e-01f, -3.233248591e-01f,
+    -1.794975065e-02f, 7.464812696e-02f, 3.023041971e-02f, -2.274135351e-01f,
+    1.402391791e-01f, 9.303899109e-02f, -1.498624235e-01f, 1.385730058e-01f,
+    -1.627259254e-01f, -2.127407119e-03f, -1.550873071e-01f, -1.770053059e-02f,
+    -5.772588309e-03f, 9.251203388e-03f, 3.167548776e-02f, 4.472617507e-01f,
+    2.543378472e-01f, -6.776642799e-02f, -1.141714491e-02f, 7.736389525e-03f,
+    2.350897342e-02f, 5.261752009e-02f, 4.198296368e-02f, -3.332534432e-02f,
+    3.481173217e-01f, 1.183501482e-01f, 1.797314882e-01f, -1.093603894e-01f,
+    3.943805397e-02f, 5.498072878e-02f, -7.156144828e-02f, -4.467238486e-02f,
+    2.773723900e-01f, -2.660428546e-02f, -5.455502495e-02f, 3.019064851e-02f,
+    -2.943076193e-01f, 1.538197696e-01f, 7.140970230e-02f, -8.558481000e-03f,
+    -3.458018973e-02f, -6.363634765e-02f, -1.659934670e-01f, -1.770209521e-01f,
+    2.893630590e-04f, -2.524303198e-01f, -3.109693644e-04f, -4.510959238e-02f,
+    -3.337599337e-02f, 1.007991955e-01f, -3.747105226e-02f, 1.029752642e-01f,
+    5.830095708e-02f, 2.626133561e-01f, 1.579417437e-01f, 1.927362978e-01f,
+    -2.532109804e-02f, 4.920870811e-02f, 1.230206806e-02f, -2.695087809e-03f,
+    7.194666564e-02f, 2.414080873e-02f, 1.392741501e-01f, 2.524827980e-02f,
+    -3.184842318e-02f, -2.870976180e-02f, 5.450733379e-02f, 7.795144618e-02f,
+    1.436060965e-01f, -1.320435405e-01f, 1.233454794e-01f, -1.013782695e-01f,
+    -8.624949306e-02f, 4.272809252e-02f, -1.851349473e-01f, 7.241091132e-02f,
+    1.937609725e-02f, -1.071236059e-01f, 3.913896903e-02f, -8.032402396e-02f,
+    3.898858428e-01f, 1.221607327e-01f, -8.956283331e-02f, 2.400606871e-02f,
+    -2.892523110e-01f, 2.094341516e-01f, 3.206113353e-02f, 1.171179414e-01f,
+    6.338839978e-02f, 2.421919443e-02f, -7.887189835e-02f, -1.389022917e-01f,
+    -5.004239455e-02f, -2.400293201e-01f, 4.294854403e-02f, -1.207549945e-01f,
+    -1.071001962e-01f, 5.643220618e-02f, 5.500741303e-03f, 1.594337076e-01f,
+    -2.007251233e-02f, 1.573891044e-01f, 2.706290781e-01f, 9.926394373e-02f,
+    2.061167732e-02f, 1.034651771e-01f, 1.398381144e-01f, 7.877624594e-03f,
+    3.431071341e-02f, -1.049082056e-01f, 3.793111071e-02f, -2.177497000e-01f,
+    2.484515682e-02f, 1.540777683e-01f, 1.317446083e-01f, -2.470626310e-02f,
+    1.707208306e-01f, -3.211996332e-02f, 1.140223518e-01f, -2.356731147e-01f,
+    -2.526334822e-01f, -6.086523458e-02f, -1.808134615e-01f, 7.450086623e-02f,
+    -1.083724797e-01f, -2.093269117e-02f, -2.220599353e-02f, -2.094906121e-01f,
+    4.993402213e-02f, 1.210836843e-01f, 4.665099457e-02f, -9.217061102e-02f,
+    -3.056462705e-01f, 1.169638261e-01f, 9.585210681e-02f, 1.221852005e-01f,
+    -8.319276571e-02f, 1.478911098e-02f, -9.830155969e-02f, 4.939649254e-02f,
+    -7.328002900e-02f, -2.553816140e-01f, 6.206834316e-02f, -2.224521898e-02f,
+    -9.238126129e-02f, 6.313735247e-02f, 1.124695223e-02f, 2.637374699e-01f,
+    -1.135073602e-01f, 7.756644487e-02f, 1.613106728e-01f, 9.689597040e-02f,
+    1.362025291e-01f, 8.217959851e-02f, 7.263044268e-02f, -3.756748140e-02f,
+    4.814678058e-02f, -1.106390730e-01f, 4.063415527e-02f, -1.954908371e-01f,
+    1.882121563e-01f, -6.949487608e-03f, 7.868075371e-02f, 7.435802370e-02f,
+    1.951142699e-01f, -2.585970163e-01f, 1.056569070e-01f, -2.804131210e-01f,
+    -1.484017074e-01f, -6.977856904e-02f, -1.178829074e-01f, 1.150264442e-01f,
+    1.163411885e-02f, -2.298633195e-02f, -4.188164696e-02f, -1.729706675e-01f,
+    1.350752115e-01f, 4.370646179e-02f, -1.763933152e-01f, -2.249054462e-01f,
+    -1.874336600e-01f, 1.612423062e-01f, 1.420368403e-01f, 2.005282789e-01f,
+    -9.189879149e-02f, -1.301156431e-01f, -4.118632153e-02f, -1.470390558e-01f,
+    -2.118506096e-02f, 8.366844058e-02f, 5.535888299e-02f, -6.475568563e-02f,
+    -1.145923957e-01f, 4.211304337e-02f, 4.070651904e-02f, 1.281250417e-01f,
+    -3.024070151e-02f, 2.907406092e-01f, 1.140605751e-02f, 3.076269031e-01f,
+    -8.902211487e-02f, 1.386623979e-01f, 1.404010803e-01f, 1.769062690e-02f,
+    8.579225838e-02f, 1.541137248e-01f, 5.443882197e-02f, -1.703066528e-01f,
+    -2.175731659e-01f, 1.138370484e-01f, -4.014501348e-02f, 7.525779307e-02f,
+    -1.969285868e-02f, -4.321870580e-02f, 1.458356082e-01f, -6.274542958e-02f,
+    -1.525734831e-02f, 2.159388736e-02f, -2.663099170e-01f, 8.979512751e-02f,
+    -6.268308498e-03f, 1.334384270e-02f, 2.387703955e-02f, -3.808512539e-02f,
+    -7.319474220e-02f, 6.368070841e-02f, 7.003775984e-02f, -1.124304160e-01f,
+    -2.670386732e-01f, 1.862541884e-01f, 1.608748734e-01f, 2.108196318e-01f,
+    -7.153077424e-02f, 9.344250895e-03f, 1.267223060e-02f, -3.156663477e-02f,
+    -1.067722216e-01f, -6.388569623e-02f, 1.050370163e-03f, -1.716458648e-01f,
+    -1.165320873e-01f, 8.039822429e-02f, 6.834478583e-03f, 8.035358787e-02f,
+    -9.475285560e-02f, 2.082888633e-01f, -2.424277179e-02f, 1.185675338e-01f,
+    2.120096469e-03f, 1.383595765e-01f, 1.256083101e-01f, 9.563061595e-02f,
+    -3.083023615e-02f, -9.081577510e-02f, 1.274108440e-01f, -2.305227965e-01f,
+    -1.961328089e-01f, 3.982889280e-02f, 1.261582375e-01f, 2.527428865e-01f,
+    1.243779436e-01f, -1.305675805e-01f, 1.747228950e-01f, -1.837810874e-02f,
+    -2.165234536e-01f, 7.655110955e-02f, -2.208432257e-01f, 1.636866182e-01f,
+    -2.793502808e-02f, -3.538904339e-02f, 1.571650505e-01f, -6.433457881e-02f,
+    5.827048421e-02f, 7.445150614e-02f, 1.312305480e-01f, -2.644786611e-02f,
+    -1.986271441e-01f, 1.957364827e-01f, 9.225501865e-02f, 1.934408545e-01f,
+    -9.568724036e-02f, 1.041181311e-01f, -1.033282354e-01f, 6.751633435e-02f,
+    -2.197842486e-02f, -3.762269393e-02f, 3.651146218e-02f, -2.037033625e-02f,
+    -1.691648811e-01f, 1.033583060e-01f, 1.014702544e-01f, 1.642245352e-01f,
+    -3.226629645e-02f, 1.716253459e-01f, 1.373541355e-01f, 7.133132219e-02f,
+    9.450672567e-02f, 1.144185513e-01f, 1.144949272e-01f, 1.219536364e-01f,
+    6.428056955e-02f, 2.677388303e-02f, 1.569019258e-01f, -2.578581572e-01f,
+    1.225138083e-02f, 8.296293020e-02f, 7.011020929e-02f, 1.202879101e-01f,
+    8.054508269e-02f, -1.831696630e-01f, -4.257699102e-02f, -9.785162657e-02f,
+    -2.134864479e-01f, -9.233404696e-02f, -2.151150405e-01f, 2.283821851e-01f,
+    2.543731220e-02f, -8.909244835e-02f, 6.287040561e-02f, -2.073305398e-01f,
+    -5.220831558e-02f, 2.297082543e-02f, 1.003360674e-01f, -1.509300023e-01f,
+    -6.774464995e-02f, 2.651959956e-01f, 5.759387463e-02f, 1.399873793e-01f,
+    -2.167712897e-01f, 2.732772008e-02f, -5.124622956e-02f, -3.566683037e-03f,
+    -7.298913598e-02f, 4.757076874e-02f, 2.501212247e-02f, -2.307229489e-01f,
+    -2.558389306e-01f, 4.620695487e-02f, 3.848703206e-02f, -8.430813253e-02f,
+    -1.056584567e-01f, 2.193649262e-01f, 1.814611703e-01f, 2.641309202e-01f,
+    -1.545416564e-01f, 8.580195159e-02f, -3.769595921e-02f, -4.951119050e-02f,
+    4.112129658e-02f, 1.256960183e-01f, 7.873341441e-02f, -1.485639364e-01f,
+    -2.415644675e-01f, 2.465072721e-01f, 6.371821463e-02f, 2.557078004e-01f,
+    -5.107830837e-02f, 3.409682587e-02f, 1.903883219e-01f, -6.463867426e-02f,
+    -2.269947082e-01f, 1.425191015e-01f, -8.884852380e-02f, 2.921651490e-02f,
+    9.788639098e-02f, 1.802880131e-02f, 1.905157603e-02f, -5.310630426e-02f,
+    -1.930207610e-01f, 1.050619334e-01f, 5.711364374e-02f, 1.017514244e-01f,
+    -6.225423142e-02f, 1.091190204e-01f, 3.389621899e-02f, 1.521971971e-01f,
+    -1.708314866e-01f, 1.632049563e-03f, 9.138613939e-02f, 1.174697503e-01f,
+    4.914884921e-03f, 1.194563955e-01f, 1.097218096e-01f, -3.639850393e-02f,
+    -1.257600933e-01f, 6.182103232e-02f, 6.497386843e-02f, 1.287441850e-01f,
+    -5.346881971e-02f, 1.745673269e-01f, 6.748475134e-02f, 6.502725929e-02f,
+    -1.176555976e-01f, 1.500404775e-01f, -2.304562833e-03f, -4.324085638e-02f,
+    9.695886821e-02f, 1.127946228e-01f, 4.693539441e-02f, -3.245806992e-01f,
+    -1.411634535e-01f, 9.843422472e-02f, 1.909833960e-02f, 1.481351405e-01f,
+    4.144651815e-02f, -6.803829968e-02f, 6.741021574e-02f, -1.134270430e-01f,
+    -3.247881308e-02f, 1.047479585e-01f, -1.474514306e-01f, 8.831820637e-02f,
+    2.106983811e-01f, 1.703908145e-01f, 8.459959924e-02f, 1.699303463e-02f,
+    -1.618032455e-01f, 1.465894282e-01f, 1.647044420e-01f, 3.084716499e-01f,
+    1.118441597e-01f, 4.434897006e-02f, -6.049002986e-03f, 1.069021896e-01f,
+    8.585148305e-02f, 8.885769546e-02f, 2.000298351e-01f, 2.042549998e-01f,
+    1.297134310e-01f, 1.584284157e-01f, 1.644109190e-01f, 4.403418675e-02f,
+    2.348371968e-02f, 1.570219547e-01f, 1.500023901e-01f, 3.383321464e-01f,
+    1.123547480e-01f, -1.815267056e-01f, 5.674942862e-03f, -2.262690514e-01f,
+    -1.284620166e-01f, 5.825083703e-02f, 1.309627295e-01f, 2.212146670e-01f,
+    1.146407202e-01f, 1.868389100e-01f, 1.335819513e-01f, -2.235762179e-01f,
+    1.226663440e-01f, 2.901670709e-02f, 1.474760324e-01f, -1.356347930e-02f,
+    1.114592701e-01f, -1.178814843e-01f, -7.638976723e-02f, -3.213569894e-02f,
+    -1.678835601e-01f, 9.844769537e-02f, -3.573099524e-02f, 4.263166338e-02f,
+    -3.041682243e-01f, -3.023191392e-01f, -3.015682995e-01f, 3.162040114e-01f,
+    2.292371243e-01f, -3.971753716e-01f, -2.126124054e-01f, -1.777539402e-01f,
+    -6.635630876e-02f, -1.204357147e-01f, -2.612237036e-01f, -2.203884721e-01f,
+    2.855427265e-01f, -3.775310814e-01f, 2.389860451e-01f, -3.026430905e-01f,
+    -1.692423373e-01f, -1.415844858e-01f, -1.336675286e-01f, 1.821665168e-01f,
+    1.730444282e-01f, -3.128984571e-01f, -1.270288825e-01f, -2.176358104e-01f,
+    -9.058498591e-02f, -4.431626573e-02f, -1.210599467e-01f, -1.121431664e-01f,
+    1.706854850e-01f, -1.860938221e-01f, 2.028457448e-02f, -1.359833926e-01f,
+    9.314507246e-03f, -2.325534448e-02f, -2.056319453e-02f, -2.680070326e-02f,
+    7.453729212e-02f, -9.545241296e-02f, -8.100911975e-02f, -6.239039078e-02f,
+    1.127135754e-01f, 3.183582099e-03f, -1.347622182e-02f, -1.358439773e-01f,
+    -4.820464179e-02f, -1.733074039e-01f, 1.711280495e-01f, -9.827946126e-02f,
+    -2.274234891e-01f, -5.023679733e-01f, -3.555071950e-01f, 1.611844450e-01f,
+    5.723650008e-02f, -4.579785764e-01f, -2.676661015e-01f, -2.726523578e-01f,
+    3.095607087e-02f, 1.869174093e-01f, -5.472511426e-02f, 5.568335950e-02f,
+    2.189851403e-01f, -3.159521520e-01f, 7.098609209e-02f, -2.049887180e-01f,
+    -1.289697587e-01f, -1.241504848e-01f, -1.576068550e-01f, 4.252205417e-02f,
+    -1.106333360e-01f, -1.598437577e-01f, -2.042366713e-01f, -1.926606447e-01f,
+    -1.010987982e-01f, 3.435528651e-02f, -3.829127550e-02f, -1.120948717e-01f,
+    1.102092490e-01f, -1.339811683e-01f, -7.937043160e-02f, -2.266173959e-01f,
+    3.530770540e-02f, -2.982172370e-02f, -5.212222412e-02f, 6.111705303e-02f,
+    -5.813118443e-02f, 7.259912789e-02f, -3.556412458e-02f, -1.450396925e-01f,
+    -9.878833592e-02f, 1.224264968e-02f, -8.694310486e-02f, 1.491435058e-02f,
+    -8.061245084e-02f, -7.442499697e-02f, 7.358214259e-02f, -1.446184367e-01f,
+    -3.339713812e-01f, -2.480201721e-01f, -2.715095282e-01f, -3.173269331e-02f,
+    -7.673525810e-02f, -2.145132869e-01f, -3.137526512e-01f, -4.134006798e-01f,
+    -8.688260615e-02f, 3.656491339e-01f, 1.286333799e-01f, 2.719285488e-01f,
+    -5.060702190e-02f, -3.302281201e-01f, -1.567089409e-01f, -2.247275859e-01f,
+    -1.730832309e-01f, -1.213178337e-01f, -1.803355813e-01f, -3.329681233e-02f,
+    -1.344353110e-01f, -5.901370943e-02f, -9.376796335e-02f, -4.993264377e-02f,
+    -2.065385282e-01f, 2.064312696e-01f, 5.920000747e-02f, 1.610874087e-01f,
+    -5.194284394e-02f, -9.904449806e-03f, -2.404673398e-01f, -2.318597883e-01f,
+    6.874030922e-03f, 1.198175177e-01f, -7.125721872e-02f, -5.031548440e-02f,
+    -3.242153823e-01f, 1.028726995e-01f, -1.706036553e-02f, 7.610092312e-02f,
+    -2.260217816e-01f, -2.029284276e-02f, -1.681218743e-01f, -1.634985358e-01f,
+    -9.379632771e-03f, 9.777182713e-04f, 7.705373317e-02f, -1.464123428e-01f,
+    2.835784554e-01f, 2.712128460e-01f, 1.654780656e-01f, -1.628247835e-02f,
+    -1.426942348e-01f, 1.989559382e-01f, 2.738832831e-01f, 1.242874414e-01f,
+    1.573531181e-01f, 1.080662757e-01f, 1.454500109e-01f, 1.838008463e-01f,
+    -1.652979404e-01f, 2.307373583e-01f, 5.382718518e-03f, 1.518706232e-01f,
+    6.403963268e-02f, 2.531540990e-01f, 2.674259432e-02f, 5.301282927e-02f,
+    -1.809732616e-01f, 1.433172971e-01f, 8.928765357e-02f, 1.511185914e-01f,
+    1.109831501e-02f, 4.050951824e-02f, 1.813676953e-01f, 3.395741805e-02f,
+    -5.645317025e-03f, 1.579504013e-01f, 1.238516048e-01f, 1.132251173e-01f,
+    5.755781755e-02f, 1.357790530e-01f, 1.232841164e-01f, -1.714525968e-01f,
+    -9.559271485e-02f, 1.778033376e-02f, 6.639868021e-02f, -4.006354138e-02f,
+    6.132779270e-02f, -1.057145931e-02f, -3.475446627e-02f, -2.725062659e-04f,
+    5.088806152e-02f, 7.108449936e-02f, -4.574992880e-02f, 8.448053151e-02f,
+    8.004306257e-02f, 2.436498255e-01f, 1.053807437e-01f, 8.494637161e-02f,
+    -1.819323450e-01f, 1.646862924e-01f, 2.903662324e-01f, 2.905662358e-01f,
+    1.228355914e-01f, -1.965975910e-01f, 5.395156890e-02f, -1.869415492e-01f,
+    -1.030683070e-01f, 8.538357168e-02f, 4.286537319e-02f, 2.793961465e-01f,
+    8.637982607e-02f, 2.422999740e-01f, 1.063440591e-01f, 1.355874389e-01f,
+    -1.257159710e-01f, 1.332920790e-01f, 1.312129647e-01f, 1.311840415e-01f,
+    -6.172478944e-02f, -6.685125083e-02f, -1.910747774e-02f, -9.858677536e-02f,
+    -6.266071647e-02f, 2.025255263e-01f, 9.172485024e-02f, 1.529870480e-01f,
+    8.247657865e-02f, 5.650905077e-04f, 1.170848124e-02f, -1.978397369e-01f,
+    5.607568100e-02f, 1.449744254e-01f, 1.265287548e-01f, -6.342986226e-02f,
+    4.424844682e-02f, 2.549265139e-02f, 1.457715407e-02f, -4.564546794e-02f,
+    1.636411995e-02f, 4.055096954e-02f, -4.145045951e-02f, 1.091829315e-01f,
+    2.031905353e-01f, 2.992838025e-01f, 2.043504864e-01f, 2.102049291e-01f,
+    -1.670804173e-01f, 1.481459588e-01f, 1.969464123e-01f, 1.510442346e-01f,
+    1.602408141e-01f, -2.872515023e-01f, -7.551362365e-02f, -3.556077182e-01f,
+    -4.999633413e-03f, 2.650094032e-01f, 1.758293062e-01f, 1.360474229e-01f,
+    5.538111180e-02f, 1.804831624e-01f, 9.621959180e-02f, 1.750547290e-01f,
+    -3.161464632e-02f, 1.195161715e-01f, 2.007577419e-01f, 6.185416877e-02f,
+    6.863789633e-03f, -1.492219567e-01f, -1.303180456e-01f, -1.194417384e-02f,
+    -6.384076551e-03f, 5.887076631e-02f, 1.444958895e-01f, 1.273237616e-01f,
+    1.013599709e-01f, -5.198376602e-04f, 6.148847193e-02f, -1.543033421e-01f,
+    1.147025526e-01f, -2.589475550e-02f, 9.263688326e-02f, 1.521191653e-02f,
+    5.248843133e-02f, 3.772209212e-02f, 7.280006260e-02f, -4.389011860e-02f,
+    -4.383203760e-02f, -4.158237204e-02f, 9.184002876e-02f, 1.973776892e-02f,
+    1.087476537e-01f, 1.074564364e-02f, 9.800357372e-02f, 7.303939015e-02f,
+    -2.313046344e-02f, 9.981966764e-02f, 1.429837048e-01f, -2.282907814e-02f,
+    -3.570246324e-02f, -1.467459351e-01f, -3.946299106e-02f, -2.077499926e-01f,
+    -2.804405242e-02f, 1.493725926e-01f, 8.926248550e-02f, 2.199570090e-02f,
+    1.458275914e-01f, 1.542626619e-01f, 6.889670342e-02f, -8.309637010e-02f,
+    1.423980594e-01f, 4.604544118e-02f, 5.196373537e-02f, 8.099088073e-02f,
+    -1.436776221e-01f, -1.717117876e-01f, 8.833318949e-03f, -1.267822832e-01f,
+    1.182890870e-02f, -3.792341799e-02f, -7.619005442e-02f, 1.281845123e-01f,
+    -1.820763573e-02f, 1.206568163e-02f, 5.354139954e-03f, -8.719407022e-02f,
+    -5.677453708e-03f, 3.560566530e-02f, 6.973826885e-02f, -6.907464564e-02f,
+    2.405395731e-02f, -8.630511165e-02f, -1.984972507e-01f, -2.259748429e-01f,
+    -2.687667497e-02f, 5.374167114e-02f, -1.987111121e-01f, 3.822232038e-02f,
+    -5.558535829e-02f, 3.466908820e-03f, -4.794193432e-02f, 2.042921931e-01f,
+    1.441674829e-01f, 1.297582034e-02f, -5.788836628e-03f, 8.194611222e-02f,
+    -9.758329391e-02f, -1.480916291e-01f, -1.067218855e-01f, -5.084978789e-02f,
+    3.024483845e-02f, 1.126486138e-01f, 1.537730396e-01f, -6.171277910e-02f,
+    9.839845449e-02f, 4.415187612e-02f, 2.615828300e-03f, 1.466949880e-01f,
+    7.872854173e-02f, -1.496997327e-01f, -6.056236476e-02f, -3.693063930e-02f,
+    -9.547822922e-02f, -1.903840154e-01f, -1.943217032e-02f, -1.586042494e-01f,
+    3.988388553e-02f, -2.336913496e-01f, 1.128862798e-02f, 3.652182594e-02f,
+    4.802348092e-02f, 9.090938419e-02f, 6.199532002e-02f, -4.554130882e-02f,
+    1.431748122e-01f, 1.083533466e-02f, 7.920373231e-03f, -3.419065848e-02f,
+    5.652461201e-02f, -1.653768867e-01f, -1.331805140e-01f, -2.889763415e-01f,
+    -1.789453924e-01f, -1.407433394e-02f, -1.891007721e-01f, 7.800390571e-02f,
+    -1.603528857e-02f, -1.270904541e-01f, -1.685148478e-01f, 1.802410930e-01f,
+    2.385811657e-01f, -1.144120097e-01f, -1.920130104e-01f, -1.078598783e-03f,
+    -1.204203144e-01f, -1.471961290e-01f, -5.162976682e-03f, -1.011817232e-01f,
+    1.012563556e-01f, -1.711004227e-02f, 2.253395170e-01f, -1.331411749e-01f,
+    4.013713822e-02f, -8.379323781e-02f, -1.149696261e-01f, 1.266587079e-01f,
+    1.408333033e-01f, -7.889959961e-02f, -4.281826690e-02f, -6.502246112e-02f,
+    -1.460616887e-01f, -2.269249558e-01f, -1.383272260e-01f, -2.950513065e-01f,
+    -7.633010391e-03f, -2.479867041e-01f, -1.783934981e-02f, -4.019815847e-02f,
+    -3.627517074e-02f, 1.200735420e-01f, 1.848594472e-02f, 2.351779118e-02f,
+    1.345308125e-01f, -6.921014190e-02f, 2.714391984e-02f, -7.985459268e-02f,
+    5.986394733e-02f, -1.361465305e-01f, -5.920847133e-02f, -2.717951238e-01f,
+    -2.620676532e-02f, -2.370630205e-01f, -1.999938637e-01f, 5.213480908e-03f,
+    3.551793471e-02f, -1.219046395e-02f, 6.441027671e-02f, 7.487332821e-02f,
+    -4.511537403e-02f, 1.873408109e-01f, 7.428656518e-02f, 2.108126283e-01f,
+    -3.199740052e-01f, -2.592411041e-01f, -1.641661525e-01f, -2.904374897e-01f,
+    2.482448667e-01f, 1.528841406e-01f, -8.691808581e-02f, 1.036831662e-01f,
+    -4.183355719e-02f, -1.537696123e-01f, 7.286880910e-02f, 5.265096202e-02f,
+    1.377916932e-01f, 1.303219944e-01f, 1.062793955e-01f, 2.288084477e-02f,
+    3.939749673e-03f, -5.967615172e-02f, -7.761889696e-02f, 2.161584096e-03f,
+    8.889462799e-02f, 1.751995236e-01f, 1.798970252e-01f, 6.353065372e-02f,
+    -3.021588363e-02f, -1.162251681e-01f, -1.291387528e-02f, -1.616251022e-01f,
+    6.222712994e-02f, -1.878697611e-02f, 4.375031218e-02f, -2.324963920e-02f,
+    1.154552475e-01f, 1.088906527e-01f, -2.945484780e-02f, 1.291240305e-01f,
+    -8.558388054e-02f, -1.399197523e-02f, 1.451034397e-01f, 6.495138258e-02f,
+    1.695379466e-01f, -9.152000397e-02f, 1.251130700e-01f, 1.339480728e-01f,
+    -5.925903842e-02f, 1.552323997e-01f, 1.423360556e-01f, 3.689678013e-02f,
+    -3.615589440e-01f, 1.474796608e-02f, -1.649152189e-01f, -9.117756784e-02f,
+    1.154933870e-01f, -1.016521920e-02f, -1.867547035e-01f, 1.363375224e-02f,
+    2.968852222e-02f, -1.661572754e-01f, 8.595262468e-02f, 2.196966857e-01f,
+    1.701204777e-01f, 1.928731799e-01f, 1.284060329e-01f, 6.140001118e-03f,
+    -1.770167798e-01f, 4.474858940e-02f, -5.843272805e-02f, -1.030173153e-02f,
+    1.716737002e-01f, 1.181490496e-01f, 7.985178381e-02f, 6.781564653e-02f,
+    -7.244399935e-02f, 2.560795750e-03f, 3.089086711e-02f, 1.390188336e-01f,
+    1.020121127e-01f, 3.828553110e-02f, -6.823484600e-02f, -6.509932876e-02f,
+    4.077583551e-02f, -6.400464475e-02f, 9.058143944e-02f, 4.960707203e-02f,
+    9.316220134e-02f, 7.778673433e-03f, 2.308002561e-01f, 7.528533787e-02f,
+    4.880991951e-02f, 3.801750485e-03f, 9.569790214e-02f, -1.326131970e-01f,
+    -2.203939855e-02f, 1.104799360e-01f, 2.654181607e-02f, 1.314827520e-02f,
+    -1.695186943e-01f, 1.511267573e-01f, -3.442447633e-02f, 9.154972434e-02f,
+    -2.062931955e-01f, -5.869460106e-02f, -1.646769494e-01f, 1.592429914e-02f,
+    7.731004152e-03f, -1.199584007e-01f, 1.032449901e-01f, 1.387377083e-02f,
+    1.116107628e-01f, 2.218329459e-01f, -1.157312840e-02f, -1.632406749e-02f,
+    -1.784162968e-01f, 3.556860611e-02f, 1.837955602e-02f, 9.023112059e-02f,
+    1.101546213e-01f, 2.222393453e-01f, -1.031694338e-01f, 6.999936700e-02f,
+    3.392564133e-02f, -8.874850720e-02f, 5.628950521e-02f, 2.393940389e-01f,
+    2.749345452e-02f, -2.787809260e-02f, -4.324176908e-02f, -5.089409277e-02f,
+    1.079036742e-01f, -6.080786139e-02f, 1.670908183e-02f, -1.787625067e-02f,
+    1.686979532e-01f, 5.342974141e-02f, 2.056512386e-01f, -6.524666399e-02f,
+    -2.427867204e-01f, -1.889339983e-01f, -3.376973569e-01f, 7.995571196e-02f,
+    -6.470867991e-02f, -9.250797331e-02f, -2.016101778e-01f, -3.440710902e-01f,
+    2.774385214e-01f, 1.037821472e-01f, -9.148717672e-02f, -2.244901471e-02f,
+    -3.314979747e-02f, -3.027784824e-01f, -5.878642201e-02f, -3.252726495e-01f,
+    -6.360544264e-02f, 1.594520872e-03f, -1.195103303e-01f, 5.931573361e-02f,
+    7.711663842e-02f, -6.382152438e-02f, -1.005277038e-01f, -5.600711331e-02f,
+    -8.497263491e-02f, 3.811208531e-02f, -1.046557948e-01f, 5.952363461e-02f,
+    1.487284750e-01f, -1.645024568e-01f, 1.839602590e-01f, -2.370797992e-01f,
+    -3.488199413e-02f, -1.076762974e-01f, -9.489740431e-02f, 4.921263829e-02f,
+    1.055165008e-01f, -1.409544945e-01f, 4.035133868e-02f, -1.412084103e-01f,
+    -1.488630380e-02f, -6.436023116e-02f, -1.511386335e-01f, 3.135292232e-02f,
+    1.832562312e-02f, -7.059752941e-02f, 1.968978196e-01f, -7.619144395e-03f,
+    -2.272531688e-01f, -1.848871261e-01f, -1.627858579e-01f, 1.019049287e-01f,
+    2.595010586e-02f, -2.070164680e-01f, -8.908028901e-02f, -1.533808559e-01f,
+    3.141757250e-01f, 2.885816060e-02f, -3.255971149e-02f, 6.993391365e-02f,
+    1.985350102e-01f, -1.944803447e-01f, 3.539460525e-02f, -2.548867166e-01f,
+    -1.366252601e-01f, -8.750060201e-02f, -1.493308246e-01f, -2.147210762e-02f,
+    7.285729051e-02f, -1.987657398e-01f, 1.126399543e-02f, -1.901613325e-01f,
+    -7.878450677e-03f, -2.131447569e-02f, -9.232874960e-02f, 1.133179218e-01f,
+    -5.378944427e-02f, -1.581980288e-01f, 9.475412220e-02f, -2.034467757e-01f,
+    -8.266342431e-02f, -5.759617686e-02f, 2.747233212e-02f, 9.221240133e-02f,
+    6.164150685e-02f, -2.530585229e-02f, -1.100259367e-02f, -4.761806875e-02f,
+    -3.605388850e-02f, 4.480806738e-02f, -1.205336582e-02f, 1.415740047e-02f,
+    5.817339942e-02f, -1.588936746e-01f, 5.634180829e-02f, -9.224709868e-02f,
+    -3.032181785e-02f, 5.085041374e-02f, -1.875440180e-01f, 6.983474642e-02f,
+    1.242890581e-02f, -3.280737400e-01f, -1.214579940e-01f, -2.409600765e-01f,
+    1.989046633e-01f, 2.757613920e-02f, 4.230448976e-02f, 2.162453830e-01f,
+    1.485451460e-01f, -1.356981993e-01f, -6.997431815e-02f, 6.373771001e-03f,
+    -1.414872110e-01f, -4.088537395e-02f, -1.252359301e-01f, -7.095404714e-02f,
+    -8.812543005e-02f, -1.209561825e-01f, -1.180096418e-01f, -1.647989452e-01f,
+    3.186227009e-02f, 6.208955124e-02f, -6.356707215e-02f, 1.711134762e-01f,
+    -9.085207433e-02f, -8.549088985e-02f, 3.099309094e-02f, -2.241915911e-01f,
+    -6.517835706e-02f, -2.661429159e-02f, -9.358345717e-02f, -5.829321221e-02f,
+    2.003368735e-02f, -3.270153701e-02f, -7.776890695e-02f, 4.451675806e-03f,
+    -1.831280142e-01f, -7.812388986e-02f, -1.607583761e-01f, -1.270303037e-02f,
+    -2.700234205e-02f, -7.169371471e-03f, 1.840097643e-02f, -5.617479235e-02f,
+    1.027694941e-01f, 1.016681567e-01f, -9.380632080e-03f, -1.704554558e-01f,
+    -2.318141460e-01f, 9.748572111e-02f, -1.569751054e-01f, -1.486178637e-01f,
+    9.920746833e-02f, -2.605084702e-02f, 5.104801059e-02f, 1.234276872e-02f,
+    -1.735670269e-01f, -1.354597956e-01f, 1.132823154e-01f, 4.616416991e-04f,
+    7.942613214e-02f, -1.090821996e-01f, -1.079750713e-02f, -5.560491234e-02f,
+    -2.869954892e-02f, 1.060680449e-01f, -1.382862628e-01f, -2.512886934e-02f,
+    -2.060074918e-02f, 1.329805120e-03f, -1.157896891e-01f, -1.193462238e-01f,
+    8.155621588e-02f, 1.416030526e-01f, -8.656580001e-02f, -8.314743638e-02f,
+    4.221927747e-02f, 3.393055126e-02f, -8.442872763e-02f, 5.713883638e-01f,
+    1.243279725e-01f, 5.368813127e-02f, 1.014589239e-02f, 1.295832396e-01f,
+    1.471301615e-01f, 1.693660319e-01f, 5.108302832e-02f, 2.591920793e-01f,
+    3.063904643e-01f, 8.911118656e-02f, 1.825367212e-01f, -3.468403593e-02f,
+    1.706199721e-02f, -1.462992001e-02f, -8.058178425e-02f, -5.169829726e-02f,
+    -1.040331647e-01f, 4.376582801e-02f, -3.044184484e-02f, -1.429866701e-01f,
+    6.753305346e-02f, -2.763933875e-02f, 5.116148666e-02f, -1.724840850e-01f,
+    -2.497151121e-02f, -3.178989887e-02f, -4.235911369e-02f, -1.739283502e-01f,
+    -1.233448684e-01f, -1.766425371e-01f, -5.431669578e-02f, -1.925068796e-01f,
+    8.960285038e-02f, 1.727267355e-01f, 3.964686766e-02f, 3.186471015e-02f,
+    -9.917771816e-02f, -6.381954998e-02f, -6.100674346e-02f, -1.482560299e-02f,
+    6.467927992e-02f, 1.669817790e-02f, -1.245783418e-01f, -1.581456959e-01f,
+    -1.290330589e-01f, -1.780801415e-01f, 3.301651776e-02f, 6.030870676e-01f,
+    1.629652381e-01f, 1.322319657e-01f, -6.921742857e-02f, 1.348491758e-01f,
+    -6.726092100e-02f, 1.667116433e-01f, 4.894042388e-02f, 2.458817959e-01f,
+    4.970691502e-01f, 5.867765844e-02f, 1.455936730e-01f, -2.386236191e-02f,
+    -7.317081839e-02f, -5.416337401e-02f, -1.786189079e-01f, -4.274177179e-02f,
+    -3.523353115e-02f, -8.753591031e-02f, -1.697662473e-01f, -4.655401409e-02f,
+    1.606630683e-01f, -3.782026470e-02f, 6.769330800e-02f, -1.542814355e-02f,
+    -2.403426319e-01f, -2.080769390e-01f, 5.942387879e-02f, -9.933725744e-02f,
+    -3.464444727e-02f, -8.134108782e-02f, -9.827753529e-04f, -6.946559995e-02f,
+    -2.378403954e-02f, 2.389509082e-01f, -3.390170261e-02f, -2.278002724e-02f,
+    -8.216992766e-02f, -3.381154500e-03f, -5.834621936e-02f, -1.406324300e-04f,
+    3.871829435e-02f, 9.854563326e-02f, -2.821201645e-02f, 4.031972960e-02f,
+    -6.910555065e-02f, -1.178161614e-02f, -8.535394073e-02f, 5.459293127e-01f,
+    2.527541816e-01f, 9.385678917e-03f, -1.701480448e-01f, -6.760690361e-02f,
+    4.224802926e-02f, 4.770274088e-02f, 5.210489780e-02f, 6.687924266e-02f,
+    4.903640449e-01f, 5.157816783e-02f, 2.384404838e-01f, -1.094155237e-01f,
+    2.431997471e-02f, -4.201758653e-02f, 9.105938673e-02f, 1.066217944e-01f,
+    2.308822870e-01f, 5.690512061e-02f, 5.553204194e-02f, -9.048969299e-02f,
+    2.213676572e-01f, 7.052753121e-02f, -3.733531386e-02f, -5.021331459e-02f,
+    2.039878517e-01f, 5.941895023e-02f, 4.789242893e-02f, -2.664092928e-03f,
+    3.963811323e-02f, -9.293758124e-02f, 1.069594994e-01f, -8.601370454e-02f,
+    -3.589608893e-02f, -7.004995644e-02f, 4.131564870e-02f, -1.246399060e-01f,
+    5.800474435e-03f, -9.873003513e-02f, -2.041332722e-01f, -9.247801453e-02f,
+    2.073688060e-02f, 4.149783403e-02f, -2.579977512e-01f, 7.624322176e-02f,
+    4.605212435e-02f, 1.366198659e-01f, 1.659569740e-01f, -1.717917919e-01f,
+    -1.732890606e-01f, 1.068894044e-01f, 4.397544265e-02f, 1.176923215e-01f,
+    -9.282262623e-02f, -5.482737720e-02f, -6.976668537e-02f, -1.627338976e-01f,
+    -1.783253402e-01f, 8.384113759e-02f, -8.069212735e-02f, 1.208309978e-01f,
+    4.526531696e-02f, -1.054643914e-01f, 5.577927455e-03f, 2.996011451e-02f,
+    3.008039296e-01f, -4.067593068e-02f, 3.220940009e-02f, -1.120481715e-01f,
+    1.619758010e-01f, 2.279223845e-04f, -1.802923232e-01f, 1.712470502e-01f,
+    1.757948101e-01f, 3.331181034e-02f, 2.552674338e-02f, 3.737458959e-02f,
+    -1.014696732e-01f, -1.120395586e-01f, 7.348330319e-02f, -1.741959602e-01f,
+    -4.581173137e-02f, -6.613297015e-02f, 5.512844026e-02f, -3.179530427e-02f,
+    -1.243710443e-01f, -1.692899168e-01f, -9.261262417e-02f, -6.397053599e-02f,
+    1.117527485e-02f, -7.849339396e-03f, -1.856901795e-01f, -4.097164795e-02f,
+    5.052747205e-02f, 1.499388069e-01f, -5.191670358e-02f, -2.593027055e-01f,
+    -2.082382888e-01f, 9.836352617e-02f, 1.105856821e-01f, 6.132115051e-02f,
+    -4.864901304e-02f, -1.243462116e-01f, -8.057750762e-02f, -1.654961519e-02f,
+    -1.862620115e-01f, 1.110443100e-01f, -6.184178218e-02f, 1.549845487e-01f,
+    -2.992147347e-03f, -1.274386197e-01f, 1.249515936e-01f, 4.086184502e-02f,
+    2.686816454e-01f, -4.073985666e-02f, -1.939584687e-02f, -1.522601489e-02f,
+    2.236850858e-01f, 1.242768914e-01f, -1.906396821e-02f, -1.519943625e-01f,
+    5.745626613e-02f, -8.526384085e-02f, -9.998148307e-03f, 1.305897087e-01f,
+    -3.933912888e-02f, 6.370962597e-03f, 1.102591157e-01f, -1.198666841e-01f,
+    -8.465939015e-02f, -8.799306303e-02f, 1.723430008e-01f, -1.765834726e-02f,
+    -1.425950974e-01f, -1.675059795e-01f, -1.113085896e-01f, -7.959695160e-02f,
+    -1.209456697e-01f, -1.078431010e-01f, -1.788007021e-01f, 4.913921654e-02f,
+    6.547766179e-02f, 1.332149059e-01f, 1.455376446e-01f, -1.575824916e-01f,
+    -1.874421388e-01f, -9.106858075e-02f, 6.541100144e-02f, -5.894928798e-02f,
+    7.909668237e-02f, 2.937107906e-02f, -1.623758301e-02f, -1.660646498e-02f,
+    -2.757501900e-01f, 9.343021363e-02f, -1.357852370e-01f, -1.673919847e-03f,
+    7.057757676e-02f, 1.222281456e-01f, 5.270897597e-02f, -3.357478082e-01f,
+    -1.768769473e-01f, 1.666785181e-01f, 6.407312304e-02f, -5.586849153e-02f,
+    1.544225365e-01f, 2.049535662e-01f, 1.507445872e-01f, 2.755214870e-01f,
+    -3.460412621e-01f, -3.213823307e-03f, -4.191038013e-02f, 2.438707650e-01f,
+    1.160204113e-01f, 2.834704816e-01f, 1.178943887e-01f, -1.330252439e-01f,
+    -3.175314963e-01f, 3.151606619e-01f, 1.080118120e-01f, 2.089116722e-01f,
+    -1.297119074e-02f, 7.145879418e-02f, 1.066797301e-01f, 2.612696290e-01f,
+    -1.722214669e-01f, 2.464201003e-01f, -8.819750696e-02f, 6.521323323e-02f,
+    9.628413618e-02f, 2.426467091e-01f, 4.151317105e-02f, -1.510980725e-01f,
+    -9.054394066e-02f, 2.087375522e-01f, -9.973658249e-03f, 1.823783517e-01f,
+    -9.492626041e-02f, -1.031013876e-01f, 4.472778365e-02f, -1.797256917e-01f,
+    -5.900938809e-02f, 3.457112983e-02f, -1.506891251e-01f, 1.180174109e-02f,
+    1.834110939e-03f, 2.095996141e-01f, 1.353753060e-01f, -4.473821819e-02f,
+    -1.363541931e-01f, 1.366399527e-01f, 2.232064605e-01f, 9.895681590e-02f,
+    1.421801001e-01f, -3.337262943e-02f, 5.562535301e-02f, -9.345234185e-02f,
+    -1.945012808e-01f, 1.196435373e-02f, 2.117900401e-01f, 1.876119077e-01f,
+    4.099802300e-02f, 2.808541059e-01f, 4.444260895e-02f, 1.025662199e-01f,
+    -1.445213407e-01f, 1.205778420e-01f, 3.620869666e-02f, 1.446609497e-01f,
+    -5.484514683e-02f, -1.667696536e-01f, -3.198997676e-02f, -8.480454981e-02f,
+    -1.015421748e-01f, 8.244323730e-02f, 8.113245666e-02f, 1.187596843e-01f,
+    1.804714948e-01f, 1.668289155e-01f, 1.397100836e-01f, -2.761996388e-01f,
+    3.358423337e-02f, 2.194602974e-03f, 4.112591967e-02f, 6.747220457e-02f,
+    -1.500586397e-03f, -7.781495154e-02f, -4.244095087e-02f, -4.505997524e-02f,
+    1.776340068e-03f, -6.344113499e-02f, -9.529737383e-02f, 1.573365033e-01f,
+    1.969965696e-01f, 1.406514645e-01f, 4.453128204e-02f, 2.464746237e-01f,
+    -8.264303952e-02f, 6.143834814e-02f, 9.062039107e-02f, 2.476598471e-01f,
+    3.742145747e-02f, -2.997924685e-01f, -1.189600602e-01f, -3.593823910e-01f,
+    8.327359706e-02f, 9.268037230e-02f, 3.546310365e-01f, 2.627669871e-01f,
+    5.595271289e-02f, 7.412423193e-02f, -1.028973982e-02f, 2.269943357e-01f,
+    3.767631203e-02f, -1.523101032e-01f, 2.098741941e-02f, 2.217333531e-03f,
+    9.036766738e-02f, -1.572932005e-01f, -2.183317244e-01f, -1.447387338e-01f,
+    3.296659887e-02f, -1.557914019e-01f, 1.772725433e-01f, 6.833945215e-02f,
+    2.284042239e-01f, 1.194801480e-01f, 1.640706360e-01f, -1.752086878e-01f,
+    1.731977165e-01f, -4.275402054e-02f, 1.916024648e-02f, -1.381928846e-02f,
+    8.879196644e-02f, -1.873295568e-02f, -1.411486566e-01f, -8.894219249e-02f,
+    7.284454256e-02f, -9.717661887e-03f, -5.025110766e-02f, 1.154290512e-01f,
+    1.005481929e-01f, 1.593395621e-01f, -1.501071155e-01f, 1.209456548e-01f,
+    2.182358354e-01f, -1.703879088e-01f, -1.658134162e-01f, -5.381137505e-02f,
+    2.676740289e-01f, 4.108983278e-02f, 2.825975791e-02f, 1.050909981e-01f,
+    2.053543553e-02f, -9.525382519e-02f, 3.806799352e-01f, -6.012495607e-02f,
+    5.078434478e-03f, -3.402360678e-01f, 6.847782433e-02f, -3.308003545e-01f,
+    -1.255467385e-01f, 1.030075029e-01f, 9.857831895e-02f, -1.077234149e-01f,
+    1.092702374e-01f, 1.124989465e-01f, -4.654281959e-02f, 7.026381791e-03f,
+    -3.198544085e-01f, 8.199527860e-02f, -3.218659461e-01f, -4.190461710e-02f,
+    -2.877100557e-02f, -3.037943691e-02f, -3.818380460e-02f, 4.292755723e-01f,
+    2.449170947e-01f, 6.616596133e-02f, -6.043970212e-02f, 6.438095868e-02f,
+    -1.089246199e-01f, 6.519366056e-02f, 1.577652246e-02f, -7.196079940e-02f,
+    3.280670345e-01f, 1.705150604e-01f, 5.044767261e-02f, 1.757012680e-02f,
+    3.015213087e-02f, 7.005714811e-03f, -5.074216798e-02f, 6.241651997e-02f,
+    -2.937714942e-02f, -2.287482768e-01f, -8.144014329e-02f, -8.238974214e-02f,
+    1.161431149e-01f, 1.268181652e-01f, 5.240050703e-02f, 1.348241121e-01f,
+    -8.347435296e-02f, 1.834807545e-02f, 2.702797353e-01f, -4.982655868e-03f,
+    -8.671443909e-03f, -1.898710728e-01f, 2.493201010e-02f, -8.430089056e-02f,
+    -1.708018631e-01f, 5.069690198e-02f, 3.509005904e-02f, -5.445755646e-02f,
+    2.420535870e-02f, 1.722377352e-02f, -5.242981762e-02f, -2.550321259e-02f,
+    -2.567886189e-02f, 4.993748665e-02f, -1.197066680e-01f, -3.634605184e-02f,
+    1.206463724e-01f, -4.148238897e-02f, -9.649599902e-03f, 6.425067186e-01f,
+    2.469522804e-01f, 4.966353998e-02f, -1.208086237e-01f, 6.948325783e-02f,
+    -1.001545265e-01f, -2.994467504e-02f, 1.157007068e-01f, 1.200442910e-01f,
+    4.478792846e-01f, -4.323531687e-02f, 1.691778153e-01f, -7.657185197e-02f,
+    -3.884596005e-02f, 1.238980368e-01f, -1.818051562e-02f, 1.770647317e-01f,
+    1.209987849e-01f, -1.817109734e-01f, -9.573505074e-02f, 5.771878734e-02f,
+    2.885562927e-02f, 5.592437461e-02f, 1.700549722e-01f, 4.155433923e-02f,
+    -2.794789150e-02f, -5.586164817e-02f, 4.250634909e-01f, -3.867867216e-02f,
+    -2.023596689e-02f, -2.578707337e-01f, -3.000562638e-02f, -3.008919358e-01f,
+    -1.718836725e-01f, 7.475853711e-02f, -7.878308184e-03f, -2.386227101e-01f,
+    1.433109194e-01f, 5.596804246e-02f, -2.538417876e-01f, 1.379715949e-01f,
+    -2.811445594e-01f, -1.438280940e-01f, -2.784264684e-01f, 2.005950361e-02f,
+    4.343700421e-04f, 3.262364119e-02f, 6.128070131e-02f, 7.371040583e-01f,
+    2.224168926e-01f, -1.678684913e-02f, 4.303828254e-02f, 9.085773677e-02f,
+    -8.634069562e-02f, -7.092726231e-02f, 5.922522768e-02f, 5.471949279e-02f,
+    3.589222133e-01f, -2.471573465e-02f, 2.152652144e-01f, 6.696273386e-02f,
+    -1.212982014e-01f, -9.547883272e-02f, -1.045068353e-02f, -6.893676519e-02f,
+    1.888853759e-01f, 5.955079570e-02f, -6.750558317e-02f, 1.948659271e-01f,
+    -4.319364429e-01f, 2.238111570e-02f, -3.002575412e-02f, -1.280191634e-02f,
+    3.607453778e-02f, 8.551510423e-02f, -1.845926493e-01f, -2.600741386e-02f,
+    5.982962251e-02f, -1.105589196e-01f, 7.880213112e-02f, -1.316777170e-01f,
+    4.671592265e-02f, -1.423612051e-02f, 2.546975017e-02f, 1.150460690e-01f,
+    -1.379524767e-01f, 1.363227367e-01f, 2.548019290e-01f, 1.325907558e-01f,
+    4.028907791e-02f, -6.169601902e-02f, 8.043798059e-02f, 5.033597723e-02f,
+    1.203180756e-02f, -1.030855104e-01f, 4.105301201e-02f, -6.604075432e-02f,
+    2.044341341e-02f, 5.459781736e-02f, -4.292783514e-02f, -9.518054128e-02f,
+    9.655137360e-02f, -1.295190156e-01f, -3.666797187e-03f, -8.777963370e-02f,
+    -1.687531471e-01f, -9.359251708e-02f, -1.266752779e-01f, 8.582528098e-04f,
+    -5.192972347e-02f, -6.047641486e-02f, 2.909880131e-02f, 3.631385043e-02f,
+    2.250580639e-01f, 2.927076072e-02f, -5.465454422e-03f, -1.021072175e-02f,
+    -3.525862396e-01f, 1.244149636e-02f, 3.637358546e-03f, 8.589463681e-02f,
+    -2.895124443e-02f, 9.922117740e-02f, -1.652010679e-01f, -9.422357380e-02f,
+    2.786983177e-02f, -1.901982576e-01f, -1.230307855e-03f, 6.609366834e-02f,
+    2.073360793e-02f, -6.418346893e-03f, -5.164392292e-03f, 1.941766888e-01f,
+    -1.294538006e-02f, 1.513312608e-01f, 1.575457454e-01f, 3.339741379e-02f,
+    1.750586182e-01f, 1.880684495e-02f, 1.405085027e-01f, -2.104025520e-02f,
+    1.143383607e-01f, -6.182652898e-03f, -3.006227687e-02f, -8.127751201e-02f,
+    9.489022195e-02f, -4.529868439e-02f, -3.288114071e-02f, -9.156068414e-02f,
+    1.750564575e-01f, -1.061137170e-01f, 1.706550084e-02f, -1.136715487e-01f,
+    -3.438870236e-02f, 8.854541928e-03f, 1.235606801e-02f, 1.541323960e-01f,
+    -6.501394510e-02f, -5.554979667e-02f, -1.087407470e-01f, -1.060480699e-01f,
+    1.512269378e-01f, 1.333086751e-02f, -9.026003629e-02f, 7.326151431e-02f,
+    -2.856467068e-01f, 1.821402311e-01f, -1.906983182e-02f, 1.199013591e-01f,
+    -1.208593845e-01f, 6.431943178e-02f, -1.483505666e-01f, -8.803483099e-02f,
+    -1.201213454e-03f, -2.432847321e-01f, -1.681237854e-02f, 6.727219373e-02f,
+    1.014630198e-01f, 1.224871259e-02f, 4.344015196e-02f, 1.918973476e-01f,
+    -1.299002767e-01f, -9.050329775e-02f, 5.326183513e-02f, -5.469555780e-02f,
+    5.117431656e-02f, 7.149563730e-02f, 1.236721203e-01f, -2.392559871e-02f,
+    9.004445747e-03f, -4.431615770e-02f, 5.684584752e-02f, 2.236444801e-01f,
+    5.744489655e-02f, -6.490889192e-02f, 4.669106752e-02f, -3.807581216e-02f,
+    2.648751736e-01f, -1.506691128e-01f, -7.418790460e-02f, -8.449384570e-02f,
+    -2.769591659e-02f, -1.671642661e-01f, -2.664085478e-02f, -6.248103455e-03f,
+    1.094234288e-01f, 9.709785134e-02f, -6.889986247e-02f, 8.591314778e-03f,
+    3.861340582e-01f, 7.693177462e-02f, -2.201411873e-01f, 9.487899393e-02f,
+    -1.636941284e-01f, -8.340613917e-03f, -3.806228051e-03f, 4.249488562e-02f,
+    2.377135120e-02f, -3.147792444e-02f, -2.753945887e-01f, 3.114798479e-02f,
+    6.342581660e-02f, -2.265844047e-01f, 9.281083941e-02f, -2.665818483e-02f,
+    7.005179673e-02f, -3.481437266e-02f, 1.402970701e-01f, -2.204064280e-02f,
+    9.978786111e-02f, 2.226465940e-01f, 1.834785491e-01f, 1.153441742e-01f,
+    -8.100356162e-02f, -7.655933499e-02f, 1.760027558e-01f, 6.148013473e-02f,
+    1.345536560e-01f, 4.106776416e-02f, 2.322564088e-02f, 2.097804099e-01f,
+    -2.061869651e-01f, 8.348484337e-02f, -1.598421298e-02f, 2.337847650e-02f,
+    7.492011040e-02f, -7.826142013e-03f, -1.797066070e-02f, -5.999335274e-02f,
+    -5.273598246e-03f, -3.850148991e-02f, -1.392961293e-01f, -1.237665787e-01f,
+    1.782149673e-01f, 1.008979976e-01f, -2.945125848e-02f, -1.486614645e-01f,
+    3.705772758e-01f, 1.298253238e-01f, -1.541087031e-01f, -4.457098991e-02f,
+    -1.150602996e-01f, 1.088738665e-01f, 1.301949471e-01f, 1.727094352e-01f,
+    -1.243015975e-01f, -5.063314165e-05f, -4.274928942e-02f, -1.215269268e-01f,
+    1.772962324e-02f, -2.045662403e-01f, 7.090188563e-02f, -1.128924191e-01f,
+    -1.299199555e-02f, -1.018586010e-01f, 1.912949085e-01f, -2.704519033e-02f,
+    1.895491928e-01f, -5.748064816e-02f, 4.531444609e-02f, 3.992418945e-02f,
+    2.173379995e-02f, -8.056290448e-02f, 2.527203038e-02f, 1.904861480e-01f,
+    3.643623367e-02f, 2.051389776e-02f, 7.016628049e-03f, 6.978815794e-02f,
+    -1.853974164e-01f, -6.563746184e-02f, -2.465218306e-02f, 9.130493551e-02f,
+    2.864901163e-02f, -1.127932444e-01f, 1.271436550e-02f, 1.237021666e-02f,
+    -1.366541162e-02f, 1.079424098e-01f, -1.292445511e-01f, -2.834285796e-02f,
+    1.225710213e-01f, 1.514904201e-01f, -1.352620870e-01f, -1.425174028e-01f,
+    4.107641280e-01f, -2.653303929e-02f, -1.919296086e-01f, 3.925009444e-02f,
+    -8.101759851e-02f, 3.021002375e-02f, -2.282275120e-03f, 1.569443196e-01f,
+    1.047966182e-01f, -6.862040609e-02f, -1.141519025e-01f, -6.671337038e-02f,
+    -1.371757090e-01f, -3.003205955e-01f, 1.603866071e-01f, -1.110002920e-01f,
+    2.113884082e-03f, -2.146118134e-02f, 1.305732578e-01f, -4.371488839e-02f,
+    1.228267178e-01f, 1.038426086e-01f, -1.772944927e-01f, 2.025404572e-01f,
+    1.169950049e-02f, -5.894156545e-02f, 6.996940821e-02f, 4.798107222e-02f,
+    1.163596660e-01f, -9.828173555e-03f, -1.190820485e-01f, -1.375271380e-02f,
+    -2.019950449e-01f, 6.156142801e-02f, 1.886772737e-02f, 1.048710048e-01f,
+    -7.578046620e-02f, -1.238777116e-01f, 3.054627916e-03f, -9.547075257e-03f,
+    -2.273150831e-01f, -4.165644199e-02f, -1.768734455e-01f, -1.159037203e-01f,
+    -1.287328601e-01f, 7.213833928e-02f, -1.781446338e-01f, 2.195975780e-01f,
+    1.688564420e-01f, -3.205114305e-01f, -1.182722077e-01f, -1.815515906e-01f,
+    2.339398414e-01f, 2.604486421e-02f, -4.493376613e-02f, 1.616418958e-01f,
+    5.532146618e-02f, -3.160269260e-01f, 1.005995721e-01f, -1.440951377e-01f,
+    2.056992240e-02f, 7.526917011e-02f, -2.297597229e-01f, 2.014256120e-01f,
+    1.444715858e-01f, -1.874735504e-01f, -1.070308983e-01f, -9.728755057e-02f,
+    -6.968934834e-02f, -1.108718887e-01f, -2.961094677e-01f, 5.195555091e-02f,
+    2.997767627e-01f, -1.502969265e-01f, 1.522306725e-02f, -1.072053146e-02f,
+    5.467364565e-02f, 7.943606004e-03f, -4.314308986e-02f, -2.665119171e-01f,
+    -7.930286974e-02f, -1.841993183e-01f, 9.867603332e-02f, -1.206950769e-01f,
+    -1.841337085e-01f, -1.525417157e-02f, -4.936819151e-02f, -2.393018268e-02f,
+    -2.361904830e-01f, 8.595186472e-02f, 5.653080530e-03f, 2.724983357e-02f,
+    -2.954778671e-01f, -1.712396741e-01f, 4.241413623e-02f, 1.281236410e-01f,
+    1.504803300e-01f, -3.026190400e-01f, -1.706236005e-01f, -3.343368769e-01f,
+    3.352912068e-01f, 1.654307395e-01f, 5.629666895e-02f, 1.257898808e-01f,
+    1.183993369e-01f, -2.915234864e-01f, 1.271227747e-01f, -2.003405988e-01f,
+    -1.319961101e-01f, -1.465281285e-02f, -1.635757536e-01f, 9.059165418e-02f,
+    2.142294496e-01f, -2.220585942e-01f, -2.915115841e-02f, 2.299671061e-02f,
+    -7.198062539e-02f, -3.348402306e-02f, -1.330202520e-01f, 1.023894697e-01f,
+    1.119355187e-01f, -4.833742976e-02f, -4.344382510e-02f, -5.402483046e-02f,
+    -1.357528567e-01f, -5.187457427e-02f, -5.696889758e-02f, -6.997275352e-02f,
+    -1.708417684e-01f, -7.819024473e-02f, 3.688341379e-02f, -5.596735701e-02f,
+    -5.342931300e-02f, -3.506184369e-02f, -1.719028503e-01f, -1.347109559e-03f,
+    -1.145330742e-01f, -3.093175963e-02f, 2.735065855e-02f, -1.583146751e-01f,
+    -2.673994005e-01f, -1.035932302e-01f, -3.921060264e-02f, 1.491218358e-01f,
+    7.992194965e-03f, -2.578315437e-01f, -1.075600013e-01f, -2.601968050e-01f,
+    4.257065952e-01f, 3.756218553e-01f, 1.032800302e-01f, 3.560161293e-01f,
+    4.798094742e-03f, -3.657126725e-01f, 9.290816635e-02f, -2.613998055e-01f,
+    -1.796702892e-01f, 5.970058218e-02f, -2.426406145e-01f, -1.052626781e-02f,
+    2.197854221e-01f, -1.692943126e-01f, -1.746639907e-01f, -8.836273849e-02f,
+    -6.131592393e-02f, 1.910054386e-01f, -1.024203971e-01f, 1.168381870e-01f,
+    1.740458906e-01f, -1.387845874e-01f, -4.725653213e-03f, 2.099731937e-02f,
+    -8.734104782e-02f, -1.294468530e-02f, -1.033208519e-01f, -8.097928017e-02f,
+    -2.854858041e-01f, 3.057943424e-03f, -1.236173436e-01f, 1.335405856e-01f,
+    -1.032928079e-01f, -1.179123204e-02f, -2.150535285e-01f, -2.253126502e-01f,
+    5.544818193e-02f, 6.969174743e-02f, 1.092417240e-01f, -3.573989868e-02f,
+    1.624685079e-01f, 2.115465403e-01f, 1.999814510e-01f, 1.785833240e-01f,
+    -7.568093389e-02f, 1.090110242e-01f, 6.819467992e-02f, 2.082245648e-01f,
+    -1.132959723e-01f, -1.995439380e-01f, 6.180939078e-02f, -3.351413310e-01f,
+    5.907778442e-02f, 3.277779371e-02f, 1.616795175e-02f, 1.439863741e-01f,
+    3.071240149e-02f, 7.759180665e-02f, 1.896164119e-01f, 1.034345850e-01f,
+    -1.163713783e-01f, 1.175297424e-01f, 2.101854533e-01f, 3.256959096e-02f,
+    8.962255716e-02f, 4.478158802e-02f, -9.940860327e-04f, 6.577587221e-03f,
+    -1.980453543e-02f, 1.435431093e-01f, 1.305099130e-01f, 9.633208066e-02f,
+    -1.420737710e-02f, 8.604969829e-02f, -4.907181486e-02f, 3.129153699e-02f,
+    4.981504753e-02f, 1.946769468e-02f, -8.031998575e-02f, -5.630504806e-03f,
+    6.942858547e-02f, 1.297500134e-01f, 4.720211774e-02f, 1.377480626e-01f,
+    1.199752837e-01f, -3.724285215e-02f, 6.434600800e-02f, -1.251377612e-01f,
+    9.171386063e-02f, 1.636687815e-01f, 1.678792387e-01f, 5.233452097e-02f,
+    -1.330888271e-01f, 1.397441179e-01f, 2.838008702e-01f, 7.780393958e-02f,
+    -1.248617545e-01f, -1.167599186e-01f, -1.158120260e-01f, -2.270286828e-01f,
+    2.865079977e-02f, 1.968147755e-01f, 1.986756921e-02f, 1.993871629e-01f,
+    2.702911012e-02f, -7.708526403e-02f, 1.686884314e-01f, 7.282943279e-02f,
+    -1.435690373e-01f, 2.001171857e-01f, 1.866680086e-01f, 2.177750506e-02f,
+    -6.789849699e-02f, -8.606132120e-02f, 3.212145716e-02f, -5.152487382e-02f,
+    -5.418768153e-02f, 1.193511933e-01f, 8.906489611e-02f, 1.501756161e-01f,
+    -8.849576116e-02f, 7.265111804e-02f, -1.965084113e-02f, -1.749276370e-02f,
+    1.626960635e-01f, -2.194297872e-02f, -4.804812372e-02f, 6.175405905e-02f,
+    7.764985412e-02f, -3.294553235e-02f, 1.154253632e-02f, 9.060468525e-02f,
+    9.910649061e-02f, -4.049337283e-02f, 1.282791048e-01f, 4.685384780e-02f,
+    8.747564256e-02f, 1.350531727e-01f, 2.631774247e-01f, -2.987113409e-02f,
+    -1.119029820e-01f, 1.731311381e-01f, 2.522808313e-01f, -3.094627894e-02f,
+    -7.485938817e-02f, 3.514475003e-02f, -1.075858101e-01f, -3.577108961e-03f,
+    -5.115820467e-02f, 7.757569104e-02f, -1.385830790e-01f, 1.494818032e-01f,
+    1.855780743e-02f, -8.675659075e-03f, 1.240285411e-01f, 5.753018335e-02f,
+    -1.664840989e-02f, 9.899235517e-02f, 1.104628742e-01f, 4.761150479e-02f,
+    -7.217629347e-03f, -3.992540389e-02f, -5.457606539e-02f, -8.779139817e-02f,
+    8.147099614e-02f, 1.446590871e-01f, 6.644344330e-02f, -8.511114866e-03f,
+    -4.118030146e-02f, -1.104883850e-02f, -4.125776142e-02f, 3.179775551e-03f,
+    1.021924093e-01f, 8.110137284e-02f, 7.538300008e-02f, -5.286454689e-03f,
+    3.460143507e-02f, 4.054697976e-02f, 6.601994485e-02f, 1.261518002e-01f,
+    2.087314725e-01f, 6.766665727e-02f, 2.775538564e-01f, -4.405837134e-02f,
+    5.250236019e-02f, 2.766975760e-01f, -3.569749743e-02f, 1.996859163e-01f,
+    2.474092692e-01f, 8.733814955e-02f, -1.029138118e-01f, -4.332937673e-02f,
+    -4.308586568e-02f, -2.007750869e-01f, -2.957683615e-02f, -3.375938237e-01f,
+    1.464744192e-02f, -1.048742756e-01f, 2.490018308e-02f, 8.600248396e-02f,
+    -5.320663098e-03f, 1.697464883e-01f, 2.120284550e-02f, 1.693325490e-01f,
+    1.087044626e-01f, -1.441867948e-01f, 2.466525510e-02f, 1.849080473e-01f,
+    -4.543393478e-02f, -2.446972430e-01f, -2.133306861e-02f, -1.217289343e-01f,
+    1.077069268e-01f, -1.292822510e-01f, -6.271348149e-02f, 9.370033629e-03f,
+    8.259070106e-03f, 1.012273952e-01f, 3.188960254e-02f, -4.909572657e-03f,
+    1.247045845e-01f, -2.347550690e-01f, -4.233083874e-02f, -1.710755527e-01f,
+    1.457449049e-01f, 1.741838269e-02f, -1.303263903e-01f, -1.975930184e-01f,
+    5.323338509e-02f, -1.168755144e-01f, -3.362576291e-02f, -1.475661062e-02f,
+    -4.503248259e-02f, 7.940454781e-02f, -6.380000710e-02f, 2.109468877e-01f,
+    8.106523007e-02f, -1.355256587e-01f, -9.912508726e-02f, 6.150778383e-02f,
+    1.445643604e-01f, -1.907947361e-01f, -7.373756170e-02f, -5.741870031e-02f,
+    1.161107868e-01f, -3.608673438e-02f, 6.957570463e-02f, 5.766763166e-02f,
+    -7.150126249e-02f, 9.385157377e-02f, -7.585417479e-02f, 1.061744466e-01f,
+    1.004767343e-01f, -1.776681393e-01f, -9.696055949e-02f, -8.380387723e-02f,
+    -3.892799839e-02f, -3.466391191e-02f, -7.015866786e-02f, -7.809130102e-02f,
+    1.550858188e-02f, -1.584714651e-01f, -3.216433898e-02f, -3.634044155e-02f,
+    1.221268550e-01f, -1.683955081e-02f, -3.197147697e-02f, 4.265394434e-02f,
+    1.458856463e-01f, 8.336820453e-02f, -5.783055350e-02f, -1.294308454e-01f,
+    -1.283132657e-02f, -2.084385306e-01f, -8.884363621e-02f, -1.912736446e-01f,
+    -1.327777803e-01f, -9.944333881e-02f, 5.621907115e-02f, -7.740193605e-02f,
+    -1.018333286e-01f, 3.757273406e-02f, -1.177290976e-01f, 1.670447588e-01f,
+    2.147866637e-01f, -2.081594020e-01f, -6.889806688e-02f, -3.436686844e-02f,
+    9.307596833e-02f, -5.789082032e-03f, 5.370513350e-02f, 7.307323627e-03f,
+    2.105378173e-02f, -2.115240544e-01f, 5.587804597e-03f, -1.173666418e-01f,
+    -6.413394958e-02f, -9.979617782e-03f, -9.054780006e-02f, -1.663547307e-01f,
+    -1.515621692e-01f, -1.696727425e-01f, -3.685450926e-02f, -7.392440736e-02f,
+    -1.084300652e-01f, 1.975246891e-02f, 2.110902593e-02f, -1.085808948e-01f,
+    4.379240423e-02f, -1.818788201e-01f, -1.265681833e-01f, -1.308203787e-01f,
+    3.129202873e-02f, 1.224458516e-01f, 5.248211790e-03f, 2.341056429e-02f,
+    -1.067257300e-01f, 9.396899492e-02f, 9.180879593e-02f, 1.737983315e-03f,
+    -1.267928630e-01f, -9.619019926e-03f, 6.594423205e-03f, -1.429581493e-01f,
+    -2.079098485e-02f, -7.335674763e-02f, -1.606210135e-02f, -4.761009663e-02f,
+    -3.807099909e-02f, -6.389953941e-02f, 1.451594532e-01f, -2.856607735e-01f,
+    -3.239795938e-02f, 1.656481922e-01f, -8.443820477e-02f, -2.655518707e-03f,
+    1.699410379e-01f, 6.402894855e-02f, -2.307810821e-02f, 8.879806101e-02f,
+    -9.067808837e-02f, -6.820622832e-02f, 5.983212497e-03f, -9.164454043e-02f,
+    -2.346709557e-02f, 1.862358749e-01f, -7.099180669e-02f, 1.817252785e-01f,
+    2.077271491e-01f, -9.595817886e-03f, -3.732550144e-02f, 1.101484746e-01f,
+    7.943698764e-02f, 5.434068292e-02f, 1.321305782e-01f, 1.095406711e-01f,
+    1.303828601e-02f, 7.479390502e-02f, -4.094303120e-03f, -1.081242338e-01f,
+    8.836248517e-02f, -6.239893660e-02f, -6.767414510e-02f, 4.286126792e-01f,
+    -7.034029346e-03f, -8.098033071e-02f, -1.268090564e-03f, -8.167493157e-03f,
+    2.920553833e-02f, 1.871184409e-01f, 7.849160582e-02f, 2.957262844e-02f,
+    1.702154428e-01f, -1.681580208e-02f, 4.379001260e-02f, -6.466671079e-02f,
+    6.024882197e-02f, -1.562150382e-02f, -3.510665521e-02f, -1.574273705e-01f,
+    -1.465914398e-01f, 7.493499666e-02f, -3.269349784e-02f, -2.886341885e-02f,
+    3.259861469e-02f, 1.129438356e-02f, 9.611615911e-03f, 1.863865741e-02f,
+    -2.479639798e-01f, -4.151130095e-02f, -1.074068397e-01f, -1.040352881e-01f,
+    9.623379260e-02f, 3.138534958e-03f, -1.985187978e-01f, 1.540071703e-02f,
+    2.135249972e-01f, 9.630964696e-02f, -4.982062429e-02f, 7.981783152e-02f,
+    8.206640929e-02f, 2.345031500e-02f, 1.828409433e-01f, 1.434761882e-01f,
+    1.377081722e-01f, 8.493835479e-02f, 3.261530399e-02f, -3.192161769e-02f,
+    -1.709449887e-01f, -1.397704184e-01f, 3.155295737e-03f, 1.067263559e-01f,
+    -1.529581696e-01f, -5.394107848e-02f, 9.442170709e-02f, 1.749831140e-01f,
+    -1.131956652e-01f, 2.736816108e-01f, 1.242713779e-01f, 1.054807305e-01f,
+    9.817104042e-02f, -3.307515010e-02f, -6.674996763e-02f, 3.231467679e-02f,
+    -1.619823836e-02f, -1.535669863e-01f, 1.223614812e-01f, -2.780543566e-01f,
+    -2.281144820e-02f, 5.207054690e-02f, -5.203854293e-02f, -2.519349158e-01f,
+    4.635704309e-02f, 6.527155638e-02f, -5.144605413e-02f, -6.748159230e-02f,
+    -1.323435009e-01f, -1.154434308e-02f, -1.697106101e-02f, -2.083533630e-02f,
+    9.225061536e-02f, -3.212695708e-03f, -9.567213804e-02f, -1.110559423e-02f,
+    4.324092865e-01f, 4.613960162e-02f, -1.485240459e-01f, 9.940022230e-02f,
+    -3.685621545e-02f, 1.512627453e-01f, 1.490439326e-01f, -3.652609140e-02f,
+    9.131509811e-02f, 3.490684554e-02f, 1.728593558e-01f, -3.445644677e-02f,
+    -2.691333648e-03f, -2.317774892e-01f, 9.249601862e-04f, 2.187621593e-01f,
+    -3.248389438e-02f, -6.392457336e-02f, 7.537942380e-02f, 1.256255656e-01f,
+    1.541163423e-03f, 8.704406768e-02f, 1.060643494e-01f, 1.706990451e-01f,
+    2.878006734e-02f, 4.243933782e-02f, 3.979773074e-02f, 7.759664208e-02f,
+    1.013478935e-01f, 8.970340341e-02f, 2.941165492e-02f, 6.692356616e-02f,
+    9.981934726e-02f, -5.728521943e-02f, 5.898179114e-02f, -3.171473369e-02f,
+    2.408167273e-01f, -9.631266445e-02f, -1.252642870e-01f, 3.755453974e-02f,
+    1.688159555e-01f, 8.589242585e-03f, -7.132791728e-02f, 2.284077108e-01f,
+    -1.235155761e-01f, 1.472942680e-01f, 1.151841786e-02f, 3.886014596e-02f,
+    -1.056292206e-01f, -7.841384038e-03f, 7.982432097e-02f, -1.649918966e-02f,
+    -1.175893620e-01f, -1.418790817e-01f, -2.014138550e-01f, -5.393757299e-02f,
+    -4.610520974e-02f, -1.087149046e-02f, -2.456344105e-02f, 6.100586429e-02f,
+    5.948229507e-02f, 8.976642787e-02f, 1.171130016e-01f, -1.771124303e-01f,
+    -1.815629005e-01f, 1.359411776e-01f, 1.098662019e-01f, 8.222185820e-02f,
+    -2.491008304e-02f, -6.724797189e-02f, -1.039485484e-01f, -2.912753448e-02f,
+    -9.579566121e-02f, 1.286155637e-02f, -1.165970117e-01f, 3.115348332e-02f,
+    4.366166517e-02f, -9.581018984e-02f, 7.697743922e-02f, 1.009702384e-01f,
+    1.082454547e-01f, 3.210946545e-02f, 1.377360821e-01f, -1.264561666e-03f,
+    2.219124734e-01f, -7.049293071e-02f, -3.945862129e-02f, 8.165770210e-03f,
+    9.853819385e-03f, 8.004463464e-02f, -3.359837830e-02f, 1.017531659e-02f,
+    -1.152738184e-02f, 2.442298457e-02f, 5.731920525e-02f, 1.852729358e-03f,
+    -2.270961739e-02f, -1.868135110e-02f, 1.257217824e-01f, 6.880040467e-02f,
+    -9.190867841e-02f, -4.194680974e-02f, -1.069439054e-01f, -4.362453148e-02f,
+    -5.816920102e-02f, 3.721968830e-02f, -1.473598629e-01f, 4.268614575e-02f,
+    -3.549417481e-03f, 6.429569423e-02f, 4.104952142e-02f, -1.478817612e-01f,
+    -1.075765043e-01f, -2.360112406e-02f, 1.020860579e-02f, -4.383864254e-02f,
+    -1.053375229e-01f, -4.133263603e-02f, -1.384501457e-01f, 8.833409101e-02f,
+    -1.778106093e-01f, -5.018737167e-02f, -1.417516265e-02f, 2.514280193e-02f,
+    1.010134444e-01f, 4.862868786e-02f, 2.567712963e-02f, 6.521232426e-02f,
+    1.513513476e-01f, 5.686838180e-02f, 1.331290007e-01f, 3.690070659e-02f,
+    1.167778075e-01f, -1.180037931e-01f, -6.622913480e-02f, -3.213623539e-02f,
+    8.885721862e-02f, 8.169230074e-02f, -3.219793737e-02f, 6.188350543e-02f,
+    8.928330988e-02f, 1.429278105e-01f, -9.609595686e-02f, -4.602438956e-02f,
+    1.782215084e-03f, 1.071203053e-01f, 2.136007510e-02f, 1.558668315e-01f,
+    -8.953144401e-02f, -1.712556183e-01f, -2.584758103e-01f, -1.216242984e-01f,
+    -5.113217980e-02f, 8.971809596e-02f, -5.431605875e-02f, -6.461773068e-02f,
+    4.261851683e-02f, 5.813032761e-02f, -1.363581326e-02f, -1.977865398e-01f,
+    -2.479296178e-01f, -1.530392282e-02f, 1.441727281e-01f, 1.303229202e-02f,
+    2.046204172e-02f, -1.527140499e-03f, 6.431078911e-02f, 4.528029822e-03f,
+    -7.730840147e-02f, 9.995174408e-02f, -3.257635236e-02f, 1.205023285e-02f,
+    2.861820348e-02f, 2.361958846e-02f, 3.912276030e-02f, -1.766679622e-02f,
+    4.278715253e-01f, -1.940634102e-03f, -1.822069734e-01f, 7.558797300e-02f,
+    -3.713978231e-01f, 3.202043101e-02f, -4.534946289e-03f, 1.163717452e-02f,
+    -1.124260202e-01f, 2.301341482e-02f, -2.601204515e-01f, 2.113012783e-02f,
+    -3.298440948e-02f, -9.567090124e-02f, 4.126809537e-02f, 2.082137465e-01f,
+    1.907000691e-01f, -7.563509792e-02f, -7.964212447e-02f, 1.713681221e-01f,
+    1.614021361e-01f, 5.384633690e-02f, 1.087073237e-01f, 1.212545931e-01f,
+    1.758332103e-01f, -9.559979290e-02f, 1.651327163e-01f, 1.025291532e-01f,
+    -2.163968049e-02f, -8.001594245e-02f, 1.071573049e-01f, -2.610658854e-02f,
+    -1.760670692e-01f, -1.108514592e-01f, 7.069567591e-02f, -9.871045500e-02f,
+    8.859892190e-02f, 1.485421043e-02f, -9.409683943e-02f, 4.355464131e-02f,
+    9.382934123e-02f, 7.889337093e-02f, -1.913902722e-02f, 2.889041416e-02f,
+    1.293676198e-01f, 7.352397591e-02f, -4.863088205e-02f, -2.319331020e-01f,
+    3.726003170e-01f, 2.385354042e-02f, -5.823169369e-03f, 2.419581637e-02f,
+    -3.768910468e-01f, 9.868061543e-02f, 1.731450669e-02f, 1.143209413e-01f,
+    -4.723030701e-02f, 1.873491704e-02f, -1.633722484e-01f, -4.858706519e-02f,
+    -3.112689964e-02f, -9.270274639e-02f, -7.215182483e-02f, 1.463645697e-01f,
+    1.481145769e-01f, 4.920586571e-02f, 2.752780216e-03f, 1.670056731e-01f,
+    1.297672540e-01f, 8.104545623e-02f, 1.649824977e-01f, 1.456419975e-01f,
+    1.470592320e-01f, -8.663623035e-02f, 1.035770550e-01f, 7.777720690e-02f,
+    -3.397965059e-02f, -1.361247152e-01f, -1.215586066e-02f, 1.701658219e-01f,
+    -1.333778650e-01f, -2.636849135e-02f, 6.165950745e-02f, 4.279249534e-02f,
+    -2.127506211e-02f, 1.228708997e-01f, 7.355467230e-02f, 2.369024325e-03f,
+    -4.730491713e-02f, 4.194954783e-02f, -6.012877449e-02f, -6.858907640e-02f,
+    1.330925971e-01f, -4.502899572e-02f, 1.536057098e-03f, -9.098478407e-02f,
+    4.695378542e-01f, 4.790705070e-02f, 3.261942044e-02f, 3.320105374e-02f,
+    -4.674782157e-01f, 1.562167406e-01f, 1.834432036e-01f, 9.534560889e-02f,
+    -1.184180751e-01f, 8.763582446e-04f, -2.045812309e-01f, 4.400155321e-02f,
+    4.974928498e-02f, -1.415459514e-01f, -6.678417325e-02f, 1.958255917e-01f,
+    2.269179821e-01f, -7.583256345e-03f, 6.577173620e-02f, 1.805565208e-01f,
+    2.036833763e-01f, -8.130307309e-03f, 1.378839165e-01f, -8.557686210e-02f,
+    2.866129279e-01f, -2.767389826e-02f, 1.290524453e-01f, 7.554990798e-02f,
+    -4.150528833e-02f, -6.140266359e-02f, 9.701836109e-02f, 2.080356702e-02f,
+    -1.908581406e-01f, 9.675672278e-03f, -6.070815958e-03f, -3.225716203e-02f,
+    -1.312723756e-01f, 6.824021786e-02f, 1.036320701e-01f, 8.497633785e-02f,
+    2.024658620e-01f, 4.017474502e-02f, 6.286854297e-02f, -1.212268416e-02f,
+    -2.374709770e-02f, 1.363108605e-01f, -1.379021257e-01f, -3.875689209e-02f,
+    1.764724553e-01f, -5.252828076e-02f, -3.935624659e-01f, -1.022827253e-01f,
+    3.058311045e-01f, 9.202012420e-02f, 1.200833693e-01f, 3.765599430e-02f,
+    -2.757018199e-03f, -2.609933317e-01f, 2.607853115e-01f, -6.625574827e-02f,
+    -1.123016179e-01f, -1.153720990e-01f, 8.567114919e-02f, 1.585652381e-01f,
+    1.108944938e-01f, -1.410091817e-01f, 1.415718794e-01f, 3.398241848e-02f,
+    1.246804446e-01f, -2.432652190e-02f, 2.964125015e-02f, 3.242313489e-02f,
+    1.748458147e-01f, -2.991811745e-02f, -2.026143111e-02f, 2.013973519e-02f,
+    -1.059105322e-01f, 3.777399659e-02f, 2.010411117e-03f, -3.186857402e-01f,
+    -2.298280448e-01f, 6.294760853e-02f, 2.173224837e-02f, -1.405838579e-01f,
+    -1.061954498e-01f, 7.089644670e-02f, -2.654646635e-01f, 1.518393606e-01f,
+    -1.019503400e-01f, -3.857656196e-02f, -6.401208788e-02f, -6.495686620e-02f,
+    1.004745737e-01f, 1.285381913e-01f, 3.185581008e-04f, -7.857978344e-02f,
+    1.469403207e-01f, -1.448876411e-01f, -4.767990112e-02f, -6.397042423e-02f,
+    2.401509881e-01f, 1.123066023e-01f, 3.863120824e-02f, 8.886998892e-02f,
+    -1.912682056e-01f, -2.016439885e-01f, 1.954365224e-01f, -1.612028852e-02f,
+    -1.837945431e-01f, -1.723894924e-01f, 7.872997969e-02f, 2.203025222e-01f,
+    1.505989134e-01f, -1.641757637e-01f, -4.056447372e-02f, -2.497359365e-02f,
+    1.819079518e-01f, 1.921021752e-02f, -1.572280750e-02f, 1.014101356e-01f,
+    7.109267265e-02f, -1.182418019e-01f, -5.478951707e-02f, 5.975271761e-02f,
+    -5.191995762e-03f, 7.774963975e-02f, -8.152964711e-02f, -2.876580954e-01f,
+    -1.561536342e-01f, 6.369608641e-02f, -7.491651922e-02f, 4.933108017e-02f,
+    -2.297931612e-01f, -1.137484983e-01f, -9.996248037e-02f, 7.095845789e-02f,
+    -9.120690078e-02f, 1.919176057e-02f, -2.115920037e-01f, -3.626412153e-02f,
+    8.762312122e-03f, 1.163221989e-02f, -2.125734389e-01f, -8.499940485e-02f,
+    -1.048992649e-01f, -1.777005494e-01f, -2.216893733e-01f, -7.709526271e-02f,
+    3.840720057e-01f, 2.233923376e-01f, 1.122414172e-01f, 2.239791155e-01f,
+    -7.182918489e-02f, -3.801736236e-01f, 2.637768984e-01f, -7.001796365e-02f,
+    2.776923962e-02f, -4.415109754e-02f, -2.778188884e-02f, 6.155493483e-02f,
+    1.725954711e-01f, -1.777116023e-02f, 8.532797545e-02f, -2.310003191e-01f,
+    1.129103377e-01f, 1.044307426e-01f, -1.288374327e-02f, 1.273231655e-01f,
+    2.618709803e-01f, -1.972283870e-01f, -1.026806682e-01f, 7.259257138e-02f,
+    -7.774838805e-02f, -4.565045238e-02f, -6.664102431e-03f, -1.271934509e-01f,
+    -2.994931936e-01f, -8.346960694e-02f, 7.779149711e-02f, 8.572975174e-03f,
+    -2.289216816e-01f, -1.027546674e-01f, -9.792154282e-02f, -3.522289917e-02f,
+    -6.714729220e-02f, 1.041610613e-01f, -9.393824637e-02f, -7.464168966e-02f,
+    -6.194689497e-02f, -6.523995101e-02f, 3.325034678e-02f, -2.037854195e-01f,
+    -1.104088277e-01f, 9.829408675e-02f, 8.689944632e-03f, -1.331140846e-01f,
+    1.288971901e-01f, -6.361981481e-02f, -3.181663752e-01f, -1.102132574e-01f,
+    -7.217326760e-02f, 1.425501611e-02f, -1.506479830e-01f, 3.881581128e-03f,
+    -5.155289918e-02f, -3.536258265e-02f, 1.062128022e-01f, -1.478257775e-01f,
+    6.259106100e-02f, 1.362767965e-01f, -1.067409813e-01f, -4.413888976e-02f,
+    -4.469361622e-03f, -4.700249992e-03f, 1.483479980e-02f, -3.859208897e-02f,
+    1.104857679e-02f, 3.466273844e-02f, -3.243172169e-02f, 6.995636225e-02f,
+    -1.104453695e-03f, -6.018282846e-02f, -6.115173548e-02f, 2.845065892e-01f,
+    1.060808599e-01f, -2.530280873e-02f, -7.506168913e-04f, 5.810305476e-02f,
+    -1.340484619e-01f, 8.625342697e-02f, 2.298919261e-01f, 1.306507140e-01f,
+    3.875032067e-01f, 6.535621732e-02f, 1.951547861e-01f, -9.835006297e-02f,
+    -5.057500675e-02f, -9.583397210e-02f, -3.064644523e-02f, -1.311472803e-01f,
+    -1.251462996e-01f, 6.530190259e-02f, -7.529415935e-02f, 1.898563094e-02f,
+    6.902928650e-02f, -2.087559402e-01f, -1.478665471e-01f, -5.146111175e-02f,
+    2.964980667e-03f, 4.091178253e-02f, -1.859485656e-01f, 3.664435446e-02f,
+    5.808917806e-02f, -1.264730692e-01f, -6.660809368e-02f, -1.196813434e-01f,
+    6.830690056e-02f, 9.649214894e-02f, -3.441078216e-02f, 3.641585261e-02f,
+    -1.445430098e-03f, 7.584937662e-02f, -9.433590807e-03f, -4.177694395e-02f,
+    8.497194946e-02f, 1.166887581e-01f, -1.402623206e-01f, -1.239040866e-02f,
+    -8.661745489e-02f, -1.303769201e-01f, -1.398267299e-01f, 4.747415483e-01f,
+    1.812256426e-01f, 1.732519642e-02f, -9.516926855e-02f, -4.533329606e-02f,
+    -3.671671078e-02f, 1.725868434e-01f, 1.120113581e-01f, 6.912960112e-02f,
+    2.738046646e-01f, 1.369444132e-01f, 1.401508879e-02f, -1.223476008e-01f,
+    -3.511941759e-03f, -2.274737507e-01f, -5.495360866e-02f, -2.647188306e-01f,
+    -1.571398973e-01f, -2.242772840e-02f, -1.066423804e-01f, -9.483426809e-02f,
+    4.586550593e-02f, -2.822088264e-02f, -2.381588221e-01f, -2.006711513e-01f,
+    -1.853945702e-01f, -1.106300019e-02f, -1.622019112e-01f, -8.121941984e-02f,
+    -3.957315534e-02f, -8.961471915e-02f, -8.983194083e-02f, 1.572968625e-02f,
+    7.059590518e-02f, 1.404022872e-01f, -1.824359894e-01f, -7.892391086e-02f,
+    9.771436453e-02f, 2.282790840e-02f, 4.169322550e-03f, 4.781673849e-02f,
+    1.432373840e-02f, 4.743937775e-02f, 8.043889701e-02f, -1.353540719e-01f,
+    -6.735940278e-02f, -7.508029044e-02f, 8.432631940e-02f, 5.365309715e-01f,
+    8.241781034e-03f, 4.705198109e-02f, -6.965672225e-02f, 3.566595912e-02f,
+    -1.477523893e-01f, 2.314669825e-02f, 1.295517897e-03f, 1.369435787e-01f,
+    3.760615289e-01f, 5.643149465e-02f, 9.299186617e-02f, -2.797943540e-02f,
+    2.159790993e-01f, 1.109009311e-01f, -3.135361150e-02f, -1.525833756e-01f,
+    3.187865317e-01f, 1.614005715e-01f, -9.877816588e-02f, 5.473281443e-02f,
+    1.341296732e-01f, -7.432283461e-02f, 1.573099792e-01f, -9.166640043e-02f,
+    8.767126501e-02f, -4.325051233e-02f, 9.555192292e-02f, 1.096382737e-01f,
+    -5.948109552e-02f, -1.745835841e-01f, 6.086302176e-02f, 2.769906819e-02f,
+    1.592462957e-01f, 5.411400273e-02f, 1.483831853e-01f, 1.463458836e-01f,
+    -4.408160225e-02f, -1.417952031e-01f, -2.525556982e-01f, 1.220636666e-01f,
+    1.684789807e-01f, -5.759451166e-02f, -2.749421634e-02f, -2.652599663e-02f,
+    1.118531898e-01f, -1.161188483e-01f, 2.304556035e-02f, -9.221853316e-02f,
+    -3.330868185e-01f, 8.664192259e-02f, 5.390364304e-02f, 6.312085688e-02f,
+    -5.517654587e-03f, 8.695992827e-02f, -1.155906692e-01f, -1.106800810e-01f,
+    -3.328311741e-01f, -8.892644942e-02f, -1.579302847e-01f, -9.369086474e-02f,
+    2.886356413e-02f, 2.597082257e-01f, -1.766058207e-01f, -6.981188059e-02f,
+    1.439466327e-01f, 5.843598768e-02f, -1.279557198e-01f, -3.393288702e-02f,
+    1.769184321e-01f, 1.316367984e-01f, -1.714810543e-02f, 1.520951837e-01f,
+    2.133428864e-02f, 8.553104848e-02f, 1.044434495e-02f, 1.301493198e-01f,
+    6.797853857e-02f, 4.093023948e-03f, 3.705084696e-02f, 5.448427051e-02f,
+    3.023734987e-01f, -8.003930002e-02f, 7.259367406e-02f, 8.812035620e-02f,
+    -6.846535206e-02f, 1.403525770e-01f, 6.255675852e-02f, -1.969017088e-01f,
+    1.040273160e-01f, -8.303897828e-02f, -6.585925072e-02f, 5.477245431e-03f,
+    6.716305017e-02f, 9.538046271e-02f, -2.673235722e-02f, -1.346634477e-01f,
+    -2.243690938e-01f, 5.333463848e-02f, 5.802081153e-02f, 1.880913042e-03f,
+    -4.787982255e-02f, -1.491425782e-01f, -7.601071149e-02f, -1.766949445e-01f,
+    -2.206726968e-01f, 1.591408104e-01f, -1.814744622e-01f, -4.307852685e-02f,
+    7.994893938e-02f, 2.091438323e-01f, -1.824146360e-01f, -2.755561145e-03f,
+    2.189201415e-01f, -5.593609530e-04f, -1.906097531e-01f, 9.529066272e-03f,
+    2.724096179e-01f, -1.801490784e-02f, 1.555519402e-01f, 2.436172217e-01f,
+    -9.677991271e-02f, -1.243989915e-02f, -1.185151115e-01f, -3.168902546e-02f,
+    3.220881149e-02f, 2.213846333e-02f, 5.883911625e-02f, 8.330933750e-02f,
+    2.541810870e-01f, -7.404547930e-02f, -1.090024784e-01f, 8.542688191e-02f,
+    7.792035490e-02f, -2.494592406e-02f, -5.212099850e-02f, -4.884449020e-02f,
+    2.657200098e-01f, -5.684502423e-02f, -7.553829998e-02f, 1.241490468e-01f,
+    4.794883728e-02f, 8.382935822e-02f, 3.499938175e-03f, -1.753599495e-01f,
+    -3.285401464e-01f, -2.093185484e-02f, 5.218737293e-03f, 1.596471481e-02f,
+    -1.743571907e-01f, -9.399114549e-02f, -4.980015382e-02f, -4.539264366e-02f,
+    -1.105957404e-01f, 5.208000168e-02f, -2.147221714e-01f, 6.111041829e-02f,
+    2.407314777e-01f, 2.669021785e-01f, 2.119589299e-01f, 1.074336693e-01f,
+    -1.336940080e-01f, 4.925189912e-02f, 1.742065251e-01f, 2.431407720e-01f,
+    -3.732660040e-02f, -1.786336601e-01f, 7.153274119e-02f, -3.007229865e-01f,
+    -2.241151407e-02f, 2.957020104e-01f, -8.498170227e-02f, 2.410153896e-01f,
+    9.992770106e-02f, 1.927457303e-01f, 2.337984741e-01f, 1.402637549e-02f,
+    -7.184101641e-02f, 2.054848373e-01f, 2.223271579e-01f, 1.747447699e-01f,
+    7.788214833e-02f, -9.407547116e-02f, -8.261057734e-02f, -8.949095011e-02f,
+    -4.391709343e-02f, 2.633672059e-01f, -2.288119309e-02f, 1.714076251e-01f,
+    1.317770220e-02f, -5.585286021e-02f, 6.939307600e-02f, -7.623308897e-02f,
+    5.174251273e-02f, 7.291500270e-02f, 3.127485141e-02f, 8.344509453e-02f,
+    -1.253700629e-02f, 2.600965500e-01f, 5.125337839e-02f, 8.318247646e-02f,
+    1.499079615e-01f, 1.529887468e-01f, 6.017545238e-02f, 6.222602725e-02f,
+    2.453410476e-01f, 2.235775143e-01f, 3.008194864e-01f, 4.543151334e-02f,
+    -1.221884936e-01f, 2.406661361e-01f, 1.370026022e-01f, 2.128094435e-01f,
+    -2.090363204e-02f, -2.981529236e-01f, -1.074970290e-01f, -2.205792516e-01f,
+    -7.022938877e-02f, 4.845704511e-02f, -1.429548562e-01f, 2.526105046e-01f,
+    1.270715445e-01f, 9.783321619e-02f, 1.662461311e-01f, 1.369071379e-02f,
+    7.693837862e-03f, 3.127436340e-01f, 1.941458881e-01f, 1.725513637e-01f,
+    6.237273663e-02f, -1.294233650e-01f, -1.377018839e-01f, -5.605481565e-03f,
+    3.765642643e-02f, 2.208963782e-01f, 6.552418694e-03f, 1.749347150e-01f,
+    4.770502448e-03f, 3.829409927e-02f, 8.678887389e-04f, 2.489050105e-02f,
+    6.546842307e-02f, 1.472163200e-02f, 4.862835631e-02f, 1.049877554e-01f,
+    -1.810778677e-02f, 1.056947708e-01f, 8.593809605e-02f, 2.244742960e-01f,
+    2.271066159e-01f, 1.187572256e-01f, 4.744141921e-02f, 8.867859840e-03f,
+    1.964556128e-01f, 1.677978337e-01f, 1.467931271e-01f, -6.193912029e-02f,
+    -2.139357477e-01f, 1.472660899e-01f, 3.021785617e-01f, 1.825183928e-01f,
+    -7.743012626e-03f, -1.128310412e-01f, -2.012355030e-01f, -1.016061455e-01f,
+    -1.069073230e-01f, 2.586531639e-01f, -2.114860117e-01f, 2.905180752e-01f,
+    1.321067754e-02f, -3.351341933e-02f, 1.627072394e-01f, 1.976189017e-02f,
+    -7.436001208e-03f, 2.266604900e-01f, 2.301138341e-01f, 6.189812720e-02f,
+    -2.455183864e-02f, -9.064935148e-02f, -1.503981352e-01f, -1.647019200e-02f,
+    5.916320533e-02f, 2.293916047e-01f, -2.581795491e-02f, 1.195231229e-01f,
+    1.034361348e-01f, 1.043315902e-01f, 1.161136292e-02f, 1.180722713e-01f,
+    3.859232878e-03f, 9.209607542e-02f, 3.632555902e-02f, 2.898579650e-02f,
+    -4.781902209e-02f, 6.154029444e-02f, 1.245668158e-01f, 3.782170266e-02f,
+    2.421901375e-01f, 1.179168150e-01f, 1.736624092e-01f, 1.292264741e-02f,
+    -1.807441190e-02f, -1.276274472e-01f, -4.751611874e-02f, 9.200181812e-03f,
+    -1.000647470e-01f, -7.435261458e-02f, 6.265354902e-02f, -8.270897716e-02f,
+    2.146602273e-01f, -9.045441635e-03f, -1.052337289e-01f, -2.451974340e-02f,
+    1.377583295e-02f, -2.316597104e-01f, 7.519877702e-02f, -4.573262483e-02f,
+    -9.640992433e-02f, 3.734004870e-02f, -2.049981058e-01f, 1.055959612e-01f,
+    -1.657400839e-02f, -4.624533653e-02f, -3.576453403e-02f, -1.482456028e-01f,
+    -5.338507146e-02f, 8.449885994e-02f, 2.977585827e-04f, 1.320615262e-01f,
+    4.597195983e-02f, -2.632392570e-02f, 1.765926778e-01f, -1.887672246e-01f,
+    -3.827236965e-02f, 9.280235320e-02f, -6.469945610e-02f, 1.416138113e-01f,
+    8.686802536e-02f, -8.694683015e-02f, -1.805146337e-01f, -1.878227293e-01f,
+    -9.457717836e-02f, -7.134636864e-03f, -1.854140908e-01f, 1.142409965e-01f,
+    7.329431921e-02f, -1.472383887e-01f, 1.983097941e-01f, -1.120893508e-01f,
+    -2.137381434e-01f, -1.478823721e-01f, -1.019941941e-01f, 3.354496881e-02f,
+    -7.362201065e-02f, -7.083399594e-02f, 8.287999779e-02f, -7.718346268e-02f,
+    1.968146563e-01f, 7.694493234e-02f, 1.259043217e-01f, 3.050113283e-02f,
+    1.345796436e-01f, 1.138784885e-01f, 2.427595109e-02f, -4.400400445e-02f,
+    -1.501442045e-01f, -1.134281680e-01f, -6.308700144e-02f, 1.338945180e-01f,
+    -8.548003435e-02f, -6.653576344e-02f, -3.480382636e-02f, -1.525958478e-01f,
+    -4.790589446e-04f, 1.058797315e-01f, -1.209428441e-02f, 1.491517574e-01f,
+    -1.167536993e-02f, -1.403129995e-01f, 1.525952965e-01f, -2.668144107e-01f,
+    1.789282635e-02f, -3.605602309e-03f, -1.062266082e-01f, 6.539602578e-02f,
+    1.545490324e-01f, -6.500872225e-02f, -6.509831548e-02f, -1.193742901e-01f,
+    3.364077210e-02f, 1.792762615e-02f, -1.984930038e-02f, 3.932404146e-02f,
+    9.344905615e-02f, -3.943089023e-02f, 7.876744121e-02f, -7.441616803e-02f,
+    -2.107910439e-02f, -1.328101307e-01f, -3.154412657e-02f, 1.861559302e-01f,
+    -1.262003481e-01f, -1.469923109e-01f, 1.345837116e-01f, -1.630094647e-01f,
+    3.843013942e-01f, 7.449190319e-02f, 1.416919529e-01f, -3.998808563e-03f,
+    -1.171087101e-02f, -4.070099071e-02f, 5.386088043e-02f, 1.636709869e-01f,
+    -1.581997126e-01f, 7.687538862e-03f, -1.879126281e-01f, 8.919514716e-02f,
+    -4.687673226e-02f, -1.200403925e-02f, -5.482066795e-02f, -1.838337779e-01f,
+    -1.280306256e-03f, 1.954650432e-01f, 6.131606922e-02f, 2.280783802e-01f,
+    -2.396359108e-02f, -1.859983206e-01f, 1.930161379e-02f, -1.980145425e-01f,
+    -3.722212464e-02f, 1.296126097e-02f, -4.371470213e-02f, -1.059083939e-01f,
+    1.494946424e-02f, 4.482766986e-02f, -1.532400679e-02f, -1.992581785e-01f,
+    -6.531906873e-02f, 1.185991801e-03f, -2.534640394e-02f, 1.061108336e-01f,
+    6.332354248e-02f, -7.975054532e-02f, 1.939394176e-01f, -1.494468153e-01f
+};
+
+static const float MAGIC_WAND_aot_stage1_bias[32] =
+{
+    -3.054328077e-02f, 8.897615969e-02f, 5.601999164e-02f, -6.336136907e-02f,
+    5.299931858e-03f, -7.973172516e-02f, 4.192189872e-02f, -1.906442107e-03f,
+    -2.485889569e-02f, -6.241760775e-02f, -2.230417542e-02f, -1.027392596e-01f,
+    5.897330120e-03f, 4.562980682e-02f, -5.096909031e-02f, 5.860209838e-02f,
+    -6.363201141e-02f, -1.287318766e-01f, 1.728342101e-02f, 7.150036097e-02f,
+    5.667730793e-02f, -3.536098078e-02f, -4.168524966e-02f, -1.005646065e-01f,
+    3.940408304e-02f, -6.816122681e-02f, 4.269850254e-02f, 1.333986130e-02f,
+    -1.523228269e-02f, 1.729635894e-02f, -9.814310074e-02f, -8.329971880e-02f
+};
+
+static const float MAGIC_WAND_aot_stage2_weights[512] =
+{
+    4.506543279e-01f, 4.897034764e-01f, 5.963501334e-02f, 4.951879382e-01f,
+    -5.873680115e-01f, -1.485704184e-01f, -3.512149677e-02f, 1.306026876e-01f,
+    4.438808858e-01f, 6.266222000e-01f, -5.188427866e-02f, -2.594896257e-01f,
+    5.566912293e-01f, -1.397225112e-01f, 7.131324708e-02f, -4.534662068e-01f,
+    4.548778534e-01f, 3.867460787e-01f, -3.468804359e-01f, -1.696696877e-01f,
+    1.083017141e-01f, -3.634216031e-03f, -8.532431722e-02f, 7.481714338e-02f,
+    1.505573839e-01f, 9.471056983e-03f, 1.856391132e-01f, -7.922592014e-02f,
+    2.255640924e-02f, 2.229800820e-01f, -2.472348362e-01f, -3.318141773e-02f,
+    -1.150043234e-01f, -4.671770036e-01f, -3.298255205e-01f, 2.382653207e-01f,
+    1.313021630e-01f, 4.010012746e-02f, 4.057504833e-01f, -3.911530375e-01f,
+    -3.044098616e-01f, -1.775662452e-01f, 3.667257726e-01f, 2.698416412e-01f,
+    -5.016172677e-02f, -1.131965294e-01f, 5.103160143e-01f, -1.628420055e-01f,
+    5.629084706e-01f, 1.179455966e-01f, 2.259138376e-01f, -2.158875167e-01f,
+    -5.762091279e-02f, 4.527347684e-01f, -1.345414389e-02f, -1.132282242e-02f,
+    2.208143007e-03f, 2.895552516e-01f, 1.760618389e-01f, 4.651479423e-01f,
+    1.713508070e-01f, 1.592651755e-01f, 9.523725510e-02f, 3.204735219e-01f,
+    -6.984927505e-02f, -6.402973086e-04f, 7.992606610e-02f, -1.167909577e-01f,
+    5.215198398e-01f, 2.007017136e-01f, 2.420660108e-02f, 3.766199946e-02f,
+    1.758002788e-01f, -3.484988213e-01f, -2.227134258e-01f, -1.893998086e-01f,
+    -3.676191568e-01f, 2.212279141e-01f, -7.347301394e-02f, 3.898861110e-01f,
+    6.853542477e-02f, -3.823927939e-01f, 6.751538515e-01f, -1.568035930e-01f,
+    -5.373052787e-03f, 8.080353588e-02f, -3.449146077e-02f, -3.208872974e-01f,
+    3.297360539e-01f, 2.630401552e-01f, 2.179164886e-01f, 5.571454763e-01f,
+    8.203660697e-02f, -4.533192609e-03f, -2.874898724e-03f, -3.130275309e-01f,
+    4.018660486e-01f, -4.713204503e-02f, 4.643081427e-01f, 1.295012981e-01f,
+    1.516183764e-01f, 1.782064736e-01f, 2.717888951e-01f, 2.129667103e-01f,
+    4.574418068e-01f, 2.701614201e-01f, -5.638413429e-01f, -1.600716114e-01f,
+    -9.515996277e-02f, 2.456152737e-01f, -6.874982119e-01f, 3.536996245e-01f,
+    3.603485525e-01f, -5.054790992e-03f, -3.996868804e-02f, 2.302038074e-01f,
+    3.624905050e-01f, -4.813434184e-01f, -4.348886013e-01f, 1.715121269e-01f,
+    2.163855284e-01f, -1.461508721e-01f, 1.728747189e-01f, 2.719052602e-03f,
+    -7.258889079e-02f, -2.219456248e-02f, -6.407201290e-01f, -4.514144957e-01f,
+    1.863398999e-01f, 2.557655275e-01f, 3.010803461e-01f, -1.199424043e-01f,
+    -2.186320424e-01f, -1.835687310e-01f, -2.686840110e-02f, 2.731978297e-01f,
+    8.398835361e-02f, -2.560173869e-01f, -7.583081126e-01f, -2.363705784e-01f,
+    2.573082149e-01f, 1.255150437e-01f, -5.223505497e-01f, -1.516392529e-01f,
+    -4.509581923e-01f, 1.530771255e-01f, -6.201837678e-03f, 5.527413487e-01f,
+    -3.977506235e-02f, -4.777984023e-01f, 1.113131568e-01f, -6.961279362e-02f,
+    1.360995173e-01f, -1.535031199e-02f, 2.160283625e-01f, -6.285987496e-01f,
+    3.538515568e-01f, -5.453503132e-02f, -2.627710402e-01f, -2.146785408e-01f,
+    5.894486234e-02f, 1.057298202e-02f, 3.225943148e-01f, 1.768605411e-02f,
+    2.711702585e-01f, -4.368632734e-01f, -3.189534545e-01f, 4.269262552e-01f,
+    3.707290813e-02f, 1.585696787e-01f, 3.772656024e-01f, 3.586040437e-01f,
+    5.118411779e-02f, 4.906689823e-01f, -5.256887525e-03f, -2.248166353e-01f,
+    -2.165770680e-01f, 4.625233114e-01f, -3.617292345e-01f, 2.377399802e-01f,
+    -5.460318923e-02f, -3.255183995e-01f, 3.545021117e-01f, 7.919955254e-02f,
+    -4.637549520e-01f, -3.715252876e-01f, -1.972380131e-01f, -5.583462715e-01f,
+    -3.871398866e-01f, -2.596255839e-01f, 2.714339197e-01f, 4.051267803e-01f,
+    5.944659561e-02f, 1.222901866e-01f, 1.804162264e-01f, -1.949795783e-01f,
+    3.687439486e-02f, -3.201712668e-01f, 9.348681569e-02f, -1.554057896e-01f,
+    -1.920753121e-01f, -1.641877741e-01f, 6.715970635e-01f, 1.591812670e-01f,
+    -9.292381257e-02f, 1.555717885e-01f, 3.327523470e-01f, 6.613624096e-02f,
+    -4.775041342e-01f, 3.781844974e-01f, -1.571254581e-01f, -2.646762729e-01f,
+    -4.069042802e-01f, 2.434310019e-01f, 2.568547130e-01f, 7.882665843e-02f,
+    -2.220454961e-01f, 2.731960081e-02f, -2.990735471e-01f, -1.266739815e-01f,
+    8.815538883e-02f, -1.203448996e-01f, 1.372900009e-01f, 2.288464159e-01f,
+    -8.105457574e-02f, 1.709095538e-01f, -8.026372641e-02f, -6.600533612e-03f,
+    1.644010395e-01f, 1.188112795e-01f, -6.453564763e-02f, 4.091831446e-01f,
+    2.474401146e-01f, -7.715033740e-02f, -5.541236699e-02f, -2.520211041e-01f,
+    3.143391907e-01f, -5.226066113e-01f, -2.849768698e-01f, 3.389453888e-01f,
+    -6.222479045e-02f, -1.804290116e-01f, 3.166042268e-01f, -2.581029236e-01f,
+    3.607295156e-01f, 4.498065412e-01f, -4.798752666e-01f, 4.735337496e-01f,
+    5.271637440e-01f, -2.533312440e-01f, 1.323024835e-02f, 3.069308028e-02f,
+    -2.330414206e-01f, 2.914916277e-01f, -7.272112966e-01f, -2.278501987e-01f,
+    1.157982945e-01f, 2.158256173e-01f, 2.548983991e-01f, -7.866168022e-02f,
+    2.721863426e-02f, -5.035120249e-01f, -2.386774868e-01f, 8.013743907e-02f,
+    -4.862140492e-02f, 1.217883751e-01f, 1.679945737e-01f, 5.416079760e-01f,
+    -9.093573317e-03f, 5.420120358e-01f, 8.815748990e-02f, 3.420879245e-01f,
+    -1.516034305e-01f, 1.744441688e-01f, 1.750584096e-01f, -1.084982790e-02f,
+    -3.129894435e-01f, -1.250348538e-01f, 3.046014011e-01f, 1.567494571e-01f,
+    -3.090176880e-01f, -2.275274843e-01f, -1.656077802e-01f, -5.749858618e-01f,
+    8.884794079e-03f, -2.579909563e-01f, 1.202544868e-01f, -1.309906691e-01f,
+    -2.006165236e-01f, -3.256997764e-01f, -1.254367232e-01f, -3.575754464e-01f,
+    6.758746505e-02f, -1.701082438e-01f, 4.955321252e-01f, -1.220160350e-02f,
+    -3.265878856e-01f, -4.294558465e-01f, -3.782942295e-01f, -2.052895143e-04f,
+    -1.859757453e-01f, 3.479822278e-01f, 3.441179693e-01f, 2.074790895e-01f,
+    8.886040002e-02f, -3.926355541e-01f, 5.300047994e-01f, -4.357868060e-02f,
+    4.326171577e-01f, -3.765989244e-01f, 8.386133611e-02f, -2.883729935e-01f,
+    2.654070854e-01f, -1.630559936e-02f, 4.897038452e-03f, -1.188265085e-01f,
+    2.867654562e-01f, 1.680817455e-01f, 2.282058597e-01f, 1.476545930e-01f,
+    1.706351489e-01f, -1.574876159e-01f, 2.136050463e-01f, 1.391530633e-01f,
+    4.999250174e-02f, -1.965806782e-01f, 3.242879733e-02f, -1.741723157e-02f,
+    1.638366431e-01f, 4.510674179e-01f, 1.659975797e-01f, 2.455279082e-01f,
+    2.470243536e-02f, 1.010114327e-01f, 3.453518450e-01f, -5.480937362e-01f,
+    -7.875993103e-02f, 7.297639847e-01f, -5.555201173e-01f, 1.600054950e-01f,
+    -6.220472455e-01f, 1.445385814e-01f, -2.103504725e-02f, 7.389162481e-02f,
+    -3.381908834e-01f, 3.063319921e-01f, -2.965380251e-01f, -5.146667734e-02f,
+    -1.103751138e-01f, -5.865040421e-02f, 4.271390289e-02f, -2.163359821e-01f,
+    -1.965028197e-01f, 2.847997248e-01f, -2.162210643e-01f, -9.298877791e-03f,
+    3.918837905e-01f, -2.904413268e-02f, -2.221284248e-02f, -3.140264452e-01f,
+    1.169640338e-03f, -3.635287881e-01f, 1.770966798e-01f, 3.300379217e-01f,
+    7.955703139e-02f, 2.747021019e-01f, 3.655333221e-01f, 2.382017374e-01f,
+    -5.533490181e-01f, 3.032857552e-02f, 9.618812241e-03f, -2.347400337e-01f,
+    -3.828701079e-01f, 2.743937671e-01f, 6.518753618e-02f, -2.579172552e-01f,
+    -5.513180792e-02f, -2.381250113e-01f, -3.750833571e-01f, 3.636802733e-01f,
+    -8.058309555e-02f, -1.888713837e-01f, 5.306273699e-01f, 1.463938951e-01f,
+    4.544744492e-01f, -1.378535777e-01f, -2.964086235e-01f, 7.594332099e-01f,
+    -1.299818754e-01f, 9.656675160e-02f, -3.502404392e-01f, 7.895084471e-02f,
+    2.086464614e-01f, 1.688264497e-02f, 3.778606057e-01f, 4.438108802e-01f,
+    3.138118088e-01f, -2.445832640e-01f, 2.436658293e-01f, -1.191286594e-01f,
+    2.661234438e-01f, 1.827559173e-01f, -2.122001648e-01f, -1.903508902e-01f,
+    1.380754821e-02f, 1.616908312e-01f, -2.086860687e-01f, 2.117564380e-01f,
+    -2.642725408e-01f, 4.230969846e-01f, -3.917225003e-01f, 3.489147723e-01f,
+    -3.593411446e-01f, 5.293768048e-01f, -7.875352167e-03f, 8.197338879e-02f,
+    -4.792434573e-01f, -2.060381137e-02f, -1.459690481e-01f, -4.430733621e-01f,
+    4.143344164e-01f, -4.980438203e-02f, 4.364920259e-01f, -4.593768120e-01f,
+    -2.492616475e-01f, -3.733148575e-01f, -1.131328568e-01f, 3.462233394e-02f,
+    -3.330776095e-01f, 3.078527749e-01f, 2.533154190e-01f, 4.723368883e-01f,
+    -3.186112940e-01f, -5.434788465e-01f, 3.569253981e-01f, 8.558709174e-02f,
+    -2.923255265e-01f, -1.698174924e-01f, 1.422415674e-01f, -4.349173978e-02f,
+    3.120667636e-01f, -1.718415469e-01f, 1.304917485e-01f, -7.979458570e-02f,
+    3.655774891e-01f, -3.235636950e-01f, 1.433262825e-01f, 2.370804176e-02f,
+    -2.125676721e-01f, 1.190903634e-01f, -4.330956563e-02f, 2.338057309e-01f,
+    -2.199611962e-01f, -5.242773145e-02f, 2.738954127e-02f, 2.948116362e-01f,
+    3.833521903e-01f, 1.573155224e-01f, -2.173142731e-01f, -4.163138568e-02f,
+    -1.669165678e-02f, -4.124636054e-01f, 1.798463799e-02f, -6.610076874e-02f,
+    5.572202057e-02f, -2.399196923e-01f, 1.417761147e-01f, -3.180217743e-02f,
+    2.585443854e-01f, -7.441903651e-02f, -2.921802700e-01f, 1.254063938e-02f,
+    -1.888452917e-01f, -2.138274014e-01f, -9.390539676e-02f, -2.727448046e-01f,
+    -3.484956026e-01f, -3.595824540e-02f, -1.105086282e-01f, 2.177476138e-02f,
+    9.850206971e-02f, -2.785750926e-01f, -2.008438408e-01f, 4.775316417e-01f,
+    1.927998811e-01f, 3.032337427e-01f, -3.863019347e-01f, -4.885270298e-01f,
+    -2.730364725e-02f, 1.624839157e-01f, 5.043867230e-01f, -9.265259653e-02f,
+    -7.084868103e-02f, -2.782407999e-01f, 4.294251502e-01f, 5.582916737e-02f,
+    1.696197689e-01f, 2.520545386e-02f, -1.609751198e-04f, -1.772623807e-01f,
+    1.143653989e-01f, 7.199002504e-01f, 2.621516287e-01f, 3.430829942e-01f,
+    2.532892525e-01f, -4.518041015e-02f, -2.935737669e-01f, 6.083828211e-01f,
+    2.412004322e-01f, 3.939053044e-02f, 2.080578543e-02f, 2.768437266e-01f
+};
+
+static const float MAGIC_WAND_aot_stage2_bias[16] =
+{
+    1.088613272e-01f, -2.628885582e-02f, 8.065516502e-02f, 1.108818054e-01f,
+    1.140600443e-01f, 1.143769640e-02f, -2.646198310e-02f, 6.434828043e-02f,
+    6.034101546e-02f, 1.006205231e-01f, -5.249918997e-02f, 1.321117394e-02f,
+    -8.098833263e-03f, 7.344834507e-02f, -7.339167874e-03f, -1.139041036e-01f
+};
+
+static const float MAGIC_WAND_aot_stage3_weights[64] =
+{
+    -1.205534697e+00f, 2.712824345e-01f, 3.123933077e-01f, -8.090502024e-01f,
+    -1.558832079e-01f, 2.251253575e-01f, 5.638442636e-01f, -9.430866241e-01f,
+    2.319181561e-01f, 8.914406300e-01f, -1.009193540e+00f, 7.564573288e-01f,
+    -8.907735348e-01f, 9.118837118e-01f, 1.169396862e-01f, 2.040909529e-01f,
+    -3.011912107e-02f, -9.969226122e-01f, 6.061891466e-02f, 1.158660799e-01f,
+    9.247779846e-01f, 4.142739773e-01f, -5.060704947e-01f, -3.143408000e-01f,
+    4.009812474e-01f, 2.355171591e-01f, 4.556880891e-02f, -7.537484169e-01f,
+    -2.457897067e-01f, -3.618728518e-01f, -6.210128069e-01f, -8.030242920e-01f,
+    -2.573468089e-01f, 1.903110892e-01f, -8.987125158e-01f, -8.456911445e-01f,
+    -6.556719542e-01f, 4.198042154e-01f, 7.574848533e-01f, -7.779583931e-01f,
+    2.532685697e-01f, -9.294056296e-01f, 8.840883970e-01f, 3.302077055e-01f,
+    4.057285190e-01f, -1.176236033e+00f, 4.259569347e-01f, 4.684278071e-01f,
+    -2.054486722e-01f, 4.537917376e-01f, 4.026246667e-01f, -7.254652679e-02f,
+    -4.982456863e-01f, -7.038149834e-01f, -7.909975648e-01f, 1.314332932e-01f,
+    -8.047851324e-01f, 4.735105932e-01f, -3.627528846e-01f, -4.171096683e-01f,
+    4.231410921e-01f, -4.313718677e-01f, -2.229588479e-01f, 5.556860566e-01f
+};
+
+static const float MAGIC_WAND_aot_stage3_bias[4] =
+{
+    -3.373950422e-01f, 1.736862808e-01f, -2.987496555e-02f, 1.398702711e-01f
+};
+
+/* Largest dot product so far of the receptive field with the weights of each
+ * channel, summed in the order of the TFLM reference kernels */
+static void aot_dot_max(const float *input, uint32_t rows, uint32_t length, uint32_t stride, const float *weights,
+                        uint32_t channels, float *acc)
+{
+    for (uint32_t c = 0; c < channels; c++)
+    {
+        const float *row = input;
+        float total = 0.0f;
+
+        for (uint32_t r = 0; r < rows; r++)
+        {
+            for (uint32_t i = 0; i < length; i++)
+            {
+                total += row[i] * weights[i];
+            }
+            row += stride;
+            weights += length;
+        }
+        if (total > acc[c])
+        {
+            acc[c] = total;
+        }
+    }
+}
+
+/* Softmax in the order of the TFLM reference kernel */
+static void aot_softmax(const float *input, float *output, uint32_t size, float beta)
+{
+    float max = -FLT_MAX;
+    float sum = 0.0f;
+
+    for (uint32_t i = 0; i < size; i++)
+    {
+        max = (max < input[i]) ? input[i] : max;
+    }
+    for (uint32_t i = 0; i < size; i++)
+    {
+        output[i] = expf((input[i] - max) * beta);
+        sum += output[i];
+    }
+    for (uint32_t i = 0; i < size; i++)
+    {
+        output[i] = output[i] / sum;
+    }
+}
+
+/* CONV_2D RELU, MAX_POOL_2D 3x3, MUL, ADD: 128x6x1 -> 42x2x16 */
+static void MAGIC_WAND_aot_stage0(const float *input, float *output)
+{
+    float acc[16];
+
+    for (uint32_t y = 0; y < 42u; y++)
+    {
+        for (uint32_t x = 0; x < 2u; x++)
+        {
+            for (uint32_t c = 0; c < 16u; c++)
+            {
+                acc[c] = -FLT_MAX;
+            }
+            for (uint32_t dy = 0; dy < 3u; dy++)
+            {
+                for (uint32_t dx = 0; dx < 3u; dx++)
+                {
+                    aot_dot_max(&input[y * 24u + dy * 8u + x * 3u + dx], 3u, 3u, 8u,
+                                MAGIC_WAND_aot_stage0_weights, 16u, acc);
+                }
+            }
+            for (uint32_t c = 0; c < 16u; c++)
+            {
+                float value = acc[c] + MAGIC_WAND_aot_stage0_bias[c];
+                value = (value < 0.000000000e+00f) ? 0.000000000e+00f : value;
+                value = value * MAGIC_WAND_aot_stage0_mul0[c];
+                value = value + MAGIC_WAND_aot_stage0_add1[c];
+                output[y * 64u + x * 16u + c + 80u] = value;
+            }
+        }
+    }
+}
+
+/* CONV_2D RELU, MAX_POOL_2D 3x1, MEAN: 42x2x16 -> 1x1x32 */
+static void MAGIC_WAND_aot_stage1(const float *input, float *output)
+{
+    float acc[32];
+    float sum[32];
+
+    for (uint32_t c = 0; c < 32u; c++)
+    {
+        sum[c] = 0.0f;
+    }
+    for (uint32_t y = 0; y < 14u; y++)
+    {
+        for (uint32_t x = 0; x < 2u; x++)
+        {
+            for (uint32_t c = 0; c < 32u; c++)
+            {
+                acc[c] = -FLT_MAX;
+            }
+            for (uint32_t dy = 0; dy < 3u; dy++)
+            {
+                aot_dot_max(&input[y * 192u + dy * 64u + x * 16u], 3u, 48u, 64u,
+                            MAGIC_WAND_aot_stage1_weights, 32u, acc);
+            }
+            for (uint32_t c = 0; c < 32u; c++)
+            {
+                float value = acc[c] + MAGIC_WAND_aot_stage1_bias[c];
+                value = (value < 0.000000000e+00f) ? 0.000000000e+00f : value;
+                sum[c] = sum[c] + value;
+            }
+        }
+    }
+
+    for (uint32_t c = 0; c < 32u; c++)
+    {
+        output[c] = sum[c] / 28.0f;
+    }
+}
+
+/* FULLY_CONNECTED RELU: 1x1x32 -> 1x1x16 */
+static void MAGIC_WAND_aot_stage2(const float *input, float *output)
+{
+    float acc[16];
+
+    for (uint32_t c = 0; c < 16u; c++)
+    {
+        acc[c] = -FLT_MAX;
+    }
+    aot_dot_max(&input[0], 1u, 32u, 32u,
+                MAGIC_WAND_aot_stage2_weights, 16u, acc);
+    for (uint32_t c = 0; c < 16u; c++)
+    {
+        float value = acc[c] + MAGIC_WAND_aot_stage2_bias[c];
+        value = (value < 0.000000000e+00f) ? 0.000000000e+00f : value;
+        output[c] = value;
+    }
+}
+
+/* FULLY_CONNECTED, SOFTMAX: 1x1x16 -> 1x1x4 */
+static void MAGIC_WAND_aot_stage3(const float *input, float *output)
+{
+    float acc[4];
+    float logits[4];
+
+    for (uint32_t c = 0; c < 4u; c++)
+    {
+        acc[c] = -FLT_MAX;
+    }
+    aot_dot_max(&input[0], 1u, 16u, 16u,
+                MAGIC_WAND_aot_stage3_weights, 4u, acc);
+    for (uint32_t c = 0; c < 4u; c++)
+    {
+        float value = acc[c] + MAGIC_WAND_aot_stage3_bias[c];
+        logits[c] = value;
+    }
+
+    aot_softmax(logits, output, 4u, 1.000000000e+00f);
+}
+
+void MAGIC_WAND_aot_run(const float *input, float *output, void *arena)
+{
+    float *buffer0 = (float *)&((uint8_t *)arena)[11264];
+    float *buffer1 = (float *)&((uint8_t *)arena)[0];
+    float *buffer2 = (float *)&((uint8_t *)arena)[11264];
+    float *buffer3 = (float *)&((uint8_t *)arena)[0];
+
+    /* Padding of the CONV_2D input */
+    memset(&buffer0[0], 0, 8u * sizeof(float));
+    memset(&buffer0[1032u], 0, 8u * sizeof(float));
+    for (uint32_t y = 1u; y < 129u; y++)
+    {
+        memset(&buffer0[y * 8u], 0, 1u * sizeof(float));
+        memset(&buffer0[y * 8u + 7u], 0, 1u * sizeof(float));
+    }
+    for (uint32_t y = 0; y < 128u; y++)
+    {
+        memcpy(&buffer0[(y + 1u) * 8u + 1u], &input[y * 6u], 6u * sizeof(float));
+    }
+    MAGIC_WAND_aot_stage0(buffer0, buffer1);
+
+    /* Padding of the CONV_2D input */
+    memset(&buffer1[0], 0, 64u * sizeof(float));
+    memset(&buffer1[2752u], 0, 64u * sizeof(float));
+    for (uint32_t y = 1u; y < 43u; y++)
+    {
+        memset(&buffer1[y * 64u], 0, 16u * sizeof(float));
+        memset(&buffer1[y * 64u + 48u], 0, 16u * sizeof(float));
+    }
+    MAGIC_WAND_aot_stage1(buffer1, buffer2);
+
+    MAGIC_WAND_aot_stage2(buffer2, buffer3);
+
+    MAGIC_WAND_aot_stage3(buffer3, output);
+}
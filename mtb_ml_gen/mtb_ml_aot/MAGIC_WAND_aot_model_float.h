@@ -0,0 +1,45 @@
+/***************************************************************************//**
+* \file MAGIC_WAND_aot_model_float.h
+*
+* \brief
+* Autogenerated with train/aot_compile.py from MAGIC_WAND_float.tflite, this file
+* contains the interface of the MAGIC_WAND model compiled to straight-line C.
+*******************************************************************************/
+
+#ifndef MAGIC_WAND_AOT_MODEL_FLOAT_H
+#define MAGIC_WAND_AOT_MODEL_FLOAT_H
+
+#include <stdint.h>
+
+#define MAGIC_WAND_AOT_QUANTIZED                0
+
+/* Values of the input and output */
+#define MAGIC_WAND_AOT_INPUT_SIZE               768
+#define MAGIC_WAND_AOT_OUTPUT_SIZE              4
+
+/* Bytes of the arena, given by the caller with an alignment of 4, and of the
+ * constant data */
+#define MAGIC_WAND_AOT_ARENA_SIZE               15424
+#define MAGIC_WAND_AOT_CONST_DATA_SIZE          21712
+
+/* Multiply-accumulates of an inference */
+#define MAGIC_WAND_AOT_MACS                     496512
+
+/* Bytes and CRC-16/CCITT-FALSE of the .tflite, to check that another engine
+ * runs the same model */
+#define MAGIC_WAND_AOT_SOURCE_SIZE              25244u
+#define MAGIC_WAND_AOT_SOURCE_CRC               0xCD69u
+
+typedef float MAGIC_WAND_aot_data_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void MAGIC_WAND_aot_run(const float *input, float *output, void *arena);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MAGIC_WAND_AOT_MODEL_FLOAT_H */
@@ -0,0 +1,746 @@
+/***************************************************************************//**
+* \file MAGIC_WAND_aot_model_int8x8.c
+*
+* \brief
+* Autogenerated with train/aot_compile.py from MAGIC_WAND_int8x8.tflite, this file
+* contains the MAGIC_WAND model compiled to straight-line C.
+*******************************************************************************/
+
+#include "MAGIC_WAND_aot_model_int8x8.h"
+
+#include <stdint.h>
+#include <string.h>
+#if defined(__ARM_FEATURE_SIMD32)
+#include <arm_acle.h>
+#endif
+
+static const int8_t MAGIC_WAND_aot_stage0_weights[192] __attribute__((aligned(4))) =
+{
+    6, 127, -112, 108, -55, 75, 46, -57, -14, 0, 0, 0, 35, 127, -44, 21,
+    -46, 88, 85, -25, 53, 0, 0, 0, 7, -75, -61, 83, -106, 127, -119, -19,
+    -109, 0, 0, 0, 66, 119, 127, -23, 85, 20, 40, 77, 37, 0, 0, 0,
+    74, 127, 32, 74, 2, 96, 101, 28, 82, 0, 0, 0, -127, -62, 9, 11,
+    -23, -22, -31, 6, 15, 0, 0, 0, 60, -127, -52, 60, -30, 73, -43, -38,
+    -98, 0, 0, 0, -103, 92, 29, -65, 92, -29, 17, 127, 93, 0, 0, 0,
+    93, -8, -23, 127, -29, 72, -59, 41, -74, 0, 0, 0, 11, -59, 60, 23,
+    -12, -12, -127, 28, -78, 0, 0, 0, 21, -80, 127, 8, 55, -69, -28, 56,
+    37, 0, 0, 0, -3, -98, 48, -18, 14, 32, -74, -31, -127, 0, 0, 0,
+    13, 87, 113, 5, 102, 16, 41, 127, 24, 0, 0, 0, 10, -45, 35, -127,
+    2, -118, 63, -93, -47, 0, 0, 0, 91, -126, 7, 60, 93, 55, -65, 127,
+    -127, 0, 0, 0, 83, -14, 3, 40, -127, 105, -21, 32, -30, 0, 0, 0
+};
+
+static const int32_t MAGIC_WAND_aot_stage0_bias[16] =
+{
+    219, -2534, 1047, 4208, 282, 1264, 805, 3118,
+    3707, 15, 808, 200, -3, 5509, 6066, 962
+};
+
+static const int32_t MAGIC_WAND_aot_stage0_multiplier[16] =
+{
+    1849794848, 1966814935, 1386535275, 1747211857, 1264061234, 1153678424, 1338672786, 1551131299,
+    1339781802, 1319326298, 2097304761, 1246347787, 1277400715, 1470059139, 1606902439, 1743789400
+};
+
+static const int8_t MAGIC_WAND_aot_stage0_shift[16] =
+{
+    -8, -8, -8, -8, -7, -7, -8, -8, -7, -7, -8, -7, -7, -8, -8, -8
+};
+
+static const int32_t MAGIC_WAND_aot_stage0_mul0[16] =
+{
+    125, 255, 151, 182, 199, 152, 184, 149,
+    169, 164, 191, 157, 141, 141, 174, 202
+};
+
+static const int32_t MAGIC_WAND_aot_stage0_add1[16] =
+{
+    -4914970, -2029116, -5095336, -7259727, -2750580, -6673538, -4509147, -7845916,
+    -11498325, -2119299, -4554238, -2615305, -2029116, -9920123, -9784849, -5456068
+};
+
+static const int8_t MAGIC_WAND_aot_stage1_weights[4608] __attribute__((aligned(4))) =
+{
+    -7, -28, -1, -115, -58, -17, -2, 12, -97, 14, 81, 127, -105, 23, -26, -11,
+    -61, -36, 38, -64, -13, -11, 1, 1, -10, 92, 63, 51, -76, -77, 8, -4,
+    42, 30, 18, -67, -48, 53, 101, 68, 18, 32, 7, 17, -75, -81, 11, 17,
+    62, -12, 11, -55, -7, 21, 11, 19, 28, 44, 80, 37, -29, 61, 56, 59,
+    -15, -3, 35, -75, -20, 29, 34, 99, -38, 46, 26, 88, -37, -5, 2, -8,
+    18, 19, 6, -71, -93, 36, 31, 48, 52, 8, -17, 3, -112, -96, 26, -12,
+    15, 71, 61, -12, 57, 55, 45, 116, 27, 25, 85, 38, -1, 26, 96, 88,
+    34, 70, 94, -25, -18, 85, 66, 121, -32, 42, 55, -6, -52, 23, 34, 87,
+    12, 13, 23, -72, -71, 73, 53, -14, 84, 56, -28, -76, -110, -120, -4, 32,
+    9, -5, -20, 34, -29, 16, 18, 18, -127, 16, 39, 35, 47, 0, 16, -9,
+    11, 18, -46, 9, 1, -10, -6, 31, 1, 34, 16, -30, 16, 28, -19, 20,
+    7, -25, -23, -4, 40, -12, -13, -40, 18, 25, -34, -37, 2, -21, -21, 27,
+    8, -22, -12, -11, 35, -20, 46, -5, -118, 30, 75, 53, -6, -4, 33, -15,
+    -7, 2, -73, -5, 8, -8, -11, 37, -4, 40, 21, 17, 35, 43, 20, 0,
+    -9, -13, -8, -34, 60, -1, -3, -45, 46, 10, -29, -26, -33, -2, -29, 39,
+    2, 3, -14, -18, 18, 2, 2, -1, -126, 23, 37, 36, 4, 1, 33, 3,
+    4, -16, -64, -7, -17, -24, -8, 27, -29, 51, 1, -35, -18, -3, 9, -19,
+    -4, -17, -9, 41, 68, 0, -19, -30, 68, 15, -24, -57, 12, 21, -34, 29,
+    -15, -39, -29, 25, 50, -3, 11, 10, -111, -34, -3, 9, 37, -28, -16, -54,
+    -9, 10, -20, 43, 28, -17, -12, 7, -10, 18, -9, -52, 10, 53, 8, -11,
+    10, 3, 10, 6, 21, 3, -44, 4, 23, 24, -60, -10, -6, -12, -22, -20,
+    -5, -29, -19, -30, 27, 13, 20, 13, -127, 4, 18, 42, -6, -49, -1, -42,
+    -10, -1, -34, 44, 4, -3, 11, 39, -44, 36, 18, 13, 14, 4, 20, 6,
+    40, -6, -42, 27, 54, -2, -16, -27, 78, 18, -9, -46, -13, 39, -40, 1,
+    -5, -13, -16, -14, -6, -3, 30, 65, -76, 17, 57, 53, 26, -18, 17, -8,
+    -4, 23, -47, -17, -14, 17, 15, 59, -35, 63, 25, 35, -39, -36, 3, -10,
+    -15, 9, -52, -29, 49, -5, 2, -20, 59, 27, -48, -33, -26, -13, 3, 32,
+    12, 30, 2, 5, -6, 56, 30, -12, 120, -44, -86, -54, 27, -3, -7, 45,
+    43, 25, 49, 34, 40, 18, 18, 42, 40, -10, -28, -2, 11, 18, 14, 68,
+    34, -10, 25, -52, -32, 26, 5, 1, -15, 5, -32, -19, -65, -67, 4, -11,
+    -45, -9, -40, 0, -13, -11, -12, -12, 127, 6, -46, -1, 9, -13, -44, 13,
+    -11, 21, 25, 27, 56, 36, 5, -23, 8, -4, -28, 25, 4, 14, -19, 14,
+    3, 22, 46, -60, -25, -16, 21, 5, -33, -39, -32, -29, -50, -44, 8, 3,
+    -89, -46, 14, -22, -43, -42, -63, -30, 104, -50, 0, 17, 29, -16, -62, -51,
+    6, 6, -15, 17, 14, 4, 0, 35, 47, 14, -49, -33, 28, 17, 11, -21,
+    9, -16, 53, -52, -14, 3, -12, 37, -55, -21, -59, -23, -68, -44, 2, 0,
+    -28, -5, 47, -4, -42, -6, -37, -72, 118, -19, 29, 15, -55, -33, 6, -2,
+    -49, -94, 28, 35, -33, -73, -19, -47, 15, 76, 44, 103, 39, 52, -32, -86,
+    -79, -56, -48, 20, -37, -11, -20, -19, -78, -43, 4, 0, 23, -78, -25, -90,
+    14, -8, -1, -9, -32, -60, -51, -58, 127, 56, -16, 16, -15, 10, -56, 12,
+    -34, -45, 8, 84, 7, -76, -69, -28, 1, 31, 73, 33, 39, 25, -32, -55,
+    -5, -23, -8, -5, -38, -19, 15, -42, -47, -54, 64, 70, 1, -32, -21, -45,
+    -27, -18, -4, 6, -74, -55, -56, -88, 101, 13, -7, 7, -39, 31, -25, -13,
+    -19, -48, 16, 99, -35, -41, -42, -51, 6, 39, 34, 45, 40, 84, -30, -43,
+    -11, 12, 9, -97, -45, -60, -5, -47, -41, -11, 50, 86, -40, -19, -6, 14,
+    -53, 22, -13, 28, 101, -58, -15, -55, 74, -62, -72, -99, 20, -79, -1, 14,
+    17, 38, -71, -16, 3, -6, -9, -9, -16, -31, -22, -47, -39, 39, -34, 29,
+    -20, -10, 45, -106, -118, 62, 67, -26, -30, -30, 24, -33, -60, -13, 33, 2,
+    32, 23, 21, -56, 63, 25, 24, -23, 127, -101, -96, -31, 77, -20, -12, 49,
+    -74, 72, -33, -52, 42, 96, 6, -20, -38, -55, -13, -31, -13, 10, -31, -26,
+    -8, 39, 24, -49, -54, 49, 36, 34, -68, 3, -13, -88, -58, -91, 25, 29,
+    -3, -16, -25, -45, 113, -55, 31, -66, 89, -40, -110, -98, 55, 34, 23, 16,
+    -35, 32, -7, -23, -36, 87, -46, -43, 41, -46, 15, -1, 6, -7, -34, 35,
+    18, 22, -20, -51, -110, 31, 60, 74, -55, -52, -92, -75, 10, -51, -46, 16,
+    13, -57, 26, 43, 13, -68, -39, 18, 76, 43, 51, 34, 5, 58, -48, -36,
+    -3, -25, -25, -77, -46, 7, 23, -54, 13, -61, 28, 18, -4, -65, 26, 32,
+    3, -21, 2, 114, 60, -11, 15, 1, -10, -11, 40, 5, 61, 23, 32, 10,
+    25, -55, 19, -13, 26, -76, -39, 26, 48, -12, 26, 26, -13, 27, -4, -37,
+    25, -31, -29, -54, -46, -5, -10, -46, 13, 5, 30, -5, -43, 0, 0, -20,
+    -9, -17, -15, 127, 46, -26, 16, -23, -33, 26, 20, -6, 80, 25, -27, -17,
+    9, -49, 50, 33, 5, -48, -17, 52, 2, -4, 23, -16, 49, 91, 3, -30,
+    -18, -28, -56, -86, -5, 8, 20, -61, 37, -40, 25, 37, -43, -41, -1, -5,
+    -2, 8, 2, 119, 68, -3, -18, 2, 6, 11, 14, -9, 93, 48, 32, -29,
+    13, -23, 18, -15, 90, -18, -9, 10, -96, 23, 50, -3, -11, -54, -21, -58,
+    0, 0, -82, -15, -11, -12, 33, 34, 19, 51, 86, 63, -8, 4, 16, -1,
+    23, 45, 8, 8, -10, 18, -9, 25, 47, 40, -43, -33, -28, -60, 14, 24,
+    6, 13, -35, -26, 127, -29, 40, 8, -94, 10, 68, 38, 21, -26, 8, -45,
+    -16, 14, -78, -39, -35, 2, 18, 52, -7, 88, 51, 32, 7, 46, 34, 3,
+    11, 12, -34, -71, 8, 43, 50, -8, 56, 37, -10, -77, -82, -59, -20, 24,
+    -35, -7, -7, -68, 16, 15, 39, -30, -100, 31, 38, 40, -27, -32, 5, 16,
+    -24, 20, -83, -7, -30, 4, 21, 86, -37, 53, 25, 32, 44, 24, 27, -12,
+    16, 13, -36, -64, 61, 26, -2, 24, 64, 34, -84, -91, -48, -38, -23, 37,
+    5, -17, -9, -71, 56, -73, 18, -93, -77, 59, 67, 83, -38, -17, -54, -61,
+    -9, 23, 35, -27, -47, 17, 17, 53, -12, 5, 120, 127, -37, 58, 57, 7,
+    35, 22, 64, -70, -90, -17, 47, 31, -8, 60, -18, -26, -6, -110, 9, 37,
+    -3, 10, 6, -16, -30, 29, 26, -46, -110, 66, 77, 87, -30, 5, 4, -13,
+    -44, 0, -26, -71, -48, 3, 33, 33, -39, -10, 86, 49, 1, 52, 57, 39,
+    -13, 53, -37, -95, -81, 52, 16, 104, 51, 72, -54, -8, -89, -91, 32, 68,
+    -12, 65, -15, -27, 24, 54, 31, -11, -82, 38, 81, 80, -40, -43, 43, 28,
+    -9, 15, -16, -8, -70, 42, 43, 68, -13, 57, 71, 29, 39, 47, 47, 50,
+    27, 65, 11, -106, 5, 29, 34, 50, 33, -18, -76, -40, -88, -89, -38, 94,
+    10, 24, -33, -78, -20, 38, 9, -57, -25, 22, 100, 53, -81, -19, 10, -1,
+    -27, 9, 18, -87, -96, 14, 17, -32, -40, 68, 82, 99, -58, -14, 32, -19,
+    15, 30, 47, -56, -91, 24, 93, 96, -19, 71, 13, -24, -85, -33, 53, 11,
+    37, 7, 7, -20, -72, 21, 39, 38, -23, 13, 41, 57, -64, 34, 1, 44,
+    2, 41, 45, -14, -47, 24, 23, 48, -20, 25, 66, 24, -44, -1, 56, -16,
+    36, 18, 42, -122, -53, 7, 37, 56, 16, 25, -26, -43, -12, -55, 39, 33,
+    79, 32, 64, 6, -61, 62, 55, 116, 42, -2, 17, 40, 32, 75, 33, 77,
+    49, 62, 59, 17, 9, 56, 59, 127, 42, 2, -68, -85, -48, 49, 22, 83,
+    43, 50, 70, -84, 46, 55, 11, -5, 42, -29, -44, -12, -63, -13, 37, 16,
+    -77, -76, -76, 80, 58, -54, -100, -45, -17, -66, -30, -56, 72, 60, -95, -77,
+    -43, -34, -36, 46, 44, -32, -79, -55, -23, -31, -11, -28, 43, 5, -47, -34,
+    2, -5, -6, -7, 19, -20, -24, -16, 28, -3, 1, -34, -12, 43, -44, -25,
+    -57, -90, -127, 41, 14, -68, -116, -69, 8, -14, 47, 14, 55, 18, -80, -52,
+    -33, -40, -31, 11, -28, -52, -40, -49, -26, -10, 9, -28, 28, -20, -34, -57,
+    9, -13, -8, 15, -15, -9, 18, -37, -25, -22, 3, 4, -20, 19, -19, -37,
+    -84, -69, -63, -8, -19, -79, -54, -105, -22, 33, 92, 69, -13, -40, -83, -57,
+    -44, -46, -31, -8, -34, -24, -15, -13, -52, 15, 52, 41, -13, -61, -3, -59,
+    2, -18, 30, -13, -82, -4, 26, 19, -57, -43, -5, -41, -2, 19, 0, -37,
+    101, 59, 97, -6, -51, 98, 71, 44, 56, 52, 39, 66, -59, 2, 82, 54,
+    23, 10, 90, 19, -65, 32, 51, 54, 4, 65, 14, 12, -2, 44, 56, 40,
+    21, 44, 48, -61, -34, 24, 6, -14, 22, -12, -4, 0, 18, -16, 25, 30,
+    29, 38, 87, 30, -65, 104, 59, 104, 44, 19, -70, -67, -37, 15, 30, 100,
+    31, 38, 87, 48, -45, 47, 48, 47, -22, -7, -24, -35, -22, 33, 72, 55,
+    29, 4, 0, -71, 20, 45, 52, -23, 16, 5, 9, -16, 6, -15, 14, 39,
+    73, 73, 107, 75, -60, 70, 53, 54, 57, -27, -103, -127, -2, 63, 95, 49,
+    20, 34, 64, 63, -11, 72, 43, 22, 2, -47, -53, -4, -2, 52, 21, 45,
+    36, 22, 0, -55, 41, 33, -9, 5, 19, 26, 13, -16, -16, 33, -15, 7,
+    47, 42, 5, 31, -10, 62, 43, -10, -15, -17, -63, -89, -12, 38, 64, 9,
+    63, 30, 66, -36, 61, 22, 20, 35, -62, 4, -74, -55, 5, -33, -16, 55,
+    -8, 2, 5, -38, -2, 30, 15, -30, 10, -85, -37, -97, -12, -86, 23, 16,
+    -24, -21, 1, 88, 62, -2, 6, 35, -42, -46, -64, -22, 13, 66, 48, -27,
+    42, 1, 19, 63, 34, -26, -64, -16, -41, -8, -82, -68, 17, 5, -101, 16,
+    21, 27, 39, -20, 62, 3, 5, -15, 24, -57, -71, -124, -77, -81, -6, 34,
+    -7, -73, -55, 78, 103, -83, -49, 0, -52, -2, -63, -44, 44, 97, -7, -57,
+    17, -49, -36, 55, 61, -18, -34, -28, -63, -60, -98, -127, -3, -8, -107, -17,
+    -16, 8, 52, 10, 58, 12, -30, -34, 26, -25, -59, -117, -11, -86, -102, 2,
+    12, 23, -4, 26, -16, 26, 66, 74, -112, -58, -91, -102, 87, -31, 54, 36,
+    -15, 26, -54, 18, 48, 37, 46, 8, 1, -27, -21, 1, 31, 63, 62, 22,
+    -11, -5, -41, -57, 22, 15, -7, -8, 41, -10, 38, 45, -30, 51, -5, 23,
+    60, 44, -32, 47, -21, 50, 55, 13, -127, -58, 5, -32, 41, -66, -4, 5,
+    10, 30, -58, 77, 60, 45, 68, 2, -62, -21, 16, -4, 60, 28, 42, 24,
+    -25, 11, 1, 49, 36, -24, 13, -23, 14, 32, -22, 17, 33, 81, 3, 26,
+    17, 34, 1, -47, -8, 9, 39, 5, -60, -12, 53, 32, -72, -58, -21, 6,
+    3, 36, -42, 5, 39, -4, 78, -6, -63, 6, 12, 32, 39, -36, 78, 25,
+    12, 20, -31, 84, 10, -15, -10, -18, 38, 6, -21, -6, 59, 72, 19, -23,
+    -90, -125, -70, 30, -24, -74, -34, -127, 102, -34, 38, -8, -12, -22, -112, -120,
+    -23, -44, 1, 22, 28, -37, -24, -21, -31, -39, 14, 22, 55, 68, -61, -88,
+    -13, -35, -40, 18, 39, 15, -52, -52, -5, -56, -24, 12, 7, 73, -26, -3,
+    -84, -60, -68, 38, 10, -33, -76, -57, 116, -12, 11, 26, 73, 13, -72, -94,
+    -50, -55, -32, -8, 27, 4, -73, -70, -3, -34, -8, 42, -20, 35, -58, -75,
+    -31, 10, -21, 34, 23, -4, -9, -18, -13, -4, 17, 5, 21, 21, -59, -34,
+    -11, -69, 19, 26, 5, -45, -121, -89, 73, 16, 10, 80, 55, -26, -50, 2,
+    -52, -46, -15, -26, -33, -44, -45, -61, 12, -23, 23, 63, -34, 11, -32, -83,
+    -24, -35, -10, -22, 7, -29, -12, 2, -68, -59, -29, -5, -10, 7, -3, -21,
+    22, -2, 21, -36, -49, -33, 21, -31, 21, 11, -5, 3, -37, 24, -29, 0,
+    17, -2, -23, -12, -6, -29, 22, -5, -4, -24, 0, -25, 17, -18, 30, -18,
+    9, -18, 7, 120, 26, 2, 11, 27, 31, 11, 36, 55, 65, 38, 19, -7,
+    4, -17, -3, -11, -22, -6, 9, -30, 14, 11, -6, -36, -5, -9, -7, -37,
+    -26, -11, -37, -41, 19, 8, 36, 7, -21, -13, -13, -3, 14, -26, 4, -33,
+    -27, 7, -38, 127, 34, -15, 28, 28, -14, 10, 35, 52, 105, 31, 12, -5,
+    -15, -38, -11, -9, -7, -36, -18, -10, 34, 14, -8, -3, -51, 13, -44, -21,
+    -7, 0, -17, -15, -5, -7, 50, -5, -17, -12, -1, 0, 8, -6, 21, 8,
+    -15, -18, -2, 115, 53, -36, 2, -14, 9, 11, 10, 14, 103, 50, 11, -23,
+    10, 38, -18, 45, 97, 23, 24, -38, 93, -16, 30, -21, 86, 20, 25, -1,
+    17, 45, -39, -36, -15, 17, -30, -53, 2, -86, -42, -39, 9, -109, 18, 32,
+    19, 70, 58, -73, -73, 19, 45, 50, -39, -29, -23, -69, -75, -34, 35, 51,
+    19, 2, -45, 13, 127, 14, -17, -47, 68, -76, 0, 72, 74, 11, 14, 16,
+    -43, 31, -47, -74, -19, 23, -28, -13, -53, -39, -71, -27, 5, -78, -3, -17,
+    21, -22, 63, -109, -88, 47, 42, 26, -21, -34, -52, -7, -79, -26, 47, 65,
+    -1, 53, -54, 17, 113, -8, -17, -6, 94, -8, 52, -64, 24, -4, -36, 55,
+    -17, 47, 3, -51, -36, 73, -37, -7, -60, -47, -71, -34, -51, -75, -46, 21,
+    28, 61, 56, -67, -79, 28, -38, -25, 33, -7, 12, -7, -116, -57, 39, -1,
+    25, 19, 43, -119, -63, 23, 59, -20, 55, 53, 72, 97, -122, -15, -1, 86,
+    41, 42, 100, -47, -112, 38, 111, 74, -5, 38, 25, 92, -61, -31, 87, 23,
+    34, 15, 86, -53, -32, -4, 74, 64, -34, 16, -36, -64, -21, -53, 12, 4,
+    1, 48, 74, -16, -48, 79, 48, 35, 50, 20, -12, -33, -69, 75, 4, 66,
+    14, 16, 99, 36, -51, 13, 43, 51, -19, -11, -59, -30, -36, 29, 29, 42,
+    64, 49, 59, -98, 12, 15, 1, 24, -1, -15, -27, -16, 1, -34, -22, 56,
+    70, 16, 50, 87, -29, 32, 22, 88, 13, -42, -106, -127, 29, 125, 33, 93,
+    20, -4, 26, 80, 13, 7, -54, 1, 32, -77, -56, -51, 12, 63, -55, 24,
+    81, 58, 42, -62, 61, 7, -15, -5, 31, -50, -7, -31, 26, -18, -3, 41,
+    17, -26, 27, 21, 38, -29, -29, -9, 46, 5, 7, 18, 4, 66, -16, -10,
+    1, 12, -59, -57, -22, 17, 18, -19, 19, -8, 19, 1, -55, -55, 14, -7,
+    -5, -7, -5, 74, 42, -10, 11, 11, -19, 3, 11, -12, 57, 9, 29, 3,
+    5, -9, 1, 11, -5, -14, -39, -14, 20, 9, 22, 23, -14, 47, 3, -1,
+    -1, 4, -33, -15, -29, 6, 9, -9, 4, -9, 3, -4, -4, -21, 9, -6,
+    21, -2, -7, 111, 43, -21, 9, 12, -17, 20, -5, 21, 77, 29, -7, -13,
+    -7, -3, 21, 31, 21, -16, -31, 10, 5, 29, 10, 7, -5, 73, -10, -7,
+    -3, -5, -44, -52, -30, -1, 13, -41, 25, -44, 10, 24, -48, -48, -25, 3,
+    0, 11, 6, 127, 38, 7, -3, 16, -15, 10, -12, 9, 62, 37, -4, 12,
+    -36, -3, -28, -20, 56, -20, 18, 57, -127, -9, 7, -4, 11, -54, 25, -8,
+    18, 23, -33, -39, 14, 7, -4, 34, -41, 75, 40, 39, 12, 24, -18, 15,
+    4, 12, -30, -19, 6, -13, 16, -28, 28, -1, -38, -26, -50, -37, -28, 0,
+    -15, 9, -18, 11, 66, -2, 9, -3, -104, 1, 4, 25, -9, -49, 29, -28,
+    8, 0, -56, 19, 6, -2, -2, 57, -4, 46, 44, 10, 51, 41, 6, -6,
+    34, -9, -2, -24, 28, -10, -13, -27, 51, 5, -31, -33, -10, 4, 3, 45,
+    -19, -32, -16, -31, 44, -27, 4, 22, -84, -6, 54, 35, -36, -44, 19, -26,
+    0, -5, -72, 20, 30, 13, 4, 56, -38, 16, -27, -16, 15, 36, 21, -7,
+    3, 17, -13, 66, 17, 14, -19, -11, 78, -22, -44, -25, -8, -8, -49, -2,
+    34, -21, 30, 3, 119, -68, 24, 29, -51, -1, -3, 13, 7, -85, -10, 10,
+    20, 29, -70, -8, 22, 43, -11, -7, 31, 57, 69, 36, -25, 54, -24, 19,
+    42, 7, 13, 65, -64, -5, 26, 7, 23, -6, -2, -19, -2, -43, -12, -38,
+    55, -9, 31, -46, 115, -48, 40, -14, -36, 40, 34, 53, -38, -13, 0, -38,
+    5, 22, -63, -35, -4, 59, -31, -8, 59, 14, -18, 12, 7, 8, -25, 59,
+    11, 2, 6, 22, -57, -8, -20, 28, 9, 4, -35, 4, -4, -40, 33, -9,
+    38, -42, 47, -44, 127, -59, -8, 12, -25, -1, 9, 49, 32, -35, -21, -21,
+    -42, 50, -93, -34, 1, 40, -7, -14, 38, -55, 32, 63, 4, 22, -18, 15,
+    36, -37, -3, -4, -62, 6, 19, 32, -23, 1, -38, -3, -70, -55, -13, -36,
+    -38, -53, 22, 66, 50, -35, -96, -54, 70, -13, 8, 48, 17, 30, -94, -43,
+    6, -69, 22, 60, 43, -32, -56, -29, -21, -88, -33, 15, 89, 5, -45, -3,
+    16, -13, 2, -80, -24, 29, -55, -36, -55, -15, -5, -7, -70, 2, 26, 8,
+    -88, 13, -51, 38, 45, -51, -90, -100, 100, 17, 49, 38, 35, 38, -87, -60,
+    -39, -49, -4, 27, 64, -9, -66, 7, -21, -40, -10, 31, 33, -13, -14, -16,
+    -40, -17, -15, -21, -51, 11, -23, -17, -16, -51, -10, 0, -34, 8, -9, -47,
+    -80, -12, -31, 44, 2, -32, -77, -78, 127, 31, 112, 106, 1, 28, -109, -78,
+    -54, -72, 18, -3, 66, -52, -51, -26, -18, -31, 57, 35, 52, -1, -41, 6,
+    -26, -31, -4, -24, -85, -37, 1, 40, -31, -64, -4, -67, 17, 33, 21, -11,
+    62, 76, 80, 68, -29, 26, 41, 79, -43, 23, -76, -127, 22, 6, 12, 55,
+    12, 72, 29, 39, -44, 80, 45, 12, 34, 0, 17, 2, -8, 49, 54, 37,
+    -5, -19, 33, 12, 19, -30, 7, -2, 26, 18, 49, 52, 45, 24, -14, -47,
+    35, 64, 62, 20, -50, 108, 53, 29, -47, -44, -44, -86, 11, 8, 75, 76,
+    10, 64, -29, 28, -54, 71, 76, 8, -26, 12, -33, -20, -21, 34, 45, 57,
+    -34, -7, 28, -7, 62, -18, -8, 23, 29, 4, -12, 34, 38, 49, -15, 18,
+    33, 100, 51, -11, -42, 96, 66, -12, -28, -41, 13, -1, -19, -53, 29, 57,
+    7, 47, -3, 22, -6, 42, 38, 18, -3, -21, -15, -33, 31, 25, 55, -3,
+    -16, -16, -4, 1, 39, 29, 31, -2, 13, 25, 15, 48, 79, 105, 26, -17,
+    20, -13, 104, 75, 93, -39, 33, -16, -16, -11, -76, -127, 6, 9, -39, 32,
+    -2, 8, 64, 64, 41, 9, -54, 70, -17, -8, -92, -46, 41, -24, -49, 4,
+    3, 12, 38, -2, 47, -16, -88, -64, 55, -49, 7, -74, 20, -13, -44, -6,
+    -17, -24, 30, 79, 30, -37, -51, 23, 54, -28, -72, -22, 44, 26, -14, 22,
+    -27, -29, 35, 40, 38, -36, -67, -32, -15, -26, -13, -29, 6, -12, -60, -14,
+    46, -12, -6, 16, 55, -22, 31, -49, -5, -33, -78, -72, -50, 21, -37, -29,
+    -38, -44, 14, 63, 81, -26, -78, -13, 35, 20, -2, 3, 8, 2, -80, -44,
+    -24, -34, -4, -63, -57, -14, -64, -28, -41, 8, 7, -41, 16, -48, -68, -49,
+    12, 2, 46, 9, -40, 35, 35, 1, -48, 2, -4, -54, -8, -6, -28, -18,
+    -11, 43, -19, -84, -10, -25, 49, -1, 50, -7, 19, 26, -27, 2, -20, -27,
+    -7, -21, 55, 53, 61, -11, -3, 32, 23, 39, 16, 32, 4, -1, 22, -32,
+    26, -20, -18, 126, -2, 0, -24, -2, 9, 23, 55, 9, 50, 13, -5, -19,
+    18, -10, -5, -46, -43, -10, 22, -8, 10, 3, 3, 5, -73, -32, -12, -31,
+    28, -58, 1, 5, 63, -15, 28, 23, 24, 54, 7, 42, 40, 10, 25, -9,
+    -50, 1, -41, 31, -45, 28, -16, 51, -33, 36, 80, 31, 29, -20, -10, 9,
+    -5, 36, -45, -82, -7, -15, 15, -74, 14, -15, 19, -20, -39, -5, -3, -6,
+    27, -28, -1, -3, 127, -44, 14, 29, -11, 44, 44, -11, 27, 51, 10, -10,
+    -1, 0, -68, 64, -10, 22, -19, 37, 0, 31, 26, 50, 8, 12, 12, 23,
+    50, 14, 44, 33, 49, 29, -28, -16, 118, -62, -47, 18, 83, -35, 4, 112,
+    -61, 6, 72, 19, -52, 39, -4, -8, -58, -99, -70, -27, -23, -12, -5, 30,
+    29, 58, 44, -87, -89, 54, 67, 40, -12, -51, -33, -14, -47, -57, 6, 15,
+    21, 38, -47, 50, 53, 68, 16, -1, 109, -19, -35, 4, 5, -17, 39, 5,
+    -6, 28, 12, 1, -11, 62, -9, 34, -45, -53, -21, -21, -29, -72, 18, 21,
+    -2, 20, 32, -73, -53, 5, -12, -22, -52, -68, -20, 43, -87, -7, -25, 12,
+    50, 13, 24, 32, 74, 65, 28, 18, 57, -33, -58, -16, 44, -16, 40, 30,
+    44, -47, 70, -23, 1, 10, 53, 77, -44, -127, -84, -60, -25, -27, 44, -32,
+    21, -7, 29, -97, -122, 71, -8, 6, 10, 32, -1, 2, -38, -16, 49, 6,
+    8, 11, 6, -5, 116, -49, -1, 20, -100, -1, 9, 3, -30, -70, 6, 6,
+    -9, 11, -26, 56, 52, -22, -20, 46, 44, 29, 15, 33, 48, 45, -26, 28,
+    -6, 29, -22, -7, -48, 19, -30, -27, 24, -25, 4, 12, 25, -5, 21, 8,
+    35, -13, 20, -63, 101, -2, 6, 7, -102, 5, 27, 31, -13, -44, 5, -13,
+    -8, -20, -25, 40, 40, 1, 13, 45, 35, 45, 22, 39, 40, 28, -23, 21,
+    -9, -3, -37, 46, -36, 17, -7, 12, -6, 20, 33, 1, -13, -16, 11, -19,
+    36, 0, -12, -25, 127, 9, 13, 9, -126, 50, 42, 26, -32, -55, 0, 12,
+    13, -18, -38, 53, 61, 18, -2, 49, 55, 37, -2, -23, 78, 35, -7, 20,
+    -11, 26, -17, 6, -52, -2, 3, -9, -36, 28, 18, 23, 55, 17, 11, -3,
+    -8, -45, 44, -13, 57, -127, -17, -33, 99, 39, 30, 12, -1, 84, -84, -21,
+    -36, 28, -37, 51, 36, 46, -46, 11, 40, 10, -8, 10, 56, -7, -10, 6,
+    -34, 1, 12, -103, -74, 7, 20, -45, -34, -86, 23, 49, -33, -21, -12, -21,
+    32, 0, 41, -25, 47, -15, -47, -21, 77, 12, 36, 29, -62, 63, -65, -5,
+    -59, 25, -56, 71, 49, -13, -53, -8, 59, -5, 6, 33, 23, -18, -38, 19,
+    -2, -26, 25, -93, -50, -24, 21, 16, -74, -32, -37, 23, -29, -68, 6, -12,
+    3, -69, 4, -27, -34, -72, -57, -25, 124, 36, 72, 72, -23, 85, -123, -23,
+    9, -9, -14, 20, 56, 28, -6, -75, 36, -4, 34, 41, 85, -33, -64, 23,
+    -25, -2, -15, -41, -97, 25, -27, 3, -74, -32, -33, -11, -22, -30, 34, -24,
+    -15, 8, -15, -48, -26, 2, 23, -32, 31, -75, -15, -26, -17, -36, 3, 1,
+    -12, 25, -8, -35, 15, -25, 32, -10, -1, 4, -1, -9, 3, -8, 8, 17,
+    0, -14, -14, 67, 25, 0, -6, 14, -32, 54, 20, 31, 92, 46, 15, -23,
+    -12, -7, -23, -31, -30, -18, 15, 4, 16, -35, -49, -12, 1, -44, 10, 9,
+    14, -16, -30, -28, 16, -8, 23, 9, 0, -2, 18, -10, 20, -33, 28, -3,
+    -21, -33, -31, 112, 43, -23, 4, -11, -9, 27, 41, 16, 65, 3, 32, -29,
+    -1, -13, -54, -63, -37, -25, -5, -22, 11, -56, -7, -48, -44, -38, -3, -19,
+    -9, -21, -21, 4, 17, -43, 33, -19, 23, 1, 5, 11, 3, 19, 11, -32,
+    -16, 20, -18, 127, 2, -16, 11, 8, -35, 0, 5, 32, 89, 22, 13, -7,
+    82, -12, 42, -58, 122, -38, 62, 21, 51, 60, -28, -35, 33, 36, -16, 42,
+    -23, 23, -67, 11, 61, 57, 21, 56, -17, -96, -54, 47, 64, -10, -22, -10,
+    43, 9, -44, -35, -127, 21, 33, 24, -2, -44, 33, -42, -127, -60, -34, -36,
+    11, -67, 99, -27, 55, -49, 22, -13, 67, -7, 50, 58, 8, 4, 33, 50,
+    26, 14, 2, 21, 115, 28, -31, 34, -26, 24, 54, -75, 40, -25, -32, 2,
+    26, -10, 36, -51, -86, 22, 20, 1, -18, -29, -57, -67, -84, -69, 61, -16,
+    30, -70, 80, -1, 83, -73, 0, 4, 104, 59, -7, 93, -37, -45, -5, -12,
+    12, 22, 8, 32, 97, -42, -28, 33, 30, -20, -10, -19, 101, -29, -22, 47,
+    18, 1, 32, -67, -125, 2, -8, 6, -66, -19, -36, -17, -42, -82, 20, 23,
+    98, 86, 108, 44, -54, 71, 20, 99, -15, 29, -73, -122, -9, -35, 120, 98,
+    41, 95, 78, 6, -29, 90, 83, 71, 32, -34, -38, -36, -18, -9, 107, 70,
+    5, 28, -23, -31, 21, 13, 30, 34, -5, 21, 106, 34, 61, 24, 62, 25,
+    100, 122, 91, 18, -50, 56, 98, 86, -8, -44, -121, -90, -29, -58, 20, 103,
+    52, 68, 40, 6, 3, 79, 127, 70, 25, -56, -53, -2, 15, 3, 90, 71,
+    2, 0, 16, 10, 27, 20, 6, 43, -7, 35, 43, 91, 92, 19, 48, 4,
+    80, 60, 68, -25, -87, 123, 60, 74, -3, -82, -46, -41, -43, -86, 105, 118,
+    5, 66, -14, 8, -3, 93, 92, 25, -10, -61, -37, -7, 24, -10, 93, 49,
+    42, 5, 42, 48, 2, 15, 37, 12, -19, 51, 25, 15, 98, 71, 48, 5,
+    -6, -16, -42, 3, -33, 21, -25, -27, 71, -35, -3, -8, 5, 25, -77, -15,
+    -32, -68, 12, 35, -5, -12, -15, -49, -18, 0, 28, 44, 15, 58, -9, -62,
+    -13, -21, 31, 47, 29, -60, -29, -62, -31, -61, -2, 38, 24, 66, -49, -37,
+    -71, -34, -49, 11, -24, 27, -23, -26, 65, 42, 25, 10, 44, 8, 38, -15,
+    -50, -21, -37, 44, -28, -12, -22, -50, 0, -4, 35, 49, -4, 50, -46, -88,
+    6, -35, -1, 22, 51, -22, -21, -39, 11, -7, 6, 13, 31, 26, -13, -25,
+    -7, -10, -44, 62, -42, 44, -49, -54, 127, 47, 25, -1, -4, 18, -13, 54,
+    -52, -62, 3, 29, -15, -18, -4, -61, 0, 20, 65, 75, -8, 6, -61, -65,
+    -12, -14, 4, -35, 5, -5, 15, -66, -22, -8, 0, 35, 21, 64, -26, -49
+};
+
+static const int32_t MAGIC_WAND_aot_stage1_bias[32] =
+{
+    -76, 161, 97, -89, 11, -224, 63, -3,
+    -58, -132, -32, -206, 14, 90, -106, 69,
+    -151, -256, 17, 118, 99, -59, -89, -213,
+    65, -188, 65, 24, -20, 37, -224, -155
+};
+
+static const int32_t MAGIC_WAND_aot_stage1_multiplier[32] =
+{
+    1244179097, 1715859126, 1798202650, 1112515919, 1554216157, 1104600701, 2069584035, 1695922589,
+    1338113316, 1471674685, 1092598289, 1546819797, 1283412023, 1572706477, 1496637866, 1311651828,
+    1308434755, 1563238931, 1603124867, 1878833968, 1786738774, 1851735419, 1457795305, 1468463144,
+    1880890749, 1124316139, 2042392364, 1711915087, 1166899260, 1448858578, 1360369922, 1671631455
+};
+
+static const int8_t MAGIC_WAND_aot_stage1_shift[32] =
+{
+    -9, -9, -9, -8, -9, -9, -9, -9, -9, -9, -8, -9, -9, -9, -9, -8,
+    -9, -9, -8, -9, -9, -9, -9, -9, -9, -9, -9, -9, -8, -9, -9, -9
+};
+
+static const int8_t MAGIC_WAND_aot_stage2_weights[512] __attribute__((aligned(4))) =
+{
+    75, 10, 82, 83, -98, -6, -25, 22, 74, -9, 105, -43, 93, 12, -23, -76,
+    76, -58, 65, -28, 18, -14, -1, 13, 25, 31, 2, -13, 4, -41, 37, -6,
+    -19, -55, -78, 40, 22, 68, 7, -65, -51, 61, -30, 45, -8, 85, -19, -27,
+    94, 38, 20, -36, -10, -2, 76, -2, 0, 29, 48, 78, 29, 16, 27, 54,
+    -12, 13, 0, -20, 87, 4, 34, 6, 29, -37, -58, -32, -61, -12, 37, 65,
+    11, 113, -64, -26, -1, -6, 14, -54, 55, 36, 44, 93, 14, 0, -1, -52,
+    67, 78, -8, 22, 25, 45, 30, 36, 76, -94, 45, -27, -16, -115, 41, 59,
+    60, -7, -1, 38, 61, -73, -80, 29, 36, 29, -24, 0, -12, -107, -4, -75,
+    31, 50, 43, -20, -37, -4, -31, 46, 14, -127, -43, -40, 43, -87, 21, -25,
+    -75, -1, 26, 92, -7, 19, -80, -12, 23, 36, -3, -105, 59, -44, -9, -36,
+    10, 54, 2, 3, 45, -53, -73, 71, 6, 63, 27, 60, 9, -1, 82, -38,
+    -36, -60, 77, 40, -9, 59, -54, 13, -78, -33, -62, -93, -65, 45, -43, 68,
+    10, 30, 20, -33, 6, 16, -54, -26, -32, 112, -27, 27, -16, 56, 26, 11,
+    -80, -26, 63, -44, -68, 43, 41, 13, -37, -50, 5, -21, 15, 23, -20, 38,
+    -14, -13, 29, -1, 27, -11, 20, 68, 41, -9, -13, -42, 53, -48, -87, 57,
+    -10, 53, -30, -43, 60, -80, 75, 79, 88, 2, -42, 5, -39, -122, 49, -38,
+    19, 43, 36, -13, 5, -40, -84, 13, -8, 28, 20, 91, -2, 15, 91, 57,
+    -25, 29, 29, -2, -52, 51, -21, 26, -52, -28, -38, -96, 1, 20, -43, -22,
+    -34, -21, -54, -60, 11, 83, -28, -2, -55, -63, -72, 0, -31, 58, 58, 35,
+    15, 89, -66, -7, 72, 14, -63, -48, 44, 1, -3, -20, 48, 38, 28, 25,
+    29, 36, -26, 23, 8, 5, -33, -3, 27, 28, 75, 41, 4, 58, 17, -92,
+    -13, -93, 122, 27, -104, -4, 24, 12, -57, -50, 51, -9, -18, 7, -10, -36,
+    -33, -36, 48, -2, 66, -4, -5, -53, 0, 30, -61, 55, 13, 61, 46, 40,
+    -93, 2, 5, -39, -64, 11, 46, -43, -9, -63, -40, 61, -13, 89, -32, 24,
+    76, -50, -23, 127, -22, -59, 16, 13, 35, 63, 3, 74, 52, 41, -41, -20,
+    45, -35, 31, -32, 2, -35, 27, 35, -44, -66, 71, 58, -60, -1, 89, 14,
+    -80, -24, -3, -74, 69, 73, -8, -77, -42, -19, -62, 6, -56, 42, 51, 79,
+    -53, 60, -91, 14, -49, 24, -28, -7, 52, 22, -29, -13, 61, 24, -54, 4,
+    -36, -7, 20, 39, -37, 5, -9, 49, 64, -36, 26, -7, -3, 3, -69, -11,
+    9, 24, -40, -5, 43, -49, -12, 2, -32, -16, -36, -46, -58, -18, -6, 4,
+    16, -34, -47, 80, 32, -65, 51, -82, -5, 84, 27, -15, -12, 72, -47, 9,
+    28, 0, 4, -30, 19, 44, 120, 57, 42, -49, -8, 102, 40, 3, 7, 46
+};
+
+static const int32_t MAGIC_WAND_aot_stage2_bias[16] =
+{
+    78, -19, 58, 80, 82, 8, -19, 46,
+    43, 72, -38, 9, -6, 53, -5, -82
+};
+
+static const int8_t MAGIC_WAND_aot_stage3_weights[64] __attribute__((aligned(4))) =
+{
+    -127, 33, 29, -85, -16, 59, 24, -99, 24, -106, 94, 80, -94, 12, 96, 22,
+    -3, 6, -105, 12, 97, -53, 44, -33, 42, 5, 25, -79, -26, -65, -38, -85,
+    -27, -95, 20, -89, -69, 80, 44, -82, 27, 93, -98, 35, 43, 45, -124, 49,
+    -22, 42, 48, -8, -52, -83, -74, 14, -85, -38, 50, -44, 45, -23, -45, 59
+};
+
+static const int32_t MAGIC_WAND_aot_stage3_bias[4] =
+{
+    -136, 70, -12, 56
+};
+
+/* Rounded division by 2^exponent of the TFLM and CMSIS-NN kernels */
+static inline int32_t aot_divide_by_pot(int32_t value, int32_t exponent)
+{
+    int32_t mask = (int32_t)((1u << exponent) - 1u);
+    int32_t threshold = (mask >> 1) + ((value < 0) ? 1 : 0);
+
+    return (value >> exponent) + (((value & mask) > threshold) ? 1 : 0);
+}
+
+/* value x multiplier x 2^shift for a Q31 multiplier, as arm_nn_requantize */
+static inline int32_t aot_requantize(int32_t value, int32_t multiplier, int32_t shift)
+{
+    int32_t high = (int32_t)(((int64_t)(value * (1 << ((shift > 0) ? shift : 0))) * multiplier + (1ll << 30)) >> 31);
+
+    return aot_divide_by_pot(high, (shift > 0) ? 0 : -shift);
+}
+
+static inline int32_t aot_clamp(int32_t value, int32_t low, int32_t high)
+{
+    return (value < low) ? low : ((value > high) ? high : value);
+}
+
+/* Receptive field of an output, rows of length values, with the input offset */
+static inline void aot_im2col(int16_t *col, const int8_t *input, uint32_t rows, uint32_t length, uint32_t stride,
+                              int32_t offset)
+{
+    for (uint32_t row = 0; row < rows; row++)
+    {
+        for (uint32_t i = 0; i < length; i++)
+        {
+            *col++ = (int16_t)(input[i] + offset);
+        }
+        input += stride;
+    }
+}
+
+/* Largest dot product so far of the column with the weights of each channel.
+ * The weights of a channel are count values, in groups of 4 with the middle
+ * two swapped. */
+static void aot_dot_max(const int16_t *col, const int8_t *weights, uint32_t count, uint32_t channels,
+                        int32_t *acc)
+{
+    for (uint32_t c = 0; c < channels; c++)
+    {
+        int32_t sum = 0;
+#if defined(__ARM_FEATURE_SIMD32)
+        for (uint32_t i = 0; i < count; i += 4u)
+        {
+            uint32_t group;
+            uint32_t low;
+            uint32_t high;
+
+            memcpy(&group, &weights[i], sizeof(group));
+            memcpy(&low, &col[i], sizeof(low));
+            memcpy(&high, &col[i + 2u], sizeof(high));
+            sum = __smlad((int16x2_t)low, __sxtb16((int8x4_t)group), sum);
+            sum = __smlad((int16x2_t)high, __sxtb16((int8x4_t)__ror(group, 8u)), sum);
+        }
+#else
+        for (uint32_t i = 0; i < count; i += 4u)
+        {
+            sum += col[i] * weights[i] + col[i + 1u] * weights[i + 2u] +
+                   col[i + 2u] * weights[i + 1u] + col[i + 3u] * weights[i + 3u];
+        }
+#endif
+        if (sum > acc[c])
+        {
+            acc[c] = sum;
+        }
+        weights += count;
+    }
+}
+
+/* Saturating rounded doubling high multiplication, as arm_nn_doubling_high_mult */
+static inline int32_t aot_high_mul(int32_t a, int32_t b)
+{
+    int64_t product = ((a < 0) != (b < 0)) ? (1 - (1ll << 30)) : (1ll << 30);
+
+    if ((a == b) && (a == INT32_MIN))
+    {
+        return INT32_MAX;
+    }
+    product += (int64_t)a * b;
+
+    return (int32_t)(product / (1ll << 31));
+}
+
+/* exp() of a Q5.26 value in [-32, 0], in Q0.31, as arm_nn_exp_on_negative_values */
+static int32_t aot_exp_on_negative(int32_t value)
+{
+    static const int32_t multipliers[7] = { 1672461947, 1302514674, 790015084, 290630308, 39332535, 720401, 242 };
+    int32_t quarter = (value & ((1 << 24) - 1)) - (1 << 24);
+    int32_t remainder = quarter - value;
+    int32_t x = (int32_t)((uint32_t)quarter << 5) + (1 << 28);
+    int32_t x2 = aot_high_mul(x, x);
+    int32_t result = 1895147668 + aot_high_mul(1895147668, x + aot_divide_by_pot(
+        aot_high_mul(aot_divide_by_pot(aot_high_mul(x2, x2), 2) + aot_high_mul(x2, x), 715827883) + x2, 1));
+
+    for (uint32_t i = 0; i < 7u; i++)
+    {
+        if (0 != (remainder & (1 << (24u + i))))
+        {
+            result = aot_high_mul(result, multipliers[i]);
+        }
+    }
+
+    return (0 == value) ? INT32_MAX : result;
+}
+
+/* 1 / (1 + x) of x in [0, 1) in Q0.31, as arm_nn_one_over_one_plus_x_for_x_in_0_1 */
+static int32_t aot_one_over_one_plus_x(int32_t value)
+{
+    int64_t sum = (int64_t)value + INT32_MAX;
+    int32_t half_denominator = (int32_t)((sum + ((sum >= 0) ? 1 : -1)) / 2);
+    int32_t x = 1515870810 + aot_high_mul(half_denominator, -1010580540);
+
+    for (uint32_t i = 0; i < 3u; i++)
+    {
+        x += 4 * aot_high_mul(x, (1 << 29) - aot_high_mul(half_denominator, x));
+    }
+
+    return (x > INT32_MAX / 2) ? INT32_MAX : ((x < -(INT32_MAX / 2)) ? INT32_MIN : x * 2);
+}
+
+/* Softmax of int8 logits to an output of scale 1/256, as arm_softmax_s8 */
+static void aot_softmax(const int8_t *input, int8_t *output, uint32_t size, int32_t multiplier, int32_t shift,
+                        int32_t diff_min)
+{
+    int32_t max = input[0];
+    int32_t sum = 0;
+    int32_t headroom;
+    int32_t scale;
+
+    for (uint32_t i = 1; i < size; i++)
+    {
+        max = (input[i] > max) ? input[i] : max;
+    }
+    for (uint32_t i = 0; i < size; i++)
+    {
+        int32_t diff = input[i] - max;
+        if (diff >= diff_min)
+        {
+            sum += aot_divide_by_pot(aot_exp_on_negative(aot_high_mul(diff * (1 << shift), multiplier)), 12);
+        }
+    }
+
+    headroom = __builtin_clz((uint32_t)sum);
+    scale = aot_one_over_one_plus_x((int32_t)(((uint32_t)sum << headroom) - (1u << 31)));
+    for (uint32_t i = 0; i < size; i++)
+    {
+        int32_t diff = input[i] - max;
+        int32_t value = INT8_MIN;
+        if (diff >= diff_min)
+        {
+            value = aot_divide_by_pot(aot_high_mul(scale, aot_exp_on_negative(aot_high_mul(diff * (1 << shift),
+                multiplier))), 12 - headroom + 23) + INT8_MIN;
+        }
+        output[i] = (int8_t)aot_clamp(value, INT8_MIN, INT8_MAX);
+    }
+}
+
+/* CONV_2D RELU, MAX_POOL_2D 3x3, MUL, ADD: 128x6x1 -> 42x2x16 */
+static void MAGIC_WAND_aot_stage0(const int8_t *input, int8_t *output)
+{
+    int16_t col[12] = { 0 };
+    int32_t acc[16];
+
+    for (uint32_t y = 0; y < 42u; y++)
+    {
+        for (uint32_t x = 0; x < 2u; x++)
+        {
+            for (uint32_t c = 0; c < 16u; c++)
+            {
+                acc[c] = INT32_MIN;
+            }
+            for (uint32_t dy = 0; dy < 3u; dy++)
+            {
+                for (uint32_t dx = 0; dx < 3u; dx++)
+                {
+                    aot_im2col(col, &input[y * 24u + dy * 8u + x * 3u + dx], 3u, 3u, 8u, 0);
+                    aot_dot_max(col, MAGIC_WAND_aot_stage0_weights, 12u, 16u, acc);
+                }
+            }
+            for (uint32_t c = 0; c < 16u; c++)
+            {
+                int32_t value = acc[c] + MAGIC_WAND_aot_stage0_bias[c];
+                value = aot_requantize(value, MAGIC_WAND_aot_stage0_multiplier[c], MAGIC_WAND_aot_stage0_shift[c]);
+                value = aot_clamp(value - 128, -128, 127);
+                value = aot_requantize((value + 128) * MAGIC_WAND_aot_stage0_mul0[c], 1382963391, -7);
+                value = aot_clamp(value - 128, -128, 127);
+                value = aot_requantize((value + 128) * 1048576, 1073741824, 0) + MAGIC_WAND_aot_stage0_add1[c];
+                value = aot_requantize(value, 2040358682, -19);
+                value = aot_clamp(value - 110, -128, 127);
+                output[y * 64u + x * 16u + c + 80u] = (int8_t)value;
+            }
+        }
+    }
+}
+
+/* CONV_2D RELU, MAX_POOL_2D 3x1, MEAN: 42x2x16 -> 1x1x32 */
+static void MAGIC_WAND_aot_stage1(const int8_t *input, int8_t *output)
+{
+    int16_t col[144] = { 0 };
+    int32_t acc[32];
+    int32_t sum[32] = { 0 };
+
+    for (uint32_t y = 0; y < 14u; y++)
+    {
+        for (uint32_t x = 0; x < 2u; x++)
+        {
+            for (uint32_t c = 0; c < 32u; c++)
+            {
+                acc[c] = INT32_MIN;
+            }
+            for (uint32_t dy = 0; dy < 3u; dy++)
+            {
+                aot_im2col(col, &input[y * 192u + dy * 64u + x * 16u], 3u, 48u, 64u, 110);
+                aot_dot_max(col, MAGIC_WAND_aot_stage1_weights, 144u, 32u, acc);
+            }
+            for (uint32_t c = 0; c < 32u; c++)
+            {
+                int32_t value = acc[c] + MAGIC_WAND_aot_stage1_bias[c];
+                value = aot_requantize(value, MAGIC_WAND_aot_stage1_multiplier[c], MAGIC_WAND_aot_stage1_shift[c]);
+                value = aot_clamp(value - 128, -128, 127);
+                sum[c] += value;
+            }
+        }
+    }
+
+    for (uint32_t c = 0; c < 32u; c++)
+    {
+        int32_t value = (int32_t)(((int64_t)sum[c] * 28469 + 102295028) >> 19);
+        output[c] = (int8_t)aot_clamp(value - 128, -128, 127);
+    }
+}
+
+/* FULLY_CONNECTED RELU: 1x1x32 -> 1x1x16 */
+static void MAGIC_WAND_aot_stage2(const int8_t *input, int8_t *output)
+{
+    int16_t col[32] = { 0 };
+    int32_t acc[16];
+
+    for (uint32_t c = 0; c < 16u; c++)
+    {
+        acc[c] = INT32_MIN;
+    }
+    aot_im2col(col, &input[0], 1u, 32u, 32u, 128);
+    aot_dot_max(col, MAGIC_WAND_aot_stage2_weights, 32u, 16u, acc);
+    for (uint32_t c = 0; c < 16u; c++)
+    {
+        int32_t value = acc[c] + MAGIC_WAND_aot_stage2_bias[c];
+        value = aot_requantize(value, 1463075474, -7);
+        value = aot_clamp(value - 128, -128, 127);
+        output[c] = (int8_t)value;
+    }
+}
+
+/* FULLY_CONNECTED, SOFTMAX: 1x1x16 -> 1x1x4 */
+static void MAGIC_WAND_aot_stage3(const int8_t *input, int8_t *output)
+{
+    int16_t col[16] = { 0 };
+    int32_t acc[4];
+    int8_t logits[4];
+
+    for (uint32_t c = 0; c < 4u; c++)
+    {
+        acc[c] = INT32_MIN;
+    }
+    aot_im2col(col, &input[0], 1u, 16u, 16u, 128);
+    aot_dot_max(col, MAGIC_WAND_aot_stage3_weights, 16u, 4u, acc);
+    for (uint32_t c = 0; c < 4u; c++)
+    {
+        int32_t value = acc[c] + MAGIC_WAND_aot_stage3_bias[c];
+        value = aot_requantize(value, 2132204163, -8);
+        value = aot_clamp(value + 94, -128, 127);
+        logits[c] = (int8_t)value;
+    }
+
+    aot_softmax(logits, output, 4u, 1373518336, 26, -31);
+}
+
+void MAGIC_WAND_aot_run(const int8_t *input, int8_t *output, void *arena)
+{
+    int8_t *buffer0 = (int8_t *)&((uint8_t *)arena)[2816];
+    int8_t *buffer1 = (int8_t *)&((uint8_t *)arena)[0];
+    int8_t *buffer2 = (int8_t *)&((uint8_t *)arena)[2816];
+    int8_t *buffer3 = (int8_t *)&((uint8_t *)arena)[0];
+
+    /* Padding of the CONV_2D input */
+    memset(&buffer0[0], 0, 8u * sizeof(int8_t));
+    memset(&buffer0[1032u], 0, 8u * sizeof(int8_t));
+    for (uint32_t y = 1u; y < 129u; y++)
+    {
+        memset(&buffer0[y * 8u], 0, 1u * sizeof(int8_t));
+        memset(&buffer0[y * 8u + 7u], 0, 1u * sizeof(int8_t));
+    }
+    for (uint32_t y = 0; y < 128u; y++)
+    {
+        memcpy(&buffer0[(y + 1u) * 8u + 1u], &input[y * 6u], 6u * sizeof(int8_t));
+    }
+    MAGIC_WAND_aot_stage0(buffer0, buffer1);
+
+    /* Padding of the CONV_2D input */
+    memset(&buffer1[0], -110, 64u * sizeof(int8_t));
+    memset(&buffer1[2752u], -110, 64u * sizeof(int8_t));
+    for (uint32_t y = 1u; y < 43u; y++)
+    {
+        memset(&buffer1[y * 64u], -110, 16u * sizeof(int8_t));
+        memset(&buffer1[y * 64u + 48u], -110, 16u * sizeof(int8_t));
+    }
+    MAGIC_WAND_aot_stage1(buffer1, buffer2);
+
+    MAGIC_WAND_aot_stage2(buffer2, buffer3);
+
+    MAGIC_WAND_aot_stage3(buffer3, output);
+}
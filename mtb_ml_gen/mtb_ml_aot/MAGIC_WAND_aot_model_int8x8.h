@@ -0,0 +1,51 @@
+/***************************************************************************//**
+* \file MAGIC_WAND_aot_model_int8x8.h
+*
+* \brief
+* Autogenerated with train/aot_compile.py from MAGIC_WAND_int8x8.tflite, this file
+* contains the interface of the MAGIC_WAND model compiled to straight-line C.
+*******************************************************************************/
+
+#ifndef MAGIC_WAND_AOT_MODEL_INT8X8_H
+#define MAGIC_WAND_AOT_MODEL_INT8X8_H
+
+#include <stdint.h>
+
+#define MAGIC_WAND_AOT_QUANTIZED                1
+
+/* Values of the input and output */
+#define MAGIC_WAND_AOT_INPUT_SIZE               768
+#define MAGIC_WAND_AOT_OUTPUT_SIZE              4
+
+/* Quantization of the input and output, real = scale x (value - zero point) */
+#define MAGIC_WAND_AOT_INPUT_SCALE              7.836366072e-03f
+#define MAGIC_WAND_AOT_INPUT_ZERO_POINT         (0)
+#define MAGIC_WAND_AOT_OUTPUT_SCALE             3.906250000e-03f
+#define MAGIC_WAND_AOT_OUTPUT_ZERO_POINT        (-128)
+
+/* Bytes of the arena, given by the caller with an alignment of 4, and of the
+ * constant data */
+#define MAGIC_WAND_AOT_ARENA_SIZE               3856
+#define MAGIC_WAND_AOT_CONST_DATA_SIZE          6016
+
+/* Multiply-accumulates of an inference */
+#define MAGIC_WAND_AOT_MACS                     496512
+
+/* Bytes and CRC-16/CCITT-FALSE of the .tflite, to check that another engine
+ * runs the same model */
+#define MAGIC_WAND_AOT_SOURCE_SIZE              11088u
+#define MAGIC_WAND_AOT_SOURCE_CRC               0x00F1u
+
+typedef int8_t MAGIC_WAND_aot_data_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void MAGIC_WAND_aot_run(const int8_t *input, int8_t *output, void *arena);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MAGIC_WAND_AOT_MODEL_INT8X8_H */
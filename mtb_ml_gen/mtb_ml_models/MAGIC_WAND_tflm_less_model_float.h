@@ -1,4 +1,5 @@
 // This file is generated. Do not edit.
+// Made reentrant by train/tflm_less_context.py.
 // Generated on: 18.01.2023 00:44:01
 
 #ifndef MAGIC_WAND_GEN_H
@@ -14,6 +15,41 @@ extern "C" {
 #define MAGIC_WAND_MODEL_INIT_DATA_SIZE 797
 #define MAGIC_WAND_MODEL_UNINIT_DATA_SIZE 56156
 
+// Arena of an instance, and tensors and operators of the model
+#define MAGIC_WAND_MODEL_ARENA_SIZE 55188
+#define MAGIC_WAND_MODEL_TENSOR_COUNT 22
+#define MAGIC_WAND_MODEL_NODE_COUNT 10
+
+// Pointers reserved for the MicroContext of the kernels
+#define MAGIC_WAND_MODEL_MICRO_CONTEXT_SIZE 16
+
+// Lock of the state shared by the instances: the registrations, and the
+// cursor of the library over the precomputed operator data. All the instances
+// running concurrently use the same lock.
+typedef struct {
+  void (*lock)(void *arg);
+  void (*unlock)(void *arg);
+  void *arg;
+} MAGIC_WAND_lock_t;
+
+// State of one instance of the model. The constant tensors and the operator
+// data are shared by all the instances; the activations and the persistent
+// buffers of the kernels are in the arena of the instance.
+typedef struct {
+  TfLiteContext ctx;
+  TfLiteTensor tflTensorsWithMinus1[MAGIC_WAND_MODEL_TENSOR_COUNT + 1];
+  TfLiteEvalTensor evalTensors[MAGIC_WAND_MODEL_TENSOR_COUNT];
+  TfLiteNode tflNodes[MAGIC_WAND_MODEL_NODE_COUNT];
+  uint8_t *arena;
+  uint8_t *persistent;      // Last persistent buffer, from the end of the arena
+  int next_scratch_buffer_idx;
+  MAGIC_WAND_lock_t lock;
+  void *micro_context[MAGIC_WAND_MODEL_MICRO_CONTEXT_SIZE];
+} MAGIC_WAND_context_t;
+
+
+// The functions without a context run an instance in the arena of the
+// generated file, as used by the ML middleware.
 
 // Sets up the model with init and prepare steps.
 TfLiteStatus MAGIC_WAND_init();
@@ -24,6 +60,18 @@ TfLiteTensor *MAGIC_WAND_output(int index);
 // Runs inference for the model.
 TfLiteStatus MAGIC_WAND_invoke();
 
+// Sets up an instance of the model in an arena of at least
+// MAGIC_WAND_MODEL_ARENA_SIZE bytes, aligned to 16 bytes. lock may be NULL if
+// no other instance is set up or runs at the same time.
+TfLiteStatus MAGIC_WAND_context_init(MAGIC_WAND_context_t *context, uint8_t *arena, size_t arena_size, const MAGIC_WAND_lock_t *lock);
+// Returns the input tensor of an instance with the given index.
+TfLiteTensor *MAGIC_WAND_context_input(MAGIC_WAND_context_t *context, int index);
+// Returns the output tensor of an instance with the given index.
+TfLiteTensor *MAGIC_WAND_context_output(MAGIC_WAND_context_t *context, int index);
+// Runs inference for an instance. With the precomputed operator data, the
+// instances run one at a time under their lock.
+TfLiteStatus MAGIC_WAND_context_invoke(MAGIC_WAND_context_t *context);
+
 // Returns the number of input tensors.
 size_t MAGIC_WAND_inputs();
 
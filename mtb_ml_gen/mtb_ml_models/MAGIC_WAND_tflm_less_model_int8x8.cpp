@@ -1,11 +1,15 @@
 // This file is generated. Do not edit.
+// Made reentrant by train/tflm_less_context.py.
 // Generated on: 27.09.2022 21:35:10
 
+#include <new>
+
 #include "tensorflow/lite/c/builtin_op_data.h"
 #include "tensorflow/lite/c/common.h"
 #include "tensorflow/lite/micro/kernels/micro_ops.h"
 #include "tensorflow/lite/micro/compatibility.h"
 #include "tensorflow/lite/micro/micro_context.h"
+#include "MAGIC_WAND_tflm_less_model_int8x8.h"
 #if LOG_OP_INPUTS
 #include "tensorflow/lite/micro/micro_invoke_log.h"
 #endif
@@ -37,6 +41,7 @@ namespace {
 
 
 constexpr int kTensorArenaSize = 14692;
+// Arena of the instance used by the functions without a context
 uint8_t tensor_arena[kTensorArenaSize] ALIGN(16);
 
 
@@ -53,6 +58,7 @@ enum used_operators_e {
 struct TensorInfo_t { // subset of TfLiteTensor used for initialization from constant memory
   TfLiteType type;
   void* data;
+  size_t arena_offset;  // Used if data is nullptr
   TfLiteIntArray* dims;
   size_t bytes;
   TfLiteQuantization quantization;
@@ -66,21 +72,18 @@ struct NodeInfo_t { // subset of TfLiteNode used for initialization from constan
   };
 
 
-TfLiteContext ctx{};
-
-// Tensor table with space for -1-th element used
-// designate missing optional inputs/outputs.
-TfLiteTensor tflTensorsWithMinus1[23];
-     
-TfLiteEvalTensor evalTensors[22];
+// Instance used by the functions without a context
+MAGIC_WAND_context_t default_context;
 
-TfLiteTensor * const tflTensors = tflTensorsWithMinus1+1;
+// Dimensions of the -1-th tensor, used to designate missing optional
+// inputs/outputs
+TfLiteIntArray dimsEmptyTensor = {0};
 
 TfLiteRegistration registrations[OP_LAST];
 constexpr size_t kOpNodesCount = 10;
 
 
-TfLiteNode tflNodes[kOpNodesCount];
+static_assert(kOpNodesCount == MAGIC_WAND_MODEL_NODE_COUNT, "Node count of the context");
 
 const TfArray<4, int> tensor_dimension0 = { 4, { 1, 128, 6, 1, } };
 const TfArray<1, float> quant0_scale = { 1, { 0.0078371148556470871, } };
@@ -398,28 +401,28 @@ const TfLiteSoftmaxParams opdata9 = { 1 };
 const TfArray<1, int> inputs9 = { 1, { 20, } };
 const TfArray<1, int> outputs9 = { 1, { 21, } };
 const TensorInfo_t tensorData[] = {
-  { kTfLiteInt8, tensor_arena + 12288, (TfLiteIntArray*)&tensor_dimension0, 768, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&quant0)) },},
-  { kTfLiteInt32, (void*)tensor_data1, (TfLiteIntArray*)&tensor_dimension1, 8, {kTfLiteNoQuantization, nullptr },},
-  { kTfLiteInt8, (void*)tensor_data2, (TfLiteIntArray*)&tensor_dimension2, 144, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&quant2)) },},
-  { kTfLiteInt32, (void*)tensor_data3, (TfLiteIntArray*)&tensor_dimension3, 64, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&quant3)) },},
-  { kTfLiteInt8, (void*)tensor_data4, (TfLiteIntArray*)&tensor_dimension4, 16, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&quant4)) },},
-  { kTfLiteInt8, (void*)tensor_data5, (TfLiteIntArray*)&tensor_dimension5, 16, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&quant5)) },},
-  { kTfLiteInt8, (void*)tensor_data6, (TfLiteIntArray*)&tensor_dimension6, 4608, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&quant6)) },},
-  { kTfLiteInt32, (void*)tensor_data7, (TfLiteIntArray*)&tensor_dimension7, 128, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&quant7)) },},
-  { kTfLiteInt8, (void*)tensor_data8, (TfLiteIntArray*)&tensor_dimension8, 512, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&quant8)) },},
-  { kTfLiteInt32, (void*)tensor_data9, (TfLiteIntArray*)&tensor_dimension9, 64, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&quant9)) },},
-  { kTfLiteInt8, (void*)tensor_data10, (TfLiteIntArray*)&tensor_dimension10, 64, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&quant10)) },},
-  { kTfLiteInt32, (void*)tensor_data11, (TfLiteIntArray*)&tensor_dimension11, 16, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&quant11)) },},
-  { kTfLiteInt8, tensor_arena + 0, (TfLiteIntArray*)&tensor_dimension12, 12288, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&quant12)) },},
-  { kTfLiteInt8, tensor_arena + 12288, (TfLiteIntArray*)&tensor_dimension13, 1344, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&quant13)) },},
-  { kTfLiteInt8, tensor_arena + 0, (TfLiteIntArray*)&tensor_dimension14, 1344, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&quant14)) },},
-  { kTfLiteInt8, tensor_arena + 2688, (TfLiteIntArray*)&tensor_dimension15, 1344, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&quant15)) },},
-  { kTfLiteInt8, tensor_arena + 0, (TfLiteIntArray*)&tensor_dimension16, 2688, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&quant16)) },},
-  { kTfLiteInt8, tensor_arena + 2688, (TfLiteIntArray*)&tensor_dimension17, 896, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&quant17)) },},
-  { kTfLiteInt8, tensor_arena + 128, (TfLiteIntArray*)&tensor_dimension18, 32, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&quant18)) },},
-  { kTfLiteInt8, tensor_arena + 0, (TfLiteIntArray*)&tensor_dimension19, 16, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&quant19)) },},
-  { kTfLiteInt8, tensor_arena + 16, (TfLiteIntArray*)&tensor_dimension20, 4, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&quant20)) },},
-  { kTfLiteInt8, tensor_arena + 0, (TfLiteIntArray*)&tensor_dimension21, 4, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&quant21)) },},
+  { kTfLiteInt8, nullptr, 12288, (TfLiteIntArray*)&tensor_dimension0, 768, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&quant0)) },},
+  { kTfLiteInt32, (void*)tensor_data1, 0, (TfLiteIntArray*)&tensor_dimension1, 8, {kTfLiteNoQuantization, nullptr },},
+  { kTfLiteInt8, (void*)tensor_data2, 0, (TfLiteIntArray*)&tensor_dimension2, 144, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&quant2)) },},
+  { kTfLiteInt32, (void*)tensor_data3, 0, (TfLiteIntArray*)&tensor_dimension3, 64, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&quant3)) },},
+  { kTfLiteInt8, (void*)tensor_data4, 0, (TfLiteIntArray*)&tensor_dimension4, 16, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&quant4)) },},
+  { kTfLiteInt8, (void*)tensor_data5, 0, (TfLiteIntArray*)&tensor_dimension5, 16, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&quant5)) },},
+  { kTfLiteInt8, (void*)tensor_data6, 0, (TfLiteIntArray*)&tensor_dimension6, 4608, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&quant6)) },},
+  { kTfLiteInt32, (void*)tensor_data7, 0, (TfLiteIntArray*)&tensor_dimension7, 128, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&quant7)) },},
+  { kTfLiteInt8, (void*)tensor_data8, 0, (TfLiteIntArray*)&tensor_dimension8, 512, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&quant8)) },},
+  { kTfLiteInt32, (void*)tensor_data9, 0, (TfLiteIntArray*)&tensor_dimension9, 64, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&quant9)) },},
+  { kTfLiteInt8, (void*)tensor_data10, 0, (TfLiteIntArray*)&tensor_dimension10, 64, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&quant10)) },},
+  { kTfLiteInt32, (void*)tensor_data11, 0, (TfLiteIntArray*)&tensor_dimension11, 16, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&quant11)) },},
+  { kTfLiteInt8, nullptr, 0, (TfLiteIntArray*)&tensor_dimension12, 12288, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&quant12)) },},
+  { kTfLiteInt8, nullptr, 12288, (TfLiteIntArray*)&tensor_dimension13, 1344, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&quant13)) },},
+  { kTfLiteInt8, nullptr, 0, (TfLiteIntArray*)&tensor_dimension14, 1344, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&quant14)) },},
+  { kTfLiteInt8, nullptr, 2688, (TfLiteIntArray*)&tensor_dimension15, 1344, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&quant15)) },},
+  { kTfLiteInt8, nullptr, 0, (TfLiteIntArray*)&tensor_dimension16, 2688, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&quant16)) },},
+  { kTfLiteInt8, nullptr, 2688, (TfLiteIntArray*)&tensor_dimension17, 896, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&quant17)) },},
+  { kTfLiteInt8, nullptr, 128, (TfLiteIntArray*)&tensor_dimension18, 32, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&quant18)) },},
+  { kTfLiteInt8, nullptr, 0, (TfLiteIntArray*)&tensor_dimension19, 16, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&quant19)) },},
+  { kTfLiteInt8, nullptr, 16, (TfLiteIntArray*)&tensor_dimension20, 4, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&quant20)) },},
+  { kTfLiteInt8, nullptr, 0, (TfLiteIntArray*)&tensor_dimension21, 4, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&quant21)) },},
 };
 const NodeInfo_t nodeData[kOpNodesCount] = {
   { (TfLiteIntArray*)&inputs0, (TfLiteIntArray*)&outputs0, const_cast<void*>(static_cast<const void*>(&opdata0)), OP_CONV_2D, },
@@ -438,7 +441,6 @@ const NodeInfo_t nodeData[kOpNodesCount] = {
   // Used by RequestScratchBufferInArena to generate buffer index
   // for each request.  Reset for each node from _init to allow
   // for nodes omitting calls as scratch buffer indexes is in pre-computed OpData
-  int next_scratch_buffer_idx;
   const uint8_t node_scratch_buffer_requests[] = {
 1, 0, 0, 0, 1, 0, 1, 0, 0, 0,
 
@@ -448,29 +450,47 @@ const size_t scratchbuf_offsets[] = {
 13056, 4032, 0, 
 };  
 
-void *AllocatePersistentBuffer(struct TfLiteContext* ignore,
+MAGIC_WAND_context_t *GetContext(const struct TfLiteContext *ctx) {
+  return reinterpret_cast<MAGIC_WAND_context_t *>(const_cast<TfLiteContext *>(ctx));
+}
+
+void *AllocatePersistentBuffer(struct TfLiteContext* ctx,
                                                  size_t bytes) {
-  static uint8_t *AllocPtr = tensor_arena + sizeof(tensor_arena);
+  MAGIC_WAND_context_t *context = GetContext(ctx);
 
-  AllocPtr -= bytes;
-  return AllocPtr;
+  context->persistent -= bytes;
+  return context->persistent;
 }
 
-TfLiteEvalTensor *GetEvalTensor(const struct TfLiteContext *ignore,
+TfLiteEvalTensor *GetEvalTensor(const struct TfLiteContext *ctx,
                                        int tensor_idx) {
-  return &evalTensors[tensor_idx];
+  return &GetContext(ctx)->evalTensors[tensor_idx];
 }
 
-TfLiteStatus RequestScratchBufferInArena(TfLiteContext *ignored,
+TfLiteStatus RequestScratchBufferInArena(TfLiteContext *ctx,
                                                 size_t bytes_ignored,
                                                 int *buffer_idx) {
-  *buffer_idx = next_scratch_buffer_idx;
-  ++next_scratch_buffer_idx;
+  MAGIC_WAND_context_t *context = GetContext(ctx);
+
+  *buffer_idx = context->next_scratch_buffer_idx;
+  ++context->next_scratch_buffer_idx;
   return kTfLiteOk;
 }
 
-void* GetScratchBuffer(struct TfLiteContext *ignore, int buffer_idx) {
-  return tensor_arena + scratchbuf_offsets[buffer_idx];
+void* GetScratchBuffer(struct TfLiteContext *ctx, int buffer_idx) {
+  return GetContext(ctx)->arena + scratchbuf_offsets[buffer_idx];
+}
+
+void Lock(MAGIC_WAND_context_t *context) {
+  if (context->lock.lock) {
+    context->lock.lock(context->lock.arg);
+  }
+}
+
+void Unlock(MAGIC_WAND_context_t *context) {
+  if (context->lock.unlock) {
+    context->lock.unlock(context->lock.arg);
+  }
 }
 
 } // namespace
@@ -572,8 +592,8 @@ void *precomputed_op_user_data[] = {
 
 class MAGIC_WAND_PreinterpretedMicroContext : public tflite::MicroContext {
  public:
-   MAGIC_WAND_PreinterpretedMicroContext() : 
-    tflite::MicroContext(nullptr, nullptr, nullptr) {}
+   explicit MAGIC_WAND_PreinterpretedMicroContext(TfLiteContext *ctx) :
+    tflite::MicroContext(nullptr, nullptr, nullptr), ctx_(ctx) {}
 
   // Allocate persistent buffer which has the same life time as the interpreter.
   // Returns nullptr on failure.
@@ -581,7 +601,7 @@ class MAGIC_WAND_PreinterpretedMicroContext : public tflite::MicroContext {
   // This method is only available in Init or Prepare stage.
   // Virtual so that it can be faked for kernel tests.
   virtual void* AllocatePersistentBuffer(size_t bytes) {
-    return ::AllocatePersistentBuffer(nullptr, bytes);
+    return ::AllocatePersistentBuffer(ctx_, bytes);
   }
 
   // Request a scratch buffer in the arena through static memory planning.
@@ -591,20 +611,20 @@ class MAGIC_WAND_PreinterpretedMicroContext : public tflite::MicroContext {
   // Virtual so that it can be faked for kernel tests.
   virtual TfLiteStatus RequestScratchBufferInArena(size_t bytes,
                                                    int* buffer_idx) {
-    return ::RequestScratchBufferInArena(nullptr, bytes, buffer_idx);
+    return ::RequestScratchBufferInArena(ctx_, bytes, buffer_idx);
   }
 
   // Get the scratch buffer pointer.
   // This method is only available in Eval stage.
   // Virtual so that it can be faked for kernel tests.
   virtual void* GetScratchBuffer(int buffer_idx) {
-    return ::GetScratchBuffer(nullptr, buffer_idx);
+    return ::GetScratchBuffer(ctx_, buffer_idx);
   }
 
   // Returns a temporary TfLiteTensor struct for a given index.
   // Virtual so that it can be faked for kernel tests.
   virtual TfLiteTensor* AllocateTempTfLiteTensor(int tensor_idx) {
-    return tensor_idx >= 0 ? &tflTensors[tensor_idx] : nullptr;
+    return tensor_idx >= 0 ? &ctx_->tensors[tensor_idx] : nullptr;
   }
 
   // Returns a temporary TfLiteTensor struct for the specified input tensor of a
@@ -634,7 +654,7 @@ class MAGIC_WAND_PreinterpretedMicroContext : public tflite::MicroContext {
   // Returns a TfLiteEvalTensor struct for a given index.
   // Virtual so that it can be faked for kernel tests.
   virtual TfLiteEvalTensor* GetEvalTensor(int tensor_idx) {
-    return ::GetEvalTensor(nullptr, tensor_idx);
+    return ::GetEvalTensor(ctx_, tensor_idx);
   }
 
 
@@ -646,11 +666,30 @@ class MAGIC_WAND_PreinterpretedMicroContext : public tflite::MicroContext {
   void* external_context() { return external_context_payload_; }
 protected:
   void* external_context_payload_ = nullptr;
+  TfLiteContext *ctx_;
 
   TF_LITE_REMOVE_VIRTUAL_DELETE
 };
 
-extern "C" TfLiteStatus MAGIC_WAND_init() {
+extern "C" TfLiteStatus MAGIC_WAND_context_init(MAGIC_WAND_context_t *context, uint8_t *arena, size_t arena_size, const MAGIC_WAND_lock_t *lock) {
+  static_assert(sizeof(MAGIC_WAND_PreinterpretedMicroContext) <= sizeof(context->micro_context),
+                "MicroContext larger than its space in the context");
+
+  if (arena_size < kTensorArenaSize) {
+    return kTfLiteError;
+  }
+  *context = {};
+  context->arena = arena;
+  context->persistent = arena + arena_size;
+  if (lock) {
+    context->lock = *lock;
+  }
+
+  TfLiteContext &ctx = context->ctx;
+  TfLiteTensor * const tflTensors = context->tflTensorsWithMinus1 + 1;
+  TfLiteEvalTensor * const evalTensors = context->evalTensors;
+  TfLiteNode * const tflNodes = context->tflNodes;
+
   ctx.AllocatePersistentBuffer = &AllocatePersistentBuffer;
   ctx.RequestScratchBufferInArena = &RequestScratchBufferInArena;
   ctx.GetScratchBuffer = &GetScratchBuffer;
@@ -658,19 +697,18 @@ extern "C" TfLiteStatus MAGIC_WAND_init() {
   ctx.tensors = tflTensors;
   ctx.tensors_size = 22;
 
-  static MAGIC_WAND_PreinterpretedMicroContext u_ctx;
-  ctx.impl_ = static_cast<void *>(&u_ctx);
+  ctx.impl_ = static_cast<void *>(new (context->micro_context) MAGIC_WAND_PreinterpretedMicroContext(&ctx));
 
-  TfLiteIntArray dimsEmptyTensor = {0};
   tflTensors[-1].dims = &dimsEmptyTensor;
   tflTensors[-1].data.raw = nullptr;
   for(size_t i = 0; i < 22; ++i) {
-    tflTensors[i].data.data = tensorData[i].data;
-    evalTensors[i].data.data = tensorData[i].data;
+    void *data = tensorData[i].data ? tensorData[i].data : arena + tensorData[i].arena_offset;
+    tflTensors[i].data.data = data;
+    evalTensors[i].data.data = data;
     tflTensors[i].type = tensorData[i].type;
     evalTensors[i].type = tensorData[i].type;
     tflTensors[i].is_variable = false;
-    tflTensors[i].allocation_type = (tensor_arena <= tensorData[i].data && tensorData[i].data < tensor_arena + kTensorArenaSize) ? kTfLiteArenaRw : kTfLiteMmapRo;
+    tflTensors[i].allocation_type = tensorData[i].data ? kTfLiteMmapRo : kTfLiteArenaRw;
     tflTensors[i].bytes = tensorData[i].bytes;
     tflTensors[i].dims = tensorData[i].dims;
     evalTensors[i].dims = tensorData[i].dims;
@@ -685,6 +723,9 @@ extern "C" TfLiteStatus MAGIC_WAND_init() {
       tflTensors[i].params.zero_point = quant->affine.zero_point->data[0];
     }
   }
+  // The registrations and the operator data cursor are shared by all the
+  // instances
+  Lock(context);
   registrations[OP_CONV_2D] = tflite::Register_CONV_2D();
   registrations[OP_MAX_POOL_2D] = tflite::Register_MAX_POOL_2D();
   registrations[OP_MUL] = tflite::Register_MUL();
@@ -714,31 +755,45 @@ tflite::micro::resetOfflineOpUserData( tflite::micro::MAGIC_WAND_model::precompu
   size_t precomputed_sb_idx_ctr = 0;
   
   for(size_t i = 0; i < kOpNodesCount; ++i) {
-    next_scratch_buffer_idx = precomputed_sb_idx_ctr;
+    context->next_scratch_buffer_idx = precomputed_sb_idx_ctr;
     if (registrations[nodeData[i].used_op_index].prepare) {
       TfLiteStatus status = registrations[nodeData[i].used_op_index].prepare(&ctx, &tflNodes[i]);
       if (status != kTfLiteOk) {
+        Unlock(context);
         return status;
       }
     }
     precomputed_sb_idx_ctr += node_scratch_buffer_requests[i];
   }
+  Unlock(context);
   return kTfLiteOk;
 }
 
-extern "C" TfLiteTensor* MAGIC_WAND_input(int index) {  
+extern "C" TfLiteStatus MAGIC_WAND_init() {
+  return MAGIC_WAND_context_init(&default_context, tensor_arena, sizeof(tensor_arena), nullptr);
+}
+
+extern "C" TfLiteTensor* MAGIC_WAND_context_input(MAGIC_WAND_context_t *context, int index) {
     static const int inTensorIndices[] = {
     0, 
     };
-    return &ctx.tensors[inTensorIndices[index]];
+    return &context->ctx.tensors[inTensorIndices[index]];
   }
 
-extern "C" TfLiteTensor* MAGIC_WAND_output(int index) {
+extern "C" TfLiteTensor* MAGIC_WAND_context_output(MAGIC_WAND_context_t *context, int index) {
     static const int outTensorIndices[] = {
     21, 
     };
-    return &ctx.tensors[outTensorIndices[index]];
+    return &context->ctx.tensors[outTensorIndices[index]];
   }
+
+extern "C" TfLiteTensor* MAGIC_WAND_input(int index) {
+  return MAGIC_WAND_context_input(&default_context, index);
+}
+
+extern "C" TfLiteTensor* MAGIC_WAND_output(int index) {
+  return MAGIC_WAND_context_output(&default_context, index);
+}
   
 
 // Returns the number of input tensors.
@@ -779,6 +834,13 @@ extern "C" int *MAGIC_WAND_output_dims(int index) {
 
 
 extern "C" TfLiteStatus MAGIC_WAND_invoke() {
+  return MAGIC_WAND_context_invoke(&default_context);
+}
+
+// Runs the operators of an instance, from the first operator data
+static TfLiteStatus Invoke(MAGIC_WAND_context_t *context) {
+  TfLiteContext &ctx = context->ctx;
+  TfLiteNode * const tflNodes = context->tflNodes;
 
 #if TF_LITE_MICRO_USE_OFFLINE_OP_USER_DATA
 tflite::micro::resetOfflineOpUserData( tflite::micro::MAGIC_WAND_model::precomputed_op_user_data);
@@ -796,3 +858,14 @@ tflite::micro::resetOfflineOpUserData( tflite::micro::MAGIC_WAND_model::precompu
   return kTfLiteOk;
 }
 
+extern "C" TfLiteStatus MAGIC_WAND_context_invoke(MAGIC_WAND_context_t *context) {
+#if TF_LITE_MICRO_USE_OFFLINE_OP_USER_DATA
+  Lock(context);
+  TfLiteStatus status = Invoke(context);
+  Unlock(context);
+  return status;
+#else
+  return Invoke(context);
+#endif  // TF_LITE_MICRO_USE_OFFLINE_OP_USER_DATA
+}
+
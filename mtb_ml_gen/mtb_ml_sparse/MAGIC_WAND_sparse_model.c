@@ -0,0 +1,1009 @@
+/***************************************************************************//**
+* \file MAGIC_WAND_sparse_model.c
+*
+* \brief
+* Autogenerated with train/sparse_export.py, this file contains MAGIC_WAND
+* sparse model data for source/sparse_nn.c.
+*******************************************************************************/
+
+#include "sparse_nn.h"
+
+static const uint16_t MAGIC_WAND_sparse_0_start[] =
+{
+    0, 1, 1, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 4, 4, 4,
+    4, 4, 5, 5, 5, 6, 6, 6, 6, 6, 7, 8, 8, 9, 10, 11,
+    11, 12, 13, 13, 13, 13, 14, 14, 14, 15, 16, 17, 18, 18, 18, 19,
+    20, 20, 21, 22, 23, 23, 23, 23, 24, 25, 25, 26, 27, 27, 28, 28,
+    28, 29, 29, 30, 30, 30, 31, 31, 32, 33, 34, 34, 34, 34, 34, 35,
+    35, 35, 35, 36, 37, 38, 39, 39, 39, 40, 41, 42, 42, 42, 42, 42,
+    43, 43, 44, 44, 45, 45, 46, 47, 47, 48, 48, 48, 49, 49, 50, 50,
+    51, 52, 52, 52, 53, 53, 54, 54, 55, 56, 57, 58, 59, 59, 60, 60,
+    60, 61, 62, 63, 64, 64, 65, 66, 67, 68, 69, 69, 70, 71, 71, 71,
+    72
+};
+
+static const uint8_t MAGIC_WAND_sparse_0_index[] =
+{
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0
+};
+
+static const float MAGIC_WAND_sparse_0_value[] =
+{
+    -2.901783586e-01f, -2.507002950e-01f, -2.640025318e-01f, -3.038041890e-01f,
+    1.692212969e-01f, -3.873407543e-01f, -1.418975145e-01f, -3.303048611e-01f,
+    2.158860564e-01f, -2.592670918e-01f, 1.914356202e-01f, -3.285741806e-01f,
+    1.977590770e-01f, 3.623499870e-01f, 3.001379371e-01f, -1.669723839e-01f,
+    2.120987624e-01f, 3.776364923e-01f, -1.818874180e-01f, -2.058136910e-01f,
+    -1.649676710e-01f, -1.717627496e-01f, -2.487798929e-01f, 1.528453827e-01f,
+    3.391658664e-01f, 2.296365499e-01f, 3.491186798e-01f, 1.920499653e-01f,
+    -3.161991239e-01f, 2.714407146e-01f, 1.753832549e-01f, 2.212402523e-01f,
+    -1.983830780e-01f, -1.639131308e-01f, -2.776548862e-01f, 3.461956680e-01f,
+    -2.374368906e-01f, 2.014282495e-01f, 3.674767315e-01f, 3.466073573e-01f,
+    1.631533355e-01f, -4.246910810e-01f, -1.662103981e-01f, -1.871948391e-01f,
+    3.516640663e-01f, 1.748182029e-01f, 1.687965244e-01f, 3.439262211e-01f,
+    1.812845170e-01f, 1.827465296e-01f, -1.781910360e-01f, 2.522273362e-01f,
+    2.703963816e-01f, 3.374189734e-01f, 2.279345244e-01f, 1.567275226e-01f,
+    1.760793179e-01f, 3.363650739e-01f, 2.881234586e-01f, 3.342522681e-01f,
+    2.233408242e-01f, -1.694962680e-01f, 2.002622038e-01f, 1.547727585e-01f,
+    2.518366873e-01f, 2.132214308e-01f, 1.967429966e-01f, -1.499853134e-01f,
+    2.976951003e-01f, 2.137700468e-01f, 2.756842971e-01f, 4.542722404e-01f
+};
+
+static const float MAGIC_WAND_sparse_0_bias[] =
+{
+    -9.435734153e-02f, -1.064669788e-01f, -1.923218369e-02f, 7.323595881e-02f,
+    2.830414288e-02f, 9.478710592e-03f, 1.031395495e-01f, -5.563597381e-02f,
+    -3.403585032e-02f, 3.704715893e-02f, 1.733887475e-03f, 2.779912390e-02f,
+    3.754589707e-02f, 6.500880700e-03f, 2.104436420e-02f, 7.544193417e-02f
+};
+
+static const float MAGIC_WAND_sparse_2_scale[] =
+{
+    4.420016479e+01f, 3.239289093e+01f, 2.710560608e+01f, 2.950506592e+01f,
+    2.028969383e+01f, 2.183206558e+01f, 2.321283531e+01f, 3.727536774e+01f,
+    2.121589851e+01f, 1.894729233e+01f, 2.141965866e+01f, 2.842284203e+01f,
+    2.547844124e+01f, 2.365231895e+01f, 2.662924576e+01f, 2.419679642e+01f
+};
+
+static const float MAGIC_WAND_sparse_2_shift[] =
+{
+    -1.110383868e-01f, -6.721283197e-01f, -6.170203686e-01f, -2.651737690e+00f,
+    -1.093003035e+00f, -1.435819149e+00f, -2.706569433e+00f, -5.170723200e-01f,
+    -9.614325166e-01f, -1.204263806e+00f, -1.462549090e+00f, -1.302037239e+00f,
+    -1.921401143e+00f, -7.858718634e-01f, -1.314128160e+00f, -2.379559278e+00f
+};
+
+static const uint16_t MAGIC_WAND_sparse_3_start[] =
+{
+    0, 11, 18, 26, 34, 42, 49, 60, 66, 75, 80, 87, 94, 98, 107, 114,
+    119, 126, 133, 141, 149, 155, 158, 165, 176, 183, 192, 200, 206, 213, 219, 227,
+    233, 242, 249, 255, 266, 275, 286, 291, 300, 309, 315, 324, 335, 344, 354, 359,
+    364, 375, 383, 388, 398, 407, 412, 420, 429, 441, 448, 456, 470, 482, 491, 503,
+    508, 514, 521, 525, 531, 536, 541, 547, 551, 557, 568, 577, 586, 592, 598, 606,
+    617, 629, 637, 648, 657, 666, 674, 682, 692, 702, 710, 720, 729, 732, 743, 751,
+    759, 767, 775, 781, 786, 792, 798, 809, 817, 821, 828, 834, 841, 851, 857, 865,
+    875, 886, 896, 904, 907, 917, 927, 935, 946, 956, 966, 972, 982, 992, 1001, 1009,
+    1018, 1026, 1033, 1040, 1051, 1061, 1067, 1077, 1087, 1097, 1102, 1115, 1121, 1131, 1138, 1150,
+    1157, 1168, 1179, 1185, 1192, 1198, 1202, 1214, 1220, 1227, 1238, 1250, 1258, 1272, 1282, 1290,
+    1300, 1310, 1317, 1328, 1338, 1347, 1357, 1364, 1376, 1384, 1390, 1402, 1410, 1418, 1430, 1434,
+    1438, 1444, 1448, 1453, 1456, 1465, 1470, 1478, 1485, 1490, 1498, 1505, 1512, 1521, 1533, 1539,
+    1543, 1555, 1560, 1564, 1574, 1582, 1582, 1592, 1601, 1611, 1620, 1630, 1639, 1651, 1660, 1665,
+    1672, 1682, 1693, 1701, 1705, 1714, 1724, 1730, 1741, 1745, 1751, 1755, 1760, 1769, 1773, 1778,
+    1781, 1784, 1789, 1798, 1807, 1814, 1818, 1826, 1833, 1840, 1848, 1854, 1864, 1871, 1876, 1883,
+    1890, 1901, 1908, 1918, 1925, 1927, 1937, 1946, 1951, 1960, 1971, 1982, 1992, 2004, 2012, 2021,
+    2027, 2033, 2043, 2053, 2059, 2068, 2079, 2089, 2095, 2107, 2118, 2127, 2139, 2149, 2160, 2168,
+    2174, 2181, 2189, 2194, 2199, 2205, 2209, 2214, 2225, 2234, 2246, 2258, 2265, 2275, 2286, 2297,
+    2304
+};
+
+static const uint8_t MAGIC_WAND_sparse_3_index[] =
+{
+    1, 3, 4, 5, 6, 9, 11, 12, 13, 14, 15, 3, 4, 5, 8, 9,
+    12, 14, 0, 2, 3, 4, 11, 12, 13, 15, 3, 4, 5, 8, 9, 10,
+    11, 14, 3, 4, 5, 9, 10, 12, 13, 14, 1, 2, 3, 8, 11, 13,
+    14, 0, 1, 2, 4, 5, 6, 9, 11, 12, 13, 14, 2, 3, 5, 8,
+    10, 15, 1, 2, 3, 4, 10, 11, 13, 14, 15, 0, 7, 8, 9, 13,
+    0, 3, 4, 5, 6, 8, 10, 2, 4, 7, 9, 11, 14, 15, 0, 3,
+    12, 13, 0, 3, 4, 5, 6, 8, 9, 11, 15, 0, 1, 7, 8, 11,
+    12, 13, 5, 6, 7, 8, 13, 0, 3, 8, 9, 10, 11, 13, 3, 4,
+    7, 9, 10, 11, 13, 0, 2, 3, 5, 11, 12, 13, 15, 2, 3, 4,
+    6, 7, 10, 11, 13, 3, 7, 9, 13, 14, 15, 12, 13, 14, 1, 2,
+    3, 4, 6, 11, 12, 0, 1, 2, 4, 6, 9, 11, 12, 13, 14, 15,
+    2, 3, 7, 11, 12, 13, 14, 0, 3, 4, 5, 6, 7, 10, 13, 15,
+    0, 2, 3, 8, 10, 11, 12, 15, 0, 3, 5, 11, 12, 15, 0, 1,
+    4, 6, 9, 10, 13, 0, 1, 4, 6, 8, 15, 0, 1, 4, 5, 7,
+    8, 11, 12, 0, 4, 6, 7, 13, 14, 0, 1, 2, 6, 7, 9, 10,
+    13, 15, 1, 2, 4, 7, 12, 14, 15, 0, 1, 7, 11, 13, 14, 0,
+    1, 2, 4, 6, 7, 8, 9, 11, 14, 15, 0, 1, 2, 3, 5, 7,
+    11, 13, 14, 1, 3, 4, 5, 6, 8, 10, 12, 13, 14, 15, 1, 6,
+    13, 14, 15, 1, 2, 3, 6, 7, 8, 11, 13, 15, 1, 2, 3, 4,
+    6, 11, 12, 14, 15, 0, 2, 6, 7, 10, 13, 1, 2, 3, 7, 10,
+    11, 13, 14, 15, 0, 1, 2, 3, 4, 7, 9, 12, 13, 14, 15, 1,
+    2, 3, 5, 6, 7, 9, 14, 15, 0, 1, 2, 4, 5, 6, 7, 8,
+    10, 12, 0, 2, 6, 7, 11, 5, 6, 11, 13, 15, 0, 1, 2, 5,
+    6, 7, 8, 10, 11, 12, 15, 0, 1, 6, 7, 8, 10, 12, 15, 0,
+    4, 6, 8, 10, 0, 1, 4, 5, 7, 8, 9, 12, 14, 15, 0, 1,
+    4, 6, 7, 8, 10, 13, 14, 0, 2, 3, 4, 12, 0, 2, 6, 7,
+    11, 12, 14, 15, 0, 2, 5, 6, 7, 9, 10, 14, 15, 0, 1, 3,
+    4, 5, 6, 8, 10, 11, 12, 13, 15, 0, 1, 2, 6, 7, 11, 15,
+    0, 1, 2, 4, 12, 13, 14, 15, 0, 1, 3, 4, 5, 6, 7, 8,
+    9, 11, 12, 13, 14, 15, 0, 2, 3, 4, 5, 7, 8, 9, 11, 12,
+    14, 15, 0, 1, 2, 3, 7, 8, 9, 12, 15, 0, 1, 2, 3, 4,
+    5, 6, 7, 9, 11, 13, 15, 3, 7, 11, 14, 15, 3, 4, 5, 6,
+    13, 15, 0, 2, 6, 7, 9, 13, 15, 8, 11, 13, 14, 3, 8, 10,
+    12, 13, 14, 3, 6, 9, 13, 15, 2, 3, 6, 12, 15, 4, 7, 8,
+    9, 11, 12, 5, 6, 10, 15, 1, 3, 6, 7, 13, 15, 1, 2, 3,
+    4, 5, 6, 9, 10, 11, 13, 15, 1, 4, 5, 6, 7, 8, 9, 13,
+    15, 3, 4, 6, 7, 10, 11, 12, 13, 15, 0, 4, 7, 11, 12, 13,
+    3, 6, 10, 11, 13, 15, 3, 5, 6, 7, 11, 12, 13, 14, 0, 1,
+    2, 3, 4, 5, 7, 9, 11, 13, 14, 0, 2, 4, 6, 7, 8, 9,
+    10, 12, 13, 14, 15, 2, 3, 5, 6, 10, 11, 12, 14, 2, 3, 4,
+    5, 6, 8, 9, 11, 12, 13, 15, 3, 4, 5, 6, 8, 9, 12, 13,
+    14, 2, 3, 8, 9, 10, 11, 12, 13, 14, 3, 7, 9, 10, 11, 12,
+    13, 15, 2, 3, 4, 6, 9, 12, 14, 15, 1, 2, 3, 6, 7, 10,
+    11, 12, 14, 15, 2, 3, 4, 6, 7, 9, 11, 13, 14, 15, 3, 4,
+    6, 7, 8, 9, 12, 14, 0, 1, 5, 7, 8, 10, 11, 12, 13, 14,
+    0, 1, 4, 5, 7, 8, 10, 13, 15, 1, 9, 13, 0, 1, 3, 5,
+    6, 7, 8, 10, 12, 13, 14, 0, 1, 2, 6, 7, 8, 10, 14, 1,
+    3, 4, 6, 9, 11, 13, 15, 0, 1, 6, 7, 8, 10, 12, 14, 0,
+    1, 2, 4, 5, 10, 14, 15, 1, 3, 4, 10, 13, 15, 1, 3, 6,
+    10, 13, 0, 2, 10, 12, 13, 15, 2, 4, 6, 12, 14, 15, 1, 3,
+    5, 6, 7, 8, 10, 12, 13, 14, 15, 0, 1, 2, 3, 5, 7, 8,
+    13, 0, 1, 12, 15, 0, 1, 4, 5, 7, 10, 14, 1, 6, 7, 10,
+    11, 12, 0, 1, 2, 3, 4, 11, 12, 1, 4, 5, 7, 8, 9, 11,
+    13, 14, 15, 1, 4, 6, 9, 11, 13, 1, 2, 6, 7, 8, 12, 14,
+    15, 0, 2, 3, 4, 5, 6, 8, 9, 11, 14, 0, 2, 4, 5, 6,
+    9, 11, 12, 13, 14, 15, 0, 2, 3, 6, 8, 9, 10, 12, 14, 15,
+    0, 1, 2, 4, 6, 12, 13, 14, 3, 6, 9, 2, 4, 5, 6, 7,
+    8, 9, 10, 12, 14, 0, 2, 4, 5, 6, 8, 9, 11, 13, 15, 3,
+    5, 6, 8, 9, 10, 13, 15, 0, 1, 5, 6, 7, 8, 10, 12, 13,
+    14, 15, 0, 2, 3, 5, 6, 8, 10, 11, 13, 15, 0, 2, 5, 6,
+    7, 9, 10, 12, 14, 15, 5, 6, 8, 10, 12, 13, 1, 3, 4, 7,
+    9, 10, 11, 12, 13, 14, 0, 1, 2, 3, 4, 7, 11, 12, 13, 14,
+    1, 4, 6, 7, 8, 9, 10, 11, 15, 0, 2, 3, 5, 6, 7, 9,
+    14, 2, 3, 4, 6, 7, 9, 10, 13, 15, 1, 3, 4, 5, 6, 7,
+    9, 14, 3, 4, 6, 10, 11, 14, 15, 3, 5, 6, 10, 11, 13, 15,
+    1, 2, 3, 4, 6, 7, 9, 11, 12, 13, 14, 4, 5, 6, 7, 8,
+    9, 11, 12, 13, 14, 2, 3, 4, 10, 14, 15, 0, 1, 3, 4, 6,
+    7, 9, 11, 12, 14, 0, 1, 3, 5, 6, 7, 10, 11, 12, 13, 1,
+    2, 3, 7, 9, 10, 12, 13, 14, 15, 2, 3, 8, 9, 14, 1, 2,
+    3, 4, 5, 6, 7, 8, 11, 12, 13, 14, 15, 0, 1, 3, 9, 11,
+    12, 1, 3, 4, 5, 6, 7, 11, 13, 14, 15, 3, 5, 8, 11, 12,
+    13, 14, 1, 2, 3, 4, 5, 6, 7, 8, 9, 11, 12, 15, 2, 3,
+    4, 8, 9, 11, 15, 0, 1, 2, 3, 4, 5, 7, 8, 11, 13, 15,
+    0, 1, 2, 3, 4, 5, 7, 10, 11, 12, 14, 0, 1, 5, 6, 10,
+    13, 1, 2, 3, 7, 8, 11, 12, 3, 5, 8, 12, 13, 14, 3, 4,
+    6, 15, 0, 1, 3, 4, 5, 6, 7, 8, 9, 12, 13, 15, 5, 7,
+    12, 13, 14, 15, 3, 4, 8, 10, 11, 12, 13, 0, 1, 2, 3, 5,
+    6, 7, 8, 10, 12, 14, 0, 1, 2, 3, 4, 5, 7, 8, 10, 11,
+    12, 15, 2, 4, 5, 6, 7, 8, 13, 15, 0, 1, 2, 3, 5, 6,
+    7, 8, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3, 4, 6, 8, 10,
+    11, 15, 2, 3, 5, 7, 8, 10, 11, 12, 0, 1, 2, 3, 5, 8,
+    9, 10, 11, 14, 0, 1, 2, 3, 4, 8, 9, 10, 11, 15, 1, 3,
+    4, 7, 8, 10, 11, 1, 2, 3, 6, 7, 8, 9, 11, 13, 14, 15,
+    1, 2, 3, 6, 7, 11, 12, 13, 14, 15, 3, 5, 6, 7, 8, 10,
+    12, 14, 15, 1, 2, 3, 4, 6, 9, 10, 11, 14, 15, 2, 5, 6,
+    10, 11, 12, 13, 0, 1, 4, 5, 6, 8, 9, 10, 12, 13, 14, 15,
+    0, 2, 3, 5, 6, 10, 11, 15, 2, 5, 6, 10, 12, 15, 0, 1,
+    2, 4, 6, 7, 8, 10, 11, 12, 14, 15, 2, 3, 4, 5, 6, 9,
+    14, 15, 2, 4, 6, 8, 11, 12, 14, 15, 0, 1, 2, 3, 4, 5,
+    6, 7, 8, 9, 12, 14, 2, 3, 8, 12, 3, 8, 10, 14, 2, 6,
+    9, 10, 13, 14, 2, 11, 13, 15, 1, 3, 5, 6, 8, 0, 9, 11,
+    0, 1, 2, 3, 7, 9, 10, 12, 14, 2, 3, 4, 14, 15, 1, 3,
+    6, 8, 9, 11, 13, 15, 0, 2, 3, 7, 9, 13, 14, 0, 1, 7,
+    9, 13, 3, 4, 5, 6, 9, 11, 13, 15, 1, 2, 3, 5, 6, 12,
+    13, 0, 6, 7, 8, 9, 11, 15, 0, 2, 4, 6, 9, 11, 12, 14,
+    15, 0, 1, 2, 4, 5, 7, 8, 9, 10, 12, 13, 15, 0, 7, 10,
+    11, 12, 13, 6, 9, 10, 15, 0, 1, 2, 3, 5, 6, 7, 8, 9,
+    10, 13, 15, 1, 5, 7, 11, 12, 2, 3, 10, 12, 0, 1, 5, 7,
+    8, 9, 10, 11, 12, 13, 0, 1, 3, 5, 7, 9, 11, 13, 0, 1,
+    2, 5, 6, 7, 8, 10, 11, 14, 1, 3, 4, 7, 9, 11, 12, 13,
+    14, 2, 3, 4, 6, 7, 9, 10, 11, 14, 15, 0, 1, 3, 5, 8,
+    9, 10, 11, 15, 1, 4, 5, 7, 8, 10, 11, 12, 14, 15, 1, 4,
+    6, 7, 8, 9, 10, 12, 15, 0, 1, 2, 3, 4, 5, 6, 8, 9,
+    10, 11, 13, 0, 1, 3, 6, 7, 8, 12, 13, 14, 3, 6, 9, 12,
+    14, 2, 3, 4, 5, 7, 10, 14, 0, 1, 2, 3, 6, 7, 11, 12,
+    13, 14, 0, 1, 3, 4, 5, 6, 9, 10, 11, 13, 15, 1, 2, 3,
+    5, 10, 11, 12, 13, 2, 4, 8, 14, 1, 2, 3, 4, 6, 9, 11,
+    14, 15, 1, 2, 3, 4, 5, 7, 10, 11, 13, 14, 2, 3, 4, 7,
+    11, 15, 1, 2, 3, 4, 5, 6, 9, 10, 13, 14, 15, 2, 8, 10,
+    13, 0, 4, 8, 13, 14, 15, 0, 6, 9, 15, 1, 7, 8, 11, 13,
+    1, 2, 3, 7, 8, 10, 11, 12, 15, 1, 5, 9, 13, 2, 9, 11,
+    12, 14, 1, 13, 14, 2, 7, 14, 1, 2, 3, 9, 11, 2, 4, 5,
+    6, 7, 8, 10, 12, 15, 2, 3, 4, 5, 7, 8, 9, 11, 14, 2,
+    5, 6, 9, 11, 14, 15, 6, 11, 12, 14, 0, 2, 4, 7, 8, 9,
+    14, 15, 0, 2, 4, 7, 9, 11, 14, 3, 4, 9, 10, 12, 13, 14,
+    0, 2, 3, 6, 7, 11, 13, 15, 0, 1, 3, 4, 6, 14, 0, 3,
+    4, 5, 6, 7, 8, 9, 13, 15, 3, 4, 6, 7, 9, 11, 15, 1,
+    3, 4, 12, 14, 2, 3, 4, 8, 12, 13, 15, 4, 6, 7, 9, 11,
+    13, 14, 1, 2, 3, 6, 7, 8, 10, 11, 12, 13, 14, 3, 4, 6,
+    9, 10, 13, 15, 1, 3, 4, 6, 7, 9, 11, 12, 14, 15, 2, 4,
+    5, 6, 9, 11, 15, 0, 2, 2, 3, 4, 5, 6, 7, 9, 10, 11,
+    13, 0, 2, 3, 6, 7, 9, 11, 13, 15, 0, 2, 10, 13, 14, 0,
+    2, 4, 7, 8, 10, 11, 14, 15, 0, 1, 2, 3, 6, 7, 8, 9,
+    13, 14, 15, 0, 2, 3, 5, 6, 9, 10, 11, 13, 14, 15, 0, 2,
+    3, 4, 5, 6, 10, 12, 13, 15, 0, 2, 3, 4, 6, 8, 9, 10,
+    11, 12, 14, 15, 1, 3, 4, 5, 9, 11, 12, 15, 2, 4, 5, 6,
+    9, 11, 13, 14, 15, 3, 5, 9, 11, 12, 14, 0, 3, 4, 13, 14,
+    15, 0, 2, 3, 5, 6, 8, 9, 11, 13, 15, 0, 1, 3, 4, 9,
+    10, 11, 12, 14, 15, 3, 4, 9, 13, 14, 15, 2, 4, 6, 9, 10,
+    11, 12, 13, 15, 0, 1, 2, 5, 6, 7, 8, 10, 11, 14, 15, 0,
+    1, 2, 5, 6, 8, 10, 11, 12, 15, 2, 4, 6, 9, 12, 15, 0,
+    1, 3, 4, 5, 6, 7, 8, 10, 11, 12, 15, 0, 1, 2, 4, 5,
+    6, 8, 9, 10, 11, 12, 2, 4, 6, 8, 9, 10, 12, 14, 15, 0,
+    1, 3, 5, 6, 7, 8, 10, 11, 12, 13, 15, 0, 1, 2, 3, 5,
+    6, 8, 10, 11, 12, 0, 3, 4, 5, 6, 7, 8, 9, 10, 14, 15,
+    0, 1, 3, 5, 7, 8, 10, 14, 0, 1, 6, 11, 12, 13, 1, 2,
+    4, 5, 6, 12, 14, 0, 1, 5, 6, 7, 8, 10, 13, 1, 2, 7,
+    9, 11, 1, 6, 8, 12, 15, 0, 1, 2, 7, 9, 14, 0, 1, 2,
+    8, 1, 2, 10, 12, 14, 0, 1, 2, 5, 6, 7, 9, 10, 11, 13,
+    15, 0, 1, 4, 6, 7, 9, 10, 13, 15, 0, 1, 5, 6, 7, 8,
+    9, 10, 12, 13, 14, 15, 0, 1, 2, 3, 5, 6, 7, 8, 9, 12,
+    13, 15, 0, 1, 3, 7, 11, 14, 15, 0, 1, 2, 3, 6, 7, 9,
+    10, 13, 15, 0, 1, 2, 3, 4, 6, 7, 9, 11, 12, 14, 0, 1,
+    2, 3, 6, 7, 9, 10, 11, 12, 14, 0, 1, 4, 6, 7, 11, 13
+};
+
+static const float MAGIC_WAND_sparse_3_value[] =
+{
+    -9.809597582e-02f, -2.381797880e-01f, -2.291415930e-01f, 1.269536465e-01f,
+    8.074936271e-02f, -1.886087507e-01f, 3.018898666e-01f, 1.574447453e-01f,
+    1.165074110e-01f, -1.885842085e-01f, 1.817602664e-01f, -9.652709216e-02f,
+    1.245156825e-01f, 1.609021872e-01f, 8.445180207e-02f, 1.724522263e-01f,
+    1.305086315e-01f, 2.611548603e-01f, -1.047869250e-01f, -2.062071860e-01f,
+    2.446713001e-01f, -1.027981490e-01f, 1.010083929e-01f, 1.610880196e-01f,
+    2.538814247e-01f, -1.078903973e-01f, -1.335406452e-01f, -2.115758359e-01f,
+    1.656052321e-01f, -6.804353744e-02f, -1.936503500e-01f, 1.333437711e-01f,
+    2.553706765e-01f, -2.099891007e-01f, -1.170288920e-01f, 8.831320703e-02f,
+    2.528444529e-01f, 7.719337195e-02f, 1.411383450e-01f, 1.207801625e-01f,
+    7.259581983e-02f, 1.391491890e-01f, -8.340103179e-02f, -1.105406210e-01f,
+    1.917959601e-01f, -1.383635253e-01f, 1.548710167e-01f, 2.409129739e-01f,
+    1.309069991e-01f, 1.281172335e-01f, -1.075769216e-01f, 1.191863269e-01f,
+    -1.888073534e-01f, 1.421845704e-01f, -1.417692900e-01f, -1.451081336e-01f,
+    2.628550828e-01f, 1.298069358e-01f, -1.251403540e-01f, -1.143619716e-01f,
+    1.497257203e-01f, -1.201397926e-01f, 1.527746618e-01f, 9.334740043e-02f,
+    1.659881175e-01f, 9.020930529e-02f, -1.232640073e-01f, -1.316344142e-01f,
+    1.549118906e-01f, 1.070647985e-01f, 9.515460581e-02f, 1.748536974e-01f,
+    2.407531738e-01f, 1.568510532e-01f, -1.011169925e-01f, 7.796075195e-02f,
+    1.367637813e-01f, -7.689934969e-02f, 1.164002270e-01f, 1.572506130e-01f,
+    -1.552730650e-01f, -1.188509762e-01f, -1.166032925e-01f, -1.523380578e-01f,
+    1.589181721e-01f, -1.231658086e-01f, -2.340163887e-01f, -1.147202328e-01f,
+    -1.487530321e-01f, 1.034828946e-01f, -9.905621409e-02f, -1.290454865e-01f,
+    -1.497097760e-01f, 7.015266269e-02f, 7.076968253e-02f, 7.686352730e-02f,
+    1.098169759e-01f, -8.433697373e-02f, 8.884912729e-02f, -1.615744084e-01f,
+    7.790515572e-02f, -9.672673047e-02f, 1.145955473e-01f, -8.752781898e-02f,
+    -1.424566358e-01f, -1.341958344e-01f, -1.263127476e-01f, -9.868142754e-02f,
+    9.340558946e-02f, 1.258880049e-01f, -1.343750656e-01f, -1.079796851e-01f,
+    -1.872539073e-01f, -1.577835530e-01f, 1.232393757e-01f, 1.143547520e-01f,
+    1.009800807e-01f, 1.272888929e-01f, 1.220781505e-01f, 2.775419354e-01f,
+    -9.353177994e-02f, -8.604983985e-02f, -1.103909537e-01f, -9.375526756e-02f,
+    -1.155756190e-01f, -9.016167372e-02f, -1.781611890e-01f, -8.934082091e-02f,
+    1.236576289e-01f, -1.770662963e-01f, -1.270705462e-01f, -1.211579666e-01f,
+    -1.879825741e-01f, -7.294405252e-02f, -1.415133774e-01f, -1.563004702e-01f,
+    -1.319426596e-01f, 1.599065661e-01f, 7.390244305e-02f, 2.601990998e-01f,
+    9.513413161e-02f, 9.973271936e-02f, 7.906941324e-02f, 1.222633496e-01f,
+    9.146117419e-02f, 2.129546404e-01f, -1.324033439e-01f, 1.087112129e-01f,
+    2.246593982e-01f, -1.253543943e-01f, 9.194541723e-02f, -1.474709064e-01f,
+    -1.339721978e-01f, 1.329243779e-01f, -1.730048209e-01f, 1.891041994e-01f,
+    2.277826667e-01f, 9.162332118e-02f, -7.448796928e-02f, -1.286076605e-01f,
+    -1.581723690e-01f, 9.771670401e-02f, -8.154960722e-02f, 7.985302806e-02f,
+    1.556072533e-01f, 1.067421809e-01f, -9.806177765e-02f, -1.227722540e-01f,
+    -1.465147287e-01f, -7.065700740e-02f, -9.408958256e-02f, -1.475653350e-01f,
+    1.658202410e-01f, -8.675590158e-02f, 1.628891230e-01f, -1.179995313e-01f,
+    -1.383703649e-01f, 1.524976045e-01f, 9.402938187e-02f, 1.745978892e-01f,
+    8.808026463e-02f, 1.113840565e-01f, -1.006392017e-01f, -8.669650555e-02f,
+    2.400017083e-01f, 1.704470813e-01f, -1.434888989e-01f, -1.353217363e-01f,
+    1.467529386e-01f, -7.555305958e-02f, 1.001061499e-01f, 1.413657367e-01f,
+    1.552056968e-01f, -1.245321333e-01f, -2.543329597e-01f, 1.472253501e-01f,
+    -7.132367045e-02f, -7.467871904e-02f, 9.944210947e-02f, -1.400035769e-01f,
+    1.119573563e-01f, -1.119923070e-01f, 8.980818838e-02f, 1.714643389e-01f,
+    -8.558612317e-02f, -1.996783763e-01f, 8.481872082e-02f, 1.122155041e-01f,
+    -1.960873455e-01f, -9.281452745e-02f, -8.823613077e-02f, 7.923430949e-02f,
+    -2.594285011e-01f, 1.834720075e-01f, 2.291703373e-01f, -9.324949235e-02f,
+    -1.721028984e-01f, 1.097267568e-01f, -1.931535751e-01f, 1.523211151e-01f,
+    1.704194248e-01f, -1.189201027e-01f, 1.063939929e-01f, 1.113604978e-01f,
+    1.069727838e-01f, 1.189248860e-01f, 1.357671171e-01f, 1.070275679e-01f,
+    -1.095552668e-01f, -2.035683244e-01f, 1.644438505e-01f, -9.071686864e-02f,
+    1.079389229e-01f, 3.070291281e-01f, 1.648933291e-01f, 2.199557573e-01f,
+    -1.929371804e-01f, 1.659161597e-01f, 1.079062074e-01f, 1.363200247e-01f,
+    -1.833468378e-01f, -2.181391269e-01f, 1.363176554e-01f, -1.560481936e-01f,
+    1.204194799e-01f, 1.192819402e-01f, 1.353315413e-01f, 7.807685435e-02f,
+    -9.831700474e-02f, 1.562082916e-01f, 2.177339494e-01f, 1.243044585e-01f,
+    1.283517927e-01f, -8.180871606e-02f, -9.205862135e-02f, 1.915865839e-01f,
+    1.000346467e-01f, 1.782464981e-01f, 1.128664240e-01f, -1.349548250e-01f,
+    8.460022509e-02f, 1.029174998e-01f, 1.099139675e-01f, -1.123621762e-01f,
+    1.008014157e-01f, -1.811097413e-01f, -2.051458210e-01f, -2.286694497e-01f,
+    1.990418136e-01f, 1.825336814e-01f, -1.917782426e-01f, 2.618381679e-01f,
+    1.707287282e-01f, 8.113756031e-02f, -1.315189600e-01f, -9.807073325e-02f,
+    1.433014274e-01f, 1.374002546e-01f, -8.621613681e-02f, 1.786592156e-01f,
+    -9.036005288e-02f, -1.142916009e-01f, 1.648539454e-01f, 1.126688346e-01f,
+    7.771239430e-02f, 1.433627158e-01f, 1.431212723e-01f, -2.190196812e-01f,
+    -2.412654608e-01f, 9.113460779e-02f, -2.006970197e-01f, -1.484813988e-01f,
+    7.904112339e-02f, 9.222671390e-02f, -1.093328074e-01f, 2.010729015e-01f,
+    -1.743966490e-01f, 2.352500111e-01f, 1.479187459e-01f, -1.435816139e-01f,
+    -1.082903594e-01f, 8.836164325e-02f, 1.381904781e-01f, 2.067204565e-01f,
+    -8.994821459e-02f, 1.198701784e-01f, 1.250136495e-01f, -9.925232083e-02f,
+    1.324568540e-01f, 9.631074220e-02f, 9.595873952e-02f, -1.473402679e-01f,
+    -1.399832815e-01f, 1.151984856e-01f, -3.294563293e-01f, -1.006755903e-01f,
+    6.778760999e-02f, 2.404534817e-01f, 1.356927156e-01f, -1.213387921e-01f,
+    2.301009297e-01f, 2.226137966e-01f, -7.933196425e-02f, 1.181734651e-01f,
+    -1.272381544e-01f, -8.759807050e-02f, 1.401096433e-01f, 1.159489825e-01f,
+    7.346529514e-02f, 8.526970446e-02f, 1.558299810e-01f, 1.380959749e-01f,
+    7.931255549e-02f, 1.984907687e-01f, 1.543542296e-01f, 8.682034165e-02f,
+    1.306609362e-01f, -2.050435990e-01f, 1.176950410e-01f, -1.447273642e-01f,
+    -1.066191196e-01f, -1.115087345e-01f, -7.560516894e-02f, -1.972281486e-01f,
+    -3.333030641e-01f, -4.418052435e-01f, -2.944847345e-01f, 8.744046837e-02f,
+    -2.768402100e-01f, 1.547690183e-01f, -2.655006051e-01f, -2.503366470e-01f,
+    -3.338358104e-01f, -9.629020095e-02f, -1.934529245e-01f, -1.357158124e-01f,
+    1.296852529e-01f, -1.056031808e-01f, 8.332014829e-02f, -1.108082235e-01f,
+    1.555487663e-01f, 1.346281171e-01f, 9.750177711e-02f, 1.255230159e-01f,
+    -3.358208835e-01f, -5.261563659e-01f, -8.906195313e-02f, -2.482437491e-01f,
+    1.766485423e-01f, -2.471052259e-01f, -1.549957097e-01f, -2.384680212e-01f,
+    -1.017493159e-01f, -1.612178981e-01f, -9.276651591e-02f, -2.833341956e-01f,
+    -2.832584679e-01f, 1.807883233e-01f, -1.916361004e-01f, -1.717069894e-01f,
+    -1.244379506e-01f, -1.104048565e-01f, 9.866929054e-02f, -1.028283238e-01f,
+    -8.850476146e-02f, 1.647414565e-01f, -8.241425455e-02f, -1.132185310e-01f,
+    -2.058404535e-01f, -4.873889685e-01f, -9.519911557e-02f, -2.867705822e-01f,
+    -2.680261433e-01f, -2.716056108e-01f, -9.292408824e-02f, -1.998116225e-01f,
+    -2.584761977e-01f, -1.095116884e-01f, -2.107750326e-01f, -2.431399822e-01f,
+    -8.869875222e-02f, -1.000724211e-01f, -1.995449662e-01f, -1.677332520e-01f,
+    -1.155165881e-01f, -1.599086225e-01f, -1.044674814e-01f, -1.127719507e-01f,
+    -9.071342647e-02f, -1.361132711e-01f, -1.050754637e-01f, -1.788290739e-01f,
+    -9.617275745e-02f, 1.438095123e-01f, -2.089816928e-01f, 1.471066475e-01f,
+    1.257292926e-01f, -1.189964339e-01f, -8.482246101e-02f, -1.761489809e-01f,
+    8.537793159e-02f, 2.082294524e-01f, 1.140253767e-01f, -1.558742076e-01f,
+    -9.578480572e-02f, -1.269094050e-01f, 1.253850609e-01f, -8.311641216e-02f,
+    -2.132446170e-01f, 1.057623401e-01f, 1.332876980e-01f, -1.398294568e-01f,
+    -1.398723572e-01f, 1.836310029e-01f, -3.140921891e-01f, 1.703860760e-01f,
+    1.843456924e-01f, -9.685629606e-02f, 1.405974180e-01f, -1.785257161e-01f,
+    -3.378551304e-01f, 1.318247318e-01f, 1.519661993e-01f, 2.319840938e-01f,
+    -1.603033543e-01f, 1.579015106e-01f, 1.477667540e-01f, -1.124291867e-01f,
+    1.990749687e-01f, 1.687796563e-01f, 2.632562518e-01f, -7.328300178e-02f,
+    1.116086021e-01f, -9.629134834e-02f, 1.110940054e-01f, -1.494973004e-01f,
+    1.196788922e-01f, 1.510573924e-01f, -1.129523739e-01f, -1.552147418e-01f,
+    1.681669205e-01f, -3.101944923e-01f, 1.246745661e-01f, 1.820648462e-01f,
+    -1.391712427e-01f, -1.959861517e-01f, 1.188386604e-01f, -2.652656436e-01f,
+    -7.550445199e-02f, -2.133139968e-01f, 1.150509939e-01f, 2.553496659e-01f,
+    2.144621015e-01f, 9.411893785e-02f, 1.091114059e-01f, 2.674445510e-01f,
+    1.031520516e-01f, 8.449227363e-02f, 1.335116923e-01f, 1.398150325e-01f,
+    1.055333614e-01f, -1.282069087e-01f, 1.142201051e-01f, 2.277256250e-01f,
+    1.438507587e-01f, -8.220576495e-02f, 2.196174860e-01f, 1.099423394e-01f,
+    -9.564591199e-02f, 2.127968520e-01f, -1.308965981e-01f, 1.311043054e-01f,
+    2.352292836e-01f, -9.001241624e-02f, -9.262322634e-02f, -1.842535585e-01f,
+    2.191491425e-01f, -3.843274117e-01f, 9.495546669e-02f, -9.143419564e-02f,
+    -1.665352881e-01f, -9.433969855e-02f, -9.719122946e-02f, -9.762569517e-02f,
+    7.263228297e-02f, -9.197825938e-02f, -7.785550505e-02f, -9.526589513e-02f,
+    -8.225394785e-02f, -1.081210226e-01f, 8.878033608e-02f, -1.383249909e-01f,
+    1.087649390e-01f, -1.511770636e-01f, 9.025125206e-02f, -1.292692572e-01f,
+    -9.024500102e-02f, 1.750051528e-01f, -1.930765063e-01f, -8.391364664e-02f,
+    -1.255590618e-01f, -1.075498611e-01f, 9.356200695e-02f, 1.780494303e-01f,
+    -1.646123081e-01f, -1.146193966e-01f, 8.503055573e-02f, -1.402298659e-01f,
+    1.437750161e-01f, 9.995497018e-02f, 9.477042407e-02f, -1.181463525e-01f,
+    -9.322313964e-02f, -1.179319620e-01f, 9.571947902e-02f, -1.717687547e-01f,
+    9.780930728e-02f, 1.286879033e-01f, -1.442597806e-01f, -6.995679438e-02f,
+    -9.402823448e-02f, -8.102368563e-02f, -8.764430881e-02f, 9.628689289e-02f,
+    -8.154436946e-02f, -1.816030443e-01f, 1.268137097e-01f, -9.131979197e-02f,
+    -9.185650945e-02f, -1.078552976e-01f, -2.095431983e-01f, -7.960830629e-02f,
+    1.605955362e-01f, -7.577914745e-02f, 2.246964276e-01f, 2.215393037e-01f,
+    1.312400699e-01f, -1.280869544e-01f, -1.559087485e-01f, 1.779389232e-01f,
+    2.436223477e-01f, -1.342054456e-01f, -9.882593900e-02f, 1.376701146e-01f,
+    -1.381173581e-01f, 1.141593605e-01f, 9.255154431e-02f, 1.771559715e-01f,
+    -9.567368031e-02f, -1.473743767e-01f, 7.275977731e-02f, -3.608042002e-01f,
+    -1.468908191e-01f, 1.147285700e-01f, -2.209658623e-01f, -1.108599305e-01f,
+    -1.403671354e-01f, 1.721596867e-01f, -1.481604129e-01f, -1.212250218e-01f,
+    1.340524405e-01f, 9.839631617e-02f, 1.093234494e-01f, 1.514957249e-01f,
+    2.360550165e-01f, 8.646729589e-02f, -1.327435374e-01f, 8.622577041e-02f,
+    1.675734520e-01f, -1.086847037e-01f, 1.532372236e-01f, -1.074875742e-01f,
+    -8.857079595e-02f, -1.869226247e-01f, 9.304315597e-02f, -8.464792371e-02f,
+    -8.075323701e-02f, -1.747553051e-01f, 1.050663367e-01f, -1.157994866e-01f,
+    -1.868665516e-01f, 1.203762293e-01f, 1.474903524e-01f, 1.160412133e-01f,
+    2.443323135e-01f, 1.350276470e-01f, -1.125869006e-01f, -1.115294099e-01f,
+    -1.469400525e-01f, 1.943032444e-01f, 2.318133861e-01f, -1.056613997e-01f,
+    9.614736587e-02f, 1.678089648e-01f, 1.555067748e-01f, 1.652404666e-01f,
+    1.065709144e-01f, 1.348293871e-01f, -1.118286550e-01f, -1.753151119e-01f,
+    -2.382535040e-01f, -1.756785065e-01f, 1.164321229e-01f, -1.135111749e-01f,
+    1.028833538e-01f, 8.104707301e-02f, -8.418861777e-02f, -1.983772814e-01f,
+    -2.431334257e-01f, 9.550446272e-02f, -2.122729421e-01f, 9.506603330e-02f,
+    -1.423475891e-01f, 1.189670563e-01f, 1.583167315e-01f, -1.581749618e-01f,
+    -2.685304284e-01f, -7.824439555e-02f, -1.800270081e-01f, -1.325976104e-01f,
+    1.065878645e-01f, 1.560903043e-01f, 1.439181715e-01f, -1.459234655e-01f,
+    1.061368063e-01f, 1.169390529e-01f, 1.690260917e-01f, 3.171869516e-01f,
+    1.784713864e-01f, 3.244640529e-01f, -1.170980930e-01f, 2.286357582e-01f,
+    -1.051947400e-01f, 3.315762579e-01f, 9.256853908e-02f, 1.226477474e-01f,
+    2.117098570e-01f, 1.099216938e-01f, -9.647169709e-02f, -1.627277732e-01f,
+    -1.199290305e-01f, 1.537599862e-01f, 1.726452708e-01f, -1.260253042e-01f,
+    1.103707552e-01f, -2.857445776e-01f, -2.124322057e-01f, -1.025261208e-01f,
+    -1.315787137e-01f, 1.914418042e-01f, 1.269121468e-01f, 1.645962298e-01f,
+    2.113768160e-01f, 3.033468127e-01f, 9.096640348e-02f, 1.331564784e-01f,
+    2.855981588e-01f, 1.959102303e-01f, 3.287827969e-01f, 2.617548704e-01f,
+    2.201023251e-01f, -1.498520970e-01f, -1.113163903e-01f, 1.387083828e-01f,
+    -9.758476913e-02f, -1.449849904e-01f, -1.392490119e-01f, 1.145274118e-01f,
+    -1.592251956e-01f, -1.574235111e-01f, -2.834537923e-01f, -1.817285866e-01f,
+    1.213977709e-01f, -1.840800345e-01f, -1.817398518e-01f, -1.020330191e-01f,
+    1.393562555e-01f, -1.980786771e-01f, 1.603169888e-01f, 1.183936894e-01f,
+    -1.262286603e-01f, 9.738405049e-02f, 8.229002357e-02f, 3.144856095e-01f,
+    3.202913105e-01f, -1.169292852e-01f, 1.110277474e-01f, 2.417151034e-01f,
+    3.193364739e-01f, 2.803925276e-01f, 2.280607671e-01f, 3.299216628e-01f,
+    2.906463742e-01f, 2.104233503e-01f, 1.470991075e-01f, 2.202146649e-01f,
+    1.175848171e-01f, 1.327692270e-01f, -9.141255915e-02f, 1.562695801e-01f,
+    2.831048667e-01f, 2.178100199e-01f, 9.027057141e-02f, 1.482878476e-01f,
+    1.373327374e-01f, 1.762248427e-01f, 1.006797180e-01f, -1.161549538e-01f,
+    7.794703543e-02f, -8.343698829e-02f, 8.251020312e-02f, 9.103913605e-02f,
+    3.232798874e-01f, 2.365002483e-01f, -1.129109040e-01f, 2.103745192e-01f,
+    9.695164114e-02f, 1.329245716e-01f, 1.718146801e-01f, 1.906768978e-01f,
+    1.210570037e-01f, -1.273713708e-01f, 2.266058922e-01f, 2.546990514e-01f,
+    1.869961321e-01f, 1.347246021e-01f, 1.032213569e-01f, 1.207772046e-01f,
+    9.183032066e-02f, 1.416792125e-01f, 1.511034518e-01f, -8.904097974e-02f,
+    1.400189400e-01f, 1.467796415e-01f, 8.159558475e-02f, 1.444540024e-01f,
+    1.090646386e-01f, 1.422376931e-01f, 8.877428621e-02f, 2.219289392e-01f,
+    2.319247872e-01f, 1.985476315e-01f, 1.203563437e-01f, 1.722373664e-01f,
+    1.422482878e-01f, 1.409295052e-01f, 1.210914254e-01f, 1.582659930e-01f,
+    1.841826588e-01f, -9.271807224e-02f, 8.683276922e-02f, 9.446713328e-02f,
+    1.050605029e-01f, 8.998680860e-02f, 1.228097528e-01f, 9.191631526e-02f,
+    1.433922201e-01f, 8.556640148e-02f, -1.116202921e-01f, 1.102362499e-01f,
+    1.773009896e-01f, 1.045842543e-01f, -9.007869661e-02f, 1.043755263e-01f,
+    -9.657023847e-02f, -1.191731021e-01f, -2.563734055e-01f, 1.184364036e-01f,
+    -9.311094135e-02f, -1.138181761e-01f, -1.993919909e-01f, 8.504107594e-02f,
+    1.094366461e-01f, 9.213615209e-02f, 1.517917514e-01f, -1.567518711e-01f,
+    -8.977633715e-02f, 1.436430663e-01f, 1.466243416e-01f, 8.203288168e-02f,
+    -1.119181812e-01f, 1.724007130e-01f, 1.306224763e-01f, 1.302084029e-01f,
+    9.381058067e-02f, 1.795345098e-01f, -1.323287487e-01f, 1.258720607e-01f,
+    -9.531392157e-02f, -2.853317857e-01f, -2.466226369e-01f, 7.574134320e-02f,
+    6.548390538e-02f, -9.062428027e-02f, -1.449444443e-01f, -1.007245481e-01f,
+    -1.063252091e-01f, -1.727712601e-01f, -1.308455318e-01f, -9.747947752e-02f,
+    1.036986932e-01f, 1.227742583e-01f, 1.132046059e-01f, 9.017218649e-02f,
+    1.014733091e-01f, 1.219611689e-01f, -7.423320413e-02f, 1.390491277e-01f,
+    -8.953132480e-02f, 1.238844171e-01f, -1.896940470e-01f, -1.531014442e-01f,
+    9.895583987e-02f, -1.158037931e-01f, -9.055376053e-02f, -1.084600389e-01f,
+    9.336671978e-02f, 1.139660031e-01f, -1.184345111e-01f, -1.373418570e-01f,
+    -1.391893327e-01f, 1.010824367e-01f, 8.094301820e-02f, 1.251438558e-01f,
+    1.242107153e-01f, 1.060491428e-01f, 8.470924199e-02f, -1.371414959e-01f,
+    -1.428070664e-01f, 1.968077421e-01f, -9.323815256e-02f, 9.264997393e-02f,
+    -1.161522791e-01f, -1.029207855e-01f, -1.615941823e-01f, 2.257310748e-01f,
+    1.811353117e-01f, 6.533648074e-02f, -1.049920246e-01f, -1.584694535e-01f,
+    -1.252416670e-01f, 1.116391271e-01f, 1.962460726e-01f, 3.020615876e-01f,
+    -1.060447171e-01f, -1.450812370e-01f, -1.799768806e-01f, 1.526480764e-01f,
+    1.691062450e-01f, 9.450763464e-02f, 1.687241942e-01f, 1.109498963e-01f,
+    1.740390509e-01f, -9.896161407e-02f, 1.175271049e-01f, 1.077094600e-01f,
+    -1.469907016e-01f, -1.014320701e-01f, -1.591488123e-01f, -1.859424263e-01f,
+    -1.196666509e-01f, 2.178547084e-01f, -1.540534347e-01f, 1.683504432e-01f,
+    -1.895718127e-01f, 1.988194883e-01f, -1.130181625e-01f, -1.068049893e-01f,
+    7.177329063e-02f, -1.408628225e-01f, 1.780938059e-01f, -1.392203271e-01f,
+    1.967824697e-01f, 2.553724349e-01f, 2.731076181e-01f, -1.261723042e-01f,
+    -1.720446646e-01f, -1.563666165e-01f, -2.092399746e-01f, 1.870744377e-01f,
+    2.227322310e-01f, 9.225144237e-02f, -1.631190777e-01f, 2.003969401e-01f,
+    -9.910733998e-02f, -1.649493873e-01f, -1.402084231e-01f, -1.008505151e-01f,
+    -2.077086568e-01f, 9.964932501e-02f, -1.943463087e-01f, -1.806282401e-01f,
+    1.535798311e-01f, -1.429622620e-01f, 2.260549366e-01f, 1.930955797e-01f,
+    1.560014188e-01f, 1.673536748e-01f, 1.382481158e-01f, -1.166782528e-01f,
+    1.374115795e-01f, -2.394933105e-01f, -1.100397855e-01f, -2.485927343e-01f,
+    1.680217683e-01f, -1.339759678e-01f, -3.711585104e-01f, -1.139935255e-01f,
+    1.456081271e-01f, -2.893754542e-01f, -8.115909249e-02f, -2.418460697e-01f,
+    1.452021599e-01f, -1.437914222e-01f, -1.479792297e-01f, 1.050551757e-01f,
+    1.383782327e-01f, 1.612316072e-01f, -2.149463296e-01f, 1.605244875e-01f,
+    1.837366074e-01f, 1.995189041e-01f, 1.268705577e-01f, -9.429827332e-02f,
+    1.583828479e-01f, -1.468283087e-01f, 1.971979141e-01f, 1.235394925e-01f,
+    1.293182522e-01f, 1.753311455e-01f, -1.003721133e-01f, 1.215264797e-01f,
+    1.943557262e-01f, 1.326256841e-01f, -1.176231056e-01f, -3.066202402e-01f,
+    1.451795101e-01f, 1.101802066e-01f, 1.157636344e-01f, -1.884962618e-01f,
+    1.292040795e-01f, -1.578484923e-01f, 1.125108004e-01f, 8.870974183e-02f,
+    8.674284816e-02f, -2.378032804e-01f, 1.547112465e-01f, -2.313160896e-01f,
+    7.212094218e-02f, 1.157389283e-01f, 1.042174250e-01f, -1.371686161e-01f,
+    1.756176800e-01f, 1.910403669e-01f, 2.962450981e-01f, 1.859591752e-01f,
+    2.249681354e-01f, 1.464136094e-01f, 1.732188314e-01f, 1.128849983e-01f,
+    -1.588879079e-01f, 3.558427095e-01f, 2.628954053e-01f, 1.919001192e-01f,
+    -1.249371171e-01f, 2.208239734e-01f, 1.227137446e-01f, 2.397542298e-01f,
+    2.483133525e-01f, 2.207386196e-01f, 6.878326088e-02f, 2.208053023e-01f,
+    1.402234435e-01f, -1.336992830e-01f, -9.635254741e-02f, 1.467523724e-01f,
+    7.393048704e-02f, -1.768976748e-01f, 1.025348529e-01f, 7.256962359e-02f,
+    -1.160022169e-01f, 1.549585909e-01f, 1.984385848e-01f, -2.219143361e-01f,
+    1.528341025e-01f, -2.476477623e-01f, -8.261372149e-02f, -1.324080676e-01f,
+    -1.705570817e-01f, -9.643431753e-02f, -2.252679467e-01f, 1.150963753e-01f,
+    1.962548792e-01f, -9.989361465e-02f, -8.293212205e-02f, 1.644922346e-01f,
+    1.486873478e-01f, 2.634603381e-01f, -1.228888333e-01f, 1.878411770e-01f,
+    3.741427362e-01f, 7.337332517e-02f, 1.121268347e-01f, -1.543063521e-01f,
+    2.431285530e-01f, 1.292046309e-01f, -1.387265921e-01f, -1.384864748e-01f,
+    -1.001240760e-01f, 9.681716561e-02f, 1.295063943e-01f, -2.819629908e-01f,
+    -9.260864556e-02f, -3.446747065e-01f, 1.065239608e-01f, 1.123766825e-01f,
+    1.900952160e-01f, 9.581122547e-02f, 2.699258029e-01f, 2.003201991e-01f,
+    -1.652695984e-01f, -1.075652838e-01f, 2.225481868e-01f, 4.348073006e-01f,
+    2.715105116e-01f, -1.994723529e-01f, 4.191623926e-01f, -8.896388859e-02f,
+    1.534789056e-01f, 1.042397469e-01f, 2.031877786e-01f, -1.413590908e-01f,
+    -1.218177453e-01f, -1.524796933e-01f, -2.281538844e-01f, -1.175011322e-01f,
+    -1.259987503e-01f, -2.210675329e-01f, -1.192094535e-01f, 1.058739349e-01f,
+    -3.980065584e-01f, 1.105587780e-01f, -1.867685914e-01f, -9.418407828e-02f,
+    1.377123743e-01f, -9.305626899e-02f, 1.269175410e-01f, -1.711643338e-01f,
+    -1.121447831e-01f, 1.257313639e-01f, 4.288479388e-01f, 3.175494373e-01f,
+    -9.859225899e-02f, 2.317671180e-01f, -1.086245701e-01f, 8.711691201e-02f,
+    2.111110240e-01f, -1.442721486e-01f, -1.712081283e-01f, 9.903681278e-02f,
+    -1.224764884e-01f, -1.736342013e-01f, 2.012444586e-01f, -1.118484885e-01f,
+    2.216300070e-01f, 9.087156504e-02f, 2.348063141e-01f, -8.503646404e-02f,
+    7.984767109e-02f, 1.783000529e-01f, 1.263885945e-01f, 1.758846492e-01f,
+    -1.762789786e-01f, 9.669919312e-02f, 1.544940919e-01f, 1.174741760e-01f,
+    1.511541009e-01f, 9.779842198e-02f, -1.345192939e-01f, 1.049995720e-01f,
+    -1.031504646e-01f, -1.037006900e-01f, -1.168079749e-01f, -1.043379158e-01f,
+    2.051584423e-01f, -1.121371090e-01f, -1.675648540e-01f, -1.063124165e-01f,
+    2.016204596e-01f, -1.352752745e-01f, 9.099509567e-02f, 1.444212943e-01f,
+    1.397870630e-01f, -8.387345821e-02f, -8.742833138e-02f, -1.526770443e-01f,
+    -1.427095979e-01f, 1.204435900e-01f, 9.432221949e-02f, 1.092468500e-01f,
+    1.663048118e-01f, 1.760793626e-01f, -1.259916723e-01f, -9.775718302e-02f,
+    9.838306904e-02f, -8.336418867e-02f, -1.424405873e-01f, -1.599192172e-01f,
+    -1.507825553e-01f, 1.060500145e-01f, -1.327755451e-01f, 2.341324389e-01f,
+    -1.815084815e-01f, -1.012502089e-01f, 1.947888136e-01f, 1.508077979e-01f,
+    1.355307251e-01f, -9.521327168e-02f, -1.112608984e-01f, 1.033520028e-01f,
+    1.355011612e-01f, 1.247243509e-01f, -1.258449703e-01f, 1.281925738e-01f,
+    2.458081245e-01f, -1.180296317e-01f, 1.053886190e-01f, 1.515375972e-01f,
+    7.646485418e-02f, 1.754741520e-01f, -8.063718677e-02f, -2.772266567e-01f,
+    -1.542729288e-01f, 1.785771102e-01f, 8.329110593e-02f, -2.088209838e-01f,
+    -1.227147505e-01f, -1.252609640e-01f, -2.239965200e-01f, 1.265182048e-01f,
+    1.704296619e-01f, 1.040233076e-01f, -2.148029804e-01f, 2.086199224e-01f,
+    -1.213886365e-01f, 1.947639585e-01f, 2.054110169e-01f, 7.608864456e-02f,
+    -8.569075167e-02f, 9.126054496e-02f, -1.359173954e-01f, -1.507820040e-01f,
+    9.171637148e-02f, -1.816675812e-01f, 7.874445617e-02f, -8.838357031e-02f,
+    1.960328072e-01f, 1.232332587e-01f, 1.704493165e-01f, 8.420317620e-02f,
+    7.891908288e-02f, 1.267909110e-01f, -1.151569262e-01f, -8.732851595e-02f,
+    -1.661921442e-01f, -1.987680793e-01f, 1.284335703e-01f, 1.755704284e-01f,
+    2.405633330e-01f, -1.214541942e-01f, 2.802826762e-01f, -1.246178299e-01f,
+    -1.928368658e-01f, -1.507355869e-01f, -1.020106748e-01f, 2.243819088e-01f,
+    1.147643998e-01f, 7.731867582e-02f, -1.442716867e-01f, 1.090014875e-01f,
+    -1.746975183e-01f, -1.944864541e-01f, -1.867975593e-01f, -1.004515141e-01f,
+    2.024893314e-01f, 1.032822132e-01f, -1.228549406e-01f, -1.807377338e-01f,
+    1.075365767e-01f, -1.545946449e-01f, -9.546203911e-02f, 1.150149778e-01f,
+    1.601868719e-01f, 1.163543016e-01f, -1.790826172e-01f, 1.237043887e-01f,
+    2.503985167e-01f, 1.380611062e-01f, 1.526121497e-01f, 1.422230303e-01f,
+    -1.584318876e-01f, -1.045702174e-01f, 1.031388044e-01f, 1.511425674e-01f,
+    -1.063199118e-01f, -1.161236688e-01f, -9.122789651e-02f, -3.001033068e-01f,
+    -4.625587761e-01f, 1.526142657e-01f, 2.359030992e-01f, -1.707567573e-01f,
+    -2.286932319e-01f, -1.258025169e-01f, -3.444074690e-01f, -3.210529685e-01f,
+    -2.322969139e-01f, -2.476502061e-01f, -2.447595447e-01f, -2.026858777e-01f,
+    1.264457256e-01f, 2.322810739e-01f, 1.874198467e-01f, -1.758471876e-01f,
+    -1.458250880e-01f, -2.110572308e-01f, -1.935815364e-01f, 1.998082697e-01f,
+    -2.216283530e-01f, 7.858068496e-02f, -1.381587833e-01f, 1.423322558e-01f,
+    -1.109222844e-01f, 3.352091014e-01f, -2.072566748e-01f, 9.058999270e-02f,
+    -2.077934891e-01f, 1.281266958e-01f, -3.855097890e-01f, -3.183985651e-01f,
+    1.373518258e-01f, 2.914798260e-01f, -2.166818529e-01f, -1.962278485e-01f,
+    -1.279140264e-01f, -3.985554278e-01f, -1.885775030e-01f, 2.296579182e-01f,
+    -2.190263271e-01f, 1.299191713e-01f, -1.701953262e-01f, -1.401052028e-01f,
+    -2.307606041e-01f, -1.789801419e-01f, 9.533739835e-02f, 1.829539388e-01f,
+    1.586446911e-01f, 1.083647683e-01f, -1.150096506e-01f, -1.094654649e-01f,
+    1.452781707e-01f, 2.242827415e-01f, -9.178201109e-02f, -2.129405290e-01f,
+    -9.445717186e-02f, -1.287529916e-01f, 1.278875619e-01f, -1.113216281e-01f,
+    -1.573723406e-01f, -1.199285015e-01f, -3.950222135e-01f, -4.935391843e-01f,
+    2.030320466e-01f, 3.734811544e-01f, -1.769792587e-01f, -4.084929526e-01f,
+    1.003004760e-01f, -2.500265539e-01f, 1.915102303e-01f, -8.445026726e-02f,
+    -2.736262083e-01f, -2.773183286e-01f, 2.224214226e-01f, 2.567986250e-01f,
+    9.769433737e-02f, -1.909116060e-01f, 1.199635044e-01f, -1.941243559e-01f,
+    1.558878422e-01f, 1.760008633e-01f, -1.331458986e-01f, -8.432575315e-02f,
+    -1.391658336e-01f, -1.412665546e-01f, 8.204572648e-02f, 1.251274496e-01f,
+    -2.955154181e-01f, -1.716903299e-01f, 2.639982104e-01f, -1.345889866e-01f,
+    -1.912224144e-01f, 8.406849205e-02f, -1.723216474e-01f, -1.816270798e-01f,
+    3.431267738e-01f, 1.461867094e-01f, -2.443199605e-01f, 1.378111094e-01f,
+    -9.260051697e-02f, 3.206637800e-01f, -8.182171732e-02f, -2.578130960e-01f,
+    -8.882658184e-02f, 2.938168347e-01f, 3.198809326e-01f, 1.046989858e-01f,
+    -9.485458583e-02f, -1.024213955e-01f, 1.509704143e-01f, 1.915782988e-01f,
+    -2.467823625e-01f, 7.918018848e-02f, 2.602446079e-01f, 1.542514563e-01f,
+    3.467212021e-01f, 3.521204591e-01f, -1.502389014e-01f, -1.357819736e-01f,
+    2.500620484e-01f, -1.599949449e-01f, -8.704376221e-02f, -1.715766042e-01f,
+    -8.454301208e-02f, 1.363752037e-01f, 3.041888475e-01f, -8.717387170e-02f,
+    -1.043220609e-01f, 3.075626493e-01f, 1.686598212e-01f, -3.192668557e-01f,
+    9.205981344e-02f, 1.552292854e-01f, 3.810691237e-01f, -8.736910671e-02f,
+    1.449294388e-01f, 2.131267637e-01f, -2.504641414e-01f, 1.657551378e-01f,
+    -2.349558771e-01f, 2.069827318e-01f, -1.797020882e-01f, 2.797420919e-01f,
+    3.201328218e-01f, -1.582549065e-01f, 3.411740065e-01f, -1.555472910e-01f,
+    2.256506979e-01f, 2.086047083e-01f, -8.964254707e-02f, 8.096643537e-02f,
+    -1.689235866e-01f, 8.006672561e-02f, 1.168917194e-01f, -1.681699008e-01f,
+    2.183741182e-01f, 2.160349190e-01f, -2.423974425e-01f, 1.524653286e-01f,
+    2.656332254e-01f, -1.788098812e-01f, 9.484304488e-02f, 8.267807961e-02f,
+    -8.530135453e-02f, -1.699036360e-01f, -2.735876739e-01f, 1.264715642e-01f,
+    3.161626458e-01f, 3.240703940e-01f, -1.095839068e-01f, 1.911698580e-01f,
+    8.119566739e-02f, -2.574045360e-01f, 8.754271269e-02f, 1.434459090e-01f,
+    -9.123016149e-02f, 1.322071850e-01f, -1.089408547e-01f, -1.525808573e-01f,
+    -8.400721103e-02f, -1.184591055e-01f, 1.089992374e-01f, -1.536953598e-01f,
+    -1.470281780e-01f, -7.790831476e-02f, 9.229813516e-02f, 1.858420819e-01f,
+    -1.141283587e-01f, -1.789086461e-01f, -9.268890321e-02f, -1.138746068e-01f,
+    -1.824845523e-01f, -8.829371631e-02f, -9.853685647e-02f, 9.585455060e-02f,
+    1.057347506e-01f, -9.188831598e-02f, 1.547442228e-01f, 1.182590574e-01f,
+    9.985457361e-02f, 1.165095940e-01f, 2.185347974e-01f, 8.810643852e-02f,
+    -8.503203839e-02f, -9.460007399e-02f, 1.715373099e-01f, -1.295731366e-01f,
+    1.198867634e-01f, -1.405865252e-01f, -1.187022775e-01f, 1.966556311e-01f,
+    -8.008490503e-02f, 7.758226246e-02f, 9.052975476e-02f, 8.861584961e-02f,
+    2.145054787e-01f, -1.627601385e-01f, 1.362477392e-01f, -1.298308372e-01f,
+    -8.089380711e-02f, 1.654264480e-01f, -8.062619716e-02f, -1.553893238e-01f,
+    -8.463579416e-02f, 1.557545066e-01f, -1.109591350e-01f, -8.856521547e-02f,
+    8.355107903e-02f, 1.327741891e-01f, 2.737526894e-01f, 1.386256218e-01f,
+    1.192411855e-01f, -1.276641637e-01f, 1.618537605e-01f, 8.671940863e-02f,
+    1.249437854e-01f, -1.701594442e-01f, -1.029154435e-01f, -1.476344466e-01f,
+    7.784586400e-02f, -9.440158308e-02f, 6.703214347e-02f, -1.247416139e-01f,
+    -2.836324275e-01f, 6.965515018e-02f, -2.365649194e-01f, -1.363996565e-01f,
+    -1.328486055e-01f, -1.447886229e-01f, 7.967094332e-02f, 1.792457253e-01f,
+    1.530379504e-01f, 1.207545996e-01f, 1.973731667e-01f, -8.163283765e-02f,
+    1.077314317e-01f, 1.600780040e-01f, 1.297568828e-01f, 1.530289054e-01f,
+    -2.415312678e-01f, 1.026651263e-01f, -1.324945837e-01f, -2.069728225e-01f,
+    1.160913408e-01f, -2.878279388e-01f, -1.532410532e-01f, -1.261810213e-01f,
+    -2.022242099e-01f, -2.665399015e-01f, -8.373732865e-02f, -1.022276357e-01f,
+    2.474526912e-01f, 1.402679682e-01f, -9.325642139e-02f, 1.326802522e-01f,
+    1.192261353e-01f, 1.146268994e-01f, -1.166707799e-01f, 2.102607042e-01f,
+    1.040728688e-01f, -1.062752083e-01f, 2.091145515e-01f, -1.637783647e-01f,
+    2.043480724e-01f, -9.957859665e-02f, -1.748025417e-01f, -1.899414659e-01f,
+    -1.336537600e-01f, -1.213982403e-01f, 8.730590343e-02f, -1.842089146e-01f,
+    -2.461842895e-01f, -3.727471232e-01f, -5.038935542e-01f, -2.538296580e-01f,
+    -1.306483299e-01f, -2.906701267e-01f, -1.769423634e-01f, -2.559250891e-01f,
+    -1.335852295e-01f, -2.768460512e-01f, -9.136281908e-02f, -2.384244502e-01f,
+    -1.459624916e-01f, -1.027824357e-01f, -1.281643212e-01f, -1.127771512e-01f,
+    -1.054100916e-01f, -1.307803392e-01f, -1.359827965e-01f, 1.642833650e-01f,
+    8.444836736e-02f, -1.076552346e-01f, 1.107436121e-01f, -3.688031137e-01f,
+    -5.236014128e-01f, -1.668000370e-01f, -1.494275630e-01f, -3.887231052e-01f,
+    -1.068033651e-01f, -3.816401362e-01f, -2.708422542e-01f, -1.131372526e-01f,
+    -3.059237897e-01f, -1.462486684e-01f, -1.249598786e-01f, -7.914325595e-02f,
+    -1.340040118e-01f, -9.823384881e-02f, -8.053632081e-02f, -8.267521113e-02f,
+    1.378093511e-01f, 1.023042649e-01f, 1.102778390e-01f, -1.098759025e-01f,
+    -4.369279742e-01f, -5.058683753e-01f, -2.432427555e-01f, -2.340416163e-01f,
+    -2.973685563e-01f, -1.676089019e-01f, -2.352025062e-01f, 2.151869386e-01f,
+    -7.755010575e-02f, -9.081265330e-02f, 2.066897452e-01f, 2.487184703e-01f,
+    -1.445264220e-01f, 9.356804192e-02f, 9.021405131e-02f, -1.493711174e-01f,
+    -1.294929236e-01f, -1.770764738e-01f, -3.312230110e-01f, -4.971833527e-01f,
+    1.323390454e-01f, -2.457271367e-01f, -9.869638830e-02f, 8.038096130e-02f,
+    -4.697587192e-01f, -1.969952434e-01f, 2.348675430e-01f, -2.620297074e-01f,
+    -1.597573906e-01f, 1.096003801e-01f, -1.014107019e-01f, -1.438623816e-01f,
+    -1.006708145e-01f, -1.403497756e-01f, -1.626927257e-01f, -2.066581696e-01f,
+    -2.531104982e-01f, 9.455272555e-02f, -2.033273578e-01f, 9.205607325e-02f,
+    2.369746119e-01f, -1.454854161e-01f, 1.155454293e-01f, -1.030637547e-01f,
+    -1.312183887e-01f, -8.009094745e-02f, 2.774507105e-01f, -3.690291047e-01f,
+    -5.155698061e-01f, 2.042904794e-01f, -3.577960134e-01f, -4.579674602e-01f,
+    1.077724397e-01f, -2.971784174e-01f, 1.957455575e-01f, 1.168580577e-01f,
+    -7.820816338e-02f, 9.529969096e-02f, -1.586499065e-01f, -1.472315639e-01f,
+    7.860158384e-02f, -1.023658514e-01f, -1.044557095e-01f, -1.394911706e-01f,
+    -1.946890205e-01f, 9.997148067e-02f, -8.688547462e-02f, 1.462928355e-01f,
+    2.243229002e-01f, -1.485315859e-01f, 8.560028672e-02f, 1.013276353e-01f,
+    7.915712148e-02f, -1.866069287e-01f, 2.291585058e-01f, -4.775660932e-01f,
+    -4.215454757e-01f, 7.192722708e-02f, 2.229390740e-01f, 2.546840906e-01f,
+    -3.058437705e-01f, -9.620837867e-02f, -2.598610520e-01f, 1.485432833e-01f,
+    -1.942333430e-01f, 3.290104568e-01f, -1.635723412e-01f, -1.086305976e-01f,
+    -2.103935629e-01f, 1.822683513e-01f, -9.799643606e-02f, -2.896176577e-01f,
+    -2.116429657e-01f, -2.661240697e-01f, -2.040750831e-01f, -1.465967596e-01f,
+    -1.426507682e-01f, 3.462009132e-01f, 1.253218800e-01f, -1.487306356e-01f,
+    -7.937380672e-02f, 2.917187810e-01f, 2.743426561e-01f, 1.577309370e-01f,
+    9.946724772e-02f, 1.578036249e-01f, 7.852572948e-02f, -1.465806663e-01f,
+    1.191773564e-01f, 1.458465010e-01f, 1.383939832e-01f, 1.708317846e-01f,
+    -6.531316042e-02f, -9.166882187e-02f, -1.443744451e-01f, 9.356036782e-02f,
+    9.882581234e-02f, -1.725305021e-01f, 2.064805627e-01f, 1.751664281e-01f,
+    -1.113772020e-01f, -2.261196971e-01f, 8.966215700e-02f, -2.892936766e-01f,
+    -1.571523398e-01f, 2.199228704e-01f, -1.300656050e-01f, -1.850035936e-01f,
+    -1.720813960e-01f, -1.828075796e-01f, 2.048568428e-01f, 3.044437468e-01f,
+    8.076767623e-02f, 1.035579741e-01f, 1.139467731e-01f, 1.491912454e-01f,
+    2.049383372e-01f, 1.240476742e-01f, 1.448347121e-01f, -8.121825755e-02f,
+    -1.565077603e-01f, 1.414015442e-01f, -1.022624373e-01f, -1.907635033e-01f,
+    -7.321090996e-02f, -2.120905817e-01f, -2.146705091e-01f, -1.322244257e-01f,
+    -1.066764668e-01f, -1.415675431e-01f, -1.791035086e-01f, 2.905033827e-01f,
+    2.283293605e-01f, 1.281772554e-01f, 7.624531537e-02f, 1.255248934e-01f,
+    1.748373359e-01f, 1.302698106e-01f, 2.133862972e-01f, -1.898243427e-01f,
+    2.139571905e-01f, 9.732466191e-02f, 1.288857609e-01f, -1.277831197e-01f,
+    -2.698203325e-01f, -2.330428362e-01f, 1.181693673e-01f, -9.566161782e-02f,
+    -2.242566943e-01f, -2.321771830e-01f, 1.664859504e-01f, -1.594811529e-01f,
+    -2.852323353e-01f, 1.476736963e-01f, -1.954323649e-01f, 1.057591438e-01f,
+    -1.780664772e-01f, -1.025570184e-01f, -1.143193617e-01f, 8.333814144e-02f,
+    -1.036615074e-01f, -1.017097086e-01f, 9.200021625e-02f, -8.697844297e-02f,
+    -7.053308189e-02f, -6.768830121e-02f, 1.115117744e-01f, -9.627620131e-02f,
+    1.143293455e-01f, 1.387206167e-01f, 9.865599871e-02f, 1.375783682e-01f,
+    -9.803218395e-02f, -1.491307914e-01f, -1.500545591e-01f, -8.562614769e-02f,
+    -1.979672164e-01f, 1.105815992e-01f, 1.110329330e-01f, -1.246523857e-01f,
+    -9.949295968e-02f, -9.133286774e-02f, -1.113082319e-01f, -6.839339435e-02f,
+    1.099648178e-01f, -1.069192439e-01f, -1.178819984e-01f, 1.416908205e-01f,
+    -1.246699914e-01f, -1.400766820e-01f, -6.947128475e-02f, -2.617486119e-01f,
+    -1.566114277e-01f, -9.957388043e-02f, -1.799474657e-01f, -9.938041866e-02f,
+    -6.621573120e-02f, 1.511200368e-01f, -9.270239621e-02f, -1.331255734e-01f,
+    -1.324535310e-01f, 1.188963801e-01f, -1.311888695e-01f, -1.470777839e-01f,
+    2.678896487e-01f, 1.066898331e-01f, -1.226085573e-01f, 1.517578214e-01f,
+    -1.378600299e-01f, -9.816239029e-02f, -9.178896993e-02f, 9.356507659e-02f,
+    1.429373175e-01f, -2.237931639e-01f, -1.154164150e-01f, -1.149440482e-01f,
+    -1.407286823e-01f, -7.827742398e-02f, 1.361827552e-01f, 9.043499827e-02f,
+    -2.056246400e-01f, 1.278897822e-01f, 1.152658165e-01f, 1.544361860e-01f,
+    1.216716021e-01f, -2.026566714e-01f, -1.426489651e-01f, 1.802033186e-01f,
+    -1.165335923e-01f, -1.542571336e-01f, -1.018527746e-01f, -1.148122475e-01f,
+    2.465224713e-01f, 1.650477499e-01f, 1.004614159e-01f, -8.635649085e-02f,
+    -1.802323312e-01f, 1.260795146e-01f, 1.268744320e-01f, -2.544930875e-01f,
+    -7.061083615e-02f, -1.379388422e-01f, 1.034247056e-01f, 1.207925379e-01f,
+    9.849327058e-02f, 1.094214544e-01f, 7.163736224e-02f, 2.027070671e-01f,
+    2.024635673e-01f, 1.086794063e-01f, 1.933479905e-01f, 1.469523609e-01f,
+    7.707230002e-02f, 1.815963835e-01f, 1.829144955e-01f, 3.094712496e-01f,
+    1.559276581e-01f, -1.671377718e-01f, 1.010068581e-01f, -7.286361605e-02f,
+    1.518929750e-01f, 1.728746444e-01f, 1.561080217e-01f, -1.079248935e-01f,
+    1.046329960e-01f, 1.473918706e-01f, -2.292095870e-01f, -1.768218577e-01f,
+    -9.498879313e-02f, -2.192808837e-01f, 8.696068823e-02f, -2.078391910e-01f,
+    8.183901757e-02f, 2.024987638e-01f, 1.911392659e-01f, -1.513126791e-01f,
+    1.391118616e-01f, -9.670115262e-02f, 1.312144101e-01f, 2.351624370e-01f,
+    1.988300383e-01f, 3.523590267e-01f, 3.217839301e-01f, -2.109084576e-01f,
+    4.287274778e-01f, -1.218923554e-01f, -9.311984479e-02f, -7.731673121e-02f,
+    -1.125534698e-01f, -1.069173366e-01f, -1.343022585e-01f, -2.295551151e-01f,
+    1.032170728e-01f, -2.005429268e-01f, -1.427694857e-01f, 1.097787023e-01f,
+    -8.485627919e-02f, 2.582026720e-01f, 1.938518584e-01f, 4.270810783e-01f,
+    4.454262555e-01f, -3.143269122e-01f, 2.395503521e-01f, -1.120715737e-01f,
+    1.334703416e-01f, 2.324427217e-01f, -8.815363050e-02f, -7.035167515e-02f,
+    -1.158706248e-01f, -3.106765449e-01f, -1.075917780e-01f, -7.947025448e-02f,
+    1.682519019e-01f, 1.112436354e-01f, -1.053236648e-01f, 8.474529535e-02f,
+    -3.505968451e-01f, -2.457619458e-01f, -2.018968165e-01f, -1.381403357e-01f,
+    -1.417048424e-01f, 1.494337916e-01f, 1.727434844e-01f, 1.458012462e-01f,
+    -1.424979419e-01f, 1.038980335e-01f, 4.048560858e-01f, 4.697461426e-01f,
+    -2.002362609e-01f, 4.490030110e-01f, -8.420680463e-02f, 2.091431618e-01f,
+    3.551835120e-01f, 2.130078673e-01f, -1.795313805e-01f, 1.990765929e-01f,
+    8.735761791e-02f, 1.099526137e-01f, 1.162979603e-01f, -2.115438730e-01f,
+    1.088296622e-01f, -1.099314466e-01f, -3.351831734e-01f, -3.346489668e-01f,
+    8.064397424e-02f, -1.386276335e-01f, -1.435401887e-01f, -1.239932999e-01f,
+    1.398202628e-01f, -1.080162078e-01f, -1.103923693e-01f, 2.120416760e-01f,
+    1.341648698e-01f, -1.311162412e-01f, -9.392435104e-02f, -9.238499403e-02f,
+    1.546035707e-01f, -1.104010418e-01f, 1.432385594e-01f, -1.316842586e-01f,
+    1.293303818e-01f, 1.000696123e-01f, -1.130720749e-01f, -3.188965321e-01f,
+    -1.190374345e-01f, 1.479664296e-01f, 1.425995529e-01f, -1.936670840e-01f,
+    -1.734446883e-01f, -1.880628616e-01f, 1.117952466e-01f, -1.244726107e-01f,
+    -1.437133998e-01f, 3.099169433e-01f, 8.320296556e-02f, -9.679192305e-02f,
+    -1.010725573e-01f, -9.785582125e-02f, -1.220841259e-01f, -1.858664155e-01f,
+    1.592439562e-01f, -1.136800721e-01f, 9.976323694e-02f, -8.829274029e-02f,
+    1.214347407e-01f, 7.167871296e-02f, 1.110124290e-01f, -1.644355357e-01f,
+    -2.208333910e-01f, -1.593185812e-01f, -9.781819582e-02f, 1.387347877e-01f,
+    9.269761294e-02f, -8.770988137e-02f, -7.638441026e-02f, 1.093319952e-01f,
+    1.277700216e-01f, 1.007730514e-01f, -2.040801644e-01f, -2.148164511e-01f,
+    1.292545944e-01f, 1.552799940e-01f, -2.620659471e-01f, 1.903575063e-01f,
+    -1.817340106e-01f, 1.139714867e-01f, 2.000011951e-01f, -9.457963705e-02f,
+    1.463720351e-01f, 9.358954430e-02f, -2.530373037e-01f, -1.011185199e-01f,
+    -1.353332698e-01f, 9.539575875e-02f, -1.093193814e-01f, 8.187463135e-02f,
+    -2.068379819e-01f, -1.785056442e-01f, -2.862882018e-01f, -7.375919074e-02f,
+    -6.950809807e-02f, 1.371853501e-01f, 1.895555705e-01f, -9.848886728e-02f,
+    1.327787489e-01f, 8.939013630e-02f, 1.927956790e-01f, 1.497636586e-01f,
+    2.204972208e-01f, -1.707535684e-01f, 1.282298267e-01f, -3.840003908e-01f,
+    -1.254225373e-01f, -1.930241585e-01f, -7.286322117e-02f, -1.688539535e-01f,
+    -2.612967789e-01f, -1.411492676e-01f, 9.106749296e-02f, -7.713755220e-02f,
+    -1.608420759e-01f, -1.847891808e-01f, -1.949869245e-01f, -8.609310538e-02f,
+    1.153949276e-01f, 1.137385368e-01f, 1.744182855e-01f, 9.053441137e-02f,
+    1.868496984e-01f, 9.681853652e-02f, 1.840428859e-01f, -1.250596195e-01f,
+    8.911874890e-02f, -3.115951419e-01f, -9.156994522e-02f, -1.259745806e-01f,
+    -1.946570426e-01f, -1.222828478e-01f, -3.124446869e-01f, -8.280465007e-02f,
+    -9.258406609e-02f, -1.554345638e-01f, -1.522943377e-01f, -1.083480865e-01f,
+    1.314706653e-01f, -2.280411422e-01f, -2.559288740e-01f, -3.151271045e-01f,
+    -1.046139672e-01f, 1.445228904e-01f, 2.364974767e-01f, 1.378183812e-01f,
+    1.040302888e-01f, 1.917337924e-01f, 1.952960491e-01f, 1.640141755e-01f,
+    -1.954668611e-01f, -2.815890610e-01f, -1.726585627e-01f, 1.056539938e-01f,
+    -2.940544188e-01f, -1.112084389e-01f, -2.574695945e-01f, -3.227688074e-01f,
+    1.126646772e-01f, 1.439831108e-01f, -1.392787248e-01f, 8.795001358e-02f,
+    2.182866037e-01f, 2.454313785e-01f, 3.031450212e-01f, 1.652630419e-01f,
+    -1.440044045e-01f, 1.407061666e-01f, 9.842384607e-02f, 2.023630142e-01f,
+    3.280906677e-01f, 1.224207729e-01f, 1.293545365e-01f, 9.403549880e-02f,
+    1.768091917e-01f, 1.627215892e-01f, -2.029903829e-01f, -1.586475372e-01f,
+    8.533208072e-02f, 1.595461667e-01f, 2.053551227e-01f, 2.229840010e-01f,
+    2.875868082e-01f, -1.083969772e-01f, 8.273133636e-02f, 1.772416532e-01f,
+    1.325332671e-01f, -1.086047292e-01f, -8.930189908e-02f, 1.121057793e-01f,
+    2.052049637e-01f, 2.806324065e-01f, 9.653154761e-02f, 1.087360457e-01f,
+    -2.464226037e-01f, 9.569253772e-02f, 1.194477379e-01f, 1.482428759e-01f,
+    2.394314557e-01f, 9.096068144e-02f, -1.094325334e-01f, 1.397090703e-01f,
+    1.247425750e-01f, 1.140800193e-01f, 1.183128133e-01f, 1.590525806e-01f,
+    -1.473937780e-01f, -9.119322151e-02f, 2.441565245e-01f, 2.866925001e-01f,
+    2.129102200e-01f, 1.299522817e-01f, 2.478208840e-01f, 7.208409905e-02f,
+    7.128190994e-02f, 1.268666387e-01f, 1.634935290e-01f, 1.113665849e-01f,
+    1.355233341e-01f, -2.775208652e-01f, 2.155469358e-01f, 1.429964006e-01f,
+    1.780543476e-01f, 1.977913827e-01f, 1.384303272e-01f, -2.471576184e-01f,
+    1.215917543e-01f, -1.082421392e-01f, 1.776624322e-01f, 2.527117729e-01f,
+    2.083110362e-01f, 9.648418427e-02f, -1.232812703e-01f, 1.431635320e-01f,
+    2.055453211e-01f, 1.621609032e-01f, 2.194554210e-01f, -1.522653550e-01f,
+    -1.281681210e-01f, -1.199451759e-01f, 2.036377937e-01f, 3.947975934e-01f,
+    1.419299394e-01f, 3.220447302e-01f, -1.360261440e-01f, 8.184463531e-02f,
+    2.343776524e-01f, 9.622150660e-02f, 1.363680512e-01f, 1.884177625e-01f,
+    -3.927717805e-01f, -2.481297851e-01f, 9.670867026e-02f, -1.662727892e-01f,
+    -3.913824856e-01f, -1.947175115e-01f, -1.580737382e-01f, -8.049985766e-02f,
+    -2.532180548e-01f, -2.220968902e-01f, 8.648771793e-02f, 8.766232431e-02f,
+    -1.007943228e-01f, -9.284958988e-02f, -1.136429161e-01f, -1.111333966e-01f,
+    1.073382199e-01f, 8.108831197e-02f, 1.751138568e-01f, -1.578933001e-01f,
+    -1.774737686e-01f, -2.498922050e-01f, -3.303944468e-01f, -1.405670196e-01f,
+    1.390862316e-01f, -2.720343173e-01f, -1.147662997e-01f, -1.334392428e-01f,
+    -1.065177992e-01f, -2.355560809e-01f, 7.408166677e-02f, -1.784247607e-01f,
+    -8.131556958e-02f, 8.171385527e-02f, -1.554439366e-01f, 1.844271570e-01f,
+    1.027503163e-01f, -9.050542116e-02f, 9.710910916e-02f, -3.212200403e-01f,
+    -3.986843526e-01f, 9.632098675e-02f, -2.688989639e-01f, -9.550827742e-02f,
+    -1.270431727e-01f, -1.702277362e-01f, -1.710955054e-01f, 1.081975773e-01f,
+    -1.259145737e-01f, 1.005451158e-01f, -1.093430668e-01f, -8.807323873e-02f,
+    -1.225469485e-01f, 8.874933422e-02f, 1.690034121e-01f, 2.191169560e-01f,
+    2.268499732e-01f, 3.029513359e-01f, -2.631752789e-01f, 1.822141409e-01f,
+    -1.313165873e-01f, 1.371325850e-01f, 1.374921352e-01f, -1.933330148e-01f,
+    -3.166907132e-01f, 3.022348583e-01f, 1.924051940e-01f, -2.048921883e-01f,
+    -2.791901529e-01f, 1.507299542e-01f, -1.589936316e-01f, 1.002749205e-01f,
+    -1.023280248e-01f, -2.173756659e-01f, 1.190859899e-01f, 1.713030338e-01f,
+    7.302848250e-02f, -2.210545540e-01f, 1.022103950e-01f, 7.074750960e-02f,
+    -1.348285228e-01f, 1.466492265e-01f, 6.252120435e-02f, -1.511536688e-01f,
+    1.088373289e-01f, -1.291419268e-01f, 1.858021468e-01f, 2.255532295e-01f,
+    8.907773346e-02f, 1.238492355e-01f, 1.722986400e-01f, -1.515974104e-01f,
+    1.630524546e-01f, 9.152977169e-02f, 1.133386865e-01f, 1.584999561e-01f,
+    -1.600200385e-01f, -2.115675211e-01f, 2.650426924e-01f, 3.147733212e-01f,
+    1.008190289e-01f, 2.574816644e-01f, 1.316539943e-01f, 1.067833602e-01f,
+    -1.517327279e-01f, 1.637917906e-01f, 8.527085185e-02f, 6.154748052e-02f,
+    -9.948315471e-02f, -1.913792342e-01f, 1.095009074e-01f, -1.915270239e-01f,
+    1.290104538e-01f, -1.455881745e-01f, -1.159275696e-01f, 9.532194585e-02f,
+    1.850056648e-01f, -1.137438789e-01f, 2.099456936e-01f, 2.401867360e-01f,
+    1.828401387e-01f, 1.173853502e-01f, 1.472779810e-01f, 1.732068807e-01f,
+    1.715108901e-01f, 2.911259830e-01f, 2.252610177e-01f, 2.695615888e-01f,
+    -2.375786602e-01f, 1.334038973e-01f, 1.390303522e-01f, 2.695972919e-01f,
+    6.911776960e-02f, -1.776626408e-01f, 1.505482644e-01f, 7.256944478e-02f,
+    2.380913794e-01f, 8.424060792e-02f, 1.668262929e-01f, -1.267274767e-01f,
+    -1.145872250e-01f, 1.823675781e-01f, 6.727483124e-02f, 1.117171049e-01f
+};
+
+static const float MAGIC_WAND_sparse_3_bias[] =
+{
+    5.783069879e-02f, -3.342082724e-02f, 5.074049812e-03f, -8.579181880e-02f,
+    5.620526150e-02f, -6.362031680e-03f, -3.319053724e-02f, -2.243491635e-02f,
+    6.104156747e-02f, 2.242287854e-03f, -3.790053772e-03f, 1.939460170e-03f,
+    -4.314951075e-04f, -4.404424876e-02f, 2.834475040e-02f, 2.274363115e-02f,
+    1.232227404e-02f, 7.337021828e-02f, -1.739126630e-02f, 3.046872281e-02f,
+    1.394389383e-02f, 4.634869099e-02f, 5.014551058e-02f, 1.926626824e-02f,
+    -6.804399937e-02f, -1.741240174e-02f, 4.286852852e-02f, 4.769563675e-02f,
+    -5.829263479e-03f, -1.762815937e-02f, -1.570369117e-02f, -3.906430677e-02f
+};
+
+static const uint16_t MAGIC_WAND_sparse_6_start[] =
+{
+    0, 17, 33, 50, 67, 86, 100, 113, 132, 141, 159, 177, 193, 209, 224, 241,
+    256
+};
+
+static const uint8_t MAGIC_WAND_sparse_6_index[] =
+{
+    1, 2, 5, 7, 9, 10, 14, 15, 19, 21, 22, 25, 26, 28, 29, 30,
+    31, 0, 1, 4, 5, 7, 8, 9, 11, 12, 22, 23, 26, 28, 29, 30,
+    31, 4, 5, 7, 8, 9, 14, 15, 17, 19, 20, 21, 22, 25, 26, 27,
+    28, 30, 2, 3, 6, 10, 11, 13, 16, 17, 18, 20, 22, 23, 25, 27,
+    28, 29, 31, 1, 2, 3, 4, 5, 8, 10, 12, 15, 16, 20, 21, 22,
+    23, 24, 25, 27, 28, 29, 2, 4, 12, 13, 15, 17, 18, 19, 22, 24,
+    25, 27, 29, 31, 1, 3, 4, 10, 12, 14, 16, 18, 21, 22, 24, 27,
+    29, 0, 3, 5, 8, 11, 12, 13, 14, 16, 17, 18, 19, 20, 22, 25,
+    27, 28, 29, 31, 0, 3, 7, 9, 16, 19, 22, 26, 29, 0, 1, 3,
+    5, 7, 8, 11, 13, 15, 16, 17, 19, 21, 22, 23, 24, 25, 27, 2,
+    5, 9, 11, 12, 13, 17, 18, 19, 22, 23, 25, 26, 27, 28, 29, 30,
+    31, 3, 4, 5, 8, 9, 10, 13, 14, 16, 19, 21, 25, 26, 27, 28,
+    30, 0, 1, 3, 8, 9, 14, 15, 16, 17, 18, 20, 22, 27, 28, 29,
+    31, 2, 4, 5, 6, 7, 8, 13, 14, 18, 21, 22, 23, 26, 29, 31,
+    0, 1, 4, 5, 6, 10, 11, 13, 15, 17, 19, 20, 21, 23, 24, 27,
+    29, 0, 1, 3, 4, 6, 10, 12, 13, 19, 24, 26, 27, 28, 30, 31
+};
+
+static const float MAGIC_WAND_sparse_6_value[] =
+{
+    4.576858580e-01f, -3.984259367e-01f, 2.717145383e-01f, -4.282487631e-01f,
+    -4.110770524e-01f, 4.931439757e-01f, -3.884527385e-01f, -2.696570754e-01f,
+    -2.350700796e-01f, 4.865209758e-01f, 3.447005153e-01f, -3.015627861e-01f,
+    -3.288253248e-01f, -2.235407978e-01f, 4.019339383e-01f, 6.936728954e-01f,
+    3.488256037e-01f, 2.461887598e-01f, -2.402358055e-01f, -2.160145044e-01f,
+    5.667916536e-01f, -3.452145457e-01f, -3.770839870e-01f, -3.734002113e-01f,
+    3.725315332e-01f, -2.726240456e-01f, 3.361532092e-01f, -5.670548677e-01f,
+    4.032508731e-01f, 3.847532868e-01f, 4.479584098e-01f, 3.959126174e-01f,
+    2.069048434e-01f, -2.172990888e-01f, -4.877017438e-01f, -3.738337159e-01f,
+    3.414177597e-01f, 3.598310351e-01f, 3.189682662e-01f, -4.000528157e-01f,
+    -5.478003025e-01f, 2.438073754e-01f, 2.836881876e-01f, -4.950205386e-01f,
+    -3.777320087e-01f, 4.173612893e-01f, 2.808748782e-01f, 4.516828954e-01f,
+    -2.730748355e-01f, -5.519699454e-01f, 3.198380768e-01f, 3.605264425e-01f,
+    4.862669110e-01f, -3.895528316e-01f, 2.332174033e-01f, 4.264279902e-01f,
+    3.185945153e-01f, -2.256267071e-01f, 3.492277265e-01f, 4.545082748e-01f,
+    -2.875027657e-01f, 2.219274789e-01f, 3.976699710e-01f, 2.808833420e-01f,
+    -2.372670472e-01f, -3.171922565e-01f, 3.336608410e-01f, 2.074157745e-01f,
+    2.255239040e-01f, -3.464989960e-01f, 3.629567921e-01f, -2.645402551e-01f,
+    2.679668665e-01f, -4.920090139e-01f, -4.579781592e-01f, 2.164511234e-01f,
+    5.425484776e-01f, 2.310925424e-01f, -5.888867974e-01f, -2.247759998e-01f,
+    6.377258301e-01f, -2.248240709e-01f, -3.984347284e-01f, 3.189256191e-01f,
+    4.117766619e-01f, -3.269819915e-01f, -2.667496502e-01f, -4.422388971e-01f,
+    3.994343579e-01f, 2.463094741e-01f, -2.473036200e-01f, -3.945094347e-01f,
+    4.710026085e-01f, 2.527337372e-01f, -3.986624777e-01f, -4.206026793e-01f,
+    2.621722519e-01f, 2.632334530e-01f, -3.785189092e-01f, 4.703661799e-01f,
+    -2.413561046e-01f, 2.101272196e-01f, 2.418982983e-01f, -2.416774035e-01f,
+    2.663029730e-01f, -2.121440023e-01f, 3.330933750e-01f, -4.474607110e-01f,
+    3.072109222e-01f, -4.933362305e-01f, 2.143184692e-01f, -4.459057152e-01f,
+    -2.190809995e-01f, 2.502490282e-01f, 2.461726815e-01f, 3.502943814e-01f,
+    -2.842649221e-01f, 2.320723683e-01f, 5.017728209e-01f, 7.018072009e-01f,
+    -3.061900735e-01f, -2.471016198e-01f, -2.473634183e-01f, 3.771970868e-01f,
+    2.236762047e-01f, 2.493153363e-01f, -5.303205252e-01f, -2.172141224e-01f,
+    3.035136759e-01f, -5.724639893e-01f, -2.243179530e-01f, 2.796169519e-01f,
+    4.651505351e-01f, -3.980515599e-01f, -2.180503756e-01f, -3.714706600e-01f,
+    -3.872409165e-01f, -2.626084387e-01f, -2.838147283e-01f, -3.764181733e-01f,
+    -2.248980254e-01f, -4.307564497e-01f, 1.904512346e-01f, 2.079480737e-01f,
+    2.682486773e-01f, -2.550461590e-01f, 2.758669555e-01f, 2.807306945e-01f,
+    -3.416433334e-01f, 3.593295217e-01f, 5.069206953e-01f, 5.037989020e-01f,
+    3.683650196e-01f, 2.818557620e-01f, 4.282011092e-01f, 4.569146335e-01f,
+    2.056156993e-01f, -3.064768314e-01f, -2.910938263e-01f, -4.497549236e-01f,
+    5.178337693e-01f, -3.852117360e-01f, 3.698215783e-01f, 3.348906338e-01f,
+    2.318729907e-01f, 3.275712430e-01f, -3.418324292e-01f, -2.033400238e-01f,
+    2.258714586e-01f, -2.181050777e-01f, -3.432531059e-01f, -4.049448073e-01f,
+    -2.516760230e-01f, -3.008099198e-01f, 3.346076012e-01f, 3.551643193e-01f,
+    4.825012982e-01f, -2.361180186e-01f, 3.429915607e-01f, -5.861665010e-01f,
+    2.679845393e-01f, 5.800080895e-01f, -2.053022534e-01f, -3.273435235e-01f,
+    4.045364261e-01f, 4.135636687e-01f, 4.845538437e-01f, -2.057461143e-01f,
+    -2.260962427e-01f, 3.475822210e-01f, -2.070004642e-01f, 4.205890894e-01f,
+    -3.764075935e-01f, -6.140950918e-01f, 4.639948308e-01f, 4.658939242e-01f,
+    3.295619190e-01f, -3.842520118e-01f, -2.393547595e-01f, 2.991513014e-01f,
+    2.386064827e-01f, 3.858000338e-01f, -4.457624257e-01f, 5.922692418e-01f,
+    2.933853269e-01f, -3.301470876e-01f, -2.206802219e-01f, -3.366925418e-01f,
+    5.451837778e-01f, -3.597500920e-01f, -2.428222001e-01f, -2.254547626e-01f,
+    -4.401086271e-01f, -3.691478372e-01f, 2.471343726e-01f, -3.705324829e-01f,
+    4.507412612e-01f, -4.270151556e-01f, 4.839526713e-01f, 5.056434870e-01f,
+    -3.451472819e-01f, 6.189184785e-01f, 2.672768831e-01f, -2.489593178e-01f,
+    -3.195861578e-01f, 2.558620274e-01f, -2.134511471e-01f, 4.633644223e-01f,
+    -4.303389788e-01f, 4.825752378e-01f, 4.449507296e-01f, 3.545513153e-01f,
+    -4.174014330e-01f, 3.435513973e-01f, 3.180091083e-01f, -3.424609005e-01f,
+    3.596677482e-01f, -4.314552546e-01f, 3.437972069e-01f, -2.130024731e-01f,
+    4.625128210e-01f, 2.413115501e-01f, -2.366512865e-01f, -3.277158141e-01f,
+    -2.744284868e-01f, -3.195212185e-01f, -1.957596540e-01f, 2.184672207e-01f,
+    2.658329904e-01f, 2.471606582e-01f, -3.334377706e-01f, 4.389345646e-01f,
+    3.216316402e-01f, 3.320803344e-01f, -4.303181767e-01f, -2.331196517e-01f
+};
+
+static const float MAGIC_WAND_sparse_6_bias[] =
+{
+    -9.983911179e-03f, 5.835317075e-02f, 2.490076981e-02f, -3.671475872e-02f,
+    1.838636957e-02f, 2.106692456e-02f, -1.497318689e-02f, -7.022093982e-02f,
+    8.805325255e-03f, 1.102792379e-02f, 7.545832545e-03f, 1.054485142e-01f,
+    2.373994887e-02f, 2.970335446e-02f, 2.369297855e-02f, 6.989760697e-02f
+};
+
+static const uint16_t MAGIC_WAND_sparse_7_start[] =
+{
+    0, 10, 19, 25, 32
+};
+
+static const uint8_t MAGIC_WAND_sparse_7_index[] =
+{
+    0, 1, 3, 5, 6, 7, 9, 11, 12, 13, 2, 5, 9, 10, 11, 12,
+    13, 14, 15, 0, 7, 10, 11, 13, 15, 4, 7, 9, 10, 11, 13, 14
+};
+
+static const float MAGIC_WAND_sparse_7_value[] =
+{
+    4.589738846e-01f, 5.799545050e-01f, -8.038541675e-01f, -9.771304727e-01f,
+    -3.949021697e-01f, -9.465737939e-01f, 4.808163941e-01f, 5.075630546e-01f,
+    -7.438093424e-01f, 4.557633996e-01f, 6.367160678e-01f, 6.134282351e-01f,
+    -9.293589592e-01f, -7.505259514e-01f, 5.501620770e-01f, -8.588444591e-01f,
+    -5.155928135e-01f, -4.410584569e-01f, 7.346774340e-01f, 7.000088096e-01f,
+    4.391267598e-01f, 4.474784434e-01f, -9.971086383e-01f, -6.393072009e-01f,
+    -7.188723683e-01f, 8.540388942e-01f, -6.096405387e-01f, 6.257399917e-01f,
+    -5.107041597e-01f, 7.124009728e-01f, -6.652983427e-01f, -4.810092151e-01f
+};
+
+static const float MAGIC_WAND_sparse_7_bias[] =
+{
+    2.365454659e-02f, -8.421674371e-02f, -5.989687145e-02f, 7.924246788e-02f
+};
+
+static const sparse_nn_layer_t MAGIC_WAND_sparse_layers[] =
+{
+    /* conv2d */
+    { SPARSE_NN_CONV2D, 128, 6, 1, 128, 6, 16, 3, 3, 1,
+      { MAGIC_WAND_sparse_0_start, MAGIC_WAND_sparse_0_index, MAGIC_WAND_sparse_0_value, MAGIC_WAND_sparse_0_bias }, NULL, NULL },
+    /* max_pooling2d */
+    { SPARSE_NN_MAXPOOL, 128, 6, 16, 42, 2, 16, 3, 3, 0,
+      {0}, NULL, NULL },
+    /* batch_normalization */
+    { SPARSE_NN_AFFINE, 42, 2, 16, 42, 2, 16, 1, 1, 0,
+      {0}, MAGIC_WAND_sparse_2_scale, MAGIC_WAND_sparse_2_shift },
+    /* conv2d_1 */
+    { SPARSE_NN_CONV2D, 42, 2, 16, 42, 2, 32, 3, 3, 1,
+      { MAGIC_WAND_sparse_3_start, MAGIC_WAND_sparse_3_index, MAGIC_WAND_sparse_3_value, MAGIC_WAND_sparse_3_bias }, NULL, NULL },
+    /* max_pooling2d_1 */
+    { SPARSE_NN_MAXPOOL, 42, 2, 32, 14, 2, 32, 3, 1, 0,
+      {0}, NULL, NULL },
+    /* global_average_pooling2d */
+    { SPARSE_NN_GLOBAL_AVGPOOL, 14, 2, 32, 1, 1, 32, 1, 1, 0,
+      {0}, NULL, NULL },
+    /* dense */
+    { SPARSE_NN_DENSE, 1, 1, 32, 1, 1, 16, 1, 1, 1,
+      { MAGIC_WAND_sparse_6_start, MAGIC_WAND_sparse_6_index, MAGIC_WAND_sparse_6_value, MAGIC_WAND_sparse_6_bias }, NULL, NULL },
+    /* dense_1 */
+    { SPARSE_NN_DENSE, 1, 1, 16, 1, 1, 4, 1, 1, 0,
+      { MAGIC_WAND_sparse_7_start, MAGIC_WAND_sparse_7_index, MAGIC_WAND_sparse_7_value, MAGIC_WAND_sparse_7_bias }, NULL, NULL },
+    /* dense_1_softmax */
+    { SPARSE_NN_SOFTMAX, 1, 1, 4, 1, 1, 4, 1, 1, 0,
+      {0}, NULL, NULL },
+};
+
+static float MAGIC_WAND_sparse_buffer[14976];
+
+const sparse_nn_model_t MAGIC_WAND_sparse_model =
+{
+    9, MAGIC_WAND_sparse_layers, 12288, MAGIC_WAND_sparse_buffer
+};
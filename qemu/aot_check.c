@@ -0,0 +1,331 @@
+/******************************************************************************
+* File Name:   aot_check.c
+*
+* Description: This file contains the check of the model compiled by
+*              train/aot_compile.py on QEMU. Every recorded window runs
+*              through the generated model with the TFLM interpreter of the
+*              ML middleware, then through the compiled model, on the same
+*              input, and the check reports the windows whose outputs are
+*              equal bit for bit, the instructions of both inferences, and
+*              the bytes of model data and arena of both.
+*
+*              Both engines must come from the same .tflite: the check
+*              refuses to run if the CRC of the generated model differs from
+*              the one recorded by aot_compile.py. The int8 window is
+*              quantized once with the scale of the model input, so both
+*              engines see the same values. Built with
+*              AOT_CHECK=1 and NN_INFERENCE_ENGINE=tflm, see qemu/Makefile.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2021-2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "sim_replay.h"
+#include "instrument.h"
+
+#include "mtb_ml_model.h"
+#include AOT_MODEL_HEADER
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/* Include model files */
+#include MTB_ML_INCLUDE_MODEL_FILE(MODEL_NAME)
+
+/*******************************************************************************
+* Constants
+*******************************************************************************/
+#define AOT_CHECK_DATA_DEFAULT  "../train/gesture_data"
+
+/* Names of the compiled model and of the generated model */
+#define AOT_CHECK_CONCAT(a, b)  a##b
+#define AOT_CHECK_NAME(name, suffix)    AOT_CHECK_CONCAT(name, suffix)
+
+#define AOT_CHECK_RUN           AOT_CHECK_NAME(MODEL_NAME, _aot_run)
+#define AOT_CHECK_QUANTIZED     AOT_CHECK_NAME(MODEL_NAME, _AOT_QUANTIZED)
+#define AOT_CHECK_INPUT_SIZE    AOT_CHECK_NAME(MODEL_NAME, _AOT_INPUT_SIZE)
+#define AOT_CHECK_OUTPUT_SIZE   AOT_CHECK_NAME(MODEL_NAME, _AOT_OUTPUT_SIZE)
+#define AOT_CHECK_ARENA_SIZE    AOT_CHECK_NAME(MODEL_NAME, _AOT_ARENA_SIZE)
+#define AOT_CHECK_CONST_SIZE    AOT_CHECK_NAME(MODEL_NAME, _AOT_CONST_DATA_SIZE)
+#define AOT_CHECK_BIN_LEN       AOT_CHECK_NAME(MODEL_NAME, _MODEL_BIN_LEN)
+#define AOT_CHECK_TFLM_ARENA    AOT_CHECK_NAME(MODEL_NAME, _ARENA_SIZE)
+#define AOT_CHECK_MODEL_BIN     AOT_CHECK_NAME(MODEL_NAME, _model_bin)
+#define AOT_CHECK_SOURCE_SIZE   AOT_CHECK_NAME(MODEL_NAME, _AOT_SOURCE_SIZE)
+#define AOT_CHECK_SOURCE_CRC    AOT_CHECK_NAME(MODEL_NAME, _AOT_SOURCE_CRC)
+
+/* CRC-16/CCITT-FALSE, as binascii.crc_hqx in aot_compile.py */
+#define AOT_CHECK_CRC_INIT      0xFFFFu
+#define AOT_CHECK_CRC_POLY      0x1021u
+
+#if AOT_CHECK_SOURCE_SIZE != AOT_CHECK_BIN_LEN
+#error The compiled model does not come from the .tflite of the generated model, run train/aot_compile.py
+#endif
+
+/*******************************************************************************
+* Typedefs
+*******************************************************************************/
+typedef AOT_CHECK_NAME(MODEL_NAME, _aot_data_t) aot_check_data_t;
+
+typedef struct
+{
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t total;
+} aot_check_time_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static mtb_ml_model_bin_t aot_check_bin = {MTB_ML_MODEL_BIN_DATA(MODEL_NAME)};
+
+static uint8_t aot_check_arena[AOT_CHECK_ARENA_SIZE] __attribute__((aligned(4)));
+
+static sim_replay_windows_t aot_check_data;
+static aot_check_time_t aot_check_interpreted;
+static aot_check_time_t aot_check_compiled;
+
+/*******************************************************************************
+* Local Functions
+*******************************************************************************/
+static uint16_t aot_check_crc16(const uint8_t *data, uint32_t size);
+static void aot_check_quantize(const float *window, aot_check_data_t *input);
+static void aot_check_time_add(aot_check_time_t *time, uint32_t cycles);
+static void aot_check_time_print(const char *name, const aot_check_time_t *time);
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*   Runs the check. Usage: aot_check [-r passes] [data folder | @list]
+*   Each pass runs every window once with both engines; the outputs are
+*   compared on the first pass, the times are from all the passes.
+*
+* Return:
+*   0 if every output is equal, 1 otherwise or if the model or recordings
+*   cannot be set up.
+*******************************************************************************/
+int main(int argc, char **argv)
+{
+    const char *folder = AOT_CHECK_DATA_DEFAULT;
+    uint32_t passes = 1;
+    uint32_t mismatches = 0;
+    double largest = 0.0;
+    mtb_ml_model_t *model;
+    MTB_ML_DATA_T *expected;
+    int expected_size;
+    aot_check_data_t input[AOT_CHECK_INPUT_SIZE];
+    aot_check_data_t output[AOT_CHECK_OUTPUT_SIZE];
+    int option;
+
+    while (-1 != (option = getopt(argc, argv, "r:")))
+    {
+        if ('r' == option)
+        {
+            passes = (uint32_t)strtoul(optarg, NULL, 10);
+        }
+        else
+        {
+            fprintf(stderr, "Usage: %s [-r passes] [data folder | @list]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (optind < argc)
+    {
+        folder = argv[optind];
+    }
+    if (0 == passes)
+    {
+        passes = 1;
+    }
+
+    if (!sim_replay_load_windows(folder, &aot_check_data))
+    {
+        return 1;
+    }
+
+    instrument_init();
+
+    if (AOT_CHECK_SOURCE_CRC != aot_check_crc16(AOT_CHECK_MODEL_BIN, AOT_CHECK_BIN_LEN))
+    {
+        fprintf(stderr, "The compiled model does not come from the .tflite of the generated model, "
+                "run train/aot_compile.py\n");
+        return 1;
+    }
+
+    if (CY_RSLT_SUCCESS != mtb_ml_model_init(&aot_check_bin, NULL, &model))
+    {
+        fprintf(stderr, "Cannot initialize the model\n");
+        return 1;
+    }
+    mtb_ml_model_get_output(model, &expected, &expected_size);
+    if ((AOT_CHECK_OUTPUT_SIZE != expected_size) || (sizeof(MTB_ML_DATA_T) != sizeof(aot_check_data_t)))
+    {
+        fprintf(stderr, "The compiled model does not match the generated model, set NN_TYPE\n");
+        return 1;
+    }
+
+    for (uint32_t pass = 0; pass < passes; pass++)
+    {
+        for (uint32_t i = 0; i < aot_check_data.count; i++)
+        {
+            uint32_t start;
+            uint32_t interpreted;
+            uint32_t compiled;
+
+            aot_check_quantize(aot_check_data.recorded[i], input);
+
+            start = INSTRUMENT_NOW();
+            mtb_ml_model_run(model, (MTB_ML_DATA_T *)input);
+            interpreted = INSTRUMENT_NOW();
+            AOT_CHECK_RUN(input, output, aot_check_arena);
+            compiled = INSTRUMENT_NOW();
+
+            aot_check_time_add(&aot_check_interpreted, interpreted - start);
+            aot_check_time_add(&aot_check_compiled, compiled - interpreted);
+
+            if ((0 == pass) && (0 != memcmp(output, expected, sizeof(output))))
+            {
+                mismatches++;
+                for (uint32_t j = 0; j < AOT_CHECK_OUTPUT_SIZE; j++)
+                {
+                    largest = fmax(largest, fabs((double)output[j] - (double)((aot_check_data_t *)expected)[j]));
+                }
+            }
+        }
+    }
+
+    printf("Compiled model check: %u windows from %u recordings, %u passes\n",
+           (unsigned)aot_check_data.count, (unsigned)aot_check_data.recordings, (unsigned)passes);
+    printf("Bit-exact outputs: %u of %u, largest difference %g%s\n\n",
+           (unsigned)(aot_check_data.count - mismatches), (unsigned)aot_check_data.count, largest,
+           AOT_CHECK_QUANTIZED ? " steps" : "");
+
+    printf("%-14s %10s %10s %10s\n", "Engine (insn)", "Average", "Min", "Max");
+    aot_check_time_print("tflm", &aot_check_interpreted);
+    aot_check_time_print("aot", &aot_check_compiled);
+    printf("Speedup: %.2f\n\n", (double)aot_check_interpreted.total / (double)aot_check_compiled.total);
+
+    printf("%-14s %10s %10s\n", "Bytes", "Model", "Arena");
+    printf("%-14s %10u %10u\n", "tflm", (unsigned)AOT_CHECK_BIN_LEN, (unsigned)AOT_CHECK_TFLM_ARENA);
+    printf("%-14s %10u %10u\n", "aot", (unsigned)AOT_CHECK_CONST_SIZE, (unsigned)AOT_CHECK_ARENA_SIZE);
+
+    return (0 == mismatches) ? 0 : 1;
+}
+
+/*******************************************************************************
+* Function Name: aot_check_crc16
+********************************************************************************
+* Summary:
+*   Computes the CRC-16/CCITT-FALSE of a buffer, one bit at a time as it runs
+*   once.
+*
+* Parameters:
+*     data: buffer
+*     size: bytes of the buffer
+*
+* Return:
+*   The CRC.
+*******************************************************************************/
+static uint16_t aot_check_crc16(const uint8_t *data, uint32_t size)
+{
+    uint16_t crc = AOT_CHECK_CRC_INIT;
+
+    for (uint32_t i = 0; i < size; i++)
+    {
+        crc ^= (uint16_t)((uint16_t)data[i] << 8);
+        for (uint32_t bit = 0; bit < 8; bit++)
+        {
+            crc = (crc & 0x8000u) ? (uint16_t)((crc << 1) ^ AOT_CHECK_CRC_POLY) : (uint16_t)(crc << 1);
+        }
+    }
+
+    return crc;
+}
+
+/*******************************************************************************
+* Function Name: aot_check_quantize
+********************************************************************************
+* Summary:
+*   Quantizes a window with the scale and zero point of the model input,
+*   rounded half away from zero as in TensorFlow Lite. A float model takes
+*   the window as it is.
+*
+* Parameters:
+*     window: pre-processed window
+*     input: model input
+*
+*******************************************************************************/
+static void aot_check_quantize(const float *window, aot_check_data_t *input)
+{
+    for (uint32_t i = 0; i < AOT_CHECK_INPUT_SIZE; i++)
+    {
+#if AOT_CHECK_QUANTIZED
+        float value = roundf(window[i] / AOT_CHECK_NAME(MODEL_NAME, _AOT_INPUT_SCALE)) +
+                      (float)AOT_CHECK_NAME(MODEL_NAME, _AOT_INPUT_ZERO_POINT);
+        input[i] = (aot_check_data_t)fminf(fmaxf(value, (float)INT8_MIN), (float)INT8_MAX);
+#else
+        input[i] = window[i];
+#endif
+    }
+}
+
+/*******************************************************************************
+* Function Name: aot_check_time_add
+*******************************************************************************/
+static void aot_check_time_add(aot_check_time_t *time, uint32_t cycles)
+{
+    if ((0 == time->count) || (cycles < time->min))
+    {
+        time->min = cycles;
+    }
+    if (cycles > time->max)
+    {
+        time->max = cycles;
+    }
+    time->total += cycles;
+    time->count++;
+}
+
+/*******************************************************************************
+* Function Name: aot_check_time_print
+*******************************************************************************/
+static void aot_check_time_print(const char *name, const aot_check_time_t *time)
+{
+    printf("%-14s %10.0f %10u %10u\n", name, (double)time->total / (double)time->count, (unsigned)time->min,
+           (unsigned)time->max);
+}
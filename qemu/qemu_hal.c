@@ -0,0 +1,535 @@
+/******************************************************************************
+* File Name:   qemu_hal.c
+*
+* Description: This file contains the board of the QEMU build, for the
+*              mps2-an386 machine (Cortex-M4F): the vector table and reset
+*              handler, the instruction counter, and the newlib system calls
+*              over semihosting, which open the recordings and print the
+*              report on the host.
+*
+*              QEMU runs with -icount shift=QEMU_ICOUNT_SHIFT: its virtual
+*              clock advances 2^QEMU_ICOUNT_SHIFT ns per instruction. The
+*              CMSDK timer 0 counts that clock at 25 MHz, so the instructions
+*              are the timer ticks times 40 ns, divided by the time of one
+*              instruction. The shift is large enough for every instruction to
+*              advance the timer.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2021-2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+/*******************************************************************************
+* Constants
+*******************************************************************************/
+/* Set by qemu/Makefile, must match the -icount option */
+#ifndef QEMU_ICOUNT_SHIFT
+#define QEMU_ICOUNT_SHIFT           6u
+#endif
+
+/* CMSDK APB timer 0 of the mps2-an386, clocked at 25 MHz */
+#define QEMU_TIMER_BASE             0x40000000u
+#define QEMU_TIMER_NS_PER_TICK      40u
+#define QEMU_TIMER_CTRL_ENABLE      0x1u
+
+/* Coprocessor access control, to enable the FPU */
+#define QEMU_SCB_CPACR              (*(volatile uint32_t *)0xE000ED88u)
+#define QEMU_CPACR_CP10_CP11        (0xFu << 20)
+
+/* Semihosting operations */
+#define SEMIHOSTING_SYS_OPEN        0x01u
+#define SEMIHOSTING_SYS_CLOSE       0x02u
+#define SEMIHOSTING_SYS_WRITE       0x05u
+#define SEMIHOSTING_SYS_READ        0x06u
+#define SEMIHOSTING_SYS_ISTTY       0x09u
+#define SEMIHOSTING_SYS_SEEK        0x0Au
+#define SEMIHOSTING_SYS_FLEN        0x0Cu
+#define SEMIHOSTING_SYS_GET_CMDLINE 0x15u
+#define SEMIHOSTING_SYS_EXIT_EXTENDED 0x20u
+
+#define SEMIHOSTING_APPLICATION_EXIT 0x20026u
+
+/* Open modes of SYS_OPEN, the index of the fopen mode in r, rb, r+, r+b, w,
+ * wb, w+, w+b, a, ab, a+, a+b */
+#define SEMIHOSTING_MODE_READ       0u
+#define SEMIHOSTING_MODE_BINARY     1u
+#define SEMIHOSTING_MODE_WRITE      4u
+#define SEMIHOSTING_MODE_APPEND     8u
+
+/* Files open at once, with the standard streams */
+#define QEMU_MAX_FILES              8
+#define QEMU_CMDLINE_SIZE           512u
+#define QEMU_MAX_ARGS               16
+
+/*******************************************************************************
+* Typedefs
+*******************************************************************************/
+typedef struct
+{
+    volatile uint32_t ctrl;
+    volatile uint32_t value;
+    volatile uint32_t reload;
+    volatile uint32_t intstatus;
+} qemu_timer_t;
+
+typedef struct
+{
+    int handle;                 /* Semihosting handle, -1 if closed */
+    uint32_t position;
+} qemu_file_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Defined by mps2_an386.ld */
+extern uint32_t __bss_start__;
+extern uint32_t __bss_end__;
+extern uint32_t __stack_top;
+extern char __heap_start;
+extern char __heap_end;
+
+static qemu_file_t qemu_files[QEMU_MAX_FILES];
+
+/* Instruction counter */
+static uint32_t qemu_timer_last;
+static uint64_t qemu_timer_ticks;
+
+/* C++ objects of the generated model, without the start files */
+void *__dso_handle;
+
+/*******************************************************************************
+* Local Functions
+*******************************************************************************/
+void Reset_Handler(void);
+static void qemu_fault_handler(void);
+static int qemu_semihosting(uint32_t operation, void *argument);
+static void qemu_open_standard(int fd, uint32_t mode);
+static int qemu_get_args(char **argv);
+
+extern int main(int argc, char **argv);
+extern void __libc_init_array(void);
+
+/* Vector table, read by QEMU at reset */
+__attribute__((section(".vectors"), used))
+static void (*const qemu_vectors[16])(void) =
+{
+    (void (*)(void))&__stack_top,
+    Reset_Handler,
+    qemu_fault_handler,     /* NMI */
+    qemu_fault_handler,     /* HardFault */
+    qemu_fault_handler,     /* MemManage */
+    qemu_fault_handler,     /* BusFault */
+    qemu_fault_handler,     /* UsageFault */
+};
+
+/*******************************************************************************
+* Function Name: Reset_Handler
+********************************************************************************
+* Summary:
+*   Enables the FPU, clears the bss, opens the standard streams on the host,
+*   starts the instruction counter and runs main with the arguments of the
+*   semihosting command line.
+*
+*******************************************************************************/
+void Reset_Handler(void)
+{
+    char *argv[QEMU_MAX_ARGS + 1];
+    qemu_timer_t *timer = (qemu_timer_t *)QEMU_TIMER_BASE;
+    int argc;
+
+    QEMU_SCB_CPACR |= QEMU_CPACR_CP10_CP11;
+    __asm volatile ("dsb\n\tisb" ::: "memory");
+
+    for (uint32_t *word = &__bss_start__; word < &__bss_end__; word++)
+    {
+        *word = 0;
+    }
+
+    for (int fd = 0; fd < QEMU_MAX_FILES; fd++)
+    {
+        qemu_files[fd].handle = -1;
+    }
+    qemu_open_standard(0, SEMIHOSTING_MODE_READ);
+    qemu_open_standard(1, SEMIHOSTING_MODE_WRITE);
+    qemu_open_standard(2, SEMIHOSTING_MODE_APPEND);
+
+    /* Free running down counter, extended to 64 bits when read */
+    timer->reload = UINT32_MAX;
+    timer->value = UINT32_MAX;
+    timer->ctrl = QEMU_TIMER_CTRL_ENABLE;
+    qemu_timer_last = UINT32_MAX;
+
+    __libc_init_array();
+
+    argc = qemu_get_args(argv);
+    exit(main(argc, argv));
+}
+
+/*******************************************************************************
+* Function Name: qemu_hal_instructions
+********************************************************************************
+* Summary:
+*   INSTRUMENT_NOW() of the QEMU build. Must be read at least once every
+*   2^32 timer ticks, 171 s of virtual time, and from a single context.
+*
+* Return:
+*   The instructions run since reset, modulo 2^32.
+*******************************************************************************/
+uint32_t qemu_hal_instructions(void)
+{
+    uint32_t value = ((qemu_timer_t *)QEMU_TIMER_BASE)->value;
+
+    qemu_timer_ticks += (uint32_t)(qemu_timer_last - value);
+    qemu_timer_last = value;
+
+    return (uint32_t)((qemu_timer_ticks * QEMU_TIMER_NS_PER_TICK) >> QEMU_ICOUNT_SHIFT);
+}
+
+/*******************************************************************************
+* Function Name: mtb_ml_model_profile_get_tsc
+********************************************************************************
+* Summary:
+*   Time stamp of the profiler of the ML middleware, for the layer times of
+*   the generated model: counts the instructions too.
+*
+*******************************************************************************/
+int mtb_ml_model_profile_get_tsc(uint32_t *val)
+{
+    *val = qemu_hal_instructions();
+
+    return 0;
+}
+
+/*******************************************************************************
+* Function Name: qemu_fault_handler
+********************************************************************************
+* Summary:
+*   Ends the emulation with an error, instead of hanging in the fault.
+*
+*******************************************************************************/
+static void qemu_fault_handler(void)
+{
+    static const char message[] = "Fault, emulation stopped\n";
+    uint32_t arguments[3] = { (uint32_t)qemu_files[2].handle, (uint32_t)(uintptr_t)message, sizeof(message) - 1u };
+
+    qemu_semihosting(SEMIHOSTING_SYS_WRITE, arguments);
+    _exit(1);
+}
+
+/*******************************************************************************
+* Function Name: qemu_semihosting
+********************************************************************************
+* Summary:
+*   Calls a semihosting operation of QEMU.
+*
+* Parameters:
+*   operation: SEMIHOSTING_SYS_*
+*   argument: parameter block of the operation
+*
+* Return:
+*   The result of the operation.
+*******************************************************************************/
+static int qemu_semihosting(uint32_t operation, void *argument)
+{
+    register uint32_t r0 __asm("r0") = operation;
+    register void *r1 __asm("r1") = argument;
+
+    __asm volatile ("bkpt 0xAB" : "+r"(r0) : "r"(r1) : "memory");
+
+    return (int)r0;
+}
+
+/*******************************************************************************
+* Function Name: qemu_open_standard
+********************************************************************************
+* Summary:
+*   Opens a standard stream on the console of QEMU, the special file ":tt".
+*
+*******************************************************************************/
+static void qemu_open_standard(int fd, uint32_t mode)
+{
+    uint32_t arguments[3] = { (uint32_t)(uintptr_t)":tt", mode, 3u };
+
+    qemu_files[fd].handle = qemu_semihosting(SEMIHOSTING_SYS_OPEN, arguments);
+    qemu_files[fd].position = 0;
+}
+
+/*******************************************************************************
+* Function Name: qemu_get_args
+********************************************************************************
+* Summary:
+*   Splits the semihosting command line, the arg= items of -semihosting-config,
+*   at the spaces.
+*
+* Return:
+*   The number of arguments.
+*******************************************************************************/
+static int qemu_get_args(char **argv)
+{
+    static char cmdline[QEMU_CMDLINE_SIZE];
+    uint32_t arguments[2] = { (uint32_t)(uintptr_t)cmdline, sizeof(cmdline) - 1u };
+    char *token;
+    int argc = 0;
+
+    if (0 != qemu_semihosting(SEMIHOSTING_SYS_GET_CMDLINE, arguments))
+    {
+        cmdline[0] = '\0';
+    }
+
+    for (token = strtok(cmdline, " "); (NULL != token) && (argc < QEMU_MAX_ARGS); token = strtok(NULL, " "))
+    {
+        argv[argc++] = token;
+    }
+    argv[argc] = NULL;
+
+    return argc;
+}
+
+/*******************************************************************************
+* Newlib system calls, on the files of the host
+*******************************************************************************/
+int _open(const char *name, int flags, ...)
+{
+    uint32_t mode = SEMIHOSTING_MODE_READ | SEMIHOSTING_MODE_BINARY;
+    uint32_t arguments[3];
+    int fd;
+
+    if (0 != (flags & O_APPEND))
+    {
+        mode = SEMIHOSTING_MODE_APPEND | SEMIHOSTING_MODE_BINARY;
+    }
+    else if (0 != (flags & (O_WRONLY | O_RDWR)))
+    {
+        mode = SEMIHOSTING_MODE_WRITE | SEMIHOSTING_MODE_BINARY;
+    }
+
+    for (fd = 0; (fd < QEMU_MAX_FILES) && (qemu_files[fd].handle >= 0); fd++)
+    {
+    }
+    if (QEMU_MAX_FILES == fd)
+    {
+        errno = EMFILE;
+        return -1;
+    }
+
+    arguments[0] = (uint32_t)(uintptr_t)name;
+    arguments[1] = mode;
+    arguments[2] = strlen(name);
+    qemu_files[fd].handle = qemu_semihosting(SEMIHOSTING_SYS_OPEN, arguments);
+    qemu_files[fd].position = 0;
+    if (qemu_files[fd].handle < 0)
+    {
+        errno = ENOENT;
+        return -1;
+    }
+
+    return fd;
+}
+
+int _close(int fd)
+{
+    uint32_t arguments[1];
+
+    if ((fd < 0) || (fd >= QEMU_MAX_FILES) || (qemu_files[fd].handle < 0))
+    {
+        errno = EBADF;
+        return -1;
+    }
+
+    arguments[0] = (uint32_t)qemu_files[fd].handle;
+    qemu_files[fd].handle = -1;
+
+    return (0 == qemu_semihosting(SEMIHOSTING_SYS_CLOSE, arguments)) ? 0 : -1;
+}
+
+int _read(int fd, char *buffer, int size)
+{
+    uint32_t arguments[3];
+    int remaining;
+
+    if ((fd < 0) || (fd >= QEMU_MAX_FILES) || (qemu_files[fd].handle < 0))
+    {
+        errno = EBADF;
+        return -1;
+    }
+
+    arguments[0] = (uint32_t)qemu_files[fd].handle;
+    arguments[1] = (uint32_t)(uintptr_t)buffer;
+    arguments[2] = (uint32_t)size;
+
+    /* Returns the number of bytes not read */
+    remaining = qemu_semihosting(SEMIHOSTING_SYS_READ, arguments);
+    qemu_files[fd].position += (uint32_t)(size - remaining);
+
+    return size - remaining;
+}
+
+int _write(int fd, const char *buffer, int size)
+{
+    uint32_t arguments[3];
+    int remaining;
+
+    if ((fd < 0) || (fd >= QEMU_MAX_FILES) || (qemu_files[fd].handle < 0))
+    {
+        errno = EBADF;
+        return -1;
+    }
+
+    arguments[0] = (uint32_t)qemu_files[fd].handle;
+    arguments[1] = (uint32_t)(uintptr_t)buffer;
+    arguments[2] = (uint32_t)size;
+
+    /* Returns the number of bytes not written */
+    remaining = qemu_semihosting(SEMIHOSTING_SYS_WRITE, arguments);
+    qemu_files[fd].position += (uint32_t)(size - remaining);
+
+    return size - remaining;
+}
+
+int _lseek(int fd, int offset, int whence)
+{
+    uint32_t arguments[2];
+    int position;
+
+    if ((fd < 0) || (fd >= QEMU_MAX_FILES) || (qemu_files[fd].handle < 0))
+    {
+        errno = EBADF;
+        return -1;
+    }
+
+    arguments[0] = (uint32_t)qemu_files[fd].handle;
+    if (SEEK_CUR == whence)
+    {
+        position = (int)qemu_files[fd].position + offset;
+    }
+    else if (SEEK_END == whence)
+    {
+        position = qemu_semihosting(SEMIHOSTING_SYS_FLEN, arguments) + offset;
+    }
+    else
+    {
+        position = offset;
+    }
+
+    arguments[1] = (uint32_t)position;
+    if ((position < 0) || (0 != qemu_semihosting(SEMIHOSTING_SYS_SEEK, arguments)))
+    {
+        errno = EINVAL;
+        return -1;
+    }
+    qemu_files[fd].position = (uint32_t)position;
+
+    return position;
+}
+
+int _isatty(int fd)
+{
+    uint32_t arguments[1];
+
+    if ((fd < 0) || (fd >= QEMU_MAX_FILES) || (qemu_files[fd].handle < 0))
+    {
+        errno = EBADF;
+        return 0;
+    }
+
+    arguments[0] = (uint32_t)qemu_files[fd].handle;
+
+    return (1 == qemu_semihosting(SEMIHOSTING_SYS_ISTTY, arguments)) ? 1 : 0;
+}
+
+int _fstat(int fd, struct stat *st)
+{
+    memset(st, 0, sizeof(*st));
+    st->st_mode = _isatty(fd) ? S_IFCHR : S_IFREG;
+
+    return 0;
+}
+
+/* The heap is the 16 MB PSRAM, the windows of the recordings do not fit in
+ * the 4 MB SSRAM */
+void *_sbrk(int increment)
+{
+    static char *heap = &__heap_start;
+    char *previous = heap;
+
+    if ((heap + increment) > &__heap_end)
+    {
+        errno = ENOMEM;
+        return (void *)-1;
+    }
+    heap += increment;
+
+    return previous;
+}
+
+void _exit(int status)
+{
+    uint32_t arguments[2] = { SEMIHOSTING_APPLICATION_EXIT, (uint32_t)status };
+
+    for (;;)
+    {
+        qemu_semihosting(SEMIHOSTING_SYS_EXIT_EXTENDED, arguments);
+    }
+}
+
+int _getpid(void)
+{
+    return 1;
+}
+
+int _kill(int pid, int signal)
+{
+    (void)pid;
+    (void)signal;
+    errno = EINVAL;
+
+    return -1;
+}
+
+void _init(void)
+{
+}
+
+void _fini(void)
+{
+}
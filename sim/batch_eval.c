@@ -0,0 +1,398 @@
+/******************************************************************************
+* File Name:   batch_eval.c
+*
+* Description: This file contains the offline evaluation of a float model of
+*              mtb_ml_gen/model_gen_dir on the recordings of
+*              train/gesture_data. All the recorded windows run through the
+*              batched engine of batch_nn.c, then one by one through its
+*              reference, and the tool reports the throughput of both, the
+*              largest difference of their outputs, and the accuracy of the
+*              decisions of the application on the batched outputs.
+*
+*              As in the replay benchmark, the model classifies the windows
+*              as pre-processed on the kit.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2021-2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "batch_nn.h"
+#include "tflite_reader.h"
+#include "control.h"
+#include "sim_replay.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+/*******************************************************************************
+* Constants
+*******************************************************************************/
+#define EVAL_DATA_DEFAULT       "../train/gesture_data"
+#define EVAL_MODEL_DEFAULT      "../mtb_ml_gen/model_gen_dir/MAGIC_WAND_float.tflite"
+
+/* Largest difference of an output with the reference, as
+ * FOLD_TOLERANCE of train/fold_model.py */
+#define EVAL_TOLERANCE          1e-4
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const char *const eval_layer_names[] =
+{
+    [BATCH_NN_CONV] = "conv",
+    [BATCH_NN_DENSE] = "dense",
+    [BATCH_NN_MAX_POOL] = "max pool",
+    [BATCH_NN_AVERAGE_POOL] = "average pool",
+    [BATCH_NN_AFFINE] = "affine",
+    [BATCH_NN_MEAN] = "mean",
+    [BATCH_NN_SOFTMAX] = "softmax",
+};
+
+static sim_replay_windows_t eval_data;
+static uint32_t eval_confusion[SIM_REPLAY_MAX_CLASSES][SIM_REPLAY_MAX_CLASSES];
+
+/*******************************************************************************
+* Local Functions
+*******************************************************************************/
+static double eval_seconds(void);
+static uint32_t eval_decide(const float *output, uint32_t size);
+static bool eval_write(const char *path, const float *outputs, uint32_t size);
+static void eval_report(const batch_nn_t *nn, uint32_t passes, double batched, double reference, double error,
+                        uint32_t differences);
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*   Runs the evaluation. Usage:
+*   batch_eval [-m model] [-b windows] [-r passes] [-o outputs] [data folder | @list]
+*   -b sets the windows of a chunk, -r the passes of the batched engine over
+*   all the windows, and -o writes the class, decision and outputs of each
+*   window to a CSV file.
+*
+* Return:
+*   0 on success, 1 if the model or the recordings cannot be read, or the
+*   outputs differ from the reference by more than EVAL_TOLERANCE.
+*******************************************************************************/
+int main(int argc, char **argv)
+{
+    const char *folder = EVAL_DATA_DEFAULT;
+    const char *path = EVAL_MODEL_DEFAULT;
+    const char *outputs_path = NULL;
+    uint32_t chunk = 0;
+    uint32_t passes = 1;
+    uint32_t differences = 0;
+    double error = 0.0;
+    int status;
+    double batched;
+    double reference;
+    double start;
+    tflite_reader_t model;
+    batch_nn_t nn;
+    cy_rslt_t result;
+    float *outputs;
+    float *expected;
+    int option;
+
+    while (-1 != (option = getopt(argc, argv, "m:b:r:o:")))
+    {
+        switch (option)
+        {
+            case 'm':
+                path = optarg;
+                break;
+            case 'b':
+                chunk = (uint32_t)strtoul(optarg, NULL, 10);
+                break;
+            case 'r':
+                passes = (uint32_t)strtoul(optarg, NULL, 10);
+                break;
+            case 'o':
+                outputs_path = optarg;
+                break;
+            default:
+                fprintf(stderr, "Usage: %s [-m model] [-b windows] [-r passes] [-o outputs] [data folder | @list]\n",
+                        argv[0]);
+                return 1;
+        }
+    }
+    if (optind < argc)
+    {
+        folder = argv[optind];
+    }
+    if (0 == passes)
+    {
+        passes = 1;
+    }
+
+    if (!sim_replay_load_windows(folder, &eval_data))
+    {
+        return 1;
+    }
+
+    if (CY_RSLT_SUCCESS != tflite_reader_open(&model, path))
+    {
+        fprintf(stderr, "Cannot read the model %s\n", path);
+        return 1;
+    }
+    result = batch_nn_init(&nn, &model, chunk);
+    tflite_reader_close(&model);
+    if (CY_RSLT_SUCCESS != result)
+    {
+        fprintf(stderr, "Cannot run the model %s\n", path);
+        return 1;
+    }
+
+    if ((SIM_REPLAY_WINDOW_VALUES != nn.input_size) || (eval_data.num_classes != nn.output_size))
+    {
+        fprintf(stderr, "The model takes %u values and has %u outputs, the windows have %u values and %u classes\n",
+                (unsigned)nn.input_size, (unsigned)nn.output_size, (unsigned)SIM_REPLAY_WINDOW_VALUES,
+                (unsigned)eval_data.num_classes);
+        batch_nn_deinit(&nn);
+        return 1;
+    }
+
+    outputs = malloc((size_t)eval_data.count * nn.output_size * sizeof(float));
+    expected = malloc((size_t)eval_data.count * nn.output_size * sizeof(float));
+    if ((NULL == outputs) || (NULL == expected))
+    {
+        fprintf(stderr, "Cannot allocate the outputs\n");
+        free(expected);
+        free(outputs);
+        batch_nn_deinit(&nn);
+        return 1;
+    }
+
+    start = eval_seconds();
+    for (uint32_t pass = 0; pass < passes; pass++)
+    {
+        batch_nn_run(&nn, &eval_data.recorded[0][0], eval_data.count, outputs);
+    }
+    batched = eval_seconds() - start;
+
+    start = eval_seconds();
+    for (uint32_t i = 0; i < eval_data.count; i++)
+    {
+        batch_nn_run_reference(&nn, eval_data.recorded[i], &expected[(size_t)i * nn.output_size]);
+    }
+    reference = eval_seconds() - start;
+
+    for (uint32_t i = 0; i < eval_data.count; i++)
+    {
+        const float *output = &outputs[(size_t)i * nn.output_size];
+        uint32_t predicted = eval_decide(output, nn.output_size);
+
+        for (uint32_t j = 0; j < nn.output_size; j++)
+        {
+            error = fmax(error, fabs((double)output[j] - (double)expected[(size_t)i * nn.output_size + j]));
+        }
+        if (predicted != eval_decide(&expected[(size_t)i * nn.output_size], nn.output_size))
+        {
+            differences++;
+        }
+        eval_confusion[eval_data.labels[i]][predicted]++;
+    }
+
+    eval_report(&nn, passes, batched, reference, error, differences);
+    status = (error > EVAL_TOLERANCE) ? 1 : 0;
+
+    if ((NULL != outputs_path) && !eval_write(outputs_path, outputs, nn.output_size))
+    {
+        fprintf(stderr, "Cannot write %s\n", outputs_path);
+        status = 1;
+    }
+
+    free(expected);
+    free(outputs);
+    batch_nn_deinit(&nn);
+
+    return status;
+}
+
+/*******************************************************************************
+* Function Name: output_write
+********************************************************************************
+* Summary:
+*   The decision is not printed by the evaluation, control() is not called.
+*
+*******************************************************************************/
+uint32_t output_write(const char *data, uint32_t size)
+{
+    (void)data;
+    (void)size;
+
+    return 0;
+}
+
+/*******************************************************************************
+* Function Name: eval_seconds
+********************************************************************************
+* Summary:
+*   Returns the monotonic clock in seconds.
+*
+*******************************************************************************/
+static double eval_seconds(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (double)now.tv_sec + (double)now.tv_nsec * 1e-9;
+}
+
+/*******************************************************************************
+* Function Name: eval_decide
+********************************************************************************
+* Summary:
+*   Makes the decision of the application on the outputs of a window.
+*
+* Return:
+*   The class detected; the negative class, last, below the thresholds.
+*******************************************************************************/
+static uint32_t eval_decide(const float *output, uint32_t size)
+{
+    control_decision_t decision;
+
+    control_decide(output, (int)size, &decision);
+
+    return (decision.detected && ((uint32_t)decision.class_index < size)) ? (uint32_t)decision.class_index :
+           (size - 1u);
+}
+
+/*******************************************************************************
+* Function Name: eval_write
+********************************************************************************
+* Summary:
+*   Writes the recorded class, the decision and the outputs of each window to
+*   a CSV file.
+*
+* Return:
+*   false if the file cannot be written.
+*******************************************************************************/
+static bool eval_write(const char *path, const float *outputs, uint32_t size)
+{
+    FILE *file = fopen(path, "w");
+    bool success;
+
+    if (NULL == file)
+    {
+        return false;
+    }
+
+    fprintf(file, "class,decision");
+    for (uint32_t j = 0; j < size; j++)
+    {
+        fprintf(file, ",%s", eval_data.classes[j]);
+    }
+    fprintf(file, "\n");
+
+    for (uint32_t i = 0; i < eval_data.count; i++)
+    {
+        const float *output = &outputs[(size_t)i * size];
+
+        fprintf(file, "%s,%s", eval_data.classes[eval_data.labels[i]], eval_data.classes[eval_decide(output, size)]);
+        for (uint32_t j = 0; j < size; j++)
+        {
+            fprintf(file, ",%.6f", (double)output[j]);
+        }
+        fprintf(file, "\n");
+    }
+
+    success = (0 == ferror(file));
+
+    return (0 == fclose(file)) && success;
+}
+
+/*******************************************************************************
+* Function Name: eval_report
+********************************************************************************
+* Summary:
+*   Prints the layers of the model, the throughput of the batched engine and
+*   of the reference, the largest difference of their outputs, and the recall
+*   of each class.
+*
+* Parameters:
+*     nn: engine
+*     passes: passes of the batched engine
+*     batched: seconds of the passes of the batched engine
+*     reference: seconds of the reference
+*     error: largest difference of an output with the reference
+*     differences: windows where the decision on the reference differs
+*
+*******************************************************************************/
+static void eval_report(const batch_nn_t *nn, uint32_t passes, double batched, double reference, double error,
+                        uint32_t differences)
+{
+    uint32_t correct = 0;
+
+    printf("Batch evaluation: %u windows of %u samples from %u recordings\n\n", (unsigned)eval_data.count,
+           (unsigned)SENSOR_BATCH_SIZE, (unsigned)eval_data.recordings);
+
+    printf("%-14s %12s %8s\n", "Layer", "Output", "Depth");
+    for (uint32_t i = 0; i < nn->num_layers; i++)
+    {
+        const batch_nn_layer_t *layer = &nn->layers[i];
+        char shape[32];
+
+        snprintf(shape, sizeof(shape), "%ux%ux%u", (unsigned)layer->out_h, (unsigned)layer->out_w,
+                 (unsigned)layer->out_c);
+        printf("%-14s %12s %8u\n", eval_layer_names[layer->type], shape, (unsigned)layer->depth);
+    }
+
+    printf("\nBatched, %u windows a chunk: %.0f windows/s over %u passes\n", (unsigned)nn->chunk,
+           (double)eval_data.count * passes / batched, (unsigned)passes);
+    printf("Reference, one window at a time: %.0f windows/s\n", (double)eval_data.count / reference);
+    printf("Largest difference with the reference: %.3g, tolerance %.3g; %u decisions differ\n", error,
+           EVAL_TOLERANCE, (unsigned)differences);
+
+    printf("\n%-14s %8s %8s\n", "Class", "Windows", "Recall");
+    for (uint32_t label = 0; label < eval_data.num_classes; label++)
+    {
+        uint32_t recorded = 0;
+
+        for (uint32_t i = 0; i < eval_data.num_classes; i++)
+        {
+            recorded += eval_confusion[label][i];
+        }
+        correct += eval_confusion[label][label];
+
+        printf("%-14s %8u %8.3f\n", eval_data.classes[label], (unsigned)recorded,
+               (0 == recorded) ? 0.0 : (double)eval_confusion[label][label] / recorded);
+    }
+    printf("Accuracy: %.3f\n", (double)correct / eval_data.count);
+}
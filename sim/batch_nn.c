@@ -0,0 +1,1164 @@
+/******************************************************************************
+* File Name:   batch_nn.c
+*
+* Description: This file contains a batched inference engine for the float
+*              TensorFlow Lite models, for the offline evaluation of many
+*              recorded windows on the host.
+*
+*              The windows run through the layers in chunks of a few windows,
+*              so that the activations of a chunk stay in the cache. The
+*              convolutions and the dense layers of a chunk are one matrix
+*              product each: the rows of the im2col matrix, one per output
+*              position of each window, by the weights. The product is
+*              blocked for the caches: a block of MC rows by KC depth is
+*              gathered from the input, already packed in panels of MR rows,
+*              and multiplied by the weights, packed at load in panels of NR
+*              output channels. The micro-kernel keeps an MR x NR block of
+*              the output in registers, with the vector extension of GCC, so
+*              that the compiler uses the SIMD unit of the host.
+*
+*              batch_nn_run_reference runs one window with direct loops in
+*              the order of the TensorFlow Lite reference kernels, to check
+*              the batched engine.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2021-2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "batch_nn.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*******************************************************************************
+* Constants
+*******************************************************************************/
+/* Alignment of the buffers, a cache line */
+#define BATCH_NN_ALIGNMENT          64u
+
+/*******************************************************************************
+* Typedefs
+*******************************************************************************/
+/* NR floats, one row of the register block */
+typedef float batch_nn_vector_t __attribute__((vector_size(BATCH_NN_NR * sizeof(float))));
+
+/*******************************************************************************
+* Local Functions
+*******************************************************************************/
+static cy_rslt_t batch_nn_add_layer(batch_nn_t *nn, const tflite_reader_t *model, const tflite_operator_t *op,
+                                    int32_t input, uint32_t *shape);
+static bool batch_nn_get_shape(const tflite_tensor_t *tensor, uint32_t *shape);
+static uint32_t batch_nn_get_elements(const tflite_tensor_t *tensor);
+static float *batch_nn_get_constant(const tflite_reader_t *model, int32_t index, uint32_t count);
+static bool batch_nn_set_window(batch_nn_layer_t *layer, const tflite_options_t *options);
+static bool batch_nn_pack_weights(batch_nn_layer_t *layer);
+static float *batch_nn_alloc(uint32_t count);
+static void batch_nn_run_layer(batch_nn_t *nn, const batch_nn_layer_t *layer, const float *input, uint32_t count,
+                               float *output);
+static void batch_nn_gemm(batch_nn_t *nn, const batch_nn_layer_t *layer, const float *input, uint32_t rows,
+                          float *output);
+static void batch_nn_pack_rows(batch_nn_t *nn, const batch_nn_layer_t *layer, const float *input, uint32_t first,
+                               uint32_t rows, uint32_t offset, uint32_t depth);
+static void batch_nn_im2col(const batch_nn_layer_t *layer, const float *input, uint32_t row, uint32_t offset,
+                            uint32_t depth, float *packed);
+static void batch_nn_kernel(uint32_t depth, const float *a, const float *b, float *c, uint32_t stride,
+                            uint32_t rows, uint32_t columns, const float *bias, uint8_t activation);
+static void batch_nn_direct(const batch_nn_layer_t *layer, const float *input, float *output);
+static void batch_nn_pool(const batch_nn_layer_t *layer, const float *input, uint32_t count, float *output);
+static void batch_nn_affine(const batch_nn_layer_t *layer, const float *input, uint32_t count, float *output);
+static void batch_nn_mean(const batch_nn_layer_t *layer, const float *input, uint32_t count, float *output);
+static void batch_nn_softmax(const batch_nn_layer_t *layer, const float *input, uint32_t count, float *output);
+
+/*******************************************************************************
+* Function Name: batch_nn_activate
+*******************************************************************************/
+static inline float batch_nn_activate(float value, uint8_t activation)
+{
+    if ((TFLITE_ACTIVATION_NONE != activation) && (value < 0.0f))
+    {
+        value = 0.0f;
+    }
+    if ((TFLITE_ACTIVATION_RELU6 == activation) && (value > 6.0f))
+    {
+        value = 6.0f;
+    }
+
+    return value;
+}
+
+/*******************************************************************************
+* Function Name: batch_nn_init
+********************************************************************************
+* Summary:
+*   Builds the layers of a float model from the operators of a .tflite file,
+*   packs the weights for the matrix products and allocates the buffers of a
+*   chunk. The operators must run one after the other, each on the output of
+*   the previous one. A multiplication followed by an addition by constants
+*   of each channel, such as a BatchNormalization, is one affine layer.
+*
+* Parameters:
+*     nn: engine, released with batch_nn_deinit
+*     model: model read by tflite_reader_open, which can be closed after
+*     chunk: windows run through the layers together, 0 for the default
+*
+* Return:
+*   BATCH_NN_RSLT_ERR_UNSUPPORTED if an operator cannot run, the reason is
+*   printed, BATCH_NN_RSLT_NO_MEMORY if the buffers cannot be allocated.
+*******************************************************************************/
+cy_rslt_t batch_nn_init(batch_nn_t *nn, const tflite_reader_t *model, uint32_t chunk)
+{
+    const tflite_tensor_t *tensor = &model->tensors[model->input];
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    int32_t current = model->input;
+    uint32_t shape[3];
+
+    memset(nn, 0, sizeof(*nn));
+    nn->chunk = (0u == chunk) ? BATCH_NN_DEFAULT_CHUNK : chunk;
+
+    if ((TFLITE_TYPE_FLOAT32 != tensor->type) || !batch_nn_get_shape(tensor, shape))
+    {
+        fprintf(stderr, "The input of the model is not a float window, only float models run\n");
+        return BATCH_NN_RSLT_ERR_UNSUPPORTED;
+    }
+    nn->input_size = shape[0] * shape[1] * shape[2];
+    nn->max_size = nn->input_size;
+
+    for (uint32_t i = 0; (i < model->num_operators) && (CY_RSLT_SUCCESS == result); i++)
+    {
+        const tflite_operator_t *op = &model->operators[i];
+
+        if ((op->num_inputs < 1u) || (1u != op->num_outputs) ||
+            ((current != op->inputs[0]) && ((op->num_inputs < 2u) || (current != op->inputs[1]))))
+        {
+            fprintf(stderr, "Operator %u does not run on the output of the previous one\n", (unsigned)i);
+            result = BATCH_NN_RSLT_ERR_UNSUPPORTED;
+            break;
+        }
+
+        result = batch_nn_add_layer(nn, model, op, current, shape);
+        current = op->outputs[0];
+
+        /* The shape computed for the layer is the shape of the model */
+        if ((CY_RSLT_SUCCESS == result) &&
+            (batch_nn_get_elements(&model->tensors[current]) != shape[0] * shape[1] * shape[2]))
+        {
+            result = BATCH_NN_RSLT_ERR_UNSUPPORTED;
+        }
+        if (CY_RSLT_SUCCESS != result)
+        {
+            fprintf(stderr, "Operator %u, code %d, is not supported\n", (unsigned)i, (int)op->code);
+            break;
+        }
+
+        if (nn->max_size < shape[0] * shape[1] * shape[2])
+        {
+            nn->max_size = shape[0] * shape[1] * shape[2];
+        }
+    }
+
+    if ((CY_RSLT_SUCCESS == result) && ((current != model->output) || (0u == nn->num_layers)))
+    {
+        fprintf(stderr, "The last operator does not write the output of the model\n");
+        result = BATCH_NN_RSLT_ERR_UNSUPPORTED;
+    }
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        nn->output_size = shape[0] * shape[1] * shape[2];
+        nn->buffers[0] = batch_nn_alloc(nn->chunk * nn->max_size);
+        nn->buffers[1] = batch_nn_alloc(nn->chunk * nn->max_size);
+        nn->block = batch_nn_alloc(BATCH_NN_MC * BATCH_NN_KC);
+        if ((NULL == nn->buffers[0]) || (NULL == nn->buffers[1]) || (NULL == nn->block))
+        {
+            result = BATCH_NN_RSLT_NO_MEMORY;
+        }
+    }
+
+    if (CY_RSLT_SUCCESS != result)
+    {
+        batch_nn_deinit(nn);
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: batch_nn_run
+********************************************************************************
+* Summary:
+*   Runs the model on windows, a chunk at a time.
+*
+* Parameters:
+*     nn: engine
+*     input: windows, input_size values each
+*     count: number of windows
+*     output: output_size values of each window
+*
+*******************************************************************************/
+void batch_nn_run(batch_nn_t *nn, const float *input, uint32_t count, float *output)
+{
+    for (uint32_t first = 0; first < count; first += nn->chunk)
+    {
+        uint32_t windows = ((count - first) < nn->chunk) ? (count - first) : nn->chunk;
+        const float *source = &input[(size_t)first * nn->input_size];
+
+        for (uint32_t i = 0; i < nn->num_layers; i++)
+        {
+            float *destination = (i + 1u == nn->num_layers) ? &output[(size_t)first * nn->output_size] :
+                                 nn->buffers[i % 2u];
+
+            batch_nn_run_layer(nn, &nn->layers[i], source, windows, destination);
+            source = destination;
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: batch_nn_run_reference
+********************************************************************************
+* Summary:
+*   Runs the model on one window, with direct loops for the convolutions and
+*   the dense layers instead of the matrix products. The other layers are the
+*   same as in batch_nn_run.
+*
+* Parameters:
+*     nn: engine
+*     input: window, input_size values
+*     output: output_size values
+*
+*******************************************************************************/
+void batch_nn_run_reference(batch_nn_t *nn, const float *input, float *output)
+{
+    const float *source = input;
+
+    for (uint32_t i = 0; i < nn->num_layers; i++)
+    {
+        const batch_nn_layer_t *layer = &nn->layers[i];
+        float *destination = (i + 1u == nn->num_layers) ? output : nn->buffers[i % 2u];
+
+        if ((BATCH_NN_CONV == layer->type) || (BATCH_NN_DENSE == layer->type))
+        {
+            batch_nn_direct(layer, source, destination);
+        }
+        else
+        {
+            batch_nn_run_layer(nn, layer, source, 1u, destination);
+        }
+        source = destination;
+    }
+}
+
+/*******************************************************************************
+* Function Name: batch_nn_deinit
+*******************************************************************************/
+void batch_nn_deinit(batch_nn_t *nn)
+{
+    for (uint32_t i = 0; i < nn->num_layers; i++)
+    {
+        batch_nn_layer_t *layer = &nn->layers[i];
+
+        free(layer->weights);
+        free(layer->bias);
+        free(layer->packed);
+        free(layer->scale);
+        free(layer->shift);
+    }
+
+    free(nn->buffers[0]);
+    free(nn->buffers[1]);
+    free(nn->block);
+    memset(nn, 0, sizeof(*nn));
+}
+
+/*******************************************************************************
+* Function Name: batch_nn_add_layer
+********************************************************************************
+* Summary:
+*   Adds the layer of an operator, or merges it into the previous layer.
+*
+* Parameters:
+*     nn: engine
+*     model: model of the operator
+*     op: operator
+*     input: tensor of the output of the previous operator
+*     shape: height, width and channels of the input, updated to the output
+*
+* Return:
+*   BATCH_NN_RSLT_ERR_UNSUPPORTED if the operator or its parameters are not
+*   supported.
+*******************************************************************************/
+static cy_rslt_t batch_nn_add_layer(batch_nn_t *nn, const tflite_reader_t *model, const tflite_operator_t *op,
+                                    int32_t input, uint32_t *shape)
+{
+    const tflite_options_t *options = &op->options;
+    batch_nn_layer_t *layer = &nn->layers[nn->num_layers];
+    int32_t other;
+    uint32_t size;
+    float *values;
+
+    if (TFLITE_OP_RESHAPE == op->code)
+    {
+        /* Same values in the same order */
+        size = shape[0] * shape[1] * shape[2];
+        return (batch_nn_get_shape(&model->tensors[op->outputs[0]], shape) &&
+                (size == shape[0] * shape[1] * shape[2])) ? CY_RSLT_SUCCESS : BATCH_NN_RSLT_ERR_UNSUPPORTED;
+    }
+
+    /* A multiplication or addition after an affine layer updates its constants */
+    if (((TFLITE_OP_MUL == op->code) || (TFLITE_OP_ADD == op->code)) && (nn->num_layers > 0u) &&
+        (BATCH_NN_AFFINE == layer[-1].type) && (TFLITE_ACTIVATION_NONE == layer[-1].activation))
+    {
+        layer--;
+    }
+    else if (BATCH_NN_MAX_LAYERS == nn->num_layers)
+    {
+        return BATCH_NN_RSLT_ERR_UNSUPPORTED;
+    }
+    else
+    {
+        memset(layer, 0, sizeof(*layer));
+        nn->num_layers++;
+    }
+
+    layer->in_h = shape[0];
+    layer->in_w = shape[1];
+    layer->in_c = shape[2];
+    layer->out_h = shape[0];
+    layer->out_w = shape[1];
+    layer->out_c = shape[2];
+    layer->activation = options->activation;
+
+    if ((TFLITE_ACTIVATION_NONE != options->activation) && (TFLITE_ACTIVATION_RELU != options->activation) &&
+        (TFLITE_ACTIVATION_RELU6 != options->activation))
+    {
+        return BATCH_NN_RSLT_ERR_UNSUPPORTED;
+    }
+
+    switch (op->code)
+    {
+        case TFLITE_OP_CONV_2D:
+        {
+            const tflite_tensor_t *filter = &model->tensors[op->inputs[1]];
+
+            if ((op->num_inputs < 2u) || (4u != filter->num_dims) || (filter->dims[3] != (int32_t)shape[2]) ||
+                (1 != options->dilation_w) || (1 != options->dilation_h))
+            {
+                return BATCH_NN_RSLT_ERR_UNSUPPORTED;
+            }
+            layer->type = BATCH_NN_CONV;
+            layer->filter_h = (uint32_t)filter->dims[1];
+            layer->filter_w = (uint32_t)filter->dims[2];
+            layer->out_c = (uint32_t)filter->dims[0];
+            if (!batch_nn_set_window(layer, options))
+            {
+                return BATCH_NN_RSLT_ERR_UNSUPPORTED;
+            }
+            break;
+        }
+
+        case TFLITE_OP_FULLY_CONNECTED:
+        {
+            const tflite_tensor_t *weights = &model->tensors[op->inputs[1]];
+
+            if ((op->num_inputs < 2u) || (2u != weights->num_dims) ||
+                (weights->dims[1] != (int32_t)(shape[0] * shape[1] * shape[2])))
+            {
+                return BATCH_NN_RSLT_ERR_UNSUPPORTED;
+            }
+            layer->type = BATCH_NN_DENSE;
+            layer->in_h = 1u;
+            layer->in_w = 1u;
+            layer->in_c = (uint32_t)weights->dims[1];
+            layer->out_h = 1u;
+            layer->out_w = 1u;
+            layer->out_c = (uint32_t)weights->dims[0];
+            layer->filter_h = 1u;
+            layer->filter_w = 1u;
+            layer->stride_h = 1u;
+            layer->stride_w = 1u;
+            break;
+        }
+
+        case TFLITE_OP_MAX_POOL_2D:
+        case TFLITE_OP_AVERAGE_POOL_2D:
+            layer->type = (TFLITE_OP_MAX_POOL_2D == op->code) ? BATCH_NN_MAX_POOL : BATCH_NN_AVERAGE_POOL;
+            layer->filter_h = (uint32_t)options->filter_h;
+            layer->filter_w = (uint32_t)options->filter_w;
+            if ((options->filter_h <= 0) || (options->filter_w <= 0) || !batch_nn_set_window(layer, options))
+            {
+                return BATCH_NN_RSLT_ERR_UNSUPPORTED;
+            }
+            break;
+
+        case TFLITE_OP_MUL:
+        case TFLITE_OP_ADD:
+            /* The constant of each channel, or one for all */
+            other = (input == op->inputs[0]) ? op->inputs[1] : op->inputs[0];
+            size = batch_nn_get_elements(&model->tensors[other]);
+            if ((1u != size) && (shape[2] != size))
+            {
+                return BATCH_NN_RSLT_ERR_UNSUPPORTED;
+            }
+            values = batch_nn_get_constant(model, other, size);
+            if (NULL == values)
+            {
+                return BATCH_NN_RSLT_ERR_UNSUPPORTED;
+            }
+
+            if (BATCH_NN_AFFINE != layer->type)
+            {
+                layer->type = BATCH_NN_AFFINE;
+                layer->scale = batch_nn_alloc(shape[2]);
+                layer->shift = batch_nn_alloc(shape[2]);
+                if ((NULL == layer->scale) || (NULL == layer->shift))
+                {
+                    free(values);
+                    return BATCH_NN_RSLT_NO_MEMORY;
+                }
+                for (uint32_t i = 0; i < shape[2]; i++)
+                {
+                    layer->scale[i] = 1.0f;
+                    layer->shift[i] = 0.0f;
+                }
+            }
+
+            for (uint32_t i = 0; i < shape[2]; i++)
+            {
+                float value = values[(1u == size) ? 0u : i];
+
+                if (TFLITE_OP_MUL == op->code)
+                {
+                    layer->scale[i] *= value;
+                    layer->shift[i] *= value;
+                }
+                else
+                {
+                    layer->shift[i] += value;
+                }
+            }
+            free(values);
+            break;
+
+        case TFLITE_OP_MEAN:
+        {
+            const tflite_tensor_t *axes = &model->tensors[op->inputs[1]];
+            int32_t axis[2];
+
+            /* Over the height and width, in any order */
+            if ((op->num_inputs < 2u) || (TFLITE_TYPE_INT32 != axes->type) || (sizeof(axis) != axes->size))
+            {
+                return BATCH_NN_RSLT_ERR_UNSUPPORTED;
+            }
+            memcpy(axis, axes->data, sizeof(axis));
+            if ((axis[0] + axis[1] != 3) || (axis[0] * axis[1] != 2))
+            {
+                return BATCH_NN_RSLT_ERR_UNSUPPORTED;
+            }
+            layer->type = BATCH_NN_MEAN;
+            layer->out_h = 1u;
+            layer->out_w = 1u;
+            break;
+        }
+
+        case TFLITE_OP_SOFTMAX:
+            layer->type = BATCH_NN_SOFTMAX;
+            layer->beta = options->beta;
+            break;
+
+        default:
+            return BATCH_NN_RSLT_ERR_UNSUPPORTED;
+    }
+
+    if ((BATCH_NN_CONV == layer->type) || (BATCH_NN_DENSE == layer->type))
+    {
+        layer->depth = layer->filter_h * layer->filter_w * layer->in_c;
+        layer->weights = batch_nn_get_constant(model, op->inputs[1], layer->out_c * layer->depth);
+        layer->bias = batch_nn_alloc(layer->out_c + BATCH_NN_NR);
+        if ((NULL == layer->weights) || (NULL == layer->bias))
+        {
+            return BATCH_NN_RSLT_ERR_UNSUPPORTED;
+        }
+
+        memset(layer->bias, 0, (layer->out_c + BATCH_NN_NR) * sizeof(float));
+        if ((op->num_inputs > 2u) && (TFLITE_READER_NO_TENSOR != op->inputs[2]))
+        {
+            values = batch_nn_get_constant(model, op->inputs[2], layer->out_c);
+            if (NULL == values)
+            {
+                return BATCH_NN_RSLT_ERR_UNSUPPORTED;
+            }
+            memcpy(layer->bias, values, layer->out_c * sizeof(float));
+            free(values);
+        }
+
+        if (!batch_nn_pack_weights(layer))
+        {
+            return BATCH_NN_RSLT_ERR_UNSUPPORTED;
+        }
+    }
+
+    shape[0] = layer->out_h;
+    shape[1] = layer->out_w;
+    shape[2] = layer->out_c;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: batch_nn_get_shape
+********************************************************************************
+* Summary:
+*   Gets the height, width and channels of an activation of one window:
+*   1 x H x W x C, or 1 x N for 1 x 1 x N.
+*
+* Return:
+*   false for another shape.
+*******************************************************************************/
+static bool batch_nn_get_shape(const tflite_tensor_t *tensor, uint32_t *shape)
+{
+    if ((4u == tensor->num_dims) && (1 == tensor->dims[0]) && (tensor->dims[1] > 0) && (tensor->dims[2] > 0) &&
+        (tensor->dims[3] > 0))
+    {
+        shape[0] = (uint32_t)tensor->dims[1];
+        shape[1] = (uint32_t)tensor->dims[2];
+        shape[2] = (uint32_t)tensor->dims[3];
+        return true;
+    }
+
+    if ((2u == tensor->num_dims) && (1 == tensor->dims[0]) && (tensor->dims[1] > 0))
+    {
+        shape[0] = 1u;
+        shape[1] = 1u;
+        shape[2] = (uint32_t)tensor->dims[1];
+        return true;
+    }
+
+    return false;
+}
+
+/*******************************************************************************
+* Function Name: batch_nn_get_elements
+*******************************************************************************/
+static uint32_t batch_nn_get_elements(const tflite_tensor_t *tensor)
+{
+    uint32_t elements = 1u;
+
+    for (uint32_t i = 0; i < tensor->num_dims; i++)
+    {
+        elements *= (tensor->dims[i] > 0) ? (uint32_t)tensor->dims[i] : 0u;
+    }
+
+    return elements;
+}
+
+/*******************************************************************************
+* Function Name: batch_nn_get_constant
+********************************************************************************
+* Summary:
+*   Copies the values of a constant float tensor, which are not aligned in
+*   the file.
+*
+* Parameters:
+*     model: model of the tensor
+*     index: tensor
+*     count: number of values expected
+*
+* Return:
+*   The values, to free, NULL if the tensor is not a constant float tensor
+*   of count values.
+*******************************************************************************/
+static float *batch_nn_get_constant(const tflite_reader_t *model, int32_t index, uint32_t count)
+{
+    const tflite_tensor_t *tensor;
+    float *values;
+
+    if ((index < 0) || ((uint32_t)index >= model->num_tensors))
+    {
+        return NULL;
+    }
+
+    tensor = &model->tensors[index];
+    if ((TFLITE_TYPE_FLOAT32 != tensor->type) || (NULL == tensor->data) || ((count * sizeof(float)) != tensor->size))
+    {
+        return NULL;
+    }
+
+    values = batch_nn_alloc(count);
+    if (NULL != values)
+    {
+        memcpy(values, tensor->data, count * sizeof(float));
+    }
+
+    return values;
+}
+
+/*******************************************************************************
+* Function Name: batch_nn_set_window
+********************************************************************************
+* Summary:
+*   Sets the output size and the padding of a convolution or pooling, as
+*   TensorFlow Lite: SAME pads the input so that the output is the input
+*   divided by the stride rounded up, with the smaller half of the padding
+*   before, VALID does not pad.
+*
+* Return:
+*   false if the window does not fit.
+*******************************************************************************/
+static bool batch_nn_set_window(batch_nn_layer_t *layer, const tflite_options_t *options)
+{
+    if ((options->stride_h <= 0) || (options->stride_w <= 0))
+    {
+        return false;
+    }
+    layer->stride_h = (uint32_t)options->stride_h;
+    layer->stride_w = (uint32_t)options->stride_w;
+
+    if (TFLITE_PADDING_SAME == options->padding)
+    {
+        uint32_t pad_h;
+        uint32_t pad_w;
+
+        layer->out_h = (layer->in_h + layer->stride_h - 1u) / layer->stride_h;
+        layer->out_w = (layer->in_w + layer->stride_w - 1u) / layer->stride_w;
+        pad_h = (layer->out_h - 1u) * layer->stride_h + layer->filter_h;
+        pad_w = (layer->out_w - 1u) * layer->stride_w + layer->filter_w;
+        layer->pad_top = (pad_h > layer->in_h) ? ((pad_h - layer->in_h) / 2u) : 0u;
+        layer->pad_left = (pad_w > layer->in_w) ? ((pad_w - layer->in_w) / 2u) : 0u;
+    }
+    else
+    {
+        if ((layer->filter_h > layer->in_h) || (layer->filter_w > layer->in_w))
+        {
+            return false;
+        }
+        layer->out_h = (layer->in_h - layer->filter_h) / layer->stride_h + 1u;
+        layer->out_w = (layer->in_w - layer->filter_w) / layer->stride_w + 1u;
+    }
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: batch_nn_pack_weights
+********************************************************************************
+* Summary:
+*   Packs the weights in panels of NR output channels: for each depth, the NR
+*   weights of the panel are together, as the micro-kernel reads them. The
+*   last panel is padded with zeros.
+*
+*******************************************************************************/
+static bool batch_nn_pack_weights(batch_nn_layer_t *layer)
+{
+    uint32_t panels = (layer->out_c + BATCH_NN_NR - 1u) / BATCH_NN_NR;
+
+    layer->packed = batch_nn_alloc(panels * layer->depth * BATCH_NN_NR);
+    if (NULL == layer->packed)
+    {
+        return false;
+    }
+
+    for (uint32_t panel = 0; panel < panels; panel++)
+    {
+        float *packed = &layer->packed[panel * layer->depth * BATCH_NN_NR];
+
+        for (uint32_t k = 0; k < layer->depth; k++)
+        {
+            for (uint32_t j = 0; j < BATCH_NN_NR; j++)
+            {
+                uint32_t channel = panel * BATCH_NN_NR + j;
+                packed[k * BATCH_NN_NR + j] = (channel < layer->out_c) ? layer->weights[channel * layer->depth + k] :
+                                              0.0f;
+            }
+        }
+    }
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: batch_nn_alloc
+********************************************************************************
+* Summary:
+*   Allocates floats on a cache line, as the micro-kernel loads the packed
+*   weights as vectors.
+*
+*******************************************************************************/
+static float *batch_nn_alloc(uint32_t count)
+{
+    size_t size = ((size_t)count * sizeof(float) + BATCH_NN_ALIGNMENT - 1u) & ~((size_t)BATCH_NN_ALIGNMENT - 1u);
+
+    return aligned_alloc(BATCH_NN_ALIGNMENT, (0u == size) ? BATCH_NN_ALIGNMENT : size);
+}
+
+/*******************************************************************************
+* Function Name: batch_nn_run_layer
+********************************************************************************
+* Summary:
+*   Runs a layer on the windows of a chunk.
+*
+*******************************************************************************/
+static void batch_nn_run_layer(batch_nn_t *nn, const batch_nn_layer_t *layer, const float *input, uint32_t count,
+                               float *output)
+{
+    switch (layer->type)
+    {
+        case BATCH_NN_CONV:
+        case BATCH_NN_DENSE:
+            batch_nn_gemm(nn, layer, input, count * layer->out_h * layer->out_w, output);
+            break;
+
+        case BATCH_NN_MAX_POOL:
+        case BATCH_NN_AVERAGE_POOL:
+            batch_nn_pool(layer, input, count, output);
+            break;
+
+        case BATCH_NN_AFFINE:
+            batch_nn_affine(layer, input, count, output);
+            break;
+
+        case BATCH_NN_MEAN:
+            batch_nn_mean(layer, input, count, output);
+            break;
+
+        case BATCH_NN_SOFTMAX:
+            batch_nn_softmax(layer, input, count, output);
+            break;
+    }
+}
+
+/*******************************************************************************
+* Function Name: batch_nn_gemm
+********************************************************************************
+* Summary:
+*   Multiplies the im2col matrix of the input, rows x depth, by the weights,
+*   depth x out_c, into the output of the layer, rows x out_c, which is the
+*   NHWC output of the windows. There are a few tens of output channels at
+*   most, so all the panels of the weights are used for each block of rows.
+*
+* Parameters:
+*     nn: engine
+*     layer: convolution or dense layer
+*     input: input of the windows
+*     rows: output positions of all the windows
+*     output: output of the windows
+*
+*******************************************************************************/
+static void batch_nn_gemm(batch_nn_t *nn, const batch_nn_layer_t *layer, const float *input, uint32_t rows,
+                          float *output)
+{
+    for (uint32_t offset = 0; offset < layer->depth; offset += BATCH_NN_KC)
+    {
+        uint32_t depth = ((layer->depth - offset) < BATCH_NN_KC) ? (layer->depth - offset) : BATCH_NN_KC;
+        bool first = (0u == offset);
+        bool last = (offset + depth == layer->depth);
+
+        for (uint32_t block = 0; block < rows; block += BATCH_NN_MC)
+        {
+            uint32_t block_rows = ((rows - block) < BATCH_NN_MC) ? (rows - block) : BATCH_NN_MC;
+
+            batch_nn_pack_rows(nn, layer, input, block, block_rows, offset, depth);
+
+            for (uint32_t column = 0; column < layer->out_c; column += BATCH_NN_NR)
+            {
+                const float *panel = &layer->packed[column * layer->depth + offset * BATCH_NN_NR];
+                uint32_t columns = ((layer->out_c - column) < BATCH_NN_NR) ? (layer->out_c - column) : BATCH_NN_NR;
+
+                for (uint32_t row = 0; row < block_rows; row += BATCH_NN_MR)
+                {
+                    batch_nn_kernel(depth, &nn->block[row * depth], panel,
+                                    &output[(size_t)(block + row) * layer->out_c + column], layer->out_c,
+                                    ((block_rows - row) < BATCH_NN_MR) ? (block_rows - row) : BATCH_NN_MR, columns,
+                                    first ? &layer->bias[column] : NULL,
+                                    last ? layer->activation : TFLITE_ACTIVATION_NONE);
+                }
+            }
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: batch_nn_pack_rows
+********************************************************************************
+* Summary:
+*   Gathers a block of rows of the im2col matrix, packed in panels of MR
+*   rows: for each depth, the MR values of the panel are together, as the
+*   micro-kernel reads them. The last panel is padded with zeros.
+*
+* Parameters:
+*     nn: engine
+*     layer: convolution or dense layer
+*     input: input of the windows
+*     first: first row of the block
+*     rows: rows of the block
+*     offset: first depth of the block
+*     depth: depths of the block
+*
+*******************************************************************************/
+static void batch_nn_pack_rows(batch_nn_t *nn, const batch_nn_layer_t *layer, const float *input, uint32_t first,
+                               uint32_t rows, uint32_t offset, uint32_t depth)
+{
+    uint32_t padded = (rows + BATCH_NN_MR - 1u) / BATCH_NN_MR * BATCH_NN_MR;
+
+    for (uint32_t row = 0; row < padded; row++)
+    {
+        float *packed = &nn->block[(row / BATCH_NN_MR) * BATCH_NN_MR * depth + row % BATCH_NN_MR];
+
+        if (row < rows)
+        {
+            batch_nn_im2col(layer, input, first + row, offset, depth, packed);
+        }
+        else
+        {
+            for (uint32_t k = 0; k < depth; k++)
+            {
+                packed[k * BATCH_NN_MR] = 0.0f;
+            }
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: batch_nn_im2col
+********************************************************************************
+* Summary:
+*   Gathers depths of a row of the im2col matrix into a packed panel: the
+*   input under the filter at an output position, in the order of the
+*   weights, with zeros in the padding. The row of a dense layer is its
+*   input.
+*
+* Parameters:
+*     layer: convolution or dense layer
+*     input: input of the windows
+*     row: output position in all the windows
+*     offset: first depth
+*     depth: depths to gather
+*     packed: first value of the row in the panel, the next depths are MR
+*             values apart
+*
+*******************************************************************************/
+static void batch_nn_im2col(const batch_nn_layer_t *layer, const float *input, uint32_t row, uint32_t offset,
+                            uint32_t depth, float *packed)
+{
+    uint32_t positions = layer->out_h * layer->out_w;
+    const float *window = &input[(size_t)(row / positions) * layer->in_h * layer->in_w * layer->in_c];
+    uint32_t out_y = (row % positions) / layer->out_w;
+    uint32_t out_x = (row % positions) % layer->out_w;
+    uint32_t k = 0;
+
+    if (BATCH_NN_DENSE == layer->type)
+    {
+        const float *values = &input[(size_t)row * layer->depth + offset];
+
+        for (k = 0; k < depth; k++)
+        {
+            packed[k * BATCH_NN_MR] = values[k];
+        }
+        return;
+    }
+
+    for (uint32_t filter_y = 0; filter_y < layer->filter_h; filter_y++)
+    {
+        /* Below zero wraps around, above the input */
+        uint32_t in_y = out_y * layer->stride_h + filter_y - layer->pad_top;
+
+        for (uint32_t filter_x = 0; filter_x < layer->filter_w; filter_x++)
+        {
+            uint32_t in_x = out_x * layer->stride_w + filter_x - layer->pad_left;
+            bool inside = (in_y < layer->in_h) && (in_x < layer->in_w);
+            const float *tap = &window[(in_y * layer->in_w + in_x) * layer->in_c];
+
+            /* Only the depths of the block, below offset wraps around */
+            for (uint32_t channel = 0; channel < layer->in_c; channel++, k++)
+            {
+                uint32_t index = k - offset;
+
+                if (index < depth)
+                {
+                    packed[index * BATCH_NN_MR] = inside ? tap[channel] : 0.0f;
+                }
+            }
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: batch_nn_kernel
+********************************************************************************
+* Summary:
+*   Multiplies a packed panel of MR rows by a packed panel of NR output
+*   channels, and adds the MR x NR product to the output. The product is
+*   accumulated in MR vectors; each depth is one vector of weights,
+*   multiplied by each of the MR values of the rows.
+*
+* Parameters:
+*     depth: depths of the panels
+*     a: panel of rows, depth x MR
+*     b: panel of weights, depth x NR
+*     c: output of the first row and channel
+*     stride: values between two rows of the output
+*     rows: rows to write, MR except at the end
+*     columns: channels to write, NR except at the end
+*     bias: the bias of the channels for the first depths, which set the
+*           output, NULL for the next ones, which add to it
+*     activation: fused activation for the last depths
+*
+*******************************************************************************/
+static void batch_nn_kernel(uint32_t depth, const float *a, const float *b, float *c, uint32_t stride,
+                            uint32_t rows, uint32_t columns, const float *bias, uint8_t activation)
+{
+    batch_nn_vector_t sum[BATCH_NN_MR];
+    float block[BATCH_NN_MR][BATCH_NN_NR] __attribute__((aligned(sizeof(batch_nn_vector_t))));
+
+    for (uint32_t r = 0; r < BATCH_NN_MR; r++)
+    {
+        sum[r] = (batch_nn_vector_t){ 0.0f };
+    }
+
+    for (uint32_t k = 0; k < depth; k++)
+    {
+        batch_nn_vector_t weights = *(const batch_nn_vector_t *)&b[k * BATCH_NN_NR];
+
+        for (uint32_t r = 0; r < BATCH_NN_MR; r++)
+        {
+            sum[r] += a[k * BATCH_NN_MR + r] * weights;
+        }
+    }
+
+    memcpy(block, sum, sizeof(block));
+
+    for (uint32_t r = 0; r < rows; r++)
+    {
+        float *output = &c[(size_t)r * stride];
+
+        for (uint32_t j = 0; j < columns; j++)
+        {
+            float value = block[r][j] + ((NULL == bias) ? output[j] : bias[j]);
+            output[j] = batch_nn_activate(value, activation);
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: batch_nn_direct
+********************************************************************************
+* Summary:
+*   Runs a convolution or dense layer on one window, with the loops of the
+*   TensorFlow Lite reference kernels.
+*
+*******************************************************************************/
+static void batch_nn_direct(const batch_nn_layer_t *layer, const float *input, float *output)
+{
+    for (uint32_t out_y = 0; out_y < layer->out_h; out_y++)
+    {
+        for (uint32_t out_x = 0; out_x < layer->out_w; out_x++)
+        {
+            for (uint32_t channel = 0; channel < layer->out_c; channel++)
+            {
+                const float *weights = &layer->weights[channel * layer->depth];
+                float total = 0.0f;
+
+                for (uint32_t filter_y = 0; filter_y < layer->filter_h; filter_y++)
+                {
+                    for (uint32_t filter_x = 0; filter_x < layer->filter_w; filter_x++)
+                    {
+                        uint32_t in_y = out_y * layer->stride_h + filter_y - layer->pad_top;
+                        uint32_t in_x = out_x * layer->stride_w + filter_x - layer->pad_left;
+
+                        if ((in_y >= layer->in_h) || (in_x >= layer->in_w))
+                        {
+                            continue;
+                        }
+
+                        for (uint32_t in_c = 0; in_c < layer->in_c; in_c++)
+                        {
+                            total += input[(in_y * layer->in_w + in_x) * layer->in_c + in_c] *
+                                     weights[(filter_y * layer->filter_w + filter_x) * layer->in_c + in_c];
+                        }
+                    }
+                }
+
+                output[(out_y * layer->out_w + out_x) * layer->out_c + channel] =
+                    batch_nn_activate(total + layer->bias[channel], layer->activation);
+            }
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: batch_nn_pool
+********************************************************************************
+* Summary:
+*   Runs a max or average pooling, on all the channels of a tap at once. Only
+*   the input under the window counts, as in TensorFlow Lite.
+*
+*******************************************************************************/
+static void batch_nn_pool(const batch_nn_layer_t *layer, const float *input, uint32_t count, float *output)
+{
+    bool average = (BATCH_NN_AVERAGE_POOL == layer->type);
+    uint32_t channels = layer->in_c;
+
+    for (uint32_t window = 0; window < count; window++)
+    {
+        const float *in = &input[(size_t)window * layer->in_h * layer->in_w * channels];
+        float *out = &output[(size_t)window * layer->out_h * layer->out_w * channels];
+
+        for (uint32_t out_y = 0; out_y < layer->out_h; out_y++)
+        {
+            for (uint32_t out_x = 0; out_x < layer->out_w; out_x++)
+            {
+                uint32_t taps = 0;
+
+                for (uint32_t channel = 0; channel < channels; channel++)
+                {
+                    out[channel] = average ? 0.0f : -INFINITY;
+                }
+
+                for (uint32_t filter_y = 0; filter_y < layer->filter_h; filter_y++)
+                {
+                    for (uint32_t filter_x = 0; filter_x < layer->filter_w; filter_x++)
+                    {
+                        uint32_t in_y = out_y * layer->stride_h + filter_y - layer->pad_top;
+                        uint32_t in_x = out_x * layer->stride_w + filter_x - layer->pad_left;
+                        const float *tap = &in[(in_y * layer->in_w + in_x) * channels];
+
+                        if ((in_y >= layer->in_h) || (in_x >= layer->in_w))
+                        {
+                            continue;
+                        }
+
+                        if (average)
+                        {
+                            for (uint32_t channel = 0; channel < channels; channel++)
+                            {
+                                out[channel] += tap[channel];
+                            }
+                        }
+                        else
+                        {
+                            for (uint32_t channel = 0; channel < channels; channel++)
+                            {
+                                out[channel] = (out[channel] < tap[channel]) ? tap[channel] : out[channel];
+                            }
+                        }
+                        taps++;
+                    }
+                }
+
+                for (uint32_t channel = 0; channel < channels; channel++)
+                {
+                    float value = (average && (0u != taps)) ? (out[channel] / (float)taps) : out[channel];
+                    out[channel] = batch_nn_activate(value, layer->activation);
+                }
+                out += channels;
+            }
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: batch_nn_affine
+*******************************************************************************/
+static void batch_nn_affine(const batch_nn_layer_t *layer, const float *input, uint32_t count, float *output)
+{
+    size_t positions = (size_t)count * layer->in_h * layer->in_w;
+
+    for (size_t position = 0; position < positions; position++)
+    {
+        const float *in = &input[position * layer->in_c];
+        float *out = &output[position * layer->in_c];
+
+        for (uint32_t channel = 0; channel < layer->in_c; channel++)
+        {
+            out[channel] = batch_nn_activate(in[channel] * layer->scale[channel] + layer->shift[channel],
+                                             layer->activation);
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: batch_nn_mean
+*******************************************************************************/
+static void batch_nn_mean(const batch_nn_layer_t *layer, const float *input, uint32_t count, float *output)
+{
+    uint32_t positions = layer->in_h * layer->in_w;
+
+    for (uint32_t window = 0; window < count; window++)
+    {
+        const float *in = &input[(size_t)window * positions * layer->in_c];
+        float *out = &output[(size_t)window * layer->out_c];
+
+        for (uint32_t channel = 0; channel < layer->in_c; channel++)
+        {
+            float sum = 0.0f;
+
+            for (uint32_t position = 0; position < positions; position++)
+            {
+                sum += in[position * layer->in_c + channel];
+            }
+            out[channel] = sum / (float)positions;
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: batch_nn_softmax
+*******************************************************************************/
+static void batch_nn_softmax(const batch_nn_layer_t *layer, const float *input, uint32_t count, float *output)
+{
+    size_t positions = (size_t)count * layer->in_h * layer->in_w;
+
+    for (size_t position = 0; position < positions; position++)
+    {
+        const float *in = &input[position * layer->in_c];
+        float *out = &output[position * layer->in_c];
+        float max = in[0];
+        float sum = 0.0f;
+
+        for (uint32_t i = 1; i < layer->in_c; i++)
+        {
+            max = fmaxf(max, in[i]);
+        }
+        for (uint32_t i = 0; i < layer->in_c; i++)
+        {
+            out[i] = expf((in[i] - max) * layer->beta);
+            sum += out[i];
+        }
+        for (uint32_t i = 0; i < layer->in_c; i++)
+        {
+            out[i] /= sum;
+        }
+    }
+}
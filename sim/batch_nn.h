@@ -0,0 +1,133 @@
+/******************************************************************************
+* File Name:   batch_nn.h
+*
+* Description: This file contains the function prototypes and constants used
+*   in batch_nn.c.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2021-2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef BATCH_NN_H
+#define BATCH_NN_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "cy_result.h"
+#include "tflite_reader.h"
+
+/******************************************************************************
+ * Constants
+ *****************************************************************************/
+#define BATCH_NN_MAX_LAYERS         16u
+
+/* Register block of the GEMM: MR rows of the im2col matrix by NR output
+ * channels, accumulated in MR vectors of NR floats */
+#define BATCH_NN_MR                 6u
+#define BATCH_NN_NR                 8u
+
+/* Cache blocks of the GEMM: a packed MC x KC block of the im2col matrix stays
+ * in the L2 cache, a packed KC x NR panel of the weights in the L1 cache */
+#define BATCH_NN_MC                 120u
+#define BATCH_NN_KC                 256u
+
+/* Windows run through the layers together, so that their activations stay
+ * in the cache */
+#define BATCH_NN_DEFAULT_CHUNK      16u
+
+#define BATCH_NN_RSLT_ERR_UNSUPPORTED CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_MIDDLEWARE_BASE, 0x2Fu)
+#define BATCH_NN_RSLT_NO_MEMORY     CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_MIDDLEWARE_BASE, 0x30u)
+
+/******************************************************************************
+ * Typedefs
+ *****************************************************************************/
+typedef enum
+{
+    BATCH_NN_CONV,
+    BATCH_NN_DENSE,
+    BATCH_NN_MAX_POOL,
+    BATCH_NN_AVERAGE_POOL,
+    BATCH_NN_AFFINE,            /* MUL and ADD by constants of each channel */
+    BATCH_NN_MEAN,              /* Over the height and width */
+    BATCH_NN_SOFTMAX,
+} batch_nn_type_t;
+
+/* Shapes are of one window, in NHWC order; a dense layer is 1 x 1 x units */
+typedef struct
+{
+    batch_nn_type_t type;
+    uint8_t activation;
+    uint32_t in_h;
+    uint32_t in_w;
+    uint32_t in_c;
+    uint32_t out_h;
+    uint32_t out_w;
+    uint32_t out_c;
+    uint32_t filter_h;
+    uint32_t filter_w;
+    uint32_t stride_h;
+    uint32_t stride_w;
+    uint32_t pad_top;
+    uint32_t pad_left;
+    uint32_t depth;             /* filter_h x filter_w x in_c, K of the GEMM */
+    float *weights;             /* out_c x depth, as in the model */
+    float *bias;                /* Padded to NR, zeros if the model has none */
+    float *packed;              /* Weights in panels of depth x NR */
+    float *scale;
+    float *shift;
+    float beta;
+} batch_nn_layer_t;
+
+typedef struct
+{
+    uint32_t num_layers;
+    batch_nn_layer_t layers[BATCH_NN_MAX_LAYERS];
+    uint32_t input_size;        /* Values of a window */
+    uint32_t output_size;
+    uint32_t max_size;          /* Largest activation of a window */
+    uint32_t chunk;
+    float *buffers[2];          /* Activations of a chunk, in turn */
+    float *block;               /* Packed MC x KC block of the im2col matrix */
+} batch_nn_t;
+
+/*******************************************************************************
+* Functions
+*******************************************************************************/
+cy_rslt_t batch_nn_init(batch_nn_t *nn, const tflite_reader_t *model, uint32_t chunk);
+void batch_nn_run(batch_nn_t *nn, const float *input, uint32_t count, float *output);
+void batch_nn_run_reference(batch_nn_t *nn, const float *input, float *output);
+void batch_nn_deinit(batch_nn_t *nn);
+
+#endif /* BATCH_NN_H */
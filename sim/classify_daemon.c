@@ -0,0 +1,1114 @@
+/******************************************************************************
+* File Name:   classify_daemon.c
+*
+* Description: This file contains a Linux daemon that classifies many IMU
+*              streams at the same time, with the pre-processing, sparse model
+*              and decision of the application. Each input is a file, a FIFO,
+*              or a connection on a local socket, carrying the frames of
+*              source/stream.c: the STREAM_TYPE_RAW and STREAM_TYPE_DELTA
+*              windows sent by the kit, for example a capture of its debug
+*              UART.
+*
+*              The main thread reads the inputs into the chunks of each
+*              stream. A stream with chunks is queued on a work-stealing pool
+*              (work_pool.c), and the worker that runs it parses its frames
+*              and classifies its windows in order, so the filters of the
+*              stream carry their state from one window to the next. Each
+*              worker has its own model buffer, so the workers only share the
+*              deques of the pool.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2021-2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "processing.h"
+#include "sparse_nn.h"
+#include "control.h"
+#include "sensor.h"
+#include "stream.h"
+#include "imu_codec.h"
+#include "latency.h"
+#include "instrument.h"
+#include "work_pool.h"
+
+#include "cyabs_rtos.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+
+/*******************************************************************************
+* Constants
+*******************************************************************************/
+#define DAEMON_MAX_STREAMS      256u
+#define DAEMON_NAME_SIZE        64u
+
+/* Each stream reads ahead up to DAEMON_CHUNKS chunks, and a worker parses
+ * up to DAEMON_BATCH_CHUNKS of them before it lets the other streams run */
+#define DAEMON_CHUNK_SIZE       16384u
+#define DAEMON_CHUNKS           4u
+#define DAEMON_BATCH_CHUNKS     2u
+
+#define DAEMON_FRAME_SIZE       (STREAM_HEADER_SIZE + STREAM_MAX_PAYLOAD + STREAM_CRC_SIZE)
+#define DAEMON_WINDOW_VALUES    (SENSOR_BATCH_SIZE * SENSOR_NUM_AXIS)
+#define DAEMON_MAX_CLASSES      16u
+#define DAEMON_LISTEN_BACKLOG   16
+
+/* A larger jump of the sequence number is a restart of the sender, for
+ * example a new writer on a FIFO, not lost frames */
+#define DAEMON_MAX_LOST_FRAMES  0x8000u
+
+/*******************************************************************************
+* Typedefs
+*******************************************************************************/
+typedef enum
+{
+    DAEMON_INPUT_FILE,          /* Ends at the end of the file */
+    DAEMON_INPUT_FIFO,          /* Stays open for the next writer */
+    DAEMON_INPUT_SOCKET         /* Ends when the client disconnects */
+} daemon_input_t;
+
+typedef struct
+{
+    uint8_t data[DAEMON_CHUNK_SIZE];
+    uint32_t size;
+    latency_time_t time;        /* LATENCY_NOW() when read */
+} daemon_chunk_t;
+
+typedef struct
+{
+    char name[DAEMON_NAME_SIZE];
+    daemon_input_t input;
+    int fd;                     /* -1 once the input ended, main thread only */
+    bool counted;               /* Counted as finished, main thread only */
+
+    /* Chunks read by the main thread, oldest at head, and the state of the
+     * stream in the pool */
+    pthread_mutex_t lock;
+    daemon_chunk_t chunks[DAEMON_CHUNKS];
+    uint32_t head;
+    uint32_t count;
+    bool scheduled;             /* Queued in the pool or run by a worker */
+    bool eof;                   /* No more chunks will be read */
+    bool finished;              /* eof, and every chunk parsed */
+
+    /* Parser and filters, used by one worker at a time */
+    uint8_t frame[DAEMON_FRAME_SIZE];
+    uint32_t frame_size;        /* Bytes of the current frame received */
+    bool has_sequence;
+    uint16_t sequence;          /* Of the last valid frame */
+    bool processing_started;
+    processing_stream_t processing;
+
+    /* Counters, read once the stream is finished */
+    uint32_t windows;
+    uint32_t detections;        /* Windows above their class threshold */
+    uint32_t bad_frames;        /* CRC errors and invalid windows */
+    uint32_t lost_frames;       /* Gaps in the sequence numbers */
+    uint32_t other_frames;      /* Frames that are not windows, ignored */
+    latency_histogram_t latency;
+} daemon_stream_t;
+
+/* Buffers of a worker, aligned on a cache line as work_pool_worker_t */
+typedef struct
+{
+    float *buffer;              /* Activations of the model */
+    int16_t samples[DAEMON_WINDOW_VALUES];
+    float window[DAEMON_WINDOW_VALUES];
+    float probabilities[DAEMON_MAX_CLASSES];
+    atomic_uint_fast64_t windows;
+} __attribute__((aligned(WORK_POOL_CACHE_LINE))) daemon_worker_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Generated with train/sparse_export.py */
+extern const sparse_nn_model_t SPARSE_NN_MODEL(MODEL_NAME);
+
+static daemon_stream_t *daemon_streams[DAEMON_MAX_STREAMS];
+static uint32_t daemon_num_streams;
+static uint32_t daemon_active_streams;
+static uint32_t daemon_connections;
+
+static work_pool_t daemon_pool;
+static daemon_worker_t daemon_workers[WORK_POOL_MAX_WORKERS];
+
+/* Written by the workers to wake the main thread */
+static int daemon_wake_fd = -1;
+
+/* Options */
+static bool daemon_restart_filter;
+static bool daemon_quiet;
+
+static volatile sig_atomic_t daemon_stop;
+
+/*******************************************************************************
+* Local Functions
+*******************************************************************************/
+static bool daemon_open_input(const char *path);
+static int daemon_listen(const char *path);
+static daemon_stream_t *daemon_add_stream(int fd, daemon_input_t input, const char *name);
+static void daemon_loop(int listener, uint32_t interval_s);
+static void daemon_read(daemon_stream_t *stream);
+static void daemon_end_input(daemon_stream_t *stream);
+static void daemon_run_stream(void *item, uint32_t worker);
+static void daemon_parse(daemon_stream_t *stream, daemon_worker_t *worker, const daemon_chunk_t *chunk);
+static void daemon_handle_frame(daemon_stream_t *stream, daemon_worker_t *worker, latency_time_t time);
+static void daemon_classify(daemon_stream_t *stream, daemon_worker_t *worker, uint8_t flags, bool lost,
+                            latency_time_t time);
+static void daemon_wake(void);
+static uint64_t daemon_get_windows(void);
+static double daemon_seconds(void);
+static void daemon_report(double elapsed);
+static void daemon_signal(int signal_number);
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*   Runs the daemon. Usage:
+*   classify_daemon [-t threads] [-l socket] [-i seconds] [-w] [-q] [input...]
+*   It prints a line per window on the standard output, and the throughput
+*   and latency of each stream on the standard error when all the inputs end,
+*   or on SIGINT or SIGTERM.
+*
+* Return:
+*   0 on success, 1 if an input cannot be opened.
+*******************************************************************************/
+int main(int argc, char **argv)
+{
+    const char *socket_path = NULL;
+    uint32_t num_workers = (uint32_t)sysconf(_SC_NPROCESSORS_ONLN);
+    uint32_t interval_s = 0;
+    uint32_t buffer_size = sparse_nn_get_buffer_size(&SPARSE_NN_MODEL(MODEL_NAME));
+    struct sigaction action;
+    int listener = -1;
+    double start;
+    int option;
+
+    while (-1 != (option = getopt(argc, argv, "t:l:i:wq")))
+    {
+        switch (option)
+        {
+            case 't':
+                num_workers = (uint32_t)strtoul(optarg, NULL, 10);
+                break;
+            case 'l':
+                socket_path = optarg;
+                break;
+            case 'i':
+                interval_s = (uint32_t)strtoul(optarg, NULL, 10);
+                break;
+            case 'w':
+                daemon_restart_filter = true;
+                break;
+            case 'q':
+                daemon_quiet = true;
+                break;
+            default:
+                fprintf(stderr, "Usage: %s [-t threads] [-l socket] [-i seconds] [-w] [-q] [input...]\n", argv[0]);
+                return 1;
+        }
+    }
+    if ((0 == num_workers) || (num_workers > WORK_POOL_MAX_WORKERS))
+    {
+        num_workers = (0 == num_workers) ? 1u : WORK_POOL_MAX_WORKERS;
+    }
+    if ((optind == argc) && (NULL == socket_path))
+    {
+        fprintf(stderr, "No input, pass files or FIFOs, or -l socket\n");
+        return 1;
+    }
+
+    instrument_init();
+
+    daemon_wake_fd = eventfd(0, EFD_NONBLOCK);
+    for (int i = optind; i < argc; i++)
+    {
+        if (!daemon_open_input(argv[i]))
+        {
+            return 1;
+        }
+    }
+    if (NULL != socket_path)
+    {
+        listener = daemon_listen(socket_path);
+        if (listener < 0)
+        {
+            return 1;
+        }
+    }
+
+    for (uint32_t i = 0; i < num_workers; i++)
+    {
+        daemon_workers[i].buffer = malloc(buffer_size * sizeof(float));
+        if (NULL == daemon_workers[i].buffer)
+        {
+            fprintf(stderr, "Cannot allocate the model buffers\n");
+            return 1;
+        }
+        atomic_init(&daemon_workers[i].windows, 0);
+    }
+
+    /* A stream is queued at most once */
+    if (CY_RSLT_SUCCESS != work_pool_init(&daemon_pool, num_workers, DAEMON_MAX_STREAMS, daemon_run_stream))
+    {
+        fprintf(stderr, "Cannot start the workers\n");
+        return 1;
+    }
+
+    /* Interrupt poll() on SIGINT and SIGTERM, to stop after the queued windows */
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = daemon_signal;
+    sigaction(SIGINT, &action, NULL);
+    sigaction(SIGTERM, &action, NULL);
+
+    start = daemon_seconds();
+    daemon_loop(listener, interval_s);
+    daemon_report(daemon_seconds() - start);
+
+    work_pool_deinit(&daemon_pool);
+    if (NULL != socket_path)
+    {
+        unlink(socket_path);
+    }
+
+    return 0;
+}
+
+/*******************************************************************************
+* Function Name: output_printf
+********************************************************************************
+* Summary:
+*   Prints the errors of the pre-processing.
+*
+*******************************************************************************/
+uint32_t output_printf(const char *format, ...)
+{
+    va_list args;
+    int length;
+
+    va_start(args, format);
+    length = vfprintf(stderr, format, args);
+    va_end(args);
+
+    return (length < 0) ? 0u : (uint32_t)length;
+}
+
+/*******************************************************************************
+* Function Name: output_write
+********************************************************************************
+* Summary:
+*   The decisions are printed by the daemon, control() is not called, and
+*   the daemon only receives frames, stream_send() is not called.
+*
+*******************************************************************************/
+uint32_t output_write(const char *data, uint32_t size)
+{
+    (void)data;
+    (void)size;
+
+    return 0;
+}
+
+/*******************************************************************************
+* Function Name: cy_rtos_init_mutex
+********************************************************************************
+* Summary:
+*   The lock of stream_send(), which is not called.
+*
+*******************************************************************************/
+cy_rslt_t cy_rtos_init_mutex(cy_mutex_t *mutex)
+{
+    (void)mutex;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: cy_rtos_get_mutex
+*******************************************************************************/
+cy_rslt_t cy_rtos_get_mutex(cy_mutex_t *mutex, uint32_t timeout)
+{
+    (void)mutex;
+    (void)timeout;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: cy_rtos_set_mutex
+*******************************************************************************/
+cy_rslt_t cy_rtos_set_mutex(cy_mutex_t *mutex)
+{
+    (void)mutex;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: daemon_open_input
+********************************************************************************
+* Summary:
+*   Opens a file or a FIFO as a stream. A FIFO is opened for writing too, so
+*   it does not end when its writer closes it, and the next writer continues
+*   the stream.
+*
+* Parameters:
+*   path: File or FIFO
+*
+* Return:
+*   True if the input is open.
+*******************************************************************************/
+static bool daemon_open_input(const char *path)
+{
+    struct stat status;
+    daemon_input_t input = DAEMON_INPUT_FILE;
+    size_t length = strlen(path);
+    int fd;
+
+    if ((0 == stat(path, &status)) && S_ISFIFO(status.st_mode))
+    {
+        input = DAEMON_INPUT_FIFO;
+        fd = open(path, O_RDWR | O_NONBLOCK);
+    }
+    else
+    {
+        fd = open(path, O_RDONLY);
+    }
+    if (fd < 0)
+    {
+        fprintf(stderr, "Cannot open %s: %s\n", path, strerror(errno));
+        return false;
+    }
+
+    /* The end of the path tells the recordings apart */
+    if (length >= DAEMON_NAME_SIZE)
+    {
+        path += length - (DAEMON_NAME_SIZE - 1u);
+    }
+
+    return (NULL != daemon_add_stream(fd, input, path));
+}
+
+/*******************************************************************************
+* Function Name: daemon_listen
+********************************************************************************
+* Summary:
+*   Creates the local socket. Each connection is a new stream.
+*
+* Parameters:
+*   path: Path of the socket, replaced if it exists
+*
+* Return:
+*   The listening socket, or -1 on error.
+*******************************************************************************/
+static int daemon_listen(const char *path)
+{
+    struct sockaddr_un address;
+    int listener;
+
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if (strlen(path) >= sizeof(address.sun_path))
+    {
+        fprintf(stderr, "Socket path too long: %s\n", path);
+        return -1;
+    }
+    strcpy(address.sun_path, path);
+
+    listener = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0);
+    unlink(path);
+    if ((listener < 0) ||
+        (0 != bind(listener, (const struct sockaddr *)&address, sizeof(address))) ||
+        (0 != listen(listener, DAEMON_LISTEN_BACKLOG)))
+    {
+        fprintf(stderr, "Cannot listen on %s: %s\n", path, strerror(errno));
+        if (listener >= 0)
+        {
+            close(listener);
+        }
+        return -1;
+    }
+
+    return listener;
+}
+
+/*******************************************************************************
+* Function Name: daemon_add_stream
+********************************************************************************
+* Summary:
+*   Allocates the state of a new stream.
+*
+* Parameters:
+*   fd: Input of the stream
+*   input: Kind of input
+*   name: Name printed with the decisions and in the report
+*
+* Return:
+*   The stream, or NULL if there are too many streams. The input is closed
+*   on error.
+*******************************************************************************/
+static daemon_stream_t *daemon_add_stream(int fd, daemon_input_t input, const char *name)
+{
+    daemon_stream_t *stream = NULL;
+
+    if (daemon_num_streams < DAEMON_MAX_STREAMS)
+    {
+        stream = calloc(1, sizeof(daemon_stream_t));
+    }
+    if (NULL == stream)
+    {
+        fprintf(stderr, "Too many streams, %s is ignored\n", name);
+        close(fd);
+        return NULL;
+    }
+
+    snprintf(stream->name, sizeof(stream->name), "%s", name);
+    stream->input = input;
+    stream->fd = fd;
+    pthread_mutex_init(&stream->lock, NULL);
+
+    daemon_streams[daemon_num_streams++] = stream;
+    daemon_active_streams++;
+
+    return stream;
+}
+
+/*******************************************************************************
+* Function Name: daemon_loop
+********************************************************************************
+* Summary:
+*   Reads the inputs until they all end, or until SIGINT or SIGTERM. Only the
+*   streams with a free chunk are polled, so a stream read faster than it is
+*   classified waits for its worker. The workers wake the loop when they free
+*   a chunk of a full stream, or finish a stream.
+*
+* Parameters:
+*   listener: Local socket, or -1
+*   interval_s: Seconds between two throughput reports, 0 for none
+*
+*******************************************************************************/
+static void daemon_loop(int listener, uint32_t interval_s)
+{
+    static struct pollfd fds[DAEMON_MAX_STREAMS + 2u];
+    static daemon_stream_t *polled[DAEMON_MAX_STREAMS + 2u];
+    double next_report = daemon_seconds() + interval_s;
+    uint64_t reported_windows = 0;
+
+    for (;;)
+    {
+        nfds_t count = 0;
+        int timeout = -1;
+
+        if (daemon_stop)
+        {
+            /* Classify what was read, then stop */
+            if (listener >= 0)
+            {
+                close(listener);
+                listener = -1;
+            }
+            for (uint32_t i = 0; i < daemon_num_streams; i++)
+            {
+                if (daemon_streams[i]->fd >= 0)
+                {
+                    daemon_end_input(daemon_streams[i]);
+                }
+            }
+        }
+
+        for (uint32_t i = 0; i < daemon_num_streams; i++)
+        {
+            daemon_stream_t *stream = daemon_streams[i];
+            bool finished;
+
+            if (stream->counted)
+            {
+                continue;
+            }
+            pthread_mutex_lock(&stream->lock);
+            finished = stream->finished;
+            pthread_mutex_unlock(&stream->lock);
+            if (finished)
+            {
+                stream->counted = true;
+                daemon_active_streams--;
+            }
+        }
+        if ((0 == daemon_active_streams) && (listener < 0))
+        {
+            break;
+        }
+
+        fds[count].fd = daemon_wake_fd;
+        fds[count].events = POLLIN;
+        polled[count++] = NULL;
+        if (listener >= 0)
+        {
+            fds[count].fd = listener;
+            fds[count].events = POLLIN;
+            polled[count++] = NULL;
+        }
+        for (uint32_t i = 0; i < daemon_num_streams; i++)
+        {
+            daemon_stream_t *stream = daemon_streams[i];
+            bool room;
+
+            if (stream->fd < 0)
+            {
+                continue;
+            }
+            pthread_mutex_lock(&stream->lock);
+            room = (stream->count < DAEMON_CHUNKS);
+            pthread_mutex_unlock(&stream->lock);
+            if (room)
+            {
+                fds[count].fd = stream->fd;
+                fds[count].events = POLLIN;
+                polled[count++] = stream;
+            }
+        }
+
+        if (interval_s > 0)
+        {
+            double remaining = next_report - daemon_seconds();
+            timeout = (remaining > 0.0) ? (int)(remaining * 1000.0) + 1 : 0;
+        }
+
+        if (poll(fds, count, timeout) < 0)
+        {
+            if (EINTR != errno)
+            {
+                fprintf(stderr, "poll: %s\n", strerror(errno));
+                daemon_stop = 1;
+            }
+            continue;
+        }
+
+        if ((interval_s > 0) && (daemon_seconds() >= next_report))
+        {
+            uint64_t windows = daemon_get_windows();
+
+            fprintf(stderr, "%.0f windows/s, %u streams\n",
+                    (double)(windows - reported_windows) / interval_s, daemon_active_streams);
+            reported_windows = windows;
+            next_report += interval_s;
+        }
+
+        for (nfds_t i = 0; i < count; i++)
+        {
+            if (0 == (fds[i].revents & (POLLIN | POLLHUP | POLLERR)))
+            {
+                continue;
+            }
+
+            if (NULL != polled[i])
+            {
+                daemon_read(polled[i]);
+            }
+            else if (fds[i].fd == daemon_wake_fd)
+            {
+                uint64_t value;
+
+                /* Clears the counter, the loop checks every stream anyway */
+                if (read(daemon_wake_fd, &value, sizeof(value)) < 0)
+                {
+                    continue;
+                }
+            }
+            else
+            {
+                int fd = accept(listener, NULL, NULL);
+                char name[DAEMON_NAME_SIZE];
+
+                if (fd >= 0)
+                {
+                    fcntl(fd, F_SETFL, O_NONBLOCK);
+                    snprintf(name, sizeof(name), "socket:%u", daemon_connections++);
+                    daemon_add_stream(fd, DAEMON_INPUT_SOCKET, name);
+                }
+            }
+        }
+
+    }
+}
+
+/*******************************************************************************
+* Function Name: daemon_read
+********************************************************************************
+* Summary:
+*   Reads the input of a stream into its next free chunk, and queues the
+*   stream on the pool if no worker has it. Only the main thread adds chunks,
+*   so the free chunk is filled without the lock.
+*
+* Parameters:
+*   stream: A stream with a free chunk
+*
+*******************************************************************************/
+static void daemon_read(daemon_stream_t *stream)
+{
+    daemon_chunk_t *chunk;
+    bool schedule;
+    ssize_t size;
+
+    pthread_mutex_lock(&stream->lock);
+    chunk = &stream->chunks[(stream->head + stream->count) % DAEMON_CHUNKS];
+    pthread_mutex_unlock(&stream->lock);
+
+    size = read(stream->fd, chunk->data, sizeof(chunk->data));
+    if (size < 0)
+    {
+        if ((EAGAIN != errno) && (EINTR != errno))
+        {
+            fprintf(stderr, "Cannot read %s: %s\n", stream->name, strerror(errno));
+            daemon_end_input(stream);
+        }
+        return;
+    }
+    if (0 == size)
+    {
+        daemon_end_input(stream);
+        return;
+    }
+
+    chunk->size = (uint32_t)size;
+    chunk->time = LATENCY_NOW();
+
+    pthread_mutex_lock(&stream->lock);
+    stream->count++;
+    schedule = !stream->scheduled;
+    stream->scheduled = true;
+    pthread_mutex_unlock(&stream->lock);
+
+    if (schedule)
+    {
+        work_pool_submit(&daemon_pool, stream, WORK_POOL_EXTERNAL);
+    }
+}
+
+/*******************************************************************************
+* Function Name: daemon_end_input
+********************************************************************************
+* Summary:
+*   Closes the input of a stream. The stream finishes when its worker has
+*   parsed the chunks already read, or now if it has none.
+*
+* Parameters:
+*   stream: A stream with an open input
+*
+*******************************************************************************/
+static void daemon_end_input(daemon_stream_t *stream)
+{
+    close(stream->fd);
+    stream->fd = -1;
+
+    pthread_mutex_lock(&stream->lock);
+    stream->eof = true;
+    stream->finished = !stream->scheduled;
+    pthread_mutex_unlock(&stream->lock);
+}
+
+/*******************************************************************************
+* Function Name: daemon_run_stream
+********************************************************************************
+* Summary:
+*   Function of the pool: parses the chunks of a stream in order. After
+*   DAEMON_BATCH_CHUNKS chunks, the stream is queued again behind the other
+*   streams of the worker so they get their turn.
+*
+* Parameters:
+*   item: The daemon_stream_t
+*   worker: The worker running the stream
+*
+*******************************************************************************/
+static void daemon_run_stream(void *item, uint32_t worker)
+{
+    daemon_stream_t *stream = item;
+
+    for (uint32_t batch = 0; ; batch++)
+    {
+        const daemon_chunk_t *chunk;
+        bool wake;
+
+        pthread_mutex_lock(&stream->lock);
+        if (0 == stream->count)
+        {
+            stream->scheduled = false;
+            stream->finished = stream->eof;
+            wake = stream->finished;
+            pthread_mutex_unlock(&stream->lock);
+            if (wake)
+            {
+                daemon_wake();
+            }
+            return;
+        }
+        if (DAEMON_BATCH_CHUNKS == batch)
+        {
+            pthread_mutex_unlock(&stream->lock);
+            work_pool_yield(&daemon_pool, stream, worker);
+            return;
+        }
+        chunk = &stream->chunks[stream->head];
+        pthread_mutex_unlock(&stream->lock);
+
+        daemon_parse(stream, &daemon_workers[worker], chunk);
+
+        pthread_mutex_lock(&stream->lock);
+        wake = (DAEMON_CHUNKS == stream->count);
+        stream->head = (stream->head + 1u) % DAEMON_CHUNKS;
+        stream->count--;
+        pthread_mutex_unlock(&stream->lock);
+
+        /* The main thread does not poll a stream without a free chunk */
+        if (wake)
+        {
+            daemon_wake();
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: daemon_parse
+********************************************************************************
+* Summary:
+*   Collects the frames of a stream from a chunk. The header is checked as in
+*   train/stream_protocol.py: the sync bytes, then the payload length.
+*
+* Parameters:
+*   stream: The stream
+*   worker: Buffers of the worker
+*   chunk: The next chunk of the stream
+*
+*******************************************************************************/
+static void daemon_parse(daemon_stream_t *stream, daemon_worker_t *worker, const daemon_chunk_t *chunk)
+{
+    uint32_t position = 0;
+
+    while (position < chunk->size)
+    {
+        uint32_t needed;
+        uint32_t length;
+
+        if (stream->frame_size < 2u)
+        {
+            uint8_t byte = chunk->data[position++];
+
+            if (byte == ((0 == stream->frame_size) ? STREAM_SYNC_0 : STREAM_SYNC_1))
+            {
+                stream->frame[stream->frame_size++] = byte;
+            }
+            else
+            {
+                stream->frame_size = (STREAM_SYNC_0 == byte) ? 1u : 0u;
+            }
+            continue;
+        }
+
+        length = stream->frame[6] | ((uint32_t)stream->frame[7] << 8);
+        if (stream->frame_size < STREAM_HEADER_SIZE)
+        {
+            needed = STREAM_HEADER_SIZE - stream->frame_size;
+        }
+        else
+        {
+            needed = STREAM_HEADER_SIZE + length + STREAM_CRC_SIZE - stream->frame_size;
+        }
+        if (needed > chunk->size - position)
+        {
+            needed = chunk->size - position;
+        }
+        memcpy(&stream->frame[stream->frame_size], &chunk->data[position], needed);
+        stream->frame_size += needed;
+        position += needed;
+
+        if (STREAM_HEADER_SIZE == stream->frame_size)
+        {
+            length = stream->frame[6] | ((uint32_t)stream->frame[7] << 8);
+            if (length > STREAM_MAX_PAYLOAD)
+            {
+                stream->bad_frames++;
+                stream->frame_size = 0;
+            }
+        }
+        else if (stream->frame_size == STREAM_HEADER_SIZE + length + STREAM_CRC_SIZE)
+        {
+            daemon_handle_frame(stream, worker, chunk->time);
+            stream->frame_size = 0;
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: daemon_handle_frame
+********************************************************************************
+* Summary:
+*   Checks a complete frame and classifies the window it carries.
+*
+* Parameters:
+*   stream: The stream, with a complete frame
+*   worker: Buffers of the worker
+*   time: LATENCY_NOW() when the end of the frame was read
+*
+*******************************************************************************/
+static void daemon_handle_frame(daemon_stream_t *stream, daemon_worker_t *worker, latency_time_t time)
+{
+    const uint8_t *frame = stream->frame;
+    uint32_t length = frame[6] | ((uint32_t)frame[7] << 8);
+    uint16_t crc = (uint16_t)(frame[STREAM_HEADER_SIZE + length] | (frame[STREAM_HEADER_SIZE + length + 1] << 8));
+    uint16_t sequence = (uint16_t)(frame[4] | (frame[5] << 8));
+    bool lost = false;
+
+    if (crc != stream_crc16(&frame[2], STREAM_HEADER_SIZE - 2u + length))
+    {
+        stream->bad_frames++;
+        return;
+    }
+
+    if (stream->has_sequence && (sequence != (uint16_t)(stream->sequence + 1u)))
+    {
+        uint16_t gap = (uint16_t)(sequence - stream->sequence - 1u);
+
+        if (gap < DAEMON_MAX_LOST_FRAMES)
+        {
+            stream->lost_frames += gap;
+        }
+        lost = true;
+    }
+    stream->has_sequence = true;
+    stream->sequence = sequence;
+
+    if (STREAM_TYPE_RAW == frame[2])
+    {
+        /* Little-endian int16, as on the kit */
+        if (length != sizeof(worker->samples))
+        {
+            stream->bad_frames++;
+            return;
+        }
+        memcpy(worker->samples, &frame[STREAM_HEADER_SIZE], length);
+    }
+    else if (STREAM_TYPE_DELTA == frame[2])
+    {
+        if (SENSOR_BATCH_SIZE != imu_codec_decode(&frame[STREAM_HEADER_SIZE], length, worker->samples,
+                                                  SENSOR_BATCH_SIZE))
+        {
+            stream->bad_frames++;
+            return;
+        }
+    }
+    else
+    {
+        stream->other_frames++;
+        return;
+    }
+
+    daemon_classify(stream, worker, frame[3], lost, time);
+}
+
+/*******************************************************************************
+* Function Name: daemon_classify
+********************************************************************************
+* Summary:
+*   Pre-processes a window of a stream, runs the model and the decision. The
+*   filters restart at the first window, after lost frames, and on every
+*   window with -w, as on the kit.
+*
+* Parameters:
+*   stream: The stream
+*   worker: Buffers of the worker, with the samples of the window
+*   flags: Flags of the frame, STREAM_FLAG_*
+*   lost: Frames were lost, or the sender restarted, before this one
+*   time: LATENCY_NOW() when the end of the frame was read
+*
+*******************************************************************************/
+static void daemon_classify(daemon_stream_t *stream, daemon_worker_t *worker, uint8_t flags, bool lost,
+                            latency_time_t time)
+{
+    bool bmi160_axes = (0 != (flags & STREAM_FLAG_BMI160_AXES));
+    control_decision_t decision;
+    int output_size;
+
+    if (!stream->processing_started || lost || daemon_restart_filter ||
+        (bmi160_axes != stream->processing.bmi160_axes))
+    {
+        processing_stream_init(&stream->processing, SENSOR_NUM_AXIS, bmi160_axes);
+        stream->processing_started = true;
+    }
+
+    processing_stream_window(&stream->processing, worker->samples, worker->window, SENSOR_BATCH_SIZE);
+    output_size = sparse_nn_run_buffer(&SPARSE_NN_MODEL(MODEL_NAME), worker->buffer, worker->window,
+                                       worker->probabilities);
+    control_decide(worker->probabilities, output_size, &decision);
+
+    latency_histogram_add(&stream->latency, LATENCY_NOW() - time);
+    if (decision.detected)
+    {
+        stream->detections++;
+    }
+    if (!daemon_quiet)
+    {
+        printf("%s,%u,%d,%.3f,%d\n", stream->name, stream->windows, decision.class_index,
+               decision.confidence, decision.detected ? 1 : 0);
+    }
+
+    stream->windows++;
+    atomic_fetch_add_explicit(&worker->windows, 1, memory_order_relaxed);
+}
+
+/*******************************************************************************
+* Function Name: daemon_wake
+********************************************************************************
+* Summary:
+*   Wakes the main thread from poll().
+*
+*******************************************************************************/
+static void daemon_wake(void)
+{
+    uint64_t value = 1;
+
+    /* Fails only if the counter is full, the main thread wakes anyway */
+    if (write(daemon_wake_fd, &value, sizeof(value)) < 0)
+    {
+        return;
+    }
+}
+
+/*******************************************************************************
+* Function Name: daemon_get_windows
+********************************************************************************
+* Summary:
+*   Returns the windows classified by all the workers.
+*
+*******************************************************************************/
+static uint64_t daemon_get_windows(void)
+{
+    uint64_t windows = 0;
+
+    for (uint32_t i = 0; i < daemon_pool.num_workers; i++)
+    {
+        windows += atomic_load_explicit(&daemon_workers[i].windows, memory_order_relaxed);
+    }
+
+    return windows;
+}
+
+/*******************************************************************************
+* Function Name: daemon_seconds
+********************************************************************************
+* Summary:
+*   Returns the monotonic clock in seconds.
+*
+*******************************************************************************/
+static double daemon_seconds(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (double)now.tv_sec + (double)now.tv_nsec * 1e-9;
+}
+
+/*******************************************************************************
+* Function Name: daemon_report
+********************************************************************************
+* Summary:
+*   Prints the throughput, the share of each worker, and the counters and
+*   latency of each stream: from the read of the end of a frame to the
+*   decision on its window, including the time in the chunks.
+*
+* Parameters:
+*   elapsed: Seconds since the start
+*
+*******************************************************************************/
+static void daemon_report(double elapsed)
+{
+    uint64_t windows = daemon_get_windows();
+
+    fprintf(stderr, "\nClassification daemon: %u streams, %u workers, %.3f s\n",
+            daemon_num_streams, daemon_pool.num_workers, elapsed);
+    fprintf(stderr, "Throughput: %" PRIu64 " windows, %.0f windows/s\n",
+            windows, (elapsed > 0.0) ? (double)windows / elapsed : 0.0);
+
+    fprintf(stderr, "\nWorker   Windows     Runs   Stolen\n");
+    for (uint32_t i = 0; i < daemon_pool.num_workers; i++)
+    {
+        uint64_t runs;
+        uint64_t stolen;
+
+        work_pool_get_stats(&daemon_pool, i, &runs, &stolen);
+        fprintf(stderr, "%6u %9" PRIu64 " %8" PRIu64 " %8" PRIu64 "\n", i,
+                (uint64_t)atomic_load_explicit(&daemon_workers[i].windows, memory_order_relaxed), runs, stolen);
+    }
+
+    fprintf(stderr, "\n%-40s %8s %8s %6s %6s %8s %8s %8s\n",
+            "Stream", "Windows", "Gestures", "Bad", "Lost", "p50 us", "p99 us", "max us");
+    for (uint32_t i = 0; i < daemon_num_streams; i++)
+    {
+        const daemon_stream_t *stream = daemon_streams[i];
+        latency_summary_t summary;
+
+        latency_histogram_get_summary(&stream->latency, &summary);
+        fprintf(stderr, "%-40s %8u %8u %6u %6u %8u %8u %8u\n",
+                stream->name, stream->windows, stream->detections, stream->bad_frames, stream->lost_frames,
+                summary.p50_us, summary.p99_us, summary.max_us);
+    }
+}
+
+/*******************************************************************************
+* Function Name: daemon_signal
+********************************************************************************
+* Summary:
+*   Stops the daemon on SIGINT and SIGTERM.
+*
+*******************************************************************************/
+static void daemon_signal(int signal_number)
+{
+    (void)signal_number;
+
+    daemon_stop = 1;
+}
@@ -0,0 +1,103 @@
+/******************************************************************************
+* File Name:   cy_pdl.h
+*
+* Description: Subset of the PDL and CMSIS used by the application, for
+*   the simulation build. Interrupts are the signals of the FreeRTOS POSIX
+*   port, and the DWT cycle counter counts host nanoseconds.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2021-2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef CY_PDL_H
+#define CY_PDL_H
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "cy_result.h"
+#include "cy_utils.h"
+
+/******************************************************************************
+ * Constants
+ *****************************************************************************/
+#define __STATIC_FORCEINLINE            static inline __attribute__((always_inline))
+#define __DMB()                         __sync_synchronize()
+
+#define CY_ASSERT(x)                    do { if (!(x)) { abort(); } } while (0)
+
+#define CoreDebug_DEMCR_TRCENA_Msk      (1UL << 24U)
+#define DWT_CTRL_CYCCNTENA_Msk          (1UL)
+
+/* Read the counter through sim_dwt, so each access of DWT->CYCCNT sees the
+ * current time */
+#define DWT                             (sim_dwt())
+#define CoreDebug                       (&sim_core_debug)
+
+/******************************************************************************
+ * Typedefs
+ *****************************************************************************/
+typedef struct
+{
+    volatile uint32_t CTRL;
+    volatile uint32_t CYCCNT;
+} DWT_Type;
+
+typedef struct
+{
+    volatile uint32_t DEMCR;
+} CoreDebug_Type;
+
+/******************************************************************************
+ * Global Variables
+ *****************************************************************************/
+/* 1 GHz, so a cycle is a nanosecond */
+extern uint32_t SystemCoreClock;
+extern CoreDebug_Type sim_core_debug;
+
+/*******************************************************************************
+* Functions
+*******************************************************************************/
+DWT_Type *sim_dwt(void);
+
+void __enable_irq(void);
+void __disable_irq(void);
+uint32_t __get_PRIMASK(void);
+void __set_PRIMASK(uint32_t primask);
+void NVIC_SystemReset(void);
+
+uint32_t Cy_SysLib_EnterCriticalSection(void);
+void Cy_SysLib_ExitCriticalSection(uint32_t saved_intr_status);
+
+#endif /* CY_PDL_H */
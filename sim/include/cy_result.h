@@ -0,0 +1,71 @@
+/******************************************************************************
+* File Name:   cy_result.h
+*
+* Description: Result codes of the core library, for the simulation build.
+*   Same values as the core-lib header.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2021-2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef CY_RESULT_H
+#define CY_RESULT_H
+
+#include <stdint.h>
+
+typedef uint32_t cy_rslt_t;
+
+#define CY_RSLT_SUCCESS                 ((cy_rslt_t)0x00000000U)
+
+#define CY_RSLT_TYPE_POSITION           (16U)
+#define CY_RSLT_TYPE_WIDTH              (2U)
+#define CY_RSLT_MODULE_POSITION         (18U)
+#define CY_RSLT_MODULE_WIDTH            (14U)
+#define CY_RSLT_CODE_POSITION           (0U)
+#define CY_RSLT_CODE_WIDTH              (16U)
+
+#define CY_RSLT_TYPE_INFO               (0U)
+#define CY_RSLT_TYPE_WARNING            (1U)
+#define CY_RSLT_TYPE_ERROR              (2U)
+#define CY_RSLT_TYPE_FATAL              (3U)
+
+#define CY_RSLT_MODULE_BOARD_HARDWARE_BASE  (0x01BU)
+#define CY_RSLT_MODULE_MIDDLEWARE_BASE      (0x0A0U)
+
+#define CY_RSLT_CREATE(type, module, code) \
+    ((((module) & 0x3FFFU) << CY_RSLT_MODULE_POSITION) | \
+     (((code) & 0xFFFFU) << CY_RSLT_CODE_POSITION) | \
+     (((type) & 0x3U) << CY_RSLT_TYPE_POSITION))
+
+#endif /* CY_RESULT_H */
@@ -0,0 +1,88 @@
+/******************************************************************************
+* File Name:   cyabs_rtos.h
+*
+* Description: Subset of the RTOS abstraction used by the application,
+*   for the simulation build. Implemented on FreeRTOS in sim_rtos.c, as the
+*   abstraction-rtos library does on the target.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2021-2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef CYABS_RTOS_H
+#define CYABS_RTOS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "cy_result.h"
+
+/* Set for the host tools built without FreeRTOS, see BATCH_CFLAGS */
+#if !SIM_WITHOUT_RTOS
+#include "FreeRTOS.h"
+#include "event_groups.h"
+#include "semphr.h"
+#endif
+
+/******************************************************************************
+ * Constants
+ *****************************************************************************/
+#define CY_RTOS_NEVER_TIMEOUT       (0xFFFFFFFFUL)
+
+#define CY_RTOS_TIMEOUT             CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_MIDDLEWARE_BASE + 0x100U, 1)
+#define CY_RTOS_NO_MEMORY           CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_MIDDLEWARE_BASE + 0x100U, 2)
+
+/******************************************************************************
+ * Typedefs
+ *****************************************************************************/
+#if SIM_WITHOUT_RTOS
+typedef void *cy_event_t;
+typedef void *cy_mutex_t;
+#else
+typedef EventGroupHandle_t cy_event_t;
+typedef SemaphoreHandle_t cy_mutex_t;
+#endif
+
+/*******************************************************************************
+* Functions
+*******************************************************************************/
+cy_rslt_t cy_rtos_init_event(cy_event_t *event);
+cy_rslt_t cy_rtos_setbits_event(cy_event_t *event, uint32_t bits, bool in_isr);
+cy_rslt_t cy_rtos_waitbits_event(cy_event_t *event, uint32_t *bits, bool clear, bool all, uint32_t timeout);
+
+cy_rslt_t cy_rtos_init_mutex(cy_mutex_t *mutex);
+cy_rslt_t cy_rtos_get_mutex(cy_mutex_t *mutex, uint32_t timeout);
+cy_rslt_t cy_rtos_set_mutex(cy_mutex_t *mutex);
+
+#endif /* CYABS_RTOS_H */
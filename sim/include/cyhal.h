@@ -0,0 +1,162 @@
+/******************************************************************************
+* File Name:   cyhal.h
+*
+* Description: Subset of the HAL used by the application, for the
+*   simulation build. The timer and UART are implemented in sim_hal.c.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2021-2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef CYHAL_H
+#define CYHAL_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "cy_result.h"
+#include "cy_pdl.h"
+
+/******************************************************************************
+ * Constants
+ *****************************************************************************/
+#define NC                              ((cyhal_gpio_t)0xFF)
+
+#define CYHAL_I2C_MODE_MASTER           (false)
+
+#define CYHAL_TIMER_IRQ_NONE            (0x0U)
+#define CYHAL_TIMER_IRQ_TERMINAL_COUNT  (0x1U)
+#define CYHAL_TIMER_IRQ_CAPTURE_COMPARE (0x2U)
+
+#define CYHAL_UART_IRQ_NONE             (0x0U)
+#define CYHAL_UART_IRQ_TX_DONE          (0x2U)
+#define CYHAL_UART_IRQ_RX_NOT_EMPTY     (0x100U)
+
+/* Returned by cyhal_uart_write_async while a transfer is in progress */
+#define CYHAL_UART_RSLT_ERR_TX_BUSY     CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_BOARD_HARDWARE_BASE, 0x4U)
+#define CYHAL_UART_RSLT_ERR_RX_EMPTY    CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_BOARD_HARDWARE_BASE, 0x5U)
+
+/******************************************************************************
+ * Typedefs
+ *****************************************************************************/
+typedef uint32_t cyhal_gpio_t;
+typedef void cyhal_clock_t;
+
+typedef enum
+{
+    CYHAL_TIMER_DIR_UP,
+    CYHAL_TIMER_DIR_DOWN,
+    CYHAL_TIMER_DIR_UP_DOWN,
+} cyhal_timer_direction_t;
+
+typedef uint32_t cyhal_timer_event_t;
+typedef void (*cyhal_timer_event_callback_t)(void *callback_arg, cyhal_timer_event_t event);
+
+typedef struct
+{
+    bool is_continuous;
+    cyhal_timer_direction_t direction;
+    bool is_compare;
+    uint32_t period;
+    uint32_t compare_value;
+    uint32_t value;
+} cyhal_timer_cfg_t;
+
+typedef struct
+{
+    cyhal_timer_cfg_t config;
+    uint32_t frequency;
+    cyhal_timer_event_callback_t callback;
+    void *callback_arg;
+    cyhal_timer_event_t events;
+    bool running;
+    uint64_t phase;
+} cyhal_timer_t;
+
+typedef struct
+{
+    bool is_slave;
+    uint16_t address;
+    uint32_t frequencyhal_hz;
+} cyhal_i2c_cfg_t;
+
+typedef struct
+{
+    cyhal_i2c_cfg_t config;
+} cyhal_i2c_t;
+
+typedef enum
+{
+    CYHAL_ASYNC_SW,
+    CYHAL_ASYNC_DMA,
+} cyhal_async_mode_t;
+
+typedef uint32_t cyhal_uart_event_t;
+typedef void (*cyhal_uart_event_callback_t)(void *callback_arg, cyhal_uart_event_t event);
+
+typedef struct
+{
+    uint32_t baud_rate;
+    cyhal_uart_event_callback_t callback;
+    void *callback_arg;
+    cyhal_uart_event_t events;
+    uint32_t tx_done_tick;          /* RTOS tick when the transfer in progress ends */
+    bool tx_busy;
+} cyhal_uart_t;
+
+/*******************************************************************************
+* Functions
+*******************************************************************************/
+uint32_t cyhal_system_critical_section_enter(void);
+void cyhal_system_critical_section_exit(uint32_t old_state);
+
+cy_rslt_t cyhal_timer_init(cyhal_timer_t *obj, cyhal_gpio_t pin, const cyhal_clock_t *clk);
+cy_rslt_t cyhal_timer_configure(cyhal_timer_t *obj, const cyhal_timer_cfg_t *cfg);
+cy_rslt_t cyhal_timer_set_frequency(cyhal_timer_t *obj, uint32_t hz);
+void cyhal_timer_register_callback(cyhal_timer_t *obj, cyhal_timer_event_callback_t callback, void *callback_arg);
+void cyhal_timer_enable_event(cyhal_timer_t *obj, cyhal_timer_event_t event, uint8_t intr_priority, bool enable);
+cy_rslt_t cyhal_timer_start(cyhal_timer_t *obj);
+
+cy_rslt_t cyhal_i2c_init(cyhal_i2c_t *obj, cyhal_gpio_t sda, cyhal_gpio_t scl, const cyhal_clock_t *clk);
+cy_rslt_t cyhal_i2c_configure(cyhal_i2c_t *obj, const cyhal_i2c_cfg_t *cfg);
+
+cy_rslt_t cyhal_uart_set_async_mode(cyhal_uart_t *obj, cyhal_async_mode_t mode, uint8_t dma_priority);
+void cyhal_uart_register_callback(cyhal_uart_t *obj, cyhal_uart_event_callback_t callback, void *callback_arg);
+void cyhal_uart_enable_event(cyhal_uart_t *obj, cyhal_uart_event_t event, uint8_t intr_priority, bool enable);
+cy_rslt_t cyhal_uart_write_async(cyhal_uart_t *obj, void *tx, size_t length);
+uint32_t cyhal_uart_readable(cyhal_uart_t *obj);
+cy_rslt_t cyhal_uart_getc(cyhal_uart_t *obj, uint8_t *value, uint32_t timeout);
+
+#endif /* CYHAL_H */
@@ -0,0 +1,103 @@
+/******************************************************************************
+* File Name:   mtb_bmi160.h
+*
+* Description: BMI160 driver interface of the simulation build. The
+*   samples are read from a recording by sim_replay.c.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2021-2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef MTB_BMI160_H
+#define MTB_BMI160_H
+
+#include <stdint.h>
+
+#include "cy_result.h"
+#include "cyhal.h"
+
+/******************************************************************************
+ * Constants
+ *****************************************************************************/
+#define MTB_BMI160_DEFAULT_ADDRESS      (0x68)
+
+#define BMI160_ACCEL_ODR_200HZ          UINT8_C(0x09)
+#define BMI160_ACCEL_RANGE_4G           UINT8_C(0x05)
+#define BMI160_GYRO_ODR_200HZ           UINT8_C(0x09)
+
+/******************************************************************************
+ * Typedefs
+ *****************************************************************************/
+struct bmi160_cfg
+{
+    uint8_t power;
+    uint8_t odr;
+    uint8_t range;
+    uint8_t bw;
+};
+
+struct bmi160_dev
+{
+    struct bmi160_cfg accel_cfg;
+    struct bmi160_cfg gyro_cfg;
+};
+
+struct bmi160_sensor_data
+{
+    int16_t x;
+    int16_t y;
+    int16_t z;
+    uint32_t sensortime;
+};
+
+typedef struct
+{
+    struct bmi160_sensor_data accel;
+    struct bmi160_sensor_data gyro;
+} mtb_bmi160_data_t;
+
+typedef struct
+{
+    struct bmi160_dev sensor;
+} mtb_bmi160_t;
+
+/*******************************************************************************
+* Functions
+*******************************************************************************/
+cy_rslt_t mtb_bmi160_init_i2c(mtb_bmi160_t *obj, cyhal_i2c_t *inst, uint8_t address);
+cy_rslt_t mtb_bmi160_config_default(mtb_bmi160_t *obj);
+cy_rslt_t mtb_bmi160_read(mtb_bmi160_t *obj, mtb_bmi160_data_t *sensor_data);
+int8_t bmi160_set_sens_conf(struct bmi160_dev *dev);
+
+#endif /* MTB_BMI160_H */
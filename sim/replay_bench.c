@@ -0,0 +1,526 @@
+/******************************************************************************
+* File Name:   replay_bench.c
+*
+* Description: This file contains the replay benchmark of the simulation
+*              build. It runs every recording of train/gesture_data through
+*              the pre-processing, the sparse model and the decision of the
+*              application, and reports the throughput, the time of each
+*              stage, the precision and recall of each class, and the
+*              confusion matrix.
+*
+*              The recordings hold the windows as pre-processed on the kit,
+*              so the model classifies the recorded windows, as in training.
+*              The pre-processing runs on the recorded samples scaled back to
+*              int16, for its time, and is checked against a double precision
+*              reference of the same steps.
+*
+*              qemu/Makefile builds the same benchmark for the Cortex-M4,
+*              where the stages are counted in instructions, and can run a
+*              generated model variant, or the model compiled by
+*              train/aot_compile.py, instead of the sparse model.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2021-2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "processing.h"
+#if GESTURE_SPARSE_MODEL
+#include "sparse_nn.h"
+#elif GESTURE_AOT_MODEL
+#include AOT_MODEL_HEADER
+#else
+#include "precision.h"
+#endif
+#include "control.h"
+#include "sensor.h"
+#include "instrument.h"
+#include "sim_replay.h"
+
+#include <math.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/*******************************************************************************
+* Constants
+*******************************************************************************/
+#define BENCH_DATA_DEFAULT      "../train/gesture_data"
+
+#define BENCH_MAX_CLASSES       SIM_REPLAY_MAX_CLASSES
+
+#define BENCH_WINDOW_VALUES     (SENSOR_BATCH_SIZE * SENSOR_NUM_AXIS)
+
+/* Unit of INSTRUMENT_NOW() after division by instrument_get_cycles_per_us() */
+#if defined(INSTRUMENT_QEMU_ICOUNT)
+#define BENCH_UNIT              "insn"
+#else
+#define BENCH_UNIT              "us"
+#endif
+
+#if GESTURE_AOT_MODEL
+/* Names of the model compiled by train/aot_compile.py */
+#define BENCH_CONCAT(a, b)      a##b
+#define BENCH_AOT(suffix)       BENCH_AOT_NAME(MODEL_NAME, suffix)
+#define BENCH_AOT_NAME(name, suffix)    BENCH_CONCAT(name, suffix)
+#endif
+
+/* Layer times of the generated model, with the profiler of the ML middleware */
+#ifndef BENCH_PROFILE_LAYERS
+#define BENCH_PROFILE_LAYERS    0u
+#endif
+
+/*******************************************************************************
+* Typedefs
+*******************************************************************************/
+/* Stages timed for each window */
+typedef enum
+{
+    BENCH_STAGE_PREPROCESS,
+    BENCH_STAGE_INFERENCE,
+    BENCH_STAGE_DECISION,
+    BENCH_STAGE_TOTAL,
+    BENCH_NUM_STAGES
+} bench_stage_t;
+
+typedef struct
+{
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t total;
+} bench_time_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+#if GESTURE_SPARSE_MODEL
+/* Generated with train/sparse_export.py */
+extern const sparse_nn_model_t SPARSE_NN_MODEL(MODEL_NAME);
+#endif
+
+static const char *const bench_stage_names[BENCH_NUM_STAGES] =
+{
+    "preprocess",
+    "inference",
+    "decision",
+    "total",
+};
+
+static sim_replay_windows_t bench_data;
+static bench_time_t bench_times[BENCH_NUM_STAGES];
+static uint32_t bench_confusion[BENCH_MAX_CLASSES][BENCH_MAX_CLASSES];
+
+#if GESTURE_AOT_MODEL
+static uint8_t bench_aot_arena[BENCH_AOT(_AOT_ARENA_SIZE)] __attribute__((aligned(4)));
+#endif
+
+/*******************************************************************************
+* Local Functions
+*******************************************************************************/
+static void bench_time_add(bench_time_t *time, uint32_t cycles);
+static double bench_reference_error(const int16_t *raw, const float *window);
+static void bench_report(uint32_t passes, double preprocess_error);
+#if GESTURE_AOT_MODEL
+static int bench_aot_run(const float *window, float *probabilities);
+#endif
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*   Runs the benchmark. Usage: replay_bench [-r passes] [data folder | @list]
+*   Each pass runs every window once; the precision, recall and confusion
+*   matrix are from the first pass, the times from all the passes. A list
+*   file names one recording per line, in a folder named after its class.
+*
+* Return:
+*   0 on success, 1 if the recordings cannot be read.
+*******************************************************************************/
+int main(int argc, char **argv)
+{
+    const char *folder = BENCH_DATA_DEFAULT;
+    uint32_t passes = 1;
+    double preprocess_error = 0.0;
+    float window[BENCH_WINDOW_VALUES];
+    int16_t raw[BENCH_WINDOW_VALUES];
+#if GESTURE_SPARSE_MODEL || GESTURE_AOT_MODEL
+    float probabilities[BENCH_MAX_CLASSES];
+#endif
+    int option;
+
+    while (-1 != (option = getopt(argc, argv, "r:")))
+    {
+        if ('r' == option)
+        {
+            passes = (uint32_t)strtoul(optarg, NULL, 10);
+        }
+        else
+        {
+            fprintf(stderr, "Usage: %s [-r passes] [data folder | @list]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (optind < argc)
+    {
+        folder = argv[optind];
+    }
+    if (0 == passes)
+    {
+        passes = 1;
+    }
+
+    if (!sim_replay_load_windows(folder, &bench_data))
+    {
+        return 1;
+    }
+
+    instrument_init();
+
+#if !GESTURE_SPARSE_MODEL && !GESTURE_AOT_MODEL
+    /* The variant generated for NN_INFERENCE_ENGINE and NN_TYPE */
+    if (CY_RSLT_SUCCESS != precision_init())
+    {
+        fprintf(stderr, "Cannot initialize the model\n");
+        return 1;
+    }
+#if BENCH_PROFILE_LAYERS
+    mtb_ml_model_profile_config(precision_get_model(), MTB_ML_PROFILE_ENABLE_LAYER);
+#endif
+#endif
+
+    for (uint32_t pass = 0; pass < passes; pass++)
+    {
+        for (uint32_t i = 0; i < bench_data.count; i++)
+        {
+            control_decision_t decision;
+            uint32_t start;
+            uint32_t preprocessed;
+            uint32_t inferred;
+            uint32_t decided;
+
+            for (uint32_t sample = 0; sample < SENSOR_BATCH_SIZE; sample++)
+            {
+                sim_replay_to_raw(&bench_data.recorded[i][sample * SENSOR_NUM_AXIS], &raw[sample * SENSOR_NUM_AXIS]);
+            }
+
+            start = INSTRUMENT_NOW();
+            processing_window(raw, window, SENSOR_BATCH_SIZE, SENSOR_NUM_AXIS);
+            preprocessed = INSTRUMENT_NOW();
+#if GESTURE_SPARSE_MODEL
+            int output_size = sparse_nn_run(&SPARSE_NN_MODEL(MODEL_NAME), bench_data.recorded[i], probabilities);
+            inferred = INSTRUMENT_NOW();
+            control_decide(probabilities, output_size, &decision);
+#elif GESTURE_AOT_MODEL
+            int output_size = bench_aot_run(bench_data.recorded[i], probabilities);
+            inferred = INSTRUMENT_NOW();
+            control_decide(probabilities, output_size, &decision);
+#else
+            precision_run(bench_data.recorded[i]);
+            inferred = INSTRUMENT_NOW();
+            precision_decide(&decision);
+#endif
+            decided = INSTRUMENT_NOW();
+
+            bench_time_add(&bench_times[BENCH_STAGE_PREPROCESS], preprocessed - start);
+            bench_time_add(&bench_times[BENCH_STAGE_INFERENCE], inferred - preprocessed);
+            bench_time_add(&bench_times[BENCH_STAGE_DECISION], decided - inferred);
+            bench_time_add(&bench_times[BENCH_STAGE_TOTAL], decided - start);
+
+            if (0 == pass)
+            {
+                /* A gesture below its threshold is reported as no gesture */
+                uint32_t predicted = decision.detected ? (uint32_t)decision.class_index : (bench_data.num_classes - 1u);
+                if (predicted >= bench_data.num_classes)
+                {
+                    predicted = bench_data.num_classes - 1u;
+                }
+                bench_confusion[bench_data.labels[i]][predicted]++;
+
+                double error = bench_reference_error(raw, window);
+                if (error > preprocess_error)
+                {
+                    preprocess_error = error;
+                }
+            }
+        }
+    }
+
+    bench_report(passes, preprocess_error);
+
+#if !GESTURE_SPARSE_MODEL && !GESTURE_AOT_MODEL && BENCH_PROFILE_LAYERS
+    printf("\nLayers of the model, %s, over all the passes\n", precision_get_name(precision_get()));
+    mtb_ml_model_profile_log(precision_get_model());
+#endif
+
+    return 0;
+}
+
+/*******************************************************************************
+* Function Name: output_printf
+********************************************************************************
+* Summary:
+*   Prints the errors of the pre-processing.
+*
+*******************************************************************************/
+uint32_t output_printf(const char *format, ...)
+{
+    va_list args;
+    int length;
+
+    va_start(args, format);
+    length = vprintf(format, args);
+    va_end(args);
+
+    return (length < 0) ? 0u : (uint32_t)length;
+}
+
+/*******************************************************************************
+* Function Name: output_write
+********************************************************************************
+* Summary:
+*   The decision is not printed by the benchmark, control() is not called.
+*
+*******************************************************************************/
+uint32_t output_write(const char *data, uint32_t size)
+{
+    (void)data;
+    (void)size;
+
+    return 0;
+}
+
+/*******************************************************************************
+* Function Name: bench_time_add
+*******************************************************************************/
+static void bench_time_add(bench_time_t *time, uint32_t cycles)
+{
+    if ((0 == time->count) || (cycles < time->min))
+    {
+        time->min = cycles;
+    }
+    if (cycles > time->max)
+    {
+        time->max = cycles;
+    }
+    time->total += cycles;
+    time->count++;
+}
+
+#if GESTURE_AOT_MODEL
+/*******************************************************************************
+* Function Name: bench_aot_run
+********************************************************************************
+* Summary:
+*   Runs the model compiled by train/aot_compile.py. An int8 model takes the
+*   window quantized with the scale of its input, rounded half away from zero
+*   as in TensorFlow Lite, and its output is dequantized.
+*
+* Parameters:
+*     window: pre-processed window
+*     probabilities: output of the model
+*
+* Return:
+*   The number of outputs.
+*******************************************************************************/
+static int bench_aot_run(const float *window, float *probabilities)
+{
+#if BENCH_AOT(_AOT_QUANTIZED)
+    int8_t input[BENCH_AOT(_AOT_INPUT_SIZE)];
+    int8_t output[BENCH_AOT(_AOT_OUTPUT_SIZE)];
+
+    for (uint32_t i = 0; i < BENCH_AOT(_AOT_INPUT_SIZE); i++)
+    {
+        float value = roundf(window[i] / BENCH_AOT(_AOT_INPUT_SCALE)) + (float)BENCH_AOT(_AOT_INPUT_ZERO_POINT);
+        input[i] = (int8_t)fminf(fmaxf(value, (float)INT8_MIN), (float)INT8_MAX);
+    }
+    BENCH_AOT(_aot_run)(input, output, bench_aot_arena);
+    for (uint32_t i = 0; i < BENCH_AOT(_AOT_OUTPUT_SIZE); i++)
+    {
+        probabilities[i] = BENCH_AOT(_AOT_OUTPUT_SCALE) * (float)(output[i] - BENCH_AOT(_AOT_OUTPUT_ZERO_POINT));
+    }
+#else
+    BENCH_AOT(_aot_run)(window, probabilities, bench_aot_arena);
+#endif
+
+    return BENCH_AOT(_AOT_OUTPUT_SIZE);
+}
+#endif
+
+/*******************************************************************************
+* Function Name: bench_reference_error
+********************************************************************************
+* Summary:
+*   Pre-processes a window in double precision, with the steps of
+*   processing_window, and compares it with the window of the application.
+*
+* Parameters:
+*     raw: sensor data of the window
+*     window: output of processing_window for raw
+*
+* Return:
+*   The largest absolute difference.
+*******************************************************************************/
+static double bench_reference_error(const int16_t *raw, const float *window)
+{
+    static const double b[] = IIR_FILTER_BUTTER_WORTH_COEFF_B;
+    static const double a[] = IIR_FILTER_BUTTER_WORTH_COEFF_A;
+    double error = 0.0;
+
+    for (uint32_t axis = 0; axis < SENSOR_NUM_AXIS; axis++)
+    {
+        double x[4] = { 0.0 };
+        double y[4] = { 0.0 };
+        uint32_t column = axis;
+        bool inverse = false;
+
+#ifdef CY_BMI_160_IMU_I2C
+        /* Where the axis swap moves this axis */
+        static const uint32_t columns[SENSOR_NUM_AXIS] = { 1, 0, 2, 4, 3, 5 };
+        column = columns[axis];
+        inverse = (2u == axis) || (5u == axis);
+#endif
+
+        for (uint32_t sample = 0; sample < SENSOR_BATCH_SIZE; sample++)
+        {
+            double value;
+
+            memmove(&x[1], &x[0], 3u * sizeof(x[0]));
+            memmove(&y[1], &y[0], 3u * sizeof(y[0]));
+            x[0] = raw[sample * SENSOR_NUM_AXIS + axis];
+            y[0] = b[0] * x[0] + b[1] * x[1] + b[2] * x[2] + b[3] * x[3] - a[1] * y[1] - a[2] * y[2] - a[3] * y[3];
+
+            /* Min max normalization between -1 and 1 */
+            value = fmax(-1.0, fmin(1.0, 1.0 - (MAX_DATA_SAMPLE - y[0]) * (2.0 / (MAX_DATA_SAMPLE - MIN_DATA_SAMPLE))));
+            if (inverse)
+            {
+                value = -value;
+            }
+
+            error = fmax(error, fabs(value - window[sample * SENSOR_NUM_AXIS + column]));
+        }
+    }
+
+    return error;
+}
+
+/*******************************************************************************
+* Function Name: bench_report
+********************************************************************************
+* Summary:
+*   Prints the throughput, the time of each stage, the precision and recall
+*   of each class, and the confusion matrix.
+*
+* Parameters:
+*     passes: passes over the windows
+*     preprocess_error: largest error of the pre-processing
+*
+*******************************************************************************/
+static void bench_report(uint32_t passes, double preprocess_error)
+{
+    double cycles_per_us = (double)instrument_get_cycles_per_us();
+    const bench_time_t *total = &bench_times[BENCH_STAGE_TOTAL];
+    uint32_t correct = 0;
+
+    printf("Replay benchmark: %u windows of %u samples from %u recordings, %u passes\n",
+           (unsigned)bench_data.count, (unsigned)SENSOR_BATCH_SIZE, (unsigned)bench_data.recordings,
+           (unsigned)passes);
+#if defined(INSTRUMENT_QEMU_ICOUNT)
+    uint32_t overhead = INSTRUMENT_NOW();
+    overhead = INSTRUMENT_NOW() - overhead;
+    printf("Instructions: %.0f per window, %u more for each reading of the counter\n\n",
+           (double)total->total / (double)total->count, (unsigned)overhead);
+#else
+    printf("Throughput: %.0f windows/s\n\n", (double)total->count * cycles_per_us * 1e6 / (double)total->total);
+#endif
+
+    printf("%-12s %10s %10s %10s\n", "Stage (" BENCH_UNIT ")", "Average", "Min", "Max");
+    for (uint32_t stage = 0; stage < BENCH_NUM_STAGES; stage++)
+    {
+        const bench_time_t *time = &bench_times[stage];
+        printf("%-12s %10.2f %10.2f %10.2f\n", bench_stage_names[stage],
+               (double)time->total / (double)time->count / cycles_per_us,
+               (double)time->min / cycles_per_us, (double)time->max / cycles_per_us);
+    }
+
+    printf("\n%-14s %8s %10s %8s\n", "Class", "Windows", "Precision", "Recall");
+    for (uint32_t label = 0; label < bench_data.num_classes; label++)
+    {
+        uint32_t recorded = 0;
+        uint32_t predicted = 0;
+
+        for (uint32_t i = 0; i < bench_data.num_classes; i++)
+        {
+            recorded += bench_confusion[label][i];
+            predicted += bench_confusion[i][label];
+        }
+        correct += bench_confusion[label][label];
+
+        printf("%-14s %8u %10.3f %8.3f\n", bench_data.classes[label], (unsigned)recorded,
+               (0 == predicted) ? 0.0 : (double)bench_confusion[label][label] / predicted,
+               (0 == recorded) ? 0.0 : (double)bench_confusion[label][label] / recorded);
+    }
+    printf("Accuracy: %.3f\n", (double)correct / bench_data.count);
+
+    printf("\nConfusion matrix, rows: recorded class, columns: decision\n%-14s", "");
+    for (uint32_t i = 0; i < bench_data.num_classes; i++)
+    {
+        printf(" %12.12s", bench_data.classes[i]);
+    }
+    printf("\n");
+    for (uint32_t label = 0; label < bench_data.num_classes; label++)
+    {
+        printf("%-14s", bench_data.classes[label]);
+        for (uint32_t i = 0; i < bench_data.num_classes; i++)
+        {
+            printf(" %12u", (unsigned)bench_confusion[label][i]);
+        }
+        printf("\n");
+    }
+
+    printf("\nPre-processing: %.3g largest error against the double precision reference\n", preprocess_error);
+
+#if INSTRUMENT_ENABLE
+    instrument_summary_t summary;
+
+    printf("\n%-20s %10s %10s %10s %10s\n", "Timer (" BENCH_UNIT ")", "Count", "Min", "Average", "Max");
+    for (const instrument_stat_t *stat = instrument_get_next(NULL, &summary); NULL != stat;
+         stat = instrument_get_next(stat, &summary))
+    {
+        printf("%-20s %10u %10u %10u %10u\n", summary.name, (unsigned)summary.count, (unsigned)summary.min,
+               (unsigned)summary.average, (unsigned)summary.max);
+    }
+#endif
+}
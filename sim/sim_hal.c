@@ -0,0 +1,683 @@
+/******************************************************************************
+* File Name:   sim_hal.c
+*
+* Description: This file contains the board of the simulation build: the
+*              HAL timer, UART and I2C, retarget-io, the cycle counter and the
+*              FreeRTOS hooks.
+*
+*              The interrupts are run by the highest priority task, woken on
+*              every RTOS tick. It calls the sensor timer callback at the rate
+*              the timer is set to, ends the UART transfers after the time
+*              they take at the baud rate, and passes the bytes typed on the
+*              standard input to the UART callback. As on the target, the
+*              interrupt callbacks preempt the application tasks.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2021-2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "cyhal.h"
+#include "cybsp.h"
+#include "cy_pdl.h"
+#include "cy_retarget_io.h"
+#include "sim_replay.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include <errno.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+/*******************************************************************************
+* Constants
+*******************************************************************************/
+/* Recording replayed when SIM_REPLAY is not set, relative to the sim folder */
+#define SIM_REPLAY_DEFAULT          "../train/gesture_data/Circle/output_Circle_nrsh.txt"
+
+/* The stacks are pthread stacks, far larger than on the target */
+#define SIM_STACK_SCALE             16u
+
+#define SIM_INTERRUPT_TASK_STACK    1024u
+#define SIM_INTERRUPT_TASK_PRIORITY (configMAX_PRIORITIES - 1)
+#define SIM_REPORT_TASK_STACK       1024u
+#define SIM_REPORT_TASK_PRIORITY    1u
+
+/* Ticks between two reads of the standard input */
+#define SIM_STDIN_PERIOD            10u
+#define SIM_RX_SIZE                 256u
+
+/* Bits per byte on the UART, with the start and stop bits */
+#define SIM_UART_BITS_PER_BYTE      10u
+
+/* Console commands sent at the end of a run of SIM_DURATION_S seconds */
+#define SIM_REPORT_DELAY_MS         500u
+static const char *const sim_report_commands[] =
+{
+    "tasks\n",
+    "counters\n",
+    "latency\n",
+    "memory\n",
+};
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+uint32_t SystemCoreClock = 1000000000u;
+CoreDebug_Type sim_core_debug;
+static DWT_Type sim_dwt_registers;
+
+cyhal_uart_t cy_retarget_io_uart_obj;
+
+/* Timer set up by sensor.c */
+static cyhal_timer_t *sim_timer;
+
+/* Bytes received by the debug UART, read by cyhal_uart_getc */
+static uint8_t sim_rx[SIM_RX_SIZE];
+static volatile uint32_t sim_rx_head;
+static volatile uint32_t sim_rx_tail;
+static bool sim_stdin_closed;
+
+static uint32_t sim_duration_s;
+
+/* Memory of the idle and timer tasks */
+static StaticTask_t sim_idle_task_tcb;
+static StackType_t sim_idle_task_stack[configMINIMAL_STACK_SIZE];
+static StaticTask_t sim_timer_task_tcb;
+static StackType_t sim_timer_task_stack[configTIMER_TASK_STACK_DEPTH];
+
+/*******************************************************************************
+* Local Functions
+*******************************************************************************/
+static void sim_interrupt_task(void *arg);
+static void sim_report_task(void *arg);
+static void sim_rx_push(const char *data, uint32_t size);
+static void sim_poll_stdin(void);
+
+BaseType_t __real_xTaskCreate(TaskFunction_t code, const char * const name, const configSTACK_DEPTH_TYPE stack_depth,
+                              void * const parameters, UBaseType_t priority, TaskHandle_t * const created_task);
+
+/*******************************************************************************
+* Function Name: cybsp_init
+********************************************************************************
+* Summary:
+*   Loads the recording to replay and creates the interrupt task. Settings
+*   are read from the environment:
+*     SIM_REPLAY: recording of train/gesture_data to replay
+*     SIM_DURATION_S: seconds to run before printing the metrics and exiting,
+*                     0 or unset to run until stopped
+*
+* Return:
+*   The status of the initialization.
+*******************************************************************************/
+cy_rslt_t cybsp_init(void)
+{
+    const char *replay = getenv("SIM_REPLAY");
+    const char *duration = getenv("SIM_DURATION_S");
+    cy_rslt_t result;
+
+    if (NULL == replay)
+    {
+        replay = SIM_REPLAY_DEFAULT;
+    }
+
+    result = sim_replay_open(replay);
+    if (CY_RSLT_SUCCESS != result)
+    {
+        fprintf(stderr, "Cannot read the recording %s\n", replay);
+        return result;
+    }
+
+    xTaskCreate(sim_interrupt_task, "Sim interrupts", SIM_INTERRUPT_TASK_STACK, NULL,
+                SIM_INTERRUPT_TASK_PRIORITY, NULL);
+
+    if (NULL != duration)
+    {
+        sim_duration_s = (uint32_t)strtoul(duration, NULL, 10);
+    }
+    if (0 != sim_duration_s)
+    {
+        xTaskCreate(sim_report_task, "Sim report", SIM_REPORT_TASK_STACK, NULL,
+                    SIM_REPORT_TASK_PRIORITY, NULL);
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: cy_retarget_io_init
+********************************************************************************
+* Summary:
+*   The debug UART is the standard output, written without buffering so the
+*   output appears when the simulated transfer starts.
+*
+*******************************************************************************/
+cy_rslt_t cy_retarget_io_init(cyhal_gpio_t tx, cyhal_gpio_t rx, uint32_t baudrate)
+{
+    (void)tx;
+    (void)rx;
+
+    setvbuf(stdout, NULL, _IONBF, 0);
+    memset(&cy_retarget_io_uart_obj, 0, sizeof(cy_retarget_io_uart_obj));
+    cy_retarget_io_uart_obj.baud_rate = baudrate;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: sim_dwt
+********************************************************************************
+* Summary:
+*   Returns the DWT registers, with the cycle counter set to the host
+*   monotonic clock in nanoseconds.
+*
+*******************************************************************************/
+DWT_Type *sim_dwt(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    sim_dwt_registers.CYCCNT = (uint32_t)((uint64_t)now.tv_sec * 1000000000u + (uint64_t)now.tv_nsec);
+
+    return &sim_dwt_registers;
+}
+
+/*******************************************************************************
+* Function Name: __enable_irq
+********************************************************************************
+* Summary:
+*   The interrupts are enabled by the scheduler.
+*
+*******************************************************************************/
+void __enable_irq(void)
+{
+}
+
+/*******************************************************************************
+* Function Name: __disable_irq
+********************************************************************************
+* Summary:
+*   Masks the interrupts until __set_PRIMASK. The application only uses the
+*   pair to save and restore the mask, so it maps to a critical section.
+*
+*******************************************************************************/
+void __disable_irq(void)
+{
+    taskENTER_CRITICAL();
+}
+
+/*******************************************************************************
+* Function Name: __get_PRIMASK
+*******************************************************************************/
+uint32_t __get_PRIMASK(void)
+{
+    return 0u;
+}
+
+/*******************************************************************************
+* Function Name: __set_PRIMASK
+*******************************************************************************/
+void __set_PRIMASK(uint32_t primask)
+{
+    (void)primask;
+
+    taskEXIT_CRITICAL();
+}
+
+/*******************************************************************************
+* Function Name: Cy_SysLib_EnterCriticalSection
+*******************************************************************************/
+uint32_t Cy_SysLib_EnterCriticalSection(void)
+{
+    taskENTER_CRITICAL();
+
+    return 0u;
+}
+
+/*******************************************************************************
+* Function Name: Cy_SysLib_ExitCriticalSection
+*******************************************************************************/
+void Cy_SysLib_ExitCriticalSection(uint32_t saved_intr_status)
+{
+    (void)saved_intr_status;
+
+    taskEXIT_CRITICAL();
+}
+
+/*******************************************************************************
+* Function Name: cyhal_system_critical_section_enter
+*******************************************************************************/
+uint32_t cyhal_system_critical_section_enter(void)
+{
+    return Cy_SysLib_EnterCriticalSection();
+}
+
+/*******************************************************************************
+* Function Name: cyhal_system_critical_section_exit
+*******************************************************************************/
+void cyhal_system_critical_section_exit(uint32_t old_state)
+{
+    Cy_SysLib_ExitCriticalSection(old_state);
+}
+
+/*******************************************************************************
+* Function Name: NVIC_SystemReset
+********************************************************************************
+* Summary:
+*   A reset ends the simulation.
+*
+*******************************************************************************/
+void NVIC_SystemReset(void)
+{
+    fprintf(stderr, "System reset\n");
+    exit(EXIT_FAILURE);
+}
+
+/*******************************************************************************
+* Function Name: cyhal_timer_init
+*******************************************************************************/
+cy_rslt_t cyhal_timer_init(cyhal_timer_t *obj, cyhal_gpio_t pin, const cyhal_clock_t *clk)
+{
+    (void)pin;
+    (void)clk;
+
+    memset(obj, 0, sizeof(*obj));
+    sim_timer = obj;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: cyhal_timer_configure
+*******************************************************************************/
+cy_rslt_t cyhal_timer_configure(cyhal_timer_t *obj, const cyhal_timer_cfg_t *cfg)
+{
+    obj->config = *cfg;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: cyhal_timer_set_frequency
+*******************************************************************************/
+cy_rslt_t cyhal_timer_set_frequency(cyhal_timer_t *obj, uint32_t hz)
+{
+    obj->frequency = hz;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: cyhal_timer_register_callback
+*******************************************************************************/
+void cyhal_timer_register_callback(cyhal_timer_t *obj, cyhal_timer_event_callback_t callback, void *callback_arg)
+{
+    obj->callback = callback;
+    obj->callback_arg = callback_arg;
+}
+
+/*******************************************************************************
+* Function Name: cyhal_timer_enable_event
+*******************************************************************************/
+void cyhal_timer_enable_event(cyhal_timer_t *obj, cyhal_timer_event_t event, uint8_t intr_priority, bool enable)
+{
+    (void)intr_priority;
+
+    obj->events = enable ? (obj->events | event) : (obj->events & ~event);
+}
+
+/*******************************************************************************
+* Function Name: cyhal_timer_start
+*******************************************************************************/
+cy_rslt_t cyhal_timer_start(cyhal_timer_t *obj)
+{
+    obj->phase = 0;
+    obj->running = true;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: cyhal_i2c_init
+*******************************************************************************/
+cy_rslt_t cyhal_i2c_init(cyhal_i2c_t *obj, cyhal_gpio_t sda, cyhal_gpio_t scl, const cyhal_clock_t *clk)
+{
+    (void)sda;
+    (void)scl;
+    (void)clk;
+
+    memset(obj, 0, sizeof(*obj));
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: cyhal_i2c_configure
+*******************************************************************************/
+cy_rslt_t cyhal_i2c_configure(cyhal_i2c_t *obj, const cyhal_i2c_cfg_t *cfg)
+{
+    obj->config = *cfg;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: cyhal_uart_set_async_mode
+*******************************************************************************/
+cy_rslt_t cyhal_uart_set_async_mode(cyhal_uart_t *obj, cyhal_async_mode_t mode, uint8_t dma_priority)
+{
+    (void)obj;
+    (void)mode;
+    (void)dma_priority;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: cyhal_uart_register_callback
+*******************************************************************************/
+void cyhal_uart_register_callback(cyhal_uart_t *obj, cyhal_uart_event_callback_t callback, void *callback_arg)
+{
+    obj->callback = callback;
+    obj->callback_arg = callback_arg;
+}
+
+/*******************************************************************************
+* Function Name: cyhal_uart_enable_event
+*******************************************************************************/
+void cyhal_uart_enable_event(cyhal_uart_t *obj, cyhal_uart_event_t event, uint8_t intr_priority, bool enable)
+{
+    (void)intr_priority;
+
+    obj->events = enable ? (obj->events | event) : (obj->events & ~event);
+}
+
+/*******************************************************************************
+* Function Name: cyhal_uart_write_async
+********************************************************************************
+* Summary:
+*   Writes the data to the standard output, and schedules the end of the
+*   transfer after the time it takes at the baud rate.
+*
+*******************************************************************************/
+cy_rslt_t cyhal_uart_write_async(cyhal_uart_t *obj, void *tx, size_t length)
+{
+    const uint8_t *data = (const uint8_t *)tx;
+    uint32_t ticks;
+
+    if (obj->tx_busy)
+    {
+        return CYHAL_UART_RSLT_ERR_TX_BUSY;
+    }
+
+    /* The tick signal can interrupt the write */
+    while (length > 0)
+    {
+        ssize_t written = write(STDOUT_FILENO, data, length);
+        if (written < 0)
+        {
+            if (EINTR == errno)
+            {
+                continue;
+            }
+            break;
+        }
+        data += written;
+        length -= (size_t)written;
+    }
+
+    ticks = (uint32_t)((((uint64_t)(data - (const uint8_t *)tx) * SIM_UART_BITS_PER_BYTE * configTICK_RATE_HZ) +
+                        obj->baud_rate - 1u) / obj->baud_rate);
+    obj->tx_done_tick = xTaskGetTickCount() + ((0u == ticks) ? 1u : ticks);
+    obj->tx_busy = true;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: cyhal_uart_readable
+*******************************************************************************/
+uint32_t cyhal_uart_readable(cyhal_uart_t *obj)
+{
+    (void)obj;
+
+    return sim_rx_head - sim_rx_tail;
+}
+
+/*******************************************************************************
+* Function Name: cyhal_uart_getc
+*******************************************************************************/
+cy_rslt_t cyhal_uart_getc(cyhal_uart_t *obj, uint8_t *value, uint32_t timeout)
+{
+    (void)obj;
+    (void)timeout;
+
+    if (sim_rx_head == sim_rx_tail)
+    {
+        return CYHAL_UART_RSLT_ERR_RX_EMPTY;
+    }
+
+    *value = sim_rx[sim_rx_tail % SIM_RX_SIZE];
+    sim_rx_tail++;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: sim_interrupt_task
+********************************************************************************
+* Summary:
+*   Runs the interrupt callbacks that are due at each RTOS tick. The timer
+*   callback runs frequency / period times a second, spread over the ticks.
+*
+* Parameters:
+*     arg: not used
+*
+*******************************************************************************/
+static void sim_interrupt_task(void *arg)
+{
+    TickType_t wake = xTaskGetTickCount();
+    cyhal_uart_t *uart = &cy_retarget_io_uart_obj;
+
+    (void)arg;
+
+    for (;;)
+    {
+        vTaskDelayUntil(&wake, 1);
+
+        if ((NULL != sim_timer) && sim_timer->running && (NULL != sim_timer->callback) &&
+            (0 != (sim_timer->events & CYHAL_TIMER_IRQ_TERMINAL_COUNT)) && (0 != sim_timer->config.period))
+        {
+            uint64_t per_event = (uint64_t)sim_timer->config.period * configTICK_RATE_HZ;
+
+            sim_timer->phase += sim_timer->frequency;
+            while (sim_timer->phase >= per_event)
+            {
+                sim_timer->phase -= per_event;
+                sim_timer->callback(sim_timer->callback_arg, CYHAL_TIMER_IRQ_TERMINAL_COUNT);
+            }
+        }
+
+        if (uart->tx_busy && ((TickType_t)(wake - uart->tx_done_tick) < (portMAX_DELAY / 2u)))
+        {
+            uart->tx_busy = false;
+            if ((NULL != uart->callback) && (0 != (uart->events & CYHAL_UART_IRQ_TX_DONE)))
+            {
+                uart->callback(uart->callback_arg, CYHAL_UART_IRQ_TX_DONE);
+            }
+        }
+
+        if (0 == (wake % SIM_STDIN_PERIOD))
+        {
+            sim_poll_stdin();
+        }
+
+        if ((sim_rx_head != sim_rx_tail) && (NULL != uart->callback) &&
+            (0 != (uart->events & CYHAL_UART_IRQ_RX_NOT_EMPTY)))
+        {
+            uart->callback(uart->callback_arg, CYHAL_UART_IRQ_RX_NOT_EMPTY);
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: sim_report_task
+********************************************************************************
+* Summary:
+*   Ends a run of SIM_DURATION_S seconds: types the metrics commands on the
+*   console, waits for their output, and exits.
+*
+* Parameters:
+*     arg: not used
+*
+*******************************************************************************/
+static void sim_report_task(void *arg)
+{
+    (void)arg;
+
+    vTaskDelay(pdMS_TO_TICKS(sim_duration_s * 1000u));
+
+    for (uint32_t i = 0; i < (sizeof(sim_report_commands) / sizeof(sim_report_commands[0])); i++)
+    {
+        sim_rx_push(sim_report_commands[i], (uint32_t)strlen(sim_report_commands[i]));
+        vTaskDelay(pdMS_TO_TICKS(SIM_REPORT_DELAY_MS));
+    }
+
+    exit(EXIT_SUCCESS);
+}
+
+/*******************************************************************************
+* Function Name: sim_rx_push
+********************************************************************************
+* Summary:
+*   Adds bytes to the receive buffer of the debug UART. Bytes that do not fit
+*   are lost, as on an overflowing receive FIFO.
+*
+*******************************************************************************/
+static void sim_rx_push(const char *data, uint32_t size)
+{
+    taskENTER_CRITICAL();
+    for (uint32_t i = 0; (i < size) && ((sim_rx_head - sim_rx_tail) < SIM_RX_SIZE); i++)
+    {
+        sim_rx[sim_rx_head % SIM_RX_SIZE] = (uint8_t)data[i];
+        sim_rx_head++;
+    }
+    taskEXIT_CRITICAL();
+}
+
+/*******************************************************************************
+* Function Name: sim_poll_stdin
+********************************************************************************
+* Summary:
+*   Moves the bytes typed on the standard input to the receive buffer,
+*   without blocking.
+*
+*******************************************************************************/
+static void sim_poll_stdin(void)
+{
+    struct pollfd input = { .fd = STDIN_FILENO, .events = POLLIN };
+    char data[SIM_RX_SIZE / 4u];
+    ssize_t size;
+
+    if (sim_stdin_closed || (poll(&input, 1, 0) <= 0) || (0 == (input.revents & (POLLIN | POLLHUP))))
+    {
+        return;
+    }
+
+    size = read(STDIN_FILENO, data, sizeof(data));
+    if (size > 0)
+    {
+        sim_rx_push(data, (uint32_t)size);
+    }
+    else if ((0 == size) || (EINTR != errno))
+    {
+        sim_stdin_closed = true;
+    }
+}
+
+/*******************************************************************************
+* Function Name: __wrap_xTaskCreate
+********************************************************************************
+* Summary:
+*   Creates the tasks of the application with SIM_STACK_SCALE times their
+*   stack, linked with --wrap=xTaskCreate.
+*
+*******************************************************************************/
+BaseType_t __wrap_xTaskCreate(TaskFunction_t code, const char * const name, const configSTACK_DEPTH_TYPE stack_depth,
+                              void * const parameters, UBaseType_t priority, TaskHandle_t * const created_task)
+{
+    return __real_xTaskCreate(code, name, stack_depth * SIM_STACK_SCALE, parameters, priority, created_task);
+}
+
+/*******************************************************************************
+* Function Name: vApplicationGetIdleTaskMemory
+*******************************************************************************/
+void vApplicationGetIdleTaskMemory(StaticTask_t **tcb, StackType_t **stack, uint32_t *stack_size)
+{
+    *tcb = &sim_idle_task_tcb;
+    *stack = sim_idle_task_stack;
+    *stack_size = configMINIMAL_STACK_SIZE;
+}
+
+/*******************************************************************************
+* Function Name: vApplicationGetTimerTaskMemory
+*******************************************************************************/
+void vApplicationGetTimerTaskMemory(StaticTask_t **tcb, StackType_t **stack, uint32_t *stack_size)
+{
+    *tcb = &sim_timer_task_tcb;
+    *stack = sim_timer_task_stack;
+    *stack_size = configTIMER_TASK_STACK_DEPTH;
+}
+
+/*******************************************************************************
+* Function Name: vApplicationMallocFailedHook
+*******************************************************************************/
+void vApplicationMallocFailedHook(void)
+{
+    fprintf(stderr, "Heap allocation failed\n");
+    abort();
+}
+
+/*******************************************************************************
+* Function Name: vAssertCalled
+*******************************************************************************/
+void vAssertCalled(const char *file, unsigned long line)
+{
+    fprintf(stderr, "Assertion failed at %s:%lu\n", file, line);
+    abort();
+}
@@ -0,0 +1,646 @@
+/******************************************************************************
+* File Name:   sim_replay.c
+*
+* Description: This file contains the IMU of the simulation build. The
+*              BMI160 driver functions return the samples of a recording of
+*              train/gesture_data, in a loop, one sample per call.
+*
+*              The recordings hold filtered and normalized samples with the
+*              BMI160 axis swap applied. They are scaled back to int16 and the
+*              axis swap is undone, so the pre-processing of the application
+*              sees data close to the sensor output.
+*
+*              The recordings are also cut into windows of the model input
+*              for replay_bench.c and batch_eval.c.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2021-2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "sim_replay.h"
+#include "mtb_bmi160.h"
+
+#if !defined(__ARM_ARCH)
+#include <dirent.h>
+#endif
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*******************************************************************************
+* Constants
+*******************************************************************************/
+#define SIM_REPLAY_LINE_SIZE    256u
+#define SIM_REPLAY_MAX_FILES    256u
+
+/* Last in model output order, as in train/replay_data.py */
+#define SIM_REPLAY_NEGATIVE_CLASS "negative"
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static int16_t (*sim_replay_samples)[SIM_REPLAY_NUM_AXIS];
+static uint32_t sim_replay_count;
+static uint32_t sim_replay_next;
+
+/*******************************************************************************
+* Local Functions
+*******************************************************************************/
+static int16_t sim_replay_quantize(float value);
+#if !defined(__ARM_ARCH)
+static bool sim_replay_load_folder(const char *folder, sim_replay_windows_t *windows);
+static uint32_t sim_replay_list(const char *path, bool folders, char (*names)[SIM_REPLAY_NAME_SIZE]);
+#endif
+static bool sim_replay_load_list(const char *list, sim_replay_windows_t *windows);
+static int sim_replay_find_class(const char *name, const sim_replay_windows_t *windows);
+static void sim_replay_order_classes(sim_replay_windows_t *windows);
+static int sim_replay_compare_names(const void *a, const void *b);
+static bool sim_replay_read_recording(const char *path, uint8_t label, sim_replay_windows_t *windows);
+static bool sim_replay_add_window(const float *samples, uint8_t label, sim_replay_windows_t *windows);
+
+/*******************************************************************************
+* Function Name: sim_replay_open
+********************************************************************************
+* Summary:
+*   Loads a recording written by train/collect.py. The blocks between the
+*   separators are replayed back to back.
+*
+* Parameters:
+*   path: Path of the TXT recording
+*
+* Return:
+*   SIM_REPLAY_RSLT_NO_DATA if the file cannot be read or has no sample.
+*******************************************************************************/
+cy_rslt_t sim_replay_open(const char *path)
+{
+    char line[SIM_REPLAY_LINE_SIZE];
+    uint32_t capacity = 0;
+    FILE *file;
+
+    file = fopen(path, "r");
+    if (NULL == file)
+    {
+        return SIM_REPLAY_RSLT_NO_DATA;
+    }
+
+    while (NULL != fgets(line, sizeof(line), file))
+    {
+        float values[SIM_REPLAY_NUM_AXIS];
+
+        /* Separators and blank lines do not parse */
+        if (!sim_replay_parse_line(line, values))
+        {
+            continue;
+        }
+
+        if (sim_replay_count == capacity)
+        {
+            capacity = (0 == capacity) ? 1024u : (2u * capacity);
+            sim_replay_samples = realloc(sim_replay_samples, capacity * sizeof(sim_replay_samples[0]));
+            if (NULL == sim_replay_samples)
+            {
+                fclose(file);
+                return SIM_REPLAY_RSLT_NO_DATA;
+            }
+        }
+
+        sim_replay_to_raw(values, sim_replay_samples[sim_replay_count]);
+        sim_replay_count++;
+    }
+
+    fclose(file);
+    sim_replay_next = 0;
+
+    return (0 == sim_replay_count) ? SIM_REPLAY_RSLT_NO_DATA : CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: sim_replay_get_count
+********************************************************************************
+* Summary:
+*   Returns the number of samples of the loaded recording.
+*
+*******************************************************************************/
+uint32_t sim_replay_get_count(void)
+{
+    return sim_replay_count;
+}
+
+/*******************************************************************************
+* Function Name: sim_replay_parse_line
+********************************************************************************
+* Summary:
+*   Parses a sample of a recording.
+*
+* Parameters:
+*     line: line of the recording
+*     values: SIM_REPLAY_NUM_AXIS values of the sample
+*
+* Return:
+*   false if the line is not a sample, such as a separator.
+*******************************************************************************/
+bool sim_replay_parse_line(const char *line, float *values)
+{
+    const char *cursor = line;
+
+    for (uint32_t axis = 0; axis < SIM_REPLAY_NUM_AXIS; axis++)
+    {
+        char *end;
+
+        values[axis] = strtof(cursor, &end);
+        if ((end == cursor) || ((axis < (SIM_REPLAY_NUM_AXIS - 1u)) && (',' != *end)))
+        {
+            return false;
+        }
+        cursor = end + 1;
+    }
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: sim_replay_to_raw
+********************************************************************************
+* Summary:
+*   Converts a sample of a recording to sensor data: scales it back to int16,
+*   and undoes the BMI160 axis swap and inversion of the pre-processing.
+*
+* Parameters:
+*     values: SIM_REPLAY_NUM_AXIS values of the sample
+*     raw: SIM_REPLAY_NUM_AXIS sensor values
+*
+*******************************************************************************/
+void sim_replay_to_raw(const float *values, int16_t *raw)
+{
+    raw[0] = sim_replay_quantize(values[1]);
+    raw[1] = sim_replay_quantize(values[0]);
+    raw[2] = sim_replay_quantize(-values[2]);
+    raw[3] = sim_replay_quantize(values[4]);
+    raw[4] = sim_replay_quantize(values[3]);
+    raw[5] = sim_replay_quantize(-values[5]);
+}
+
+/*******************************************************************************
+* Function Name: sim_replay_load_windows
+********************************************************************************
+* Summary:
+*   Splits the recordings of train/gesture_data in labeled windows, for the
+*   host tools that classify them all. The classes are in model output order.
+*
+* Parameters:
+*     source: folder with one sub-folder of recordings per class, or @ and a
+*             file listing one recording per line, in a folder named after its
+*             class
+*     windows: windows read, zero-initialized by the caller
+*
+* Return:
+*   false if no window could be read, the reason is printed.
+*******************************************************************************/
+bool sim_replay_load_windows(const char *source, sim_replay_windows_t *windows)
+{
+    if ('@' == source[0])
+    {
+        return sim_replay_load_list(&source[1], windows);
+    }
+
+#if defined(__ARM_ARCH)
+    /* Semihosting cannot list a folder */
+    fprintf(stderr, "Pass the recordings as @list\n");
+    return false;
+#else
+    return sim_replay_load_folder(source, windows);
+#endif
+}
+
+/*******************************************************************************
+* Function Name: mtb_bmi160_init_i2c
+********************************************************************************
+* Summary:
+*   Nothing to initialize, the recording is loaded by cybsp_init.
+*
+*******************************************************************************/
+cy_rslt_t mtb_bmi160_init_i2c(mtb_bmi160_t *obj, cyhal_i2c_t *inst, uint8_t address)
+{
+    (void)inst;
+    (void)address;
+
+    memset(obj, 0, sizeof(*obj));
+
+    return (0 == sim_replay_count) ? SIM_REPLAY_RSLT_NO_DATA : CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: mtb_bmi160_config_default
+*******************************************************************************/
+cy_rslt_t mtb_bmi160_config_default(mtb_bmi160_t *obj)
+{
+    (void)obj;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: bmi160_set_sens_conf
+*******************************************************************************/
+int8_t bmi160_set_sens_conf(struct bmi160_dev *dev)
+{
+    (void)dev;
+
+    return 0;
+}
+
+/*******************************************************************************
+* Function Name: mtb_bmi160_read
+********************************************************************************
+* Summary:
+*   Returns the next sample of the recording, and starts over at its end.
+*   Called from the sensor interrupt.
+*
+*******************************************************************************/
+cy_rslt_t mtb_bmi160_read(mtb_bmi160_t *obj, mtb_bmi160_data_t *sensor_data)
+{
+    const int16_t *sample = sim_replay_samples[sim_replay_next];
+
+    (void)obj;
+
+    sensor_data->accel.x = sample[0];
+    sensor_data->accel.y = sample[1];
+    sensor_data->accel.z = sample[2];
+    sensor_data->gyro.x = sample[3];
+    sensor_data->gyro.y = sample[4];
+    sensor_data->gyro.z = sample[5];
+
+    sim_replay_next = (sim_replay_next + 1u) % sim_replay_count;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: sim_replay_quantize
+********************************************************************************
+* Summary:
+*   Scales a normalized value to the int16 range of the sensor.
+*
+*******************************************************************************/
+static int16_t sim_replay_quantize(float value)
+{
+    float scaled = roundf(value * SIM_REPLAY_RANGE);
+
+    if (scaled > 32767.0f)
+    {
+        return INT16_MAX;
+    }
+    if (scaled < -32768.0f)
+    {
+        return INT16_MIN;
+    }
+    return (int16_t)scaled;
+}
+
+#if !defined(__ARM_ARCH)
+/*******************************************************************************
+* Function Name: sim_replay_load_folder
+********************************************************************************
+* Summary:
+*   Reads the recordings of each class folder. The classes are in model output
+*   order: sorted by name, with the negative class last, as in
+*   train/replay_data.py.
+*
+* Parameters:
+*     folder: folder with one sub-folder of recordings per class
+*     windows: windows read
+*
+* Return:
+*   false if no window could be read.
+*******************************************************************************/
+static bool sim_replay_load_folder(const char *folder, sim_replay_windows_t *windows)
+{
+    static char files[SIM_REPLAY_MAX_FILES][SIM_REPLAY_NAME_SIZE];
+    char path[4u * SIM_REPLAY_NAME_SIZE];
+
+    windows->num_classes = sim_replay_list(folder, true, windows->classes);
+    sim_replay_order_classes(windows);
+
+    for (uint32_t label = 0; label < windows->num_classes; label++)
+    {
+        uint32_t count;
+
+        if (snprintf(path, sizeof(path), "%s/%s", folder, windows->classes[label]) >= (int)sizeof(path))
+        {
+            continue;
+        }
+        count = sim_replay_list(path, false, files);
+        for (uint32_t i = 0; i < count; i++)
+        {
+            if ((snprintf(path, sizeof(path), "%s/%s/%s", folder, windows->classes[label], files[i]) >= (int)sizeof(path)) ||
+                !sim_replay_read_recording(path, (uint8_t)label, windows))
+            {
+                fprintf(stderr, "Cannot read %s\n", path);
+                return false;
+            }
+        }
+    }
+
+    if (0 == windows->count)
+    {
+        fprintf(stderr, "No recording found in %s\n", folder);
+        return false;
+    }
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: sim_replay_list
+********************************************************************************
+* Summary:
+*   Lists the sub-folders or the files of a folder, sorted by name.
+*
+* Parameters:
+*     path: folder to list
+*     folders: true to list the sub-folders, false for the files
+*     names: names found, SIM_REPLAY_MAX_CLASSES for folders,
+*            SIM_REPLAY_MAX_FILES for files
+*
+* Return:
+*   The number of names.
+*******************************************************************************/
+static uint32_t sim_replay_list(const char *path, bool folders, char (*names)[SIM_REPLAY_NAME_SIZE])
+{
+    uint32_t limit = folders ? SIM_REPLAY_MAX_CLASSES : SIM_REPLAY_MAX_FILES;
+    uint32_t count = 0;
+    struct dirent *entry;
+    DIR *dir;
+
+    dir = opendir(path);
+    if (NULL == dir)
+    {
+        return 0;
+    }
+
+    while ((NULL != (entry = readdir(dir))) && (count < limit))
+    {
+        if (('.' == entry->d_name[0]) || (folders != (DT_DIR == entry->d_type)))
+        {
+            continue;
+        }
+        snprintf(names[count], SIM_REPLAY_NAME_SIZE, "%s", entry->d_name);
+        count++;
+    }
+    closedir(dir);
+
+    qsort(names, count, SIM_REPLAY_NAME_SIZE, sim_replay_compare_names);
+
+    return count;
+}
+#endif /* #if !defined(__ARM_ARCH) */
+
+/*******************************************************************************
+* Function Name: sim_replay_load_list
+********************************************************************************
+* Summary:
+*   Reads the recordings named in a list file, one path per line. The class of
+*   a recording is the name of its folder. Used where the folders cannot be
+*   listed, as with semihosting.
+*
+* Parameters:
+*     list: file with the paths of the recordings
+*     windows: windows read
+*
+* Return:
+*   false if no window could be read.
+*******************************************************************************/
+static bool sim_replay_load_list(const char *list, sim_replay_windows_t *windows)
+{
+    char line[SIM_REPLAY_LINE_SIZE];
+    char *name;
+    FILE *file;
+    bool success = true;
+
+    file = fopen(list, "r");
+    if (NULL == file)
+    {
+        fprintf(stderr, "Cannot read %s\n", list);
+        return false;
+    }
+
+    /* First the classes, to label the recordings in model output order */
+    for (int pass = 0; (pass < 2) && success; pass++)
+    {
+        rewind(file);
+        while (success && (NULL != fgets(line, sizeof(line), file)))
+        {
+            line[strcspn(line, "\r\n")] = '\0';
+            name = strrchr(line, '/');
+            if (NULL == name)
+            {
+                continue;
+            }
+
+            /* Cut the path to the folder name */
+            *name = '\0';
+            name = strrchr(line, '/');
+            name = (NULL == name) ? line : (name + 1);
+
+            if (0 == pass)
+            {
+                if ((sim_replay_find_class(name, windows) < 0) && (windows->num_classes < SIM_REPLAY_MAX_CLASSES))
+                {
+                    snprintf(windows->classes[windows->num_classes++], SIM_REPLAY_NAME_SIZE, "%s", name);
+                }
+            }
+            else
+            {
+                int label = sim_replay_find_class(name, windows);
+
+                /* Put the path back together */
+                line[strlen(line)] = '/';
+                if ((label < 0) || !sim_replay_read_recording(line, (uint8_t)label, windows))
+                {
+                    fprintf(stderr, "Cannot read %s\n", line);
+                    success = false;
+                }
+            }
+        }
+
+        if (0 == pass)
+        {
+            sim_replay_order_classes(windows);
+        }
+    }
+    fclose(file);
+
+    if (success && (0 == windows->count))
+    {
+        fprintf(stderr, "No recording found in %s\n", list);
+        success = false;
+    }
+
+    return success;
+}
+
+/*******************************************************************************
+* Function Name: sim_replay_find_class
+********************************************************************************
+* Return:
+*   The label of a class, -1 if it is not known.
+*******************************************************************************/
+static int sim_replay_find_class(const char *name, const sim_replay_windows_t *windows)
+{
+    for (uint32_t i = 0; i < windows->num_classes; i++)
+    {
+        if (0 == strcmp(windows->classes[i], name))
+        {
+            return (int)i;
+        }
+    }
+
+    return -1;
+}
+
+/*******************************************************************************
+* Function Name: sim_replay_order_classes
+********************************************************************************
+* Summary:
+*   Puts the classes in model output order: sorted by name, with the negative
+*   class last, as in train/replay_data.py.
+*
+*******************************************************************************/
+static void sim_replay_order_classes(sim_replay_windows_t *windows)
+{
+    qsort(windows->classes, windows->num_classes, SIM_REPLAY_NAME_SIZE, sim_replay_compare_names);
+
+    for (uint32_t i = 0; i + 1u < windows->num_classes; i++)
+    {
+        if (0 == strcmp(windows->classes[i], SIM_REPLAY_NEGATIVE_CLASS))
+        {
+            memmove(windows->classes[i], windows->classes[i + 1u], (windows->num_classes - i - 1u) * SIM_REPLAY_NAME_SIZE);
+            strcpy(windows->classes[windows->num_classes - 1u], SIM_REPLAY_NEGATIVE_CLASS);
+            break;
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: sim_replay_compare_names
+*******************************************************************************/
+static int sim_replay_compare_names(const void *a, const void *b)
+{
+    return strcmp((const char *)a, (const char *)b);
+}
+
+/*******************************************************************************
+* Function Name: sim_replay_read_recording
+********************************************************************************
+* Summary:
+*   Splits a recording in windows of SENSOR_BATCH_SIZE samples. Each block
+*   between two separators is a continuous capture; a partial window at the
+*   end of a block is dropped, as in train/replay_data.py.
+*
+* Parameters:
+*     path: TXT recording written by collect.py
+*     label: class of the recording
+*     windows: windows read
+*
+* Return:
+*   false if the file cannot be read.
+*******************************************************************************/
+static bool sim_replay_read_recording(const char *path, uint8_t label, sim_replay_windows_t *windows)
+{
+    char line[SIM_REPLAY_LINE_SIZE];
+    float samples[SIM_REPLAY_WINDOW_VALUES];
+    uint32_t length = 0;
+    FILE *file;
+
+    file = fopen(path, "r");
+    if (NULL == file)
+    {
+        return false;
+    }
+
+    while (NULL != fgets(line, sizeof(line), file))
+    {
+        if (!sim_replay_parse_line(line, &samples[length * SIM_REPLAY_NUM_AXIS]))
+        {
+            /* A separator starts a new block, blank lines are skipped */
+            if ('-' == line[0])
+            {
+                length = 0;
+            }
+            continue;
+        }
+
+        length++;
+        if (SENSOR_BATCH_SIZE == length)
+        {
+            if (!sim_replay_add_window(samples, label, windows))
+            {
+                fclose(file);
+                return false;
+            }
+            length = 0;
+        }
+    }
+
+    fclose(file);
+    windows->recordings++;
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: sim_replay_add_window
+*******************************************************************************/
+static bool sim_replay_add_window(const float *samples, uint8_t label, sim_replay_windows_t *windows)
+{
+    uint32_t i = windows->count;
+
+    if (windows->count == windows->capacity)
+    {
+        windows->capacity = (0 == windows->capacity) ? 256u : (2u * windows->capacity);
+        windows->recorded = realloc(windows->recorded, windows->capacity * sizeof(windows->recorded[0]));
+        windows->labels = realloc(windows->labels, windows->capacity * sizeof(windows->labels[0]));
+        if ((NULL == windows->recorded) || (NULL == windows->labels))
+        {
+            return false;
+        }
+    }
+
+    memcpy(windows->recorded[i], samples, sizeof(windows->recorded[0]));
+    windows->labels[i] = label;
+    windows->count++;
+
+    return true;
+}
@@ -0,0 +1,89 @@
+/******************************************************************************
+* File Name:   sim_replay.h
+*
+* Description: This file contains the function prototypes and constants used
+*   in sim_replay.c.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2021-2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef SIM_REPLAY_H
+#define SIM_REPLAY_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "cy_result.h"
+#include "sensor.h"
+
+/******************************************************************************
+ * Constants
+ *****************************************************************************/
+#define SIM_REPLAY_NUM_AXIS     6u
+
+#define SIM_REPLAY_WINDOW_VALUES (SENSOR_BATCH_SIZE * SIM_REPLAY_NUM_AXIS)
+#define SIM_REPLAY_MAX_CLASSES  16u
+#define SIM_REPLAY_NAME_SIZE    256u
+
+/* Same scale as the min max normalization of the pre-processing */
+#define SIM_REPLAY_RANGE        32768.0f
+
+#define SIM_REPLAY_RSLT_NO_DATA CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_MIDDLEWARE_BASE, 0x2Cu)
+
+/******************************************************************************
+ * Typedefs
+ *****************************************************************************/
+/* Windows of the recordings */
+typedef struct
+{
+    uint32_t count;
+    uint32_t capacity;
+    uint32_t recordings;
+    float (*recorded)[SIM_REPLAY_WINDOW_VALUES];    /* As pre-processed on the kit */
+    uint8_t *labels;
+    uint32_t num_classes;
+    char classes[SIM_REPLAY_MAX_CLASSES][SIM_REPLAY_NAME_SIZE];
+} sim_replay_windows_t;
+
+/*******************************************************************************
+* Functions
+*******************************************************************************/
+cy_rslt_t sim_replay_open(const char *path);
+uint32_t sim_replay_get_count(void);
+bool sim_replay_parse_line(const char *line, float *values);
+void sim_replay_to_raw(const float *values, int16_t *raw);
+bool sim_replay_load_windows(const char *source, sim_replay_windows_t *windows);
+
+#endif /* SIM_REPLAY_H */
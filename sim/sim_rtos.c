@@ -0,0 +1,159 @@
+/******************************************************************************
+* File Name:   sim_rtos.c
+*
+* Description: This file contains the event and mutex functions of the
+*              RTOS abstraction used by sensor.c and stream.c, on FreeRTOS
+*              event groups and mutexes like the abstraction-rtos library on
+*              the target.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2021-2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "cyabs_rtos.h"
+
+#include "FreeRTOS.h"
+#include "event_groups.h"
+#include "semphr.h"
+
+/*******************************************************************************
+* Function Name: cy_rtos_init_event
+*******************************************************************************/
+cy_rslt_t cy_rtos_init_event(cy_event_t *event)
+{
+    *event = xEventGroupCreate();
+
+    return (NULL == *event) ? CY_RTOS_NO_MEMORY : CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: cy_rtos_setbits_event
+********************************************************************************
+* Summary:
+*   Sets bits of an event. From an interrupt, the bits are set by the timer
+*   daemon task, as on the target.
+*
+*******************************************************************************/
+cy_rslt_t cy_rtos_setbits_event(cy_event_t *event, uint32_t bits, bool in_isr)
+{
+    if (in_isr)
+    {
+        BaseType_t higher_priority_task_woken = pdFALSE;
+
+        if (pdPASS != xEventGroupSetBitsFromISR(*event, (EventBits_t)bits, &higher_priority_task_woken))
+        {
+            return CY_RTOS_NO_MEMORY;
+        }
+        portYIELD_FROM_ISR(higher_priority_task_woken);
+    }
+    else
+    {
+        xEventGroupSetBits(*event, (EventBits_t)bits);
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: cy_rtos_waitbits_event
+********************************************************************************
+* Summary:
+*   Waits for bits of an event.
+*
+* Parameters:
+*   event: Event to wait on
+*   bits: Bits to wait for, set to the bits of the event on return
+*   clear: Clear the bits waited for on return
+*   all: Wait for all the bits, instead of any
+*   timeout: Time to wait in ms, CY_RTOS_NEVER_TIMEOUT to wait forever
+*
+* Return:
+*   CY_RTOS_TIMEOUT if the bits were not set in time.
+*******************************************************************************/
+cy_rslt_t cy_rtos_waitbits_event(cy_event_t *event, uint32_t *bits, bool clear, bool all, uint32_t timeout)
+{
+    EventBits_t wait_for = (EventBits_t)*bits;
+    TickType_t ticks = (CY_RTOS_NEVER_TIMEOUT == timeout) ? portMAX_DELAY : pdMS_TO_TICKS(timeout);
+    EventBits_t set;
+
+    set = xEventGroupWaitBits(*event, wait_for, clear ? pdTRUE : pdFALSE, all ? pdTRUE : pdFALSE, ticks);
+    *bits = (uint32_t)set;
+
+    if ((all && ((set & wait_for) != wait_for)) || (!all && (0 == (set & wait_for))))
+    {
+        return CY_RTOS_TIMEOUT;
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: cy_rtos_init_mutex
+*******************************************************************************/
+cy_rslt_t cy_rtos_init_mutex(cy_mutex_t *mutex)
+{
+    *mutex = xSemaphoreCreateMutex();
+
+    return (NULL == *mutex) ? CY_RTOS_NO_MEMORY : CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: cy_rtos_get_mutex
+********************************************************************************
+* Summary:
+*   Takes a mutex.
+*
+* Parameters:
+*   mutex: Mutex to take
+*   timeout: Time to wait in ms, CY_RTOS_NEVER_TIMEOUT to wait forever
+*
+* Return:
+*   CY_RTOS_TIMEOUT if the mutex was not taken in time.
+*******************************************************************************/
+cy_rslt_t cy_rtos_get_mutex(cy_mutex_t *mutex, uint32_t timeout)
+{
+    TickType_t ticks = (CY_RTOS_NEVER_TIMEOUT == timeout) ? portMAX_DELAY : pdMS_TO_TICKS(timeout);
+
+    return (pdTRUE == xSemaphoreTake(*mutex, ticks)) ? CY_RSLT_SUCCESS : CY_RTOS_TIMEOUT;
+}
+
+/*******************************************************************************
+* Function Name: cy_rtos_set_mutex
+*******************************************************************************/
+cy_rslt_t cy_rtos_set_mutex(cy_mutex_t *mutex)
+{
+    xSemaphoreGive(*mutex);
+
+    return CY_RSLT_SUCCESS;
+}
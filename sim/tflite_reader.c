@@ -0,0 +1,574 @@
+/******************************************************************************
+* File Name:   tflite_reader.c
+*
+* Description: This file contains a reader of the TensorFlow Lite models of
+*              mtb_ml_gen/model_gen_dir, for the host tools. It loads the
+*              file and decodes the tensors and operators of its first
+*              subgraph from the flatbuffer, without the TensorFlow Lite
+*              library. The constant data stays in the loaded file.
+*
+*              Every offset of the flatbuffer is checked against the size of
+*              the file; a bad offset makes the whole model invalid.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2021-2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "tflite_reader.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*******************************************************************************
+* Constants
+*******************************************************************************/
+/* Version of the schema, checked as by TensorFlow Lite Micro. The file
+ * identifier is optional, the packed models of the ML middleware have none. */
+#define TFLITE_READER_VERSION           3
+
+/* Fields of the tables of the schema, in declaration order */
+#define TFLITE_MODEL_VERSION            0u
+#define TFLITE_MODEL_OPERATOR_CODES     1u
+#define TFLITE_MODEL_SUBGRAPHS          2u
+#define TFLITE_MODEL_BUFFERS            4u
+
+#define TFLITE_CODE_DEPRECATED_BUILTIN  0u
+#define TFLITE_CODE_BUILTIN             3u
+
+#define TFLITE_SUBGRAPH_TENSORS         0u
+#define TFLITE_SUBGRAPH_INPUTS          1u
+#define TFLITE_SUBGRAPH_OUTPUTS         2u
+#define TFLITE_SUBGRAPH_OPERATORS       3u
+
+#define TFLITE_TENSOR_SHAPE             0u
+#define TFLITE_TENSOR_TYPE              1u
+#define TFLITE_TENSOR_BUFFER            2u
+#define TFLITE_TENSOR_NAME              3u
+
+#define TFLITE_OPERATOR_OPCODE_INDEX    0u
+#define TFLITE_OPERATOR_INPUTS          1u
+#define TFLITE_OPERATOR_OUTPUTS         2u
+#define TFLITE_OPERATOR_OPTIONS         4u
+
+#define TFLITE_BUFFER_DATA              0u
+#define TFLITE_BUFFER_OFFSET            1u
+#define TFLITE_BUFFER_SIZE              2u
+
+/*******************************************************************************
+* Local Functions
+*******************************************************************************/
+static bool tflite_reader_load(tflite_reader_t *reader, const char *path);
+static uint32_t tflite_reader_read(tflite_reader_t *reader, size_t offset, uint32_t bytes);
+static size_t tflite_reader_field(tflite_reader_t *reader, size_t table, uint32_t field);
+static int32_t tflite_reader_get_scalar(tflite_reader_t *reader, size_t table, uint32_t field, uint32_t bytes,
+                                        int32_t value);
+static size_t tflite_reader_get_table(tflite_reader_t *reader, size_t table, uint32_t field);
+static size_t tflite_reader_get_vector(tflite_reader_t *reader, size_t table, uint32_t field, uint32_t width,
+                                       uint32_t *length);
+static void tflite_reader_get_tensor(tflite_reader_t *reader, size_t table, size_t buffers, uint32_t num_buffers,
+                                     tflite_tensor_t *tensor);
+static void tflite_reader_get_options(tflite_reader_t *reader, size_t table, tflite_operator_t *op);
+static uint32_t tflite_reader_get_indices(tflite_reader_t *reader, size_t table, uint32_t field, int32_t *indices,
+                                          uint32_t limit);
+
+/*******************************************************************************
+* Function Name: tflite_reader_open
+********************************************************************************
+* Summary:
+*   Loads a model and decodes its first subgraph.
+*
+* Parameters:
+*     reader: model read, released with tflite_reader_close
+*     path: .tflite file
+*
+* Return:
+*   TFLITE_READER_RSLT_ERR_FORMAT if the file cannot be read or is not a
+*   valid model.
+*******************************************************************************/
+cy_rslt_t tflite_reader_open(tflite_reader_t *reader, const char *path)
+{
+    size_t model;
+    size_t subgraph;
+    size_t codes;
+    size_t buffers;
+    size_t tensors;
+    size_t operators;
+    uint32_t num_codes;
+    uint32_t num_buffers;
+    uint32_t num_subgraphs;
+    int32_t index;
+
+    memset(reader, 0, sizeof(*reader));
+
+    if (!tflite_reader_load(reader, path))
+    {
+        tflite_reader_close(reader);
+        return TFLITE_READER_RSLT_ERR_FORMAT;
+    }
+
+    model = tflite_reader_read(reader, 0u, 4u);
+    if (TFLITE_READER_VERSION != tflite_reader_get_scalar(reader, model, TFLITE_MODEL_VERSION, 4u, 0))
+    {
+        reader->error = true;
+    }
+    codes = tflite_reader_get_vector(reader, model, TFLITE_MODEL_OPERATOR_CODES, 4u, &num_codes);
+    buffers = tflite_reader_get_vector(reader, model, TFLITE_MODEL_BUFFERS, 4u, &num_buffers);
+    subgraph = tflite_reader_get_vector(reader, model, TFLITE_MODEL_SUBGRAPHS, 4u, &num_subgraphs);
+    if (reader->error || (0u == num_subgraphs))
+    {
+        tflite_reader_close(reader);
+        return TFLITE_READER_RSLT_ERR_FORMAT;
+    }
+    subgraph += tflite_reader_read(reader, subgraph, 4u);
+
+    tensors = tflite_reader_get_vector(reader, subgraph, TFLITE_SUBGRAPH_TENSORS, 4u, &reader->num_tensors);
+    operators = tflite_reader_get_vector(reader, subgraph, TFLITE_SUBGRAPH_OPERATORS, 4u, &reader->num_operators);
+    reader->tensors = calloc(reader->num_tensors + 1u, sizeof(reader->tensors[0]));
+    reader->operators = calloc(reader->num_operators + 1u, sizeof(reader->operators[0]));
+    if ((NULL == reader->tensors) || (NULL == reader->operators))
+    {
+        tflite_reader_close(reader);
+        return TFLITE_READER_RSLT_ERR_FORMAT;
+    }
+
+    for (uint32_t i = 0; (i < reader->num_tensors) && !reader->error; i++)
+    {
+        size_t position = tensors + 4u * i;
+        tflite_reader_get_tensor(reader, position + tflite_reader_read(reader, position, 4u), buffers, num_buffers,
+                                 &reader->tensors[i]);
+    }
+
+    for (uint32_t i = 0; (i < reader->num_operators) && !reader->error; i++)
+    {
+        tflite_operator_t *op = &reader->operators[i];
+        size_t table = operators + 4u * i;
+        size_t code;
+
+        table += tflite_reader_read(reader, table, 4u);
+
+        index = tflite_reader_get_scalar(reader, table, TFLITE_OPERATOR_OPCODE_INDEX, 4u, 0);
+        if ((index < 0) || ((uint32_t)index >= num_codes))
+        {
+            reader->error = true;
+            break;
+        }
+
+        /* The builtin code is in the deprecated field below 127 */
+        code = codes + 4u * (uint32_t)index;
+        code += tflite_reader_read(reader, code, 4u);
+        op->code = tflite_reader_get_scalar(reader, code, TFLITE_CODE_BUILTIN, 4u, 0);
+        index = tflite_reader_get_scalar(reader, code, TFLITE_CODE_DEPRECATED_BUILTIN, 1u, 0);
+        if (index > op->code)
+        {
+            op->code = index;
+        }
+
+        op->num_inputs = tflite_reader_get_indices(reader, table, TFLITE_OPERATOR_INPUTS, op->inputs,
+                                                   TFLITE_READER_MAX_INPUTS);
+        op->num_outputs = tflite_reader_get_indices(reader, table, TFLITE_OPERATOR_OUTPUTS, op->outputs,
+                                                    TFLITE_READER_MAX_OUTPUTS);
+        tflite_reader_get_options(reader, tflite_reader_get_table(reader, table, TFLITE_OPERATOR_OPTIONS), op);
+    }
+
+    /* The tools run models of one input and one output */
+    if ((1u != tflite_reader_get_indices(reader, subgraph, TFLITE_SUBGRAPH_INPUTS, &reader->input, 1u)) ||
+        (1u != tflite_reader_get_indices(reader, subgraph, TFLITE_SUBGRAPH_OUTPUTS, &reader->output, 1u)) ||
+        reader->error)
+    {
+        tflite_reader_close(reader);
+        return TFLITE_READER_RSLT_ERR_FORMAT;
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: tflite_reader_close
+********************************************************************************
+* Summary:
+*   Releases a model. The tensors and their data are no longer valid.
+*
+*******************************************************************************/
+void tflite_reader_close(tflite_reader_t *reader)
+{
+    free(reader->operators);
+    free(reader->tensors);
+    free(reader->file);
+    memset(reader, 0, sizeof(*reader));
+}
+
+/*******************************************************************************
+* Function Name: tflite_reader_load
+********************************************************************************
+* Summary:
+*   Reads a whole file.
+*
+*******************************************************************************/
+static bool tflite_reader_load(tflite_reader_t *reader, const char *path)
+{
+    FILE *file;
+    long size;
+
+    file = fopen(path, "rb");
+    if (NULL == file)
+    {
+        return false;
+    }
+
+    if ((0 == fseek(file, 0, SEEK_END)) && ((size = ftell(file)) > 8) && (0 == fseek(file, 0, SEEK_SET)))
+    {
+        /* One more byte, so a string at the end is terminated */
+        reader->file = calloc((size_t)size + 1u, 1u);
+        if ((NULL != reader->file) && (1u == fread(reader->file, (size_t)size, 1u, file)))
+        {
+            reader->size = (size_t)size;
+        }
+    }
+    fclose(file);
+
+    return (0u != reader->size);
+}
+
+/*******************************************************************************
+* Function Name: tflite_reader_read
+********************************************************************************
+* Summary:
+*   Reads a little endian value of 1, 2 or 4 bytes. Out of the file, sets the
+*   error of the reader and returns 0.
+*
+*******************************************************************************/
+static uint32_t tflite_reader_read(tflite_reader_t *reader, size_t offset, uint32_t bytes)
+{
+    uint32_t value = 0;
+
+    if ((offset > reader->size) || (bytes > (reader->size - offset)))
+    {
+        reader->error = true;
+        return 0;
+    }
+
+    for (uint32_t i = bytes; i > 0u; i--)
+    {
+        value = (value << 8) | reader->file[offset + i - 1u];
+    }
+
+    return value;
+}
+
+/*******************************************************************************
+* Function Name: tflite_reader_field
+********************************************************************************
+* Summary:
+*   Finds a field of a table through its vtable.
+*
+* Parameters:
+*     reader: model
+*     table: offset of the table in the file
+*     field: index of the field in the table of the schema
+*
+* Return:
+*   The offset of the field in the file, 0 if it is absent.
+*******************************************************************************/
+static size_t tflite_reader_field(tflite_reader_t *reader, size_t table, uint32_t field)
+{
+    int32_t relative = (int32_t)tflite_reader_read(reader, table, 4u);
+    size_t vtable = table - (size_t)(ptrdiff_t)relative;
+    uint32_t position;
+
+    if (reader->error || (0u == table) || (vtable > reader->size))
+    {
+        reader->error = true;
+        return 0;
+    }
+
+    if ((4u + 2u * field) >= tflite_reader_read(reader, vtable, 2u))
+    {
+        return 0;
+    }
+
+    position = tflite_reader_read(reader, vtable + 4u + 2u * field, 2u);
+
+    return (0u == position) ? 0u : (table + position);
+}
+
+/*******************************************************************************
+* Function Name: tflite_reader_get_scalar
+********************************************************************************
+* Summary:
+*   Reads an integer field of 1, 2 or 4 bytes, or its default value.
+*
+*******************************************************************************/
+static int32_t tflite_reader_get_scalar(tflite_reader_t *reader, size_t table, uint32_t field, uint32_t bytes,
+                                        int32_t value)
+{
+    size_t position = tflite_reader_field(reader, table, field);
+
+    if (0u != position)
+    {
+        uint32_t read = tflite_reader_read(reader, position, bytes);
+
+        /* Sign extension of the smaller fields */
+        uint32_t shift = 32u - 8u * bytes;
+        value = (int32_t)(read << shift) >> shift;
+    }
+
+    return value;
+}
+
+/*******************************************************************************
+* Function Name: tflite_reader_get_table
+********************************************************************************
+* Return:
+*   The offset of the table referenced by a field, 0 if it is absent.
+*******************************************************************************/
+static size_t tflite_reader_get_table(tflite_reader_t *reader, size_t table, uint32_t field)
+{
+    size_t position = tflite_reader_field(reader, table, field);
+
+    return (0u == position) ? 0u : (position + tflite_reader_read(reader, position, 4u));
+}
+
+/*******************************************************************************
+* Function Name: tflite_reader_get_vector
+********************************************************************************
+* Summary:
+*   Finds the elements of a vector field, and checks that they are in the
+*   file.
+*
+* Parameters:
+*     reader: model
+*     table: offset of the table in the file
+*     field: index of the vector in the table of the schema
+*     width: bytes of an element
+*     length: number of elements, 0 if the vector is absent
+*
+* Return:
+*   The offset of the first element in the file.
+*******************************************************************************/
+static size_t tflite_reader_get_vector(tflite_reader_t *reader, size_t table, uint32_t field, uint32_t width,
+                                       uint32_t *length)
+{
+    size_t vector = tflite_reader_get_table(reader, table, field);
+
+    *length = 0u;
+    if (0u == vector)
+    {
+        return 0u;
+    }
+
+    *length = tflite_reader_read(reader, vector, 4u);
+    if (reader->error || ((uint64_t)*length * width > (reader->size - vector - 4u)))
+    {
+        reader->error = true;
+        *length = 0u;
+        return 0u;
+    }
+
+    return vector + 4u;
+}
+
+/*******************************************************************************
+* Function Name: tflite_reader_get_tensor
+********************************************************************************
+* Summary:
+*   Decodes a tensor and finds its constant data. The data of a model larger
+*   than 2 GB is after the flatbuffer, at an offset from the start of the
+*   file.
+*
+*******************************************************************************/
+static void tflite_reader_get_tensor(tflite_reader_t *reader, size_t table, size_t buffers, uint32_t num_buffers,
+                                     tflite_tensor_t *tensor)
+{
+    uint32_t length;
+    size_t shape;
+    size_t name;
+    int32_t index;
+
+    shape = tflite_reader_get_vector(reader, table, TFLITE_TENSOR_SHAPE, 4u, &length);
+    if (length > TFLITE_READER_MAX_DIMS)
+    {
+        reader->error = true;
+        return;
+    }
+    tensor->num_dims = length;
+    for (uint32_t i = 0; i < length; i++)
+    {
+        tensor->dims[i] = (int32_t)tflite_reader_read(reader, shape + 4u * i, 4u);
+    }
+
+    tensor->type = (uint8_t)tflite_reader_get_scalar(reader, table, TFLITE_TENSOR_TYPE, 1u, 0);
+
+    name = tflite_reader_get_vector(reader, table, TFLITE_TENSOR_NAME, 1u, &length);
+    tensor->name = (0u == name) ? "" : (const char *)&reader->file[name];
+
+    /* Buffer 0 is the empty buffer of the activations */
+    index = tflite_reader_get_scalar(reader, table, TFLITE_TENSOR_BUFFER, 4u, 0);
+    if ((index <= 0) || ((uint32_t)index >= num_buffers))
+    {
+        return;
+    }
+
+    size_t buffer = buffers + 4u * (uint32_t)index;
+    buffer += tflite_reader_read(reader, buffer, 4u);
+
+    size_t data = tflite_reader_get_vector(reader, buffer, TFLITE_BUFFER_DATA, 1u, &length);
+    if (0u == length)
+    {
+        size_t offset = tflite_reader_field(reader, buffer, TFLITE_BUFFER_OFFSET);
+        size_t size = tflite_reader_field(reader, buffer, TFLITE_BUFFER_SIZE);
+
+        if ((0u == offset) || (0u == size))
+        {
+            return;
+        }
+
+        /* Only the low words, a loaded file is smaller than 4 GB */
+        data = tflite_reader_read(reader, offset, 4u);
+        length = tflite_reader_read(reader, size, 4u);
+        if ((0u != tflite_reader_read(reader, offset + 4u, 4u)) || (0u != tflite_reader_read(reader, size + 4u, 4u)) ||
+            (data > reader->size) || (length > (reader->size - data)))
+        {
+            reader->error = true;
+            return;
+        }
+    }
+
+    tensor->data = &reader->file[data];
+    tensor->size = length;
+}
+
+/*******************************************************************************
+* Function Name: tflite_reader_get_options
+********************************************************************************
+* Summary:
+*   Decodes the options table of the supported operators.
+*
+* Parameters:
+*     reader: model
+*     table: offset of the options table, 0 if the operator has none
+*     op: operator of the options
+*
+*******************************************************************************/
+static void tflite_reader_get_options(tflite_reader_t *reader, size_t table, tflite_operator_t *op)
+{
+    tflite_options_t *options = &op->options;
+    size_t position;
+
+    options->dilation_w = 1;
+    options->dilation_h = 1;
+
+    if (0u == table)
+    {
+        return;
+    }
+
+    switch (op->code)
+    {
+        case TFLITE_OP_CONV_2D:
+            options->padding = (uint8_t)tflite_reader_get_scalar(reader, table, 0u, 1u, TFLITE_PADDING_SAME);
+            options->stride_w = tflite_reader_get_scalar(reader, table, 1u, 4u, 0);
+            options->stride_h = tflite_reader_get_scalar(reader, table, 2u, 4u, 0);
+            options->activation = (uint8_t)tflite_reader_get_scalar(reader, table, 3u, 1u, TFLITE_ACTIVATION_NONE);
+            options->dilation_w = tflite_reader_get_scalar(reader, table, 4u, 4u, 1);
+            options->dilation_h = tflite_reader_get_scalar(reader, table, 5u, 4u, 1);
+            break;
+
+        case TFLITE_OP_AVERAGE_POOL_2D:
+        case TFLITE_OP_MAX_POOL_2D:
+            options->padding = (uint8_t)tflite_reader_get_scalar(reader, table, 0u, 1u, TFLITE_PADDING_SAME);
+            options->stride_w = tflite_reader_get_scalar(reader, table, 1u, 4u, 0);
+            options->stride_h = tflite_reader_get_scalar(reader, table, 2u, 4u, 0);
+            options->filter_w = tflite_reader_get_scalar(reader, table, 3u, 4u, 0);
+            options->filter_h = tflite_reader_get_scalar(reader, table, 4u, 4u, 0);
+            options->activation = (uint8_t)tflite_reader_get_scalar(reader, table, 5u, 1u, TFLITE_ACTIVATION_NONE);
+            break;
+
+        case TFLITE_OP_ADD:
+        case TFLITE_OP_MUL:
+        case TFLITE_OP_FULLY_CONNECTED:
+            options->activation = (uint8_t)tflite_reader_get_scalar(reader, table, 0u, 1u, TFLITE_ACTIVATION_NONE);
+            break;
+
+        case TFLITE_OP_MEAN:
+            options->keep_dims = (0 != tflite_reader_get_scalar(reader, table, 0u, 1u, 0));
+            break;
+
+        case TFLITE_OP_SOFTMAX:
+            position = tflite_reader_field(reader, table, 0u);
+            if (0u != position)
+            {
+                uint32_t bits = tflite_reader_read(reader, position, 4u);
+                memcpy(&options->beta, &bits, sizeof(options->beta));
+            }
+            break;
+
+        default:
+            break;
+    }
+}
+
+/*******************************************************************************
+* Function Name: tflite_reader_get_indices
+********************************************************************************
+* Summary:
+*   Reads a vector of tensor indices, and checks them against the tensors of
+*   the subgraph.
+*
+* Return:
+*   The number of indices, the error of the reader is set above the limit.
+*******************************************************************************/
+static uint32_t tflite_reader_get_indices(tflite_reader_t *reader, size_t table, uint32_t field, int32_t *indices,
+                                          uint32_t limit)
+{
+    uint32_t length;
+    size_t vector = tflite_reader_get_vector(reader, table, field, 4u, &length);
+
+    if (length > limit)
+    {
+        reader->error = true;
+        return 0u;
+    }
+
+    for (uint32_t i = 0; i < length; i++)
+    {
+        indices[i] = (int32_t)tflite_reader_read(reader, vector + 4u * i, 4u);
+        if ((indices[i] < TFLITE_READER_NO_TENSOR) || (indices[i] >= (int32_t)reader->num_tensors))
+        {
+            reader->error = true;
+        }
+    }
+
+    return length;
+}
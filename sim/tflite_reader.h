@@ -0,0 +1,145 @@
+/******************************************************************************
+* File Name:   tflite_reader.h
+*
+* Description: This file contains the function prototypes and constants used
+*   in tflite_reader.c.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2021-2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef TFLITE_READER_H
+#define TFLITE_READER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "cy_result.h"
+
+/******************************************************************************
+ * Constants
+ *****************************************************************************/
+#define TFLITE_READER_MAX_DIMS      6u
+#define TFLITE_READER_MAX_INPUTS    4u
+#define TFLITE_READER_MAX_OUTPUTS   2u
+
+/* Absent optional input of an operator, such as a bias */
+#define TFLITE_READER_NO_TENSOR     (-1)
+
+/* Builtin operator codes of the TensorFlow Lite schema */
+#define TFLITE_OP_ADD               0
+#define TFLITE_OP_AVERAGE_POOL_2D   1
+#define TFLITE_OP_CONV_2D           3
+#define TFLITE_OP_FULLY_CONNECTED   9
+#define TFLITE_OP_MAX_POOL_2D       17
+#define TFLITE_OP_MUL               18
+#define TFLITE_OP_RESHAPE           22
+#define TFLITE_OP_SOFTMAX           25
+#define TFLITE_OP_MEAN              40
+
+/* Tensor types */
+#define TFLITE_TYPE_FLOAT32         0u
+#define TFLITE_TYPE_INT32           2u
+#define TFLITE_TYPE_INT8            9u
+
+/* Padding and fused activations of the operator options */
+#define TFLITE_PADDING_SAME         0u
+#define TFLITE_PADDING_VALID        1u
+
+#define TFLITE_ACTIVATION_NONE      0u
+#define TFLITE_ACTIVATION_RELU      1u
+#define TFLITE_ACTIVATION_RELU6     3u
+
+#define TFLITE_READER_RSLT_ERR_FORMAT CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_MIDDLEWARE_BASE, 0x2Eu)
+
+/******************************************************************************
+ * Typedefs
+ *****************************************************************************/
+typedef struct
+{
+    const char *name;
+    uint8_t type;
+    uint32_t num_dims;
+    int32_t dims[TFLITE_READER_MAX_DIMS];
+    const uint8_t *data;        /* Constant data, NULL for an activation */
+    uint32_t size;              /* Bytes of data */
+} tflite_tensor_t;
+
+/* Options of the supported operators, the schema defaults if absent */
+typedef struct
+{
+    uint8_t padding;
+    uint8_t activation;
+    int32_t stride_w;
+    int32_t stride_h;
+    int32_t filter_w;
+    int32_t filter_h;
+    int32_t dilation_w;
+    int32_t dilation_h;
+    bool keep_dims;
+    float beta;
+} tflite_options_t;
+
+typedef struct
+{
+    int32_t code;
+    uint32_t num_inputs;
+    int32_t inputs[TFLITE_READER_MAX_INPUTS];
+    uint32_t num_outputs;
+    int32_t outputs[TFLITE_READER_MAX_OUTPUTS];
+    tflite_options_t options;
+} tflite_operator_t;
+
+/* First subgraph of a model, which points into the loaded file */
+typedef struct
+{
+    uint8_t *file;
+    size_t size;
+    bool error;
+    uint32_t num_tensors;
+    tflite_tensor_t *tensors;
+    uint32_t num_operators;
+    tflite_operator_t *operators;
+    int32_t input;
+    int32_t output;
+} tflite_reader_t;
+
+/*******************************************************************************
+* Functions
+*******************************************************************************/
+cy_rslt_t tflite_reader_open(tflite_reader_t *reader, const char *path);
+void tflite_reader_close(tflite_reader_t *reader);
+
+#endif /* TFLITE_READER_H */
@@ -0,0 +1,339 @@
+/******************************************************************************
+* File Name:   work_pool.c
+*
+* Description: This file contains a work-stealing pool of host threads, for
+*              the classification daemon. Each worker has a deque of items:
+*              it runs the newest item of its own deque, which is still in
+*              its cache, and when the deque is empty it steals the oldest
+*              item of another worker. Items submitted by other threads are
+*              spread over the workers in turn.
+*
+*              A deque is protected by its own mutex, so the workers only
+*              contend when one of them steals. An idle worker waits on a
+*              semaphore that counts the queued items.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2021-2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "work_pool.h"
+
+#include <errno.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*******************************************************************************
+* Local Functions
+*******************************************************************************/
+static void *work_pool_thread(void *argument);
+static void *work_pool_take(work_pool_worker_t *worker, bool newest);
+
+/*******************************************************************************
+* Function Name: work_pool_init
+********************************************************************************
+* Summary:
+*   Starts the workers of a pool.
+*
+* Parameters:
+*   pool: The pool to start
+*   num_workers: Number of threads, up to WORK_POOL_MAX_WORKERS
+*   capacity: Largest number of items queued at the same time
+*   function: Runs each submitted item
+*
+* Return:
+*   The status of the initialization.
+*******************************************************************************/
+cy_rslt_t work_pool_init(work_pool_t *pool, uint32_t num_workers, uint32_t capacity, work_pool_function_t function)
+{
+    void *workers = NULL;
+
+    if ((0 == num_workers) || (num_workers > WORK_POOL_MAX_WORKERS) || (0 == capacity))
+    {
+        return WORK_POOL_RSLT_ERR_INIT;
+    }
+
+    memset(pool, 0, sizeof(*pool));
+    if (0 != posix_memalign(&workers, WORK_POOL_CACHE_LINE, num_workers * sizeof(work_pool_worker_t)))
+    {
+        return WORK_POOL_RSLT_ERR_INIT;
+    }
+    memset(workers, 0, num_workers * sizeof(work_pool_worker_t));
+
+    pool->function = function;
+    pool->workers = workers;
+    atomic_init(&pool->next, 0);
+    atomic_init(&pool->stopping, false);
+    sem_init(&pool->available, 0, 0);
+
+    for (uint32_t i = 0; i < num_workers; i++)
+    {
+        work_pool_worker_t *worker = &pool->workers[i];
+
+        /* Any worker may hold every item, after stealing them */
+        worker->deque.items = calloc(capacity, sizeof(void *));
+        worker->deque.capacity = capacity;
+        pthread_mutex_init(&worker->deque.lock, NULL);
+        atomic_init(&worker->stats.items, 0);
+        atomic_init(&worker->stats.stolen, 0);
+        worker->pool = pool;
+        worker->index = i;
+
+        if ((NULL == worker->deque.items) ||
+            (0 != pthread_create(&worker->thread, NULL, work_pool_thread, worker)))
+        {
+            free(worker->deque.items);
+            pthread_mutex_destroy(&worker->deque.lock);
+            work_pool_deinit(pool);
+            return WORK_POOL_RSLT_ERR_INIT;
+        }
+        pool->num_workers++;
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: work_pool_submit
+********************************************************************************
+* Summary:
+*   Queues an item. A worker that submits an item queues it on its own deque,
+*   so it runs it next unless another worker steals it first. The number of
+*   queued items must not exceed the capacity of the pool.
+*
+* Parameters:
+*   pool: The pool
+*   item: Passed to the function of the pool
+*   worker: The calling worker, or WORK_POOL_EXTERNAL
+*
+*******************************************************************************/
+void work_pool_submit(work_pool_t *pool, void *item, uint32_t worker)
+{
+    work_pool_deque_t *deque;
+
+    if (worker >= pool->num_workers)
+    {
+        worker = atomic_fetch_add_explicit(&pool->next, 1, memory_order_relaxed) % pool->num_workers;
+    }
+    deque = &pool->workers[worker].deque;
+
+    pthread_mutex_lock(&deque->lock);
+    deque->items[(deque->head + deque->count) % deque->capacity] = item;
+    deque->count++;
+    pthread_mutex_unlock(&deque->lock);
+
+    sem_post(&pool->available);
+}
+
+/*******************************************************************************
+* Function Name: work_pool_yield
+********************************************************************************
+* Summary:
+*   Queues an item again after running part of it. The item goes to the
+*   oldest end of the deque of the worker, so the worker runs the items
+*   already queued first, and another worker steals this one first.
+*
+* Parameters:
+*   pool: The pool
+*   item: Passed to the function of the pool
+*   worker: The calling worker
+*
+*******************************************************************************/
+void work_pool_yield(work_pool_t *pool, void *item, uint32_t worker)
+{
+    work_pool_deque_t *deque = &pool->workers[worker].deque;
+
+    pthread_mutex_lock(&deque->lock);
+    deque->head = (deque->head + deque->capacity - 1u) % deque->capacity;
+    deque->items[deque->head] = item;
+    deque->count++;
+    pthread_mutex_unlock(&deque->lock);
+
+    sem_post(&pool->available);
+}
+
+/*******************************************************************************
+* Function Name: work_pool_get_stats
+********************************************************************************
+* Summary:
+*   Returns the counters of a worker. Can be called while the pool runs.
+*
+* Parameters:
+*   pool: The pool
+*   worker: The worker, 0 to num_workers - 1
+*   items: Stores the number of items run by the worker
+*   stolen: Stores the number of items it took from another worker
+*
+*******************************************************************************/
+void work_pool_get_stats(work_pool_t *pool, uint32_t worker, uint64_t *items, uint64_t *stolen)
+{
+    *items = atomic_load_explicit(&pool->workers[worker].stats.items, memory_order_relaxed);
+    *stolen = atomic_load_explicit(&pool->workers[worker].stats.stolen, memory_order_relaxed);
+}
+
+/*******************************************************************************
+* Function Name: work_pool_deinit
+********************************************************************************
+* Summary:
+*   Stops the workers once they finish their current item, and frees the
+*   pool. The items still queued are not run.
+*
+* Parameters:
+*   pool: The pool to stop
+*
+*******************************************************************************/
+void work_pool_deinit(work_pool_t *pool)
+{
+    atomic_store(&pool->stopping, true);
+    for (uint32_t i = 0; i < pool->num_workers; i++)
+    {
+        sem_post(&pool->available);
+    }
+
+    for (uint32_t i = 0; i < pool->num_workers; i++)
+    {
+        pthread_join(pool->workers[i].thread, NULL);
+        pthread_mutex_destroy(&pool->workers[i].deque.lock);
+        free(pool->workers[i].deque.items);
+    }
+
+    sem_destroy(&pool->available);
+    free(pool->workers);
+    pool->workers = NULL;
+    pool->num_workers = 0;
+}
+
+/*******************************************************************************
+* Function Name: work_pool_thread
+********************************************************************************
+* Summary:
+*   Loop of a worker. Each wait on the semaphore reserves one queued item, so
+*   the worker finds one in its deque or in the deque of another worker.
+*
+* Parameters:
+*   argument: The work_pool_worker_t of the thread
+*
+*******************************************************************************/
+static void *work_pool_thread(void *argument)
+{
+    work_pool_worker_t *worker = argument;
+    work_pool_t *pool = worker->pool;
+
+    for (;;)
+    {
+        void *item;
+        bool stolen = false;
+
+        if (0 != sem_wait(&pool->available))
+        {
+            if (EINTR == errno)
+            {
+                continue;
+            }
+            break;
+        }
+        if (atomic_load(&pool->stopping))
+        {
+            break;
+        }
+
+        item = work_pool_take(worker, true);
+        while (NULL == item)
+        {
+            /* Start with the next worker, so the thieves spread over the deques */
+            for (uint32_t i = 1; (i < pool->num_workers) && (NULL == item); i++)
+            {
+                item = work_pool_take(&pool->workers[(worker->index + i) % pool->num_workers], false);
+            }
+            if (NULL != item)
+            {
+                stolen = true;
+            }
+            else
+            {
+                /* Another worker took the item we scanned past, the one left
+                 * for us is in a deque already scanned */
+                sched_yield();
+                item = work_pool_take(worker, true);
+            }
+        }
+
+        atomic_fetch_add_explicit(&worker->stats.items, 1, memory_order_relaxed);
+        if (stolen)
+        {
+            atomic_fetch_add_explicit(&worker->stats.stolen, 1, memory_order_relaxed);
+        }
+
+        pool->function(item, worker->index);
+    }
+
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: work_pool_take
+********************************************************************************
+* Summary:
+*   Removes an item from the deque of a worker.
+*
+* Parameters:
+*   worker: Owner of the deque
+*   newest: Take the newest item, as the owner, instead of the oldest one
+*
+* Return:
+*   The item, or NULL if the deque is empty.
+*******************************************************************************/
+static void *work_pool_take(work_pool_worker_t *worker, bool newest)
+{
+    work_pool_deque_t *deque = &worker->deque;
+    void *item = NULL;
+
+    pthread_mutex_lock(&deque->lock);
+    if (deque->count > 0)
+    {
+        if (newest)
+        {
+            item = deque->items[(deque->head + deque->count - 1u) % deque->capacity];
+        }
+        else
+        {
+            item = deque->items[deque->head];
+            deque->head = (deque->head + 1u) % deque->capacity;
+        }
+        deque->count--;
+    }
+    pthread_mutex_unlock(&deque->lock);
+
+    return item;
+}
@@ -0,0 +1,119 @@
+/******************************************************************************
+* File Name:   work_pool.h
+*
+* Description: This file contains the function prototypes and constants used
+*   in work_pool.c.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2021-2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef WORK_POOL_H
+#define WORK_POOL_H
+
+#include <pthread.h>
+#include <semaphore.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "cy_result.h"
+
+/******************************************************************************
+ * Constants
+ *****************************************************************************/
+#define WORK_POOL_MAX_WORKERS       64u
+
+/* Size of the cache line of the host */
+#define WORK_POOL_CACHE_LINE        64u
+
+/* Worker passed to work_pool_submit() by a thread that is not a worker */
+#define WORK_POOL_EXTERNAL          UINT32_MAX
+
+#define WORK_POOL_RSLT_ERR_INIT     CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_MIDDLEWARE_BASE, 0x2Du)
+
+/******************************************************************************
+ * Typedefs
+ *****************************************************************************/
+/* Runs an item on a worker, 0 to num_workers - 1 */
+typedef void (*work_pool_function_t)(void *item, uint32_t worker);
+
+/* Items queued on a worker. The worker takes the newest one, the other
+ * workers steal the oldest one. work_pool_yield() queues an item as the
+ * oldest one. */
+typedef struct
+{
+    pthread_mutex_t lock;
+    void **items;
+    uint32_t capacity;
+    uint32_t head;              /* Oldest item */
+    uint32_t count;
+} work_pool_deque_t;
+
+typedef struct
+{
+    atomic_uint_fast64_t items;     /* Items run by the worker */
+    atomic_uint_fast64_t stolen;    /* Items taken from the deque of another worker */
+} work_pool_stats_t;
+
+/* Aligned on a cache line, so the workers do not share one */
+typedef struct
+{
+    work_pool_deque_t deque;
+    work_pool_stats_t stats;
+    pthread_t thread;
+    struct work_pool *pool;
+    uint32_t index;
+} __attribute__((aligned(WORK_POOL_CACHE_LINE))) work_pool_worker_t;
+
+typedef struct work_pool
+{
+    work_pool_function_t function;
+    uint32_t num_workers;
+    work_pool_worker_t *workers;
+    sem_t available;            /* One post per queued item */
+    atomic_uint next;           /* Worker of the next external item */
+    atomic_bool stopping;
+} work_pool_t;
+
+/*******************************************************************************
+* Functions
+*******************************************************************************/
+cy_rslt_t work_pool_init(work_pool_t *pool, uint32_t num_workers, uint32_t capacity, work_pool_function_t function);
+void work_pool_submit(work_pool_t *pool, void *item, uint32_t worker);
+void work_pool_yield(work_pool_t *pool, void *item, uint32_t worker);
+void work_pool_get_stats(work_pool_t *pool, uint32_t worker, uint64_t *items, uint64_t *stolen);
+void work_pool_deinit(work_pool_t *pool);
+
+#endif /* WORK_POOL_H */
@@ -0,0 +1,194 @@
+/******************************************************************************
+* File Name:   alloc_guard.c
+*
+* Description: This file contains the wrappers of the newlib heap functions
+*              used when STATIC_ALLOCATION is set. Every allocation, including
+*              the ones from FreeRTOS heap_3 and the C library, goes through
+*              the reentrant functions wrapped here. Allocations are allowed
+*              during init, and counted and trapped once alloc_guard_lock() is
+*              called.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2021-2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "alloc_guard.h"
+
+#include "cy_pdl.h"
+#include "cy_utils.h"
+
+#include <stdbool.h>
+#include <string.h>
+#include <reent.h>
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static alloc_guard_stats_t alloc_guard_stats;
+static volatile bool alloc_guard_locked;
+
+#if STATIC_ALLOCATION
+/*******************************************************************************
+* Local Functions
+*******************************************************************************/
+static void alloc_guard_count(size_t size);
+
+/* Original functions, renamed by the linker with --wrap */
+void *__real__malloc_r(struct _reent *reent, size_t size);
+void *__real__calloc_r(struct _reent *reent, size_t count, size_t size);
+void *__real__realloc_r(struct _reent *reent, void *pointer, size_t size);
+void __real__free_r(struct _reent *reent, void *pointer);
+
+/*******************************************************************************
+* Function Name: __wrap__malloc_r
+********************************************************************************
+* Summary:
+*   Counts the allocation and calls the newlib function.
+*
+*******************************************************************************/
+void *__wrap__malloc_r(struct _reent *reent, size_t size)
+{
+    alloc_guard_count(size);
+    return __real__malloc_r(reent, size);
+}
+
+/*******************************************************************************
+* Function Name: __wrap__calloc_r
+********************************************************************************
+* Summary:
+*   Counts the allocation and calls the newlib function.
+*
+*******************************************************************************/
+void *__wrap__calloc_r(struct _reent *reent, size_t count, size_t size)
+{
+    alloc_guard_count(count * size);
+    return __real__calloc_r(reent, count, size);
+}
+
+/*******************************************************************************
+* Function Name: __wrap__realloc_r
+********************************************************************************
+* Summary:
+*   Counts the allocation and calls the newlib function.
+*
+*******************************************************************************/
+void *__wrap__realloc_r(struct _reent *reent, void *pointer, size_t size)
+{
+    alloc_guard_count(size);
+    return __real__realloc_r(reent, pointer, size);
+}
+
+/*******************************************************************************
+* Function Name: __wrap__free_r
+********************************************************************************
+* Summary:
+*   Counts the release and calls the newlib function.
+*
+*******************************************************************************/
+void __wrap__free_r(struct _reent *reent, void *pointer)
+{
+    if (NULL != pointer)
+    {
+        uint32_t interrupt_state = Cy_SysLib_EnterCriticalSection();
+        alloc_guard_stats.frees++;
+        Cy_SysLib_ExitCriticalSection(interrupt_state);
+    }
+
+    __real__free_r(reent, pointer);
+}
+
+/*******************************************************************************
+* Function Name: alloc_guard_count
+********************************************************************************
+* Summary:
+*   Records an allocation, and traps it if the guard is locked.
+*
+* Parameters:
+*   size: Bytes requested
+*
+*******************************************************************************/
+static void alloc_guard_count(size_t size)
+{
+    uint32_t interrupt_state = Cy_SysLib_EnterCriticalSection();
+
+    alloc_guard_stats.allocs++;
+    alloc_guard_stats.bytes += size;
+    if (alloc_guard_locked)
+    {
+        alloc_guard_stats.locked_allocs++;
+    }
+
+    Cy_SysLib_ExitCriticalSection(interrupt_state);
+
+#if ALLOC_GUARD_TRAP
+    if (alloc_guard_locked)
+    {
+        /* The steady-state path must not use the heap */
+        CY_HALT();
+    }
+#endif
+}
+#endif /* #if STATIC_ALLOCATION */
+
+/*******************************************************************************
+* Function Name: alloc_guard_lock
+********************************************************************************
+* Summary:
+*   Marks the end of init. Any later heap allocation is counted in
+*   locked_allocs, and trapped if ALLOC_GUARD_TRAP is set. Does nothing when
+*   STATIC_ALLOCATION is not set.
+*
+*******************************************************************************/
+void alloc_guard_lock(void)
+{
+    alloc_guard_locked = true;
+}
+
+/*******************************************************************************
+* Function Name: alloc_guard_get_stats
+********************************************************************************
+* Summary:
+*   Returns the heap use counted since reset. All values are 0 when
+*   STATIC_ALLOCATION is not set.
+*
+* Parameters:
+*   stats: Structure to store the statistics
+*
+*******************************************************************************/
+void alloc_guard_get_stats(alloc_guard_stats_t *stats)
+{
+    uint32_t interrupt_state = Cy_SysLib_EnterCriticalSection();
+    *stats = alloc_guard_stats;
+    Cy_SysLib_ExitCriticalSection(interrupt_state);
+}
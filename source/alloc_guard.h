@@ -0,0 +1,77 @@
+/******************************************************************************
+* File Name:   alloc_guard.h
+*
+* Description: This file contains the function prototypes and constants used
+*   in alloc_guard.c.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2021-2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef ALLOC_GUARD_H
+#define ALLOC_GUARD_H
+
+#include <stdint.h>
+
+/******************************************************************************
+ * Constants
+ *****************************************************************************/
+/* Set by the Makefile when STATIC_ALLOCATION wraps the heap functions */
+#ifndef STATIC_ALLOCATION
+#define STATIC_ALLOCATION   0u
+#endif
+
+/* Define what happens on a heap allocation after alloc_guard_lock() */
+/* 0u - count it in locked_allocs */
+/* 1u - count it and halt on a breakpoint (default) */
+#define ALLOC_GUARD_TRAP    1u
+
+/******************************************************************************
+ * Typedefs
+ *****************************************************************************/
+typedef struct
+{
+    uint32_t allocs;            /* Calls to malloc, calloc and realloc */
+    uint32_t frees;             /* Calls to free */
+    uint32_t bytes;             /* Bytes requested by all allocations */
+    uint32_t locked_allocs;     /* Allocations after alloc_guard_lock() */
+} alloc_guard_stats_t;
+
+/*******************************************************************************
+* Functions
+*******************************************************************************/
+void alloc_guard_lock(void);
+void alloc_guard_get_stats(alloc_guard_stats_t *stats);
+
+#endif /* ALLOC_GUARD_H */
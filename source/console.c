@@ -0,0 +1,517 @@
+/******************************************************************************
+* File Name:   console.c
+*
+* Description: This file contains the metrics console on the debug UART. The
+*              received bytes are collected into a line by the UART interrupt,
+*              and the console task, blocked until a full line arrives, runs
+*              the command and prints the counters of the other modules.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2021-2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "console.h"
+#include "gesture.h"
+#include "output.h"
+#include "sensor.h"
+#include "pipeline.h"
+#include "schedule.h"
+#include "model_registry.h"
+#include "latency.h"
+#include "alloc_guard.h"
+#include "trace.h"
+#include "instrument.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include <stdbool.h>
+#include <string.h>
+#if defined(__GNUC__) && !defined(__ARMCC_VERSION)
+#include <malloc.h>
+#endif
+
+/*******************************************************************************
+* Typedefs
+*******************************************************************************/
+typedef struct
+{
+    const char *name;
+    void (*run)(void);
+    const char *help;
+} console_command_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Line being received, owned by the UART interrupt until console_line_ready */
+static char console_line[CONSOLE_LINE_SIZE];
+static uint32_t console_line_length;
+static volatile bool console_line_ready;
+
+/* Run time counter */
+static uint32_t console_cycles_per_us;
+static uint32_t console_run_last;
+static uint32_t console_run_cycles;
+static uint32_t console_run_time;
+
+/* Run time of each task at the previous tasks command */
+static TaskStatus_t console_tasks[CONSOLE_MAX_TASKS];
+static uint32_t console_task_numbers[CONSOLE_MAX_TASKS];
+static uint32_t console_task_times[CONSOLE_MAX_TASKS];
+static uint32_t console_task_count;
+static uint32_t console_total_time;
+
+static TaskHandle_t console_task_handle;
+
+#if STATIC_ALLOCATION
+/* Memory of the console task */
+static StackType_t console_task_stack[CONSOLE_TASK_STACK_SIZE];
+static StaticTask_t console_task_tcb;
+#endif
+
+/*******************************************************************************
+* Local Functions
+*******************************************************************************/
+static void console_task(void *arg);
+static void console_receive(uint8_t data);
+static void console_help(void);
+static void console_tasks_load(void);
+static void console_memory(void);
+static void console_counters(void);
+static void console_latency(void);
+static void console_reset(void);
+#if TRACE_ENABLE
+static void console_trace(void);
+#endif
+#if INSTRUMENT_ENABLE
+static void console_timers(void);
+#endif
+
+static const console_command_t console_commands[] =
+{
+    { "help",     console_help,       "list the commands" },
+    { "tasks",    console_tasks_load, "CPU load since the last call and free stack of each task" },
+    { "memory",   console_memory,     "heap usage and peak, output ring usage" },
+    { "counters", console_counters,   "sensor, pipeline, deadline and model counters" },
+    { "latency",  console_latency,    "latency percentiles of each stage" },
+    { "reset",    console_reset,      "clear the latency histograms and the timers" },
+#if TRACE_ENABLE
+    { "trace",    console_trace,      "send the event trace, see trace_export.py" },
+#endif
+#if INSTRUMENT_ENABLE
+    { "timers",   console_timers,     "count, min, average and max of each timer and counter" },
+#endif
+};
+
+#define CONSOLE_NUM_COMMANDS    (sizeof(console_commands) / sizeof(console_commands[0]))
+
+/*******************************************************************************
+* Function Name: console_init
+********************************************************************************
+* Summary:
+*   Creates the console task and starts receiving on the debug UART. Must be
+*   called after output_init.
+*
+* Parameters:
+*     None
+*
+* Return:
+*   The status of the initialization.
+*******************************************************************************/
+cy_rslt_t console_init(void)
+{
+#if STATIC_ALLOCATION
+    console_task_handle = xTaskCreateStatic(console_task, "Console task", CONSOLE_TASK_STACK_SIZE, NULL,
+                                            CONSOLE_TASK_PRIORITY, console_task_stack, &console_task_tcb);
+#else
+    xTaskCreate(console_task, "Console task", CONSOLE_TASK_STACK_SIZE, NULL,
+                CONSOLE_TASK_PRIORITY, &console_task_handle);
+#endif
+
+    output_set_receive(console_receive);
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: console_start_run_time
+********************************************************************************
+* Summary:
+*   Starts the run time statistics, counted with the cycle counter started by
+*   instrument_init. Called by the scheduler when it starts.
+*
+*******************************************************************************/
+void console_start_run_time(void)
+{
+    console_cycles_per_us = instrument_get_cycles_per_us();
+    console_run_last = INSTRUMENT_NOW();
+}
+
+/*******************************************************************************
+* Function Name: console_get_run_time
+********************************************************************************
+* Summary:
+*   Returns the run time counter in microseconds. Called by the scheduler on
+*   every context switch, which must happen at least once per wrap of the
+*   cycle counter: the sensor wakes the tasks SENSOR_SCAN_RATE times a second.
+*
+* Return:
+*   Microseconds since the scheduler started, wraps after about 71 minutes.
+*******************************************************************************/
+uint32_t console_get_run_time(void)
+{
+    uint32_t now = INSTRUMENT_NOW();
+    uint32_t us;
+
+    console_run_cycles += now - console_run_last;
+    console_run_last = now;
+
+    /* Keep the remainder, so no cycle is lost */
+    us = console_run_cycles / console_cycles_per_us;
+    console_run_cycles -= us * console_cycles_per_us;
+    console_run_time += us;
+
+    return console_run_time;
+}
+
+/*******************************************************************************
+* Function Name: console_receive
+********************************************************************************
+* Summary:
+*   Adds a received byte to the line, and wakes up the console task at the end
+*   of the line. Bytes are ignored while the task runs the previous command.
+*
+* Parameters:
+*   data: Byte received by the debug UART
+*
+*******************************************************************************/
+static void console_receive(uint8_t data)
+{
+    BaseType_t higher_priority_task_woken = pdFALSE;
+
+    if (console_line_ready)
+    {
+        return;
+    }
+
+    if (('\r' == data) || ('\n' == data))
+    {
+        if (console_line_length >= CONSOLE_LINE_SIZE)
+        {
+            /* Too long to be a command, drop it */
+            console_line_length = 0;
+        }
+        else if (0 != console_line_length)
+        {
+            console_line[console_line_length] = '\0';
+            console_line_ready = true;
+            vTaskNotifyGiveFromISR(console_task_handle, &higher_priority_task_woken);
+            portYIELD_FROM_ISR(higher_priority_task_woken);
+        }
+    }
+    else if (console_line_length < (CONSOLE_LINE_SIZE - 1u))
+    {
+        console_line[console_line_length++] = (char)data;
+    }
+    else
+    {
+        /* Drop the rest of the line */
+        console_line_length = CONSOLE_LINE_SIZE;
+    }
+}
+
+/*******************************************************************************
+* Function Name: console_task
+********************************************************************************
+* Summary:
+*   Runs the commands received on the debug UART. Blocked until a full line
+*   arrives, so the console costs nothing while no command is pending.
+*
+* Parameters:
+*     arg: not used
+*
+*******************************************************************************/
+static void console_task(void *arg)
+{
+    (void)arg;
+
+    for (;;)
+    {
+        uint32_t i;
+
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        for (i = 0; i < CONSOLE_NUM_COMMANDS; i++)
+        {
+            if (0 == strcmp(console_line, console_commands[i].name))
+            {
+                console_commands[i].run();
+                break;
+            }
+        }
+
+        if (i == CONSOLE_NUM_COMMANDS)
+        {
+            output_printf("\r\nUnknown command, type help\r\n");
+        }
+
+        /* Hand the line back to the UART interrupt */
+        console_line_length = 0;
+        console_line_ready = false;
+    }
+}
+
+/*******************************************************************************
+* Function Name: console_help
+********************************************************************************
+* Summary:
+*   Lists the commands.
+*
+*******************************************************************************/
+static void console_help(void)
+{
+    output_printf("\r\n");
+    for (uint32_t i = 0; i < CONSOLE_NUM_COMMANDS; i++)
+    {
+        output_printf("%-10s %s\r\n", console_commands[i].name, console_commands[i].help);
+    }
+}
+
+/*******************************************************************************
+* Function Name: console_tasks_load
+********************************************************************************
+* Summary:
+*   Prints the share of the CPU used by each task since the previous call, or
+*   since the start, and the lowest free stack it had.
+*
+*******************************************************************************/
+static void console_tasks_load(void)
+{
+    uint32_t total_time;
+    uint32_t elapsed;
+    uint32_t count;
+
+    count = (uint32_t)uxTaskGetSystemState(console_tasks, CONSOLE_MAX_TASKS, &total_time);
+    elapsed = total_time - console_total_time;
+    console_total_time = total_time;
+
+    output_printf("\r\n%-16s %4s %8s %12s\r\n", "Task", "Prio", "CPU %", "Free stack");
+    for (uint32_t i = 0; i < count; i++)
+    {
+        const TaskStatus_t *task = &console_tasks[i];
+        uint32_t run_time = (uint32_t)task->ulRunTimeCounter;
+        uint32_t previous = 0;
+        uint32_t permille = 0;
+
+        /* Run time of the task at the previous call, if it existed */
+        for (uint32_t j = 0; j < console_task_count; j++)
+        {
+            if (console_task_numbers[j] == (uint32_t)task->xTaskNumber)
+            {
+                previous = console_task_times[j];
+                break;
+            }
+        }
+
+        if (0 != elapsed)
+        {
+            permille = (uint32_t)(((uint64_t)(run_time - previous) * 1000u) / elapsed);
+        }
+
+        output_printf("%-16s %4u %6u.%u %6u words\r\n", task->pcTaskName, (unsigned)task->uxCurrentPriority,
+                      (unsigned)(permille / 10u), (unsigned)(permille % 10u), (unsigned)task->usStackHighWaterMark);
+    }
+
+    /* Remember the run time of each task for the next call */
+    for (uint32_t i = 0; i < count; i++)
+    {
+        console_task_numbers[i] = (uint32_t)console_tasks[i].xTaskNumber;
+        console_task_times[i] = (uint32_t)console_tasks[i].ulRunTimeCounter;
+    }
+    console_task_count = count;
+}
+
+/*******************************************************************************
+* Function Name: console_memory
+********************************************************************************
+* Summary:
+*   Prints the heap usage and its peak, and the usage of the output ring.
+*
+*******************************************************************************/
+static void console_memory(void)
+{
+    output_stats_t output;
+
+#if defined(__GNUC__) && !defined(__ARMCC_VERSION)
+    /* The heap only grows, so its size is the peak usage */
+    struct mallinfo heap = mallinfo();
+    output_printf("\r\nHeap: %u bytes in use, %u bytes peak\r\n", (unsigned)heap.uordblks, (unsigned)heap.arena);
+#endif
+
+#if STATIC_ALLOCATION
+    alloc_guard_stats_t guard;
+    alloc_guard_get_stats(&guard);
+    output_printf("Heap calls: %u allocs, %u frees, %u after init\r\n",
+                  (unsigned)guard.allocs, (unsigned)guard.frees, (unsigned)guard.locked_allocs);
+#endif
+
+    output_get_stats(&output);
+    output_printf("Output: %u of %u bytes peak, %u bytes dropped\r\n",
+                  (unsigned)output.peak_bytes, (unsigned)OUTPUT_RING_SIZE, (unsigned)output.dropped_bytes);
+}
+
+/*******************************************************************************
+* Function Name: console_counters
+********************************************************************************
+* Summary:
+*   Prints the counters of the sensor, the pipeline, the deadlines and the
+*   models.
+*
+*******************************************************************************/
+static void console_counters(void)
+{
+    sensor_stats_t sensor;
+    model_registry_stats_t model;
+    uint32_t cycles_per_us = instrument_get_cycles_per_us();
+
+    sensor_get_stats(&sensor);
+    output_printf("\r\nSensor: %u windows, %u overruns, %u skipped\r\n",
+                  (unsigned)sensor.windows, (unsigned)sensor.overruns, (unsigned)sensor.skipped);
+
+#if !GESTURE_DATA_COLLECTION_MODE
+    /* The pipeline only exists when the models run */
+    pipeline_stats_t pipeline;
+    schedule_stats_t schedule;
+
+    pipeline_get_stats(&pipeline);
+    schedule_get_stats(&schedule);
+
+    output_printf("Pipeline: %u windows, %u waiting, %u peak\r\n",
+                  (unsigned)pipeline.stages[PIPELINE_STAGE_ACQUIRE].windows,
+                  (unsigned)pipeline.depth, (unsigned)pipeline.peak_depth);
+    output_printf("Deadline: %u windows, %u misses, %u skipped, %u ms worst lateness\r\n",
+                  (unsigned)schedule.windows, (unsigned)schedule.misses,
+                  (unsigned)schedule.skipped, (unsigned)schedule.max_lateness_ms);
+#endif
+
+    for (int id = 0; id < model_registry_get_count(); id++)
+    {
+        uint32_t average = 0;
+
+        model_registry_get_stats(id, &model);
+        if (0 != model.runs)
+        {
+            average = (uint32_t)(model.total_cycles / model.runs);
+        }
+        output_printf("Model %s: %u runs, %u us average latency, %u us worst latency\r\n", model_registry_get_name(id),
+                      (unsigned)model.runs, (unsigned)(average / cycles_per_us),
+                      (unsigned)(model.max_cycles / cycles_per_us));
+    }
+}
+
+/*******************************************************************************
+* Function Name: console_latency
+********************************************************************************
+* Summary:
+*   Prints the percentiles of each latency stage.
+*
+*******************************************************************************/
+static void console_latency(void)
+{
+    latency_summary_t summary;
+
+    output_printf("\r\n%-12s %8s %8s %8s %8s %8s\r\n", "Stage (us)", "Count", "p50", "p90", "p99", "Max");
+    for (uint32_t stage = 0; stage < LATENCY_NUM_STAGES; stage++)
+    {
+        latency_get_summary((latency_stage_t)stage, &summary);
+        output_printf("%-12s %8u %8u %8u %8u %8u\r\n", latency_stage_name((latency_stage_t)stage),
+                      (unsigned)summary.count, (unsigned)summary.p50_us, (unsigned)summary.p90_us,
+                      (unsigned)summary.p99_us, (unsigned)summary.max_us);
+    }
+}
+
+/*******************************************************************************
+* Function Name: console_reset
+********************************************************************************
+* Summary:
+*   Clears the latency histograms, and the timers and counters.
+*
+*******************************************************************************/
+static void console_reset(void)
+{
+    latency_reset();
+#if INSTRUMENT_ENABLE
+    instrument_reset();
+#endif
+    output_printf("\r\nLatency histograms cleared\r\n");
+}
+
+#if TRACE_ENABLE
+/*******************************************************************************
+* Function Name: console_trace
+********************************************************************************
+* Summary:
+*   Sends the event trace to the host.
+*
+*******************************************************************************/
+static void console_trace(void)
+{
+    trace_dump();
+}
+#endif
+
+#if INSTRUMENT_ENABLE
+/*******************************************************************************
+* Function Name: console_timers
+********************************************************************************
+* Summary:
+*   Prints the timers, in microseconds, and the counters placed with the
+*   INSTRUMENT_* macros.
+*
+*******************************************************************************/
+static void console_timers(void)
+{
+    instrument_summary_t summary;
+
+    output_printf("\r\n%-20s %8s %10s %8s %8s %8s\r\n", "Timer (us)", "Count", "Total", "Min", "Average", "Max");
+    for (const instrument_stat_t *stat = instrument_get_next(NULL, &summary); NULL != stat;
+         stat = instrument_get_next(stat, &summary))
+    {
+        output_printf("%-20s %8u %10u %8u %8u %8u%s\r\n", summary.name, (unsigned)summary.count,
+                      (unsigned)summary.total, (unsigned)summary.min, (unsigned)summary.average,
+                      (unsigned)summary.max, summary.is_timer ? "" : " (counter)");
+    }
+}
+#endif
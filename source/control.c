@@ -41,87 +41,143 @@
 *******************************************************************************/
 #include <gesture.h>
 #include "control.h"
-#include "mtb_ml_utils.h"
 #include "gesture_names.h"
+#include "output.h"
 
+#include <stdarg.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 /*******************************************************************************
-* Constants
+* Global Variables
 *******************************************************************************/
-#define MIN_CONFIDENCE 0.60
+static const float control_thresholds[CONTROL_NUM_CLASSES] = CONTROL_THRESHOLDS;
+
+/* Number of names generated in gesture_names.h */
+#define CONTROL_NUM_NAMES (int)(sizeof(gesture_names) / sizeof(gesture_names[0]))
 
 /*******************************************************************************
-* Function Name: control
+* Function Name: control_decide
 ********************************************************************************
 * Summary:
-*   A function used to print the results from the inference engine, such as the
-*   the class and the confidence of each class.
+*   Selects the class with the highest confidence and checks it against the
+*   threshold of the class. Used for floating-point outputs, the fixed-point
+*   outputs are compared against pre-quantized thresholds in precision.c.
 *
 * Parameters:
-*     result_buffer: The result buffer from the inference engine
+*     probabilities: The output of the inference engine in floating-point
 *     model_output_size: Output size from the inference engine
-*
+*     decision: Structure to store the decision
 *
 *******************************************************************************/
-void control(MTB_ML_DATA_T* result_buffer, int model_output_size)
+void control_decide(const float* probabilities, int model_output_size, control_decision_t* decision)
 {
     /* Get the class with the highest confidence */
-    int class_index = mtb_ml_utils_find_max(result_buffer, model_output_size);
+    int class_index = 0;
+    for (int i = 1; i < model_output_size; i++)
+    {
+        if (probabilities[i] > probabilities[class_index])
+        {
+            class_index = i;
+        }
+    }
 
-#if !COMPONENT_ML_FLOAT32
-    /* Convert 16bit fixed-point output to floating-point for visualization */
-    float *nn_float_buffer = (float *) malloc(model_output_size * sizeof(float));
-    mtb_ml_utils_model_dequantize(magic_wand_obj, nn_float_buffer);
-#else
-    float *nn_float_buffer = result_buffer;
-#endif
+    decision->class_index = class_index;
+    decision->detected = (class_index < CONTROL_NUM_CLASSES) &&
+                         (control_thresholds[class_index] < probabilities[class_index]);
+    decision->confidence = probabilities[class_index];
+}
 
-    /* Clear the screen */
-    printf("\x1b[2J\x1b[;H");
+/*******************************************************************************
+* Function Name: control_append
+********************************************************************************
+* Summary:
+*   Formats text at the end of the screen being built. Text that does not fit
+*   in CONTROL_SCREEN_SIZE bytes is truncated.
+*
+* Parameters:
+*     screen: Screen being built, CONTROL_SCREEN_SIZE bytes
+*     length: Length of the screen, updated
+*     format: printf format of the text, followed by its arguments
+*
+*******************************************************************************/
+static void control_append(char* screen, uint32_t* length, const char* format, ...)
+{
+    va_list args;
+    int written;
 
-    /* Prints the confidence level of each class */
-    printf("| Gesture         | Confidence\r\n");
-    printf("--------------------------------\r\n");
-    printf("| %s:", gesture_one);
-    printf("%s %%%-3d\r\n", dash_ges_one, (int)(nn_float_buffer[0]*100 + 0.5));
-    printf("--------------------------------\r\n");
-    printf("| %s:", gesture_two);
-    printf("%s %%%-3d\r\n", dash_ges_two, (int)(nn_float_buffer[1]*100 + 0.5));
-    printf("--------------------------------\r\n");
-    printf("| %s:", gesture_three);
-    printf("%s %%%-3d\r\n", dash_ges_three, (int)(nn_float_buffer[2]*100 + 0.5));
-    printf("--------------------------------\r\n");
-    printf("| %s:", gesture_four);
-    printf("%s %%%-3d\r\n", dash_ges_four, (int)(nn_float_buffer[3]*100 + 0.5));
-    printf("--------------------------------\r\n");
-    printf("| Detection:        ");
+    va_start(args, format);
+    written = vsnprintf(&screen[*length], CONTROL_SCREEN_SIZE - *length, format, args);
+    va_end(args);
 
-    /* Check the confidence for the selected class */
-    if(MIN_CONFIDENCE < nn_float_buffer[class_index])
+    if (written > 0)
     {
-        /* Switch statement for the selected class */
-        switch (class_index)
-        {
-            case 0:
-                printf("%s\r\n", gesture_one);
-                break;
-            case 1:
-                printf("%s\r\n", gesture_two);
-                break;
-            case 2:
-                printf("%s\r\n", gesture_three);
-                break;
-            case 3:
-                printf("%s\r\n", gesture_four);
-                break;
-        }
+        *length += ((uint32_t)written < CONTROL_SCREEN_SIZE - *length) ?
+                   (uint32_t)written : CONTROL_SCREEN_SIZE - *length - 1u;
     }
-    /* If the confidence is not high, no gesture detected */
-    else
+}
+
+/*******************************************************************************
+* Function Name: control_class_name
+********************************************************************************
+* Summary:
+*   Returns the name of a class, as generated in gesture_names.h from the
+*   classes the model was trained on.
+*
+* Parameters:
+*     class_index: Index of the class in the model output
+*
+*******************************************************************************/
+static const char* control_class_name(int class_index)
+{
+    return ((class_index >= 0) && (class_index < CONTROL_NUM_NAMES)) ? gesture_names[class_index] : "Unknown";
+}
+
+/*******************************************************************************
+* Function Name: control
+********************************************************************************
+* Summary:
+*   A function used to print the results from the inference engine, such as the
+*   the class and the confidence of each class. The screen is queued for the
+*   UART as one message, so it is printed or dropped as a whole, and this
+*   function does not wait for it to be sent.
+*
+* Parameters:
+*     decision: The class detected in the output of the inference engine
+*     probabilities: The output of the inference engine in floating-point, NULL
+*                    to print the detected class only
+*     num_classes: Output size of the model, the last class is no gesture
+*
+*******************************************************************************/
+void control(const control_decision_t* decision, const float* probabilities, int num_classes)
+{
+    char screen[CONTROL_SCREEN_SIZE];
+    uint32_t length = 0;
+
+    /* Clear the screen */
+    control_append(screen, &length, "\x1b[2J\x1b[;H");
+
+    if (NULL != probabilities)
     {
-        printf("%s\r\n", gesture_four);
+        /* Prints the confidence level of each class */
+        control_append(screen, &length, "| Gesture         | Confidence\r\n");
+        control_append(screen, &length, "--------------------------------\r\n");
+        for (int i = 0; i < num_classes; i++)
+        {
+            const char* name = control_class_name(i);
+            int padding = 16 - (int)strlen(name);
+
+            control_append(screen, &length, "| %s:%*s %%%-3d\r\n", name, (padding > 0) ? padding : 0, "",
+                           (int)(probabilities[i]*100 + 0.5));
+            control_append(screen, &length, "--------------------------------\r\n");
+        }
     }
-    free(nn_float_buffer);
+
+    /* Check the confidence for the selected class. If the confidence is not
+     * high, no gesture detected, which is the last class */
+    control_append(screen, &length, "| Detection:        %s\r\n",
+                   control_class_name(decision->detected ? decision->class_index : num_classes - 1));
+
+    output_write(screen, length);
 }
@@ -42,11 +42,42 @@
 #ifndef CONTROL_H
 #define CONTROL_H
 
-#include "mtb_ml_common.h"
+#include <stdbool.h>
+
+/*******************************************************************************
+* Constants
+*******************************************************************************/
+/* Minimum confidence to report a gesture */
+#define MIN_CONFIDENCE 0.60
+
+/* Number of classes of the model, the last one is no gesture */
+#define CONTROL_NUM_CLASSES 4
+
+/* Minimum confidence to report each class */
+#define CONTROL_THRESHOLDS {MIN_CONFIDENCE, MIN_CONFIDENCE, MIN_CONFIDENCE, MIN_CONFIDENCE}
+
+/* Define if the confidence of each class is printed */
+/* 0u - print the detected gesture only, the model output is not dequantized (default) */
+/* 1u - print the confidence of each class and the detected gesture */
+#define CONTROL_PRINT_CONFIDENCE 0u
+
+/* Longest screen printed by control, queued for the UART as one message */
+#define CONTROL_SCREEN_SIZE 512u
+
+/*******************************************************************************
+* Typedefs
+*******************************************************************************/
+typedef struct
+{
+    int class_index;            /* Class with the highest confidence */
+    bool detected;              /* The confidence is above the class threshold */
+    float confidence;           /* Confidence of class_index */
+} control_decision_t;
 
 /*******************************************************************************
 * Functions
 *******************************************************************************/
-void control(MTB_ML_DATA_T* result_buffer, int model_output_size);
+void control_decide(const float* probabilities, int model_output_size, control_decision_t* decision);
+void control(const control_decision_t* decision, const float* probabilities, int num_classes);
 
 #endif /* CONTROL_H */
@@ -43,42 +43,69 @@
 #include "gesture.h"
 
 #include "processing.h"
+#if !GESTURE_SPARSE_MODEL
+#include "precision.h"
+#endif
+#include "sparse_nn.h"
+#include "model_registry.h"
+#include "pipeline.h"
+#include "schedule.h"
+#include "results.h"
 #include "control.h"
 #include "sensor.h"
+#include "replay.h"
+#include "stream.h"
+#include "imu_codec.h"
+#include "latency.h"
+#include "trace.h"
+#include "instrument.h"
 
 #include "cyhal.h"
 #include "cybsp.h"
-#include "mtb_ml_utils.h"
-#include "mtb_ml_common.h"
 
-#include <stdlib.h>
+#include "FreeRTOS.h"
+#include "task.h"
 
-/* Include model files */
-#include MTB_ML_INCLUDE_MODEL_FILE(MODEL_NAME)
+#include <stdlib.h>
 
 /*******************************************************************************
 * Constants
 *******************************************************************************/
-#define MAX_DATA_SAMPLE 32768
-#define MIN_DATA_SAMPLE -32768
+/* Maximum number of classes in the model output */
+#define MAX_MODEL_OUTPUT_SIZE 16
 
-#if (COMPONENT_ML_INT16x16 || COMPONENT_ML_INT16x8)
-    #define QFORMAT_VALUE    15
+/* The gesture model runs on every window */
+#define GESTURE_MODEL_PERIOD  1u
+#define GESTURE_MODEL_OFFSET  0u
+
+#if GESTURE_CASCADE_MODE
+/* The cascade runs PRECISION_CASCADE_FIRST, int8x8, on every window */
+#if PRECISION_RUNTIME_SWITCH && !PRECISION_HAS_int8x8
+#error GESTURE_CASCADE_MODE needs int8x8 in NN_RUNTIME_TYPES
+#elif !PRECISION_RUNTIME_SWITCH && !COMPONENT_ML_INT8x8
+#error GESTURE_CASCADE_MODE needs NN_TYPE=int8x8 or int8x8 in NN_RUNTIME_TYPES
 #endif
-#if (COMPONENT_ML_INT8x8)
-    #define QFORMAT_VALUE    7
 #endif
+
+/*******************************************************************************
+* Local Functions
+*******************************************************************************/
+static void gesture_classify(const float *window, void *context);
+
 /*******************************************************************************
 * Global Variables
 *******************************************************************************/
-/* Model information */
-mtb_ml_model_t *magic_wand_obj;
+/* Window being processed by the inference task */
+static pipeline_window_t *gesture_window;
 
-/* Output/result buffers for the inference engine */
-static MTB_ML_DATA_T *result_buffer;
+/* Decision of the last window, published by the inference task */
+static control_decision_t gesture_decision;
+static bool gesture_decided;
 
-/* Model Output Size */
-static int model_output_size;
+#if GESTURE_SPARSE_MODEL
+/* Generated with train/sparse_export.py */
+extern const sparse_nn_model_t SPARSE_NN_MODEL(MODEL_NAME);
+#endif
 
 /*******************************************************************************
 * Function Name: gesture_init
@@ -96,25 +123,56 @@ static int model_output_size;
 cy_rslt_t gesture_init(void)
 {
     cy_rslt_t result;
+    int model_id;
 
-    mtb_ml_model_bin_t magic_wand_bin = {MTB_ML_MODEL_BIN_DATA(MODEL_NAME)};
+    /* Initialize the registry of models fed with the pre-processed windows */
+    model_registry_init();
+
+#if TRACE_ENABLE
+    /* Start recording the trace points, the cycle counter is now running */
+    trace_init();
+#endif
 
-    /* Initialize the Neural Network */
-    result = mtb_ml_model_init(&magic_wand_bin, NULL, &magic_wand_obj);
+#if !GESTURE_DATA_COLLECTION_MODE
+    /* Initialize the queues between the acquisition and inference tasks */
+    result = pipeline_init();
     if(CY_RSLT_SUCCESS != result)
     {
         return result;
     }
 
-#if !COMPONENT_ML_FLOAT32
-    /* Set the q-factor */
-    mtb_ml_model_set_input_q_fraction_bits(magic_wand_obj, QFORMAT_VALUE);
+    /* Start delivering the results to the subscribers */
+    result = results_init();
+    if(CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
 #endif
 
-    mtb_ml_model_get_output(magic_wand_obj, &result_buffer, &model_output_size);
+#if !GESTURE_SPARSE_MODEL
+    /* Initialize the Neural Network, one model per linked precision */
+    result = precision_init();
+    if(CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+#endif
 
+    /* Other models can be registered to share the pre-processed windows */
+    result = model_registry_add("gesture", gesture_classify, NULL,
+                                GESTURE_MODEL_PERIOD, GESTURE_MODEL_OFFSET, &model_id);
+    if(CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+
+#if GESTURE_REPLAY_MODE
+    /* Receive the windows from the host instead of the IMU sensor */
+    result = replay_init(model_id);
+#else
     /* Initialize the IMU sensor */
     result = sensor_init();
+#endif
 
     return result;
 }
@@ -124,6 +182,9 @@ cy_rslt_t gesture_init(void)
 ********************************************************************************
 * Summary:
 *   A task used to pre-process data before it is fed to the inference engine.
+*   Each window is pre-processed in a buffer of the pipeline and handed to
+*   gesture_inference_task, so the next window is pre-processed while the
+*   models run.
 *
 * Parameters:
 *     arg: not used
@@ -132,86 +193,179 @@ cy_rslt_t gesture_init(void)
 *******************************************************************************/
 void gesture_task(void *arg)
 {
-#if !GESTURE_DATA_COLLECTION_MODE
-    /* Regression pointers */
-    MTB_ML_DATA_T *input_reference;
+    (void)arg;
 
+#if GESTURE_DATA_COLLECTION_MODE
+    int16_t temp_buffer[SENSOR_BATCH_SIZE][SENSOR_NUM_AXIS];
+#if GESTURE_STREAM_COMPRESSION
+    static uint8_t compressed[STREAM_MAX_PAYLOAD];
+    uint32_t size;
 #endif
 
-    /* Data processed in floating point */
-    float data_feed[SENSOR_BATCH_SIZE][SENSOR_NUM_AXIS];
+    for(;;)
+    {
+        /* Get sensor data */
+        sensor_get_data((void *) temp_buffer, NULL, NULL);
 
-    (void)arg;
+        /* Stream the samples, collect.py applies the same pre-processing */
+#if GESTURE_STREAM_COMPRESSION
+        size = imu_codec_encode(&temp_buffer[0][0], SENSOR_BATCH_SIZE, compressed, sizeof(compressed));
+        if (size != 0)
+        {
+            stream_send(STREAM_TYPE_DELTA, compressed, (uint16_t)size);
+            continue;
+        }
+#endif
+        stream_send(STREAM_TYPE_RAW, temp_buffer, sizeof(temp_buffer));
+    }
+#else
+    /* Window buffer of the pipeline, data processed in floating point */
+    pipeline_window_t *window;
+    float (*data_feed)[SENSOR_NUM_AXIS];
+#if GESTURE_REPLAY_MODE
+
+    for(;;)
+    {
+        /* One window at a time, the host waits for each result */
+        window = pipeline_get_free();
+        data_feed = window->data;
 
-    /* Initialize the butter-worth filter variables */
-    int n_order = 3;
-    /* Coefficients for 3rd order butter-worth filter */
-    const float coeff_b[] = IIR_FILTER_BUTTER_WORTH_COEFF_B;
-    const float coeff_a[] = IIR_FILTER_BUTTER_WORTH_COEFF_A;
-    iir_filter_struct butter_lp_fil;
+        /* The host sends the windows already pre-processed */
+        replay_get_window(&data_feed[0][0]);
+        window->timestamp = xTaskGetTickCount();
+        LATENCY_MARK(&window->latency, LATENCY_CAPTURE);
+        LATENCY_MARK(&window->latency, LATENCY_HANDOFF);
+        LATENCY_MARK(&window->latency, LATENCY_PREPROCESS_START);
+        LATENCY_MARK(&window->latency, LATENCY_PREPROCESS_END);
+
+        /* Hand the window to the inference task */
+        pipeline_submit(window);
+    }
+#else
+    latency_time_t capture;
 
     for(;;)
     {
-        uint16_t cur = 0;
         int16_t temp_buffer[SENSOR_BATCH_SIZE][SENSOR_NUM_AXIS];
 
+        /* Wait for a free buffer, if inference falls behind */
+        window = pipeline_get_free();
+        data_feed = window->data;
+
+        /* Skip the windows that went stale while waiting, if the policy allows */
+        schedule_skip_sensor();
+
         /* Get sensor data */
-        sensor_get_data((void *) temp_buffer);
+        sensor_get_data((void *) temp_buffer, &window->timestamp, &capture);
+        LATENCY_SET(&window->latency, LATENCY_CAPTURE, capture);
+        LATENCY_MARK(&window->latency, LATENCY_HANDOFF);
+        LATENCY_MARK(&window->latency, LATENCY_PREPROCESS_START);
+        TRACE_INSTANT(TRACE_ACQUIRE_WAKE, sensor_get_pending());
+        INSTRUMENT_COUNT(pending_windows, sensor_get_pending());
 
-        /* Cast the data from an int16 to a float for pre-processing */
-        cast_int16_to_float(&temp_buffer[0][0], &data_feed[0][0], SENSOR_BATCH_SIZE*SENSOR_NUM_AXIS);
+        /* Filter, normalize and orient the window, as in the training data */
+        processing_window(&temp_buffer[0][0], &data_feed[0][0], SENSOR_BATCH_SIZE, SENSOR_NUM_AXIS);
 
-        /* Third order butter-worth filter */
-        while(cur < SENSOR_NUM_AXIS)
-        {
-            /* Initialize and run the filter */
-            iir_filter_init(&butter_lp_fil, coeff_b, coeff_a, n_order);
-            iir_filter(&butter_lp_fil, &data_feed[0][0], SENSOR_BATCH_SIZE, cur, SENSOR_NUM_AXIS);
-            cur++;
-        }
+        /* Hand the window to the inference task */
+        LATENCY_MARK(&window->latency, LATENCY_PREPROCESS_END);
+        pipeline_submit(window);
+    }
+#endif /* #if GESTURE_REPLAY_MODE */
+#endif /* #if GESTURE_DATA_COLLECTION_MODE */
+}
 
-        /* A min max normalization to get all data between -1 and 1 */
-        normalization_min_max(&data_feed[0][0], SENSOR_BATCH_SIZE, SENSOR_NUM_AXIS, MIN_DATA_SAMPLE, MAX_DATA_SAMPLE);
+/*******************************************************************************
+* Function Name: gesture_inference_task
+********************************************************************************
+* Summary:
+*   A task used to run the models on the windows pre-processed by
+*   gesture_task. Not created in data collection mode.
+*
+* Parameters:
+*     arg: not used
+*
+*
+*******************************************************************************/
+void gesture_inference_task(void *arg)
+{
+    pipeline_window_t *window;
 
-#ifdef CY_BMI_160_IMU_I2C
-        /* Swap axis for BMI_160 so board orientation stays the same */
-        column_inverse(&data_feed[0][0], SENSOR_BATCH_SIZE, SENSOR_NUM_AXIS, 2);
-        column_swap(&data_feed[0][0], SENSOR_BATCH_SIZE, SENSOR_NUM_AXIS, 0, 1);
-        column_inverse(&data_feed[0][0], SENSOR_BATCH_SIZE, SENSOR_NUM_AXIS, 5);
-        column_swap(&data_feed[0][0], SENSOR_BATCH_SIZE, SENSOR_NUM_AXIS, 3, 4);
-#endif
+    (void)arg;
 
-#if GESTURE_DATA_COLLECTION_MODE
-    cur = 0;
-    printf("-,-,-,-,-,-\r\n");
-    while (cur < SENSOR_BATCH_SIZE)
+    for(;;)
     {
-        printf("%6f,%6f,%6f,%6f,%6f,%6f\r\n", data_feed[cur][0],
-                                              data_feed[cur][1],
-                                              data_feed[cur][2],
-                                              data_feed[cur][3],
-                                              data_feed[cur][4],
-                                              data_feed[cur][5]);
-        cur++;
+        window = pipeline_get_ready();
+        TRACE_INSTANT(TRACE_INFERENCE_WAKE, window->sequence);
+
+        /* Feed every model scheduled for this window, unless a newer one waits */
+        if (!schedule_skip_window(window))
+        {
+            LATENCY_MARK(&window->latency, LATENCY_INFERENCE_START);
+            gesture_window = window;
+            gesture_decided = false;
+            model_registry_dispatch(&window->data[0][0]);
+            schedule_complete(window);
+
+            /* Notify the subscribers, without waiting for them */
+            if (gesture_decided)
+            {
+                results_publish(&gesture_decision, window->sequence, window->timestamp);
+                LATENCY_RECORD(&window->latency);
+            }
+        }
+
+        /* The buffer can be filled again */
+        pipeline_release(window);
     }
-#else
+}
 
-#if !COMPONENT_ML_FLOAT32
-        /* Quantize data before feeding model */
-        MTB_ML_DATA_T data_feed_int[SENSOR_BATCH_SIZE][SENSOR_NUM_AXIS];
-        mtb_ml_utils_model_quantize(magic_wand_obj, &data_feed[0][0], &data_feed_int[0][0]);
+/*******************************************************************************
+* Function Name: gesture_classify
+********************************************************************************
+* Summary:
+*   Runs the gesture model on a pre-processed window and prints the result.
+*   The decision is kept for gesture_inference_task to publish.
+*
+* Parameters:
+*   window: Pre-processed data, SENSOR_BATCH_SIZE x SENSOR_NUM_AXIS floats
+*   context: not used
+*
+*******************************************************************************/
+static void gesture_classify(const float *window, void *context)
+{
+    /* Model output converted to floating point */
+    float probabilities[MAX_MODEL_OUTPUT_SIZE];
+    control_decision_t decision;
+    int model_output_size;
 
-        /* Feed the Model */
-        input_reference = (MTB_ML_DATA_T *) data_feed_int;
-        mtb_ml_model_run(magic_wand_obj, input_reference);
-        control(result_buffer, model_output_size);
+    (void)context;
 
+#if GESTURE_SPARSE_MODEL
+    /* Feed the pruned model, multiplying only its non-zero weights */
+    model_output_size = sparse_nn_run(&SPARSE_NN_MODEL(MODEL_NAME), window, probabilities);
+    control_decide(probabilities, model_output_size, &decision);
 #else
-        input_reference = (MTB_ML_DATA_T *) data_feed;
-        mtb_ml_model_run(magic_wand_obj, input_reference);
-        control(result_buffer, model_output_size);
+#if GESTURE_CASCADE_MODE
+    /* Feed the cheap model, and the accurate one only if needed */
+    precision_run_cascade(window);
+#else
+    /* Feed the active model variant, quantizing the data if needed */
+    precision_run(window);
 #endif
+    /* Decide on the model output as is, fixed-point for quantized variants */
+    model_output_size = precision_decide(&decision);
 
-#endif /* #if GESTURE_DATA_COLLECTION */
-    }
+#if CONTROL_PRINT_CONFIDENCE
+    /* Dequantize only to print the confidence of each class */
+    precision_get_output(probabilities);
+#endif
+#endif
+    LATENCY_MARK(&gesture_window->latency, LATENCY_INFERENCE_END);
+    TRACE_BEGIN(TRACE_DECISION, 0);
+    control(&decision, CONTROL_PRINT_CONFIDENCE ? probabilities : NULL, model_output_size);
+    TRACE_END(TRACE_DECISION, 0);
+    LATENCY_MARK(&gesture_window->latency, LATENCY_DECISION);
+
+    gesture_decision = decision;
+    gesture_decided = true;
 }
@@ -43,26 +43,42 @@
 #define GESTURE_H
 
 #include "cyabs_rtos.h"
-#include "mtb_ml_model.h"
 
 /******************************************************************************
  * Constants
  *****************************************************************************/
 /* Define if should run inference or print data to the terminal */
 /* 0u - run inference engine (default) */
-/* 1u - print sensor data to the terminal */
+/* 1u - stream raw sensor data to train/collect.py */
 #define GESTURE_DATA_COLLECTION_MODE     0u
 
-/*******************************************************************************
-* Global Variables
-********************************************************************************/
-extern mtb_ml_model_t *magic_wand_obj;
+/* Define how the data collection windows are streamed */
+/* 0u - raw int16 samples */
+/* 1u - compressed with imu_codec_encode(), raw if it does not fit (default) */
+#define GESTURE_STREAM_COMPRESSION       1u
+
+/* Define how the precision of the model is selected */
+/* 0u - run the precision selected with precision_set() (default) */
+/* 1u - run int8x8 first, and float only when the confidence is ambiguous */
+#define GESTURE_CASCADE_MODE             0u
+
+/* Set by the Makefile when NN_SPARSE runs the model from train/sparse_export.py */
+#ifndef GESTURE_SPARSE_MODEL
+#define GESTURE_SPARSE_MODEL             0u
+#endif
+
+/* Set by the Makefile when REPLAY runs the models on the windows sent by
+ * train/variant_bench.py instead of the IMU data */
+#ifndef GESTURE_REPLAY_MODE
+#define GESTURE_REPLAY_MODE              0u
+#endif
 
 /*******************************************************************************
 * Functions
 *******************************************************************************/
 cy_rslt_t gesture_init(void);
 void gesture_task(void *arg);
+void gesture_inference_task(void *arg);
 
 
 #endif /* GESTURE_H */
@@ -0,0 +1,268 @@
+/******************************************************************************
+* File Name:   imu_codec.c
+*
+* Description: This file contains a lossless codec for windows of IMU
+*              samples. Each value is predicted from the previous samples of
+*              its axis, and the residual is stored as a zigzag varint, so the
+*              small changes between samples take a single byte.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2021-2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "imu_codec.h"
+#include "instrument.h"
+
+#include <stdbool.h>
+
+/*******************************************************************************
+* Constants
+*******************************************************************************/
+#define IMU_CODEC_VARINT_MORE   0x80u
+#define IMU_CODEC_VARINT_BITS   7u
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static imu_codec_stats_t imu_codec_stats;
+
+/*******************************************************************************
+* Local Functions
+*******************************************************************************/
+static int32_t imu_codec_predict(const int16_t *samples, uint32_t sample, uint32_t axis, uint8_t order);
+
+/*******************************************************************************
+* Function Name: imu_codec_encode
+********************************************************************************
+* Summary:
+*   Compresses a window of samples. The predictor restarts on each window, so
+*   a window decodes on its own even if the previous one was lost. The cycle
+*   counter is started by instrument_init.
+*
+* Parameters:
+*   samples: Samples of the window, SENSOR_NUM_AXIS values per sample
+*   num_samples: Number of samples in the window
+*   output: Buffer to store the compressed window
+*   output_size: Size of the buffer, IMU_CODEC_MAX_SIZE() always fits
+*
+* Return:
+*   The size of the compressed window, or 0 if it does not fit in the buffer.
+*******************************************************************************/
+uint32_t imu_codec_encode(const int16_t *samples, uint32_t num_samples, uint8_t *output, uint32_t output_size)
+{
+    uint32_t start;
+    uint32_t cycles;
+    uint32_t size = 0;
+    bool overflow = false;
+
+    start = INSTRUMENT_NOW();
+
+    if (output_size > 0)
+    {
+        output[size++] = IMU_CODEC_ORDER;
+    }
+    else
+    {
+        overflow = true;
+    }
+
+    for (uint32_t i = 0; (i < num_samples) && !overflow; i++)
+    {
+        for (uint32_t axis = 0; (axis < SENSOR_NUM_AXIS) && !overflow; axis++)
+        {
+            int32_t residual = samples[i*SENSOR_NUM_AXIS + axis] - imu_codec_predict(samples, i, axis, IMU_CODEC_ORDER);
+
+            /* Zigzag, small negative residuals become small positive numbers */
+            uint32_t value = ((uint32_t)residual << 1) ^ (uint32_t)(residual >> 31);
+
+            /* Varint, 7 bits per byte with the top bit set when more follow */
+            do
+            {
+                if (size == output_size)
+                {
+                    overflow = true;
+                    break;
+                }
+                output[size] = (uint8_t)(value & ~IMU_CODEC_VARINT_MORE);
+                value >>= IMU_CODEC_VARINT_BITS;
+                if (value != 0)
+                {
+                    output[size] |= IMU_CODEC_VARINT_MORE;
+                }
+                size++;
+            } while (value != 0);
+        }
+    }
+
+    cycles = INSTRUMENT_NOW() - start;
+
+    imu_codec_stats.frames++;
+    imu_codec_stats.raw_bytes += num_samples * SENSOR_SAMPLE_SIZE;
+    imu_codec_stats.last_cycles = cycles;
+    imu_codec_stats.total_cycles += cycles;
+    if (cycles > imu_codec_stats.max_cycles)
+    {
+        imu_codec_stats.max_cycles = cycles;
+    }
+
+    if (overflow)
+    {
+        imu_codec_stats.overflows++;
+        return 0;
+    }
+
+    imu_codec_stats.encoded_bytes += size;
+    return size;
+}
+
+/*******************************************************************************
+* Function Name: imu_codec_decode
+********************************************************************************
+* Summary:
+*   Restores a window compressed with imu_codec_encode().
+*
+* Parameters:
+*   input: Compressed window
+*   input_size: Size of the compressed window
+*   samples: Buffer to store the samples, SENSOR_NUM_AXIS values per sample
+*   max_samples: Number of samples that fit in the buffer
+*
+* Return:
+*   The number of samples, or -1 if the data is not a valid window.
+*******************************************************************************/
+int imu_codec_decode(const uint8_t *input, uint32_t input_size, int16_t *samples, uint32_t max_samples)
+{
+    uint32_t position = 1;
+    uint32_t count = 0;
+    uint8_t order;
+
+    if (input_size == 0)
+    {
+        return -1;
+    }
+
+    order = input[0];
+    if ((order != IMU_CODEC_ORDER_DELTA) && (order != IMU_CODEC_ORDER_LINEAR))
+    {
+        return -1;
+    }
+
+    while (position < input_size)
+    {
+        uint32_t sample = count / SENSOR_NUM_AXIS;
+        uint32_t axis = count % SENSOR_NUM_AXIS;
+        uint32_t value = 0;
+        uint32_t shift = 0;
+        int32_t residual;
+        int32_t decoded;
+
+        if (sample == max_samples)
+        {
+            return -1;
+        }
+
+        do
+        {
+            if ((position == input_size) || (shift == IMU_CODEC_MAX_VARINT * IMU_CODEC_VARINT_BITS))
+            {
+                return -1;
+            }
+            value |= (uint32_t)(input[position] & ~IMU_CODEC_VARINT_MORE) << shift;
+            shift += IMU_CODEC_VARINT_BITS;
+        } while (input[position++] & IMU_CODEC_VARINT_MORE);
+
+        residual = (int32_t)(value >> 1) ^ -(int32_t)(value & 1u);
+        decoded = residual + imu_codec_predict(samples, sample, axis, order);
+        if ((decoded < INT16_MIN) || (decoded > INT16_MAX))
+        {
+            return -1;
+        }
+
+        samples[count++] = (int16_t)decoded;
+    }
+
+    /* Only whole samples are valid */
+    if ((count % SENSOR_NUM_AXIS) != 0)
+    {
+        return -1;
+    }
+
+    return (int)(count / SENSOR_NUM_AXIS);
+}
+
+/*******************************************************************************
+* Function Name: imu_codec_get_stats
+********************************************************************************
+* Summary:
+*   Returns the encoder counters since reset.
+*
+* Parameters:
+*   stats: Structure to store the statistics
+*
+*******************************************************************************/
+void imu_codec_get_stats(imu_codec_stats_t *stats)
+{
+    *stats = imu_codec_stats;
+}
+
+/*******************************************************************************
+* Function Name: imu_codec_predict
+********************************************************************************
+* Summary:
+*   Predicts a value from the previous samples of the same axis. The first
+*   samples of a window use a lower order, as they have less history.
+*
+* Parameters:
+*   samples: Samples of the window, up to the one to predict
+*   sample: Index of the sample to predict
+*   axis: Axis to predict
+*   order: IMU_CODEC_ORDER_*
+*
+* Return:
+*   The prediction.
+*******************************************************************************/
+static int32_t imu_codec_predict(const int16_t *samples, uint32_t sample, uint32_t axis, uint8_t order)
+{
+    if (sample == 0)
+    {
+        return 0;
+    }
+
+    if ((sample == 1) || (order == IMU_CODEC_ORDER_DELTA))
+    {
+        return samples[(sample - 1)*SENSOR_NUM_AXIS + axis];
+    }
+
+    return 2*samples[(sample - 1)*SENSOR_NUM_AXIS + axis] - samples[(sample - 2)*SENSOR_NUM_AXIS + axis];
+}
@@ -0,0 +1,87 @@
+/******************************************************************************
+* File Name:   imu_codec.h
+*
+* Description: This file contains the function prototypes and constants used
+*   in imu_codec.c.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2021-2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef IMU_CODEC_H
+#define IMU_CODEC_H
+
+#include "sensor.h"
+
+#include <stdint.h>
+
+/******************************************************************************
+ * Constants
+ *****************************************************************************/
+/* Predictors, the residual to the prediction is stored for each axis */
+#define IMU_CODEC_ORDER_DELTA   1u      /* Previous sample */
+#define IMU_CODEC_ORDER_LINEAR  2u      /* Line through the two previous samples */
+
+/* Predictor used by imu_codec_encode(). The linear one gave the smallest
+ * windows on train/gesture_data. */
+#define IMU_CODEC_ORDER         IMU_CODEC_ORDER_LINEAR
+
+/* A zigzag encoded residual takes up to 18 bits, 3 bytes as a varint */
+#define IMU_CODEC_MAX_VARINT    3u
+
+/* Worst case size of a window, the order byte and one varint per value */
+#define IMU_CODEC_MAX_SIZE(num_samples) (1u + (num_samples) * SENSOR_NUM_AXIS * IMU_CODEC_MAX_VARINT)
+
+/******************************************************************************
+ * Typedefs
+ *****************************************************************************/
+typedef struct
+{
+    uint32_t frames;            /* Windows encoded */
+    uint32_t overflows;         /* Windows that did not fit in the output buffer */
+    uint32_t raw_bytes;         /* Size of the encoded windows as int16 */
+    uint32_t encoded_bytes;     /* Size of the encoded windows after compression */
+    uint32_t last_cycles;       /* Time of the last encoding */
+    uint32_t max_cycles;        /* Worst time of an encoding */
+    uint64_t total_cycles;      /* Time of all encodings */
+} imu_codec_stats_t;
+
+/*******************************************************************************
+* Functions
+*******************************************************************************/
+uint32_t imu_codec_encode(const int16_t *samples, uint32_t num_samples, uint8_t *output, uint32_t output_size);
+int imu_codec_decode(const uint8_t *input, uint32_t input_size, int16_t *samples, uint32_t max_samples);
+void imu_codec_get_stats(imu_codec_stats_t *stats);
+
+#endif /* IMU_CODEC_H */
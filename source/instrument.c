@@ -0,0 +1,239 @@
+/******************************************************************************
+* File Name:   instrument.c
+*
+* Description: This file starts the cycle counter, and accumulates the timers
+*   and counters placed with the INSTRUMENT_* macros.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2021-2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "instrument.h"
+
+#include <string.h>
+#if !defined(__ARM_ARCH)
+#include <time.h>
+#endif
+
+/*******************************************************************************
+* Constants
+*******************************************************************************/
+/* Time to measure the frequency of the time stamp counter */
+#define INSTRUMENT_CALIBRATION_NS   20000000u
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static uint32_t instrument_cycles_per_us = 1u;
+
+#if INSTRUMENT_ENABLE
+/* Accumulators reached at least once, most recent first */
+static instrument_stat_t *volatile instrument_stats;
+
+/* Incremented by instrument_reset, each accumulator clears itself on its next
+ * value */
+static volatile uint32_t instrument_generation;
+#endif
+
+/*******************************************************************************
+* Function Name: instrument_init
+********************************************************************************
+* Summary:
+*   Starts the cycle counter. On the host, the monotonic clock counts in
+*   nanoseconds, and the frequency of the time stamp counter is measured
+*   against it. Under QEMU, the instructions are counted, not the time.
+*
+*******************************************************************************/
+void instrument_init(void)
+{
+#if defined(INSTRUMENT_QEMU_ICOUNT)
+    instrument_cycles_per_us = 1u;
+#elif defined(__ARM_ARCH)
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    instrument_cycles_per_us = SystemCoreClock / 1000000u;
+#elif INSTRUMENT_HOST_RDTSC && (defined(__x86_64__) || defined(__i386__))
+    struct timespec start;
+    struct timespec now;
+    uint64_t start_cycles = __rdtsc();
+    uint64_t elapsed_ns;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    do
+    {
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        elapsed_ns = (uint64_t)(now.tv_sec - start.tv_sec) * 1000000000u + (uint64_t)now.tv_nsec -
+                     (uint64_t)start.tv_nsec;
+    } while (elapsed_ns < INSTRUMENT_CALIBRATION_NS);
+
+    instrument_cycles_per_us = (uint32_t)(((__rdtsc() - start_cycles) * 1000u) / elapsed_ns);
+#else
+    instrument_cycles_per_us = 1000u;
+#endif
+}
+
+/*******************************************************************************
+* Function Name: instrument_get_cycles_per_us
+********************************************************************************
+* Summary:
+*   Returns the frequency of INSTRUMENT_NOW().
+*
+* Return:
+*   Counts per microsecond.
+*******************************************************************************/
+uint32_t instrument_get_cycles_per_us(void)
+{
+    return instrument_cycles_per_us;
+}
+
+#if INSTRUMENT_ENABLE
+/*******************************************************************************
+* Function Name: instrument_add
+********************************************************************************
+* Summary:
+*   Adds a value to an accumulator, and lists it on its first value. Called
+*   by the macros; an accumulator must only be updated from one task or
+*   interrupt.
+*
+* Parameters:
+*     stat: accumulator of the timer or counter
+*     value: cycles of a timer, or the value of a counter
+*
+*******************************************************************************/
+void instrument_add(instrument_stat_t *stat, uint32_t value)
+{
+    uint32_t generation = instrument_generation;
+
+    if (!stat->registered)
+    {
+        /* Other accumulators can be listed by interrupts meanwhile */
+        stat->next = instrument_stats;
+        while (!__atomic_compare_exchange_n(&instrument_stats, &stat->next, stat, false,
+                                            __ATOMIC_RELEASE, __ATOMIC_RELAXED))
+        {
+        }
+        stat->registered = true;
+    }
+
+    if ((stat->generation != generation) || (0u == stat->count))
+    {
+        stat->generation = generation;
+        stat->count = 0;
+        stat->total = 0;
+        stat->min = value;
+        stat->max = value;
+    }
+
+    stat->count++;
+    stat->total += value;
+    if (value < stat->min)
+    {
+        stat->min = value;
+    }
+    if (value > stat->max)
+    {
+        stat->max = value;
+    }
+}
+
+/*******************************************************************************
+* Function Name: instrument_scope_end
+********************************************************************************
+* Summary:
+*   Adds the time since the start of a scope. Called when INSTRUMENT_SCOPE
+*   goes out of scope.
+*
+* Parameters:
+*     scope: timer of the scope
+*
+*******************************************************************************/
+void instrument_scope_end(instrument_scope_t *scope)
+{
+    instrument_add(scope->stat, INSTRUMENT_NOW() - scope->start);
+}
+
+/*******************************************************************************
+* Function Name: instrument_reset
+********************************************************************************
+* Summary:
+*   Clears all the accumulators.
+*
+*******************************************************************************/
+void instrument_reset(void)
+{
+    instrument_generation++;
+}
+
+/*******************************************************************************
+* Function Name: instrument_get_next
+********************************************************************************
+* Summary:
+*   Iterates over the accumulators reached since power up. Times are
+*   converted to microseconds.
+*
+* Parameters:
+*     stat: accumulator returned by the previous call, or NULL for the first
+*     summary: values of the returned accumulator
+*
+* Return:
+*   The next accumulator, or NULL at the end.
+*******************************************************************************/
+const instrument_stat_t *instrument_get_next(const instrument_stat_t *stat, instrument_summary_t *summary)
+{
+    uint32_t divider;
+
+    stat = (NULL == stat) ? instrument_stats : stat->next;
+    if (NULL == stat)
+    {
+        return NULL;
+    }
+
+    divider = stat->is_timer ? instrument_cycles_per_us : 1u;
+
+    memset(summary, 0, sizeof(*summary));
+    summary->name = stat->name;
+    summary->is_timer = stat->is_timer;
+    if ((stat->generation == instrument_generation) && (0u != stat->count))
+    {
+        summary->count = stat->count;
+        summary->min = stat->min / divider;
+        summary->max = stat->max / divider;
+        summary->average = (uint32_t)((stat->total / stat->count) / divider);
+        summary->total = stat->total / divider;
+    }
+
+    return stat;
+}
+#endif /* #if INSTRUMENT_ENABLE */
@@ -0,0 +1,178 @@
+/******************************************************************************
+* File Name:   instrument.h
+*
+* Description: This file contains the cycle counter, and the macros and
+*   function prototypes of the timers and counters in instrument.c.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2021-2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef INSTRUMENT_H
+#define INSTRUMENT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/******************************************************************************
+ * Constants
+ *****************************************************************************/
+/* Set by the Makefile with INSTRUMENT=1. When 0, the timers and counters
+ * compile to nothing and instrument.c only starts the cycle counter. */
+#ifndef INSTRUMENT_ENABLE
+#define INSTRUMENT_ENABLE           0u
+#endif
+
+/* Host builds only: count with the x86 time stamp counter instead of the
+ * monotonic clock. Its frequency is measured by instrument_init. */
+#ifndef INSTRUMENT_HOST_RDTSC
+#define INSTRUMENT_HOST_RDTSC       0u
+#endif
+
+/******************************************************************************
+ * Cycle counter
+ *****************************************************************************/
+#if defined(INSTRUMENT_QEMU_ICOUNT)
+/* QEMU build, in instructions of the emulated core, see qemu/qemu_hal.c */
+uint32_t qemu_hal_instructions(void);
+#define INSTRUMENT_NOW()            qemu_hal_instructions()
+#elif defined(__ARM_ARCH)
+#include "cy_pdl.h"
+
+/* DWT cycle counter, started by instrument_init */
+#define INSTRUMENT_NOW()            (DWT->CYCCNT)
+#elif INSTRUMENT_HOST_RDTSC && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+
+#define INSTRUMENT_NOW()            ((uint32_t)__rdtsc())
+#define INSTRUMENT_NOW64()          ((uint64_t)__rdtsc())
+#else
+#include <time.h>
+
+/* Host build, in nanoseconds. INSTRUMENT_NOW() wraps after 4.3 s, so the
+ * longer times use all the bits of INSTRUMENT_NOW64() */
+static inline uint64_t instrument_host_now(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000u + (uint64_t)now.tv_nsec;
+}
+#define INSTRUMENT_NOW()            ((uint32_t)instrument_host_now())
+#define INSTRUMENT_NOW64()          instrument_host_now()
+#endif
+
+/******************************************************************************
+ * Typedefs
+ *****************************************************************************/
+/* Accumulator of a timer or counter. Each one belongs to the single place
+ * that updates it, so the updates need no lock. */
+typedef struct instrument_stat
+{
+    const char *name;
+    bool is_timer;              /* Values are cycles */
+    bool registered;            /* Listed for instrument_get_next */
+    uint32_t generation;        /* Reset generation of the values */
+    uint32_t count;             /* Values added since reset */
+    uint32_t min;
+    uint32_t max;
+    uint64_t total;
+    struct instrument_stat *next;
+} instrument_stat_t;
+
+typedef struct
+{
+    instrument_stat_t *stat;
+    uint32_t start;
+} instrument_scope_t;
+
+typedef struct
+{
+    const char *name;
+    bool is_timer;
+    uint32_t count;
+    uint32_t min;
+    uint32_t average;
+    uint32_t max;
+    uint64_t total;
+} instrument_summary_t;
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+#if INSTRUMENT_ENABLE
+#define INSTRUMENT_STAT_INIT(name, is_timer)    { (name), (is_timer), false, 0u, 0u, 0u, 0u, 0u, NULL }
+
+/* Times the rest of the enclosing block. Uses the cleanup attribute of GCC
+ * and Arm Compiler 6. */
+#define INSTRUMENT_SCOPE(name)                                                          \
+    static instrument_stat_t instrument_stat_##name = INSTRUMENT_STAT_INIT(#name, true); \
+    instrument_scope_t instrument_scope_##name __attribute__((cleanup(instrument_scope_end))) = \
+        { &instrument_stat_##name, INSTRUMENT_NOW() }
+
+/* Times from INSTRUMENT_BEGIN to INSTRUMENT_END of the same name, in the same
+ * function */
+#define INSTRUMENT_BEGIN(name)                                                          \
+    static instrument_stat_t instrument_stat_##name = INSTRUMENT_STAT_INIT(#name, true); \
+    uint32_t instrument_start_##name = INSTRUMENT_NOW()
+#define INSTRUMENT_END(name)                                                            \
+    instrument_add(&instrument_stat_##name, INSTRUMENT_NOW() - instrument_start_##name)
+
+/* Adds a value to a named counter, which keeps its total, min, and max */
+#define INSTRUMENT_COUNT(name, value)                                                   \
+    do                                                                                  \
+    {                                                                                   \
+        static instrument_stat_t instrument_stat_##name = INSTRUMENT_STAT_INIT(#name, false); \
+        instrument_add(&instrument_stat_##name, (uint32_t)(value));                    \
+    } while (0)
+#else
+#define INSTRUMENT_SCOPE(name)
+#define INSTRUMENT_BEGIN(name)
+#define INSTRUMENT_END(name)
+#define INSTRUMENT_COUNT(name, value)
+#endif
+
+/*******************************************************************************
+* Functions
+*******************************************************************************/
+void instrument_init(void);
+uint32_t instrument_get_cycles_per_us(void);
+#if INSTRUMENT_ENABLE
+void instrument_add(instrument_stat_t *stat, uint32_t value);
+void instrument_scope_end(instrument_scope_t *scope);
+void instrument_reset(void);
+const instrument_stat_t *instrument_get_next(const instrument_stat_t *stat, instrument_summary_t *summary);
+#endif
+
+#endif /* INSTRUMENT_H */
@@ -0,0 +1,275 @@
+/******************************************************************************
+* File Name:   latency.c
+*
+* Description: This file contains streaming histograms of the time spent by
+*              each window between the stage boundaries. The buckets grow
+*              with the value, a fixed number per power of two, so the
+*              percentiles have the same relative precision from
+*              microseconds to seconds in a fixed amount of memory.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2021-2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "latency.h"
+
+#include <stdbool.h>
+#include <string.h>
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static latency_histogram_t latency_histograms[LATENCY_NUM_STAGES];
+
+/* Set by latency_reset, applied by the task that records */
+static volatile bool latency_reset_pending;
+
+static const char *const latency_stage_names[LATENCY_NUM_STAGES] =
+{
+    "fifo",
+    "handoff",
+    "preprocess",
+    "queue",
+    "inference",
+    "decision",
+    "total",
+};
+
+/*******************************************************************************
+* Local Functions
+*******************************************************************************/
+static uint32_t latency_bucket(uint32_t value);
+static uint32_t latency_bucket_top(uint32_t bucket);
+static uint32_t latency_percentile(const latency_histogram_t *histogram, uint32_t percent);
+
+/*******************************************************************************
+* Function Name: latency_record
+********************************************************************************
+* Summary:
+*   Adds the stage times of a window to the histograms. Must be called from a
+*   single task, once all the points of the window are marked.
+*
+* Parameters:
+*   stamps: Time at each point of the window
+*
+*******************************************************************************/
+void latency_record(const latency_stamps_t *stamps)
+{
+    if (latency_reset_pending)
+    {
+        memset(latency_histograms, 0, sizeof(latency_histograms));
+        latency_reset_pending = false;
+    }
+
+    for (uint32_t stage = 0; stage < LATENCY_STAGE_TOTAL; stage++)
+    {
+        latency_histogram_add(&latency_histograms[stage], stamps->points[stage + 1] - stamps->points[stage]);
+    }
+
+    latency_histogram_add(&latency_histograms[LATENCY_STAGE_TOTAL],
+                stamps->points[LATENCY_DECISION] - stamps->points[LATENCY_CAPTURE]);
+}
+
+/*******************************************************************************
+* Function Name: latency_reset
+********************************************************************************
+* Summary:
+*   Clears the histograms before the next window is recorded. Can be called
+*   from any task.
+*
+*******************************************************************************/
+void latency_reset(void)
+{
+    latency_reset_pending = true;
+}
+
+/*******************************************************************************
+* Function Name: latency_get_summary
+********************************************************************************
+* Summary:
+*   Returns the percentiles of a stage since reset. A percentile is the top of
+*   its bucket, so it is never below the measured value.
+*
+* Parameters:
+*   stage: The stage to query
+*   summary: Structure to store the summary
+*
+*******************************************************************************/
+void latency_get_summary(latency_stage_t stage, latency_summary_t *summary)
+{
+    if ((stage >= LATENCY_NUM_STAGES) || latency_reset_pending)
+    {
+        memset(summary, 0, sizeof(*summary));
+        return;
+    }
+
+    latency_histogram_get_summary(&latency_histograms[stage], summary);
+}
+
+/*******************************************************************************
+* Function Name: latency_stage_name
+********************************************************************************
+* Summary:
+*   Returns the name of a stage, to print the summaries.
+*
+*******************************************************************************/
+const char *latency_stage_name(latency_stage_t stage)
+{
+    return (stage < LATENCY_NUM_STAGES) ? latency_stage_names[stage] : "";
+}
+
+/*******************************************************************************
+* Function Name: latency_histogram_add
+********************************************************************************
+* Summary:
+*   Counts a time in a histogram.
+*
+* Parameters:
+*   histogram: The histogram of the stage
+*   ticks: Time in LATENCY_NOW() units
+*
+*******************************************************************************/
+void latency_histogram_add(latency_histogram_t *histogram, uint64_t ticks)
+{
+    uint64_t us = ticks / LATENCY_TICKS_PER_US;
+    uint32_t value = (us < UINT32_MAX) ? (uint32_t)us : UINT32_MAX;
+
+    histogram->count++;
+    histogram->buckets[latency_bucket(value)]++;
+    if (value > histogram->max_us)
+    {
+        histogram->max_us = value;
+    }
+}
+
+/*******************************************************************************
+* Function Name: latency_histogram_get_summary
+********************************************************************************
+* Summary:
+*   Returns the percentiles of a histogram. A percentile is the top of its
+*   bucket, so it is never below the measured value.
+*
+* Parameters:
+*   histogram: The histogram to query
+*   summary: Structure to store the summary
+*
+*******************************************************************************/
+void latency_histogram_get_summary(const latency_histogram_t *histogram, latency_summary_t *summary)
+{
+    summary->count = histogram->count;
+    summary->p50_us = latency_percentile(histogram, 50);
+    summary->p90_us = latency_percentile(histogram, 90);
+    summary->p99_us = latency_percentile(histogram, 99);
+    summary->max_us = histogram->max_us;
+}
+
+/*******************************************************************************
+* Function Name: latency_bucket
+********************************************************************************
+* Summary:
+*   Returns the bucket of a value: its power of two, and the next
+*   LATENCY_SUB_BITS bits below the leading one.
+*
+*******************************************************************************/
+static uint32_t latency_bucket(uint32_t value)
+{
+    uint32_t exponent = LATENCY_SUB_BITS;
+
+    if (value < LATENCY_SUB_COUNT)
+    {
+        return value;
+    }
+    if (value >= (1u << LATENCY_MAX_BITS))
+    {
+        return LATENCY_NUM_BUCKETS - 1u;
+    }
+
+    while ((value >> (exponent + 1u)) != 0)
+    {
+        exponent++;
+    }
+
+    return (exponent - LATENCY_SUB_BITS + 1u) * LATENCY_SUB_COUNT +
+           ((value >> (exponent - LATENCY_SUB_BITS)) & (LATENCY_SUB_COUNT - 1u));
+}
+
+/*******************************************************************************
+* Function Name: latency_bucket_top
+********************************************************************************
+* Summary:
+*   Returns the largest value counted in a bucket.
+*
+*******************************************************************************/
+static uint32_t latency_bucket_top(uint32_t bucket)
+{
+    uint32_t shift;
+
+    if (bucket < LATENCY_SUB_COUNT)
+    {
+        return bucket;
+    }
+
+    shift = bucket / LATENCY_SUB_COUNT - 1u;
+    return (((LATENCY_SUB_COUNT + bucket % LATENCY_SUB_COUNT + 1u) << shift) - 1u);
+}
+
+/*******************************************************************************
+* Function Name: latency_percentile
+********************************************************************************
+* Summary:
+*   Returns the value below which the percent of the counted times are.
+*
+*******************************************************************************/
+static uint32_t latency_percentile(const latency_histogram_t *histogram, uint32_t percent)
+{
+    uint32_t rank = (uint32_t)(((uint64_t)histogram->count * percent + 99u) / 100u);
+    uint32_t seen = 0;
+
+    if (histogram->count == 0)
+    {
+        return 0;
+    }
+
+    for (uint32_t bucket = 0; bucket < LATENCY_NUM_BUCKETS; bucket++)
+    {
+        seen += histogram->buckets[bucket];
+        if (seen >= rank)
+        {
+            uint32_t top = latency_bucket_top(bucket);
+            return (top < histogram->max_us) ? top : histogram->max_us;
+        }
+    }
+
+    return histogram->max_us;
+}
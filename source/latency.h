@@ -0,0 +1,160 @@
+/******************************************************************************
+* File Name:   latency.h
+*
+* Description: This file contains the function prototypes and constants used
+*   in latency.c.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2021-2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef LATENCY_H
+#define LATENCY_H
+
+#include <stdint.h>
+
+#include "instrument.h"
+
+/******************************************************************************
+ * Constants
+ *****************************************************************************/
+/* Define if the latency of each window is measured */
+/* 0u - the marks compile to nothing */
+/* 1u - mark each stage boundary and update the histograms (default) */
+#ifndef LATENCY_ENABLE
+#define LATENCY_ENABLE              1u
+#endif
+
+/* Each power of two is split in 2^LATENCY_SUB_BITS buckets, so a percentile
+ * is within 1/2^LATENCY_SUB_BITS of the measured value */
+#define LATENCY_SUB_BITS            3u
+
+/* Longest measured time, longer ones count in the last bucket */
+#define LATENCY_MAX_BITS            24u     /* About 16 s */
+
+#define LATENCY_SUB_COUNT           (1u << LATENCY_SUB_BITS)
+
+/* Values below LATENCY_SUB_COUNT have a bucket each, then LATENCY_SUB_COUNT
+ * buckets per power of two up to LATENCY_MAX_BITS */
+#define LATENCY_NUM_BUCKETS         ((LATENCY_MAX_BITS - LATENCY_SUB_BITS + 1u) * LATENCY_SUB_COUNT)
+
+/******************************************************************************
+ * Time source
+ *****************************************************************************/
+/* Cycle counter, started by instrument_init. The host clocks wrap in 32 bits
+ * before LATENCY_MAX_BITS, so they are read in 64 bits. */
+#ifdef INSTRUMENT_NOW64
+typedef uint64_t latency_time_t;
+#define LATENCY_NOW()               INSTRUMENT_NOW64()
+#else
+typedef uint32_t latency_time_t;
+#define LATENCY_NOW()               INSTRUMENT_NOW()
+#endif
+#define LATENCY_TICKS_PER_US        instrument_get_cycles_per_us()
+
+/******************************************************************************
+ * Typedefs
+ *****************************************************************************/
+/* Boundaries of the path from the sensor to the decision, in order */
+typedef enum
+{
+    LATENCY_CAPTURE,            /* The interrupt completes the window */
+    LATENCY_HANDOFF,            /* The window is read from the sensor buffer */
+    LATENCY_PREPROCESS_START,
+    LATENCY_PREPROCESS_END,
+    LATENCY_INFERENCE_START,    /* The inference task receives the window */
+    LATENCY_INFERENCE_END,      /* The model output is ready */
+    LATENCY_DECISION,           /* The result is reported */
+    LATENCY_NUM_POINTS
+} latency_point_t;
+
+/* Time between two consecutive points, and from the first to the last */
+typedef enum
+{
+    LATENCY_STAGE_FIFO,         /* Capture to handoff */
+    LATENCY_STAGE_HANDOFF,      /* Handoff to pre-processing start */
+    LATENCY_STAGE_PREPROCESS,
+    LATENCY_STAGE_QUEUE,        /* Waiting for the inference task */
+    LATENCY_STAGE_INFERENCE,
+    LATENCY_STAGE_DECISION,
+    LATENCY_STAGE_TOTAL,        /* Capture to decision */
+    LATENCY_NUM_STAGES
+} latency_stage_t;
+
+typedef struct
+{
+    latency_time_t points[LATENCY_NUM_POINTS];  /* LATENCY_NOW() at each point */
+} latency_stamps_t;
+
+/* Times of one stage, or of any other measure with latency_histogram_add() */
+typedef struct
+{
+    uint32_t count;
+    uint32_t max_us;
+    uint32_t buckets[LATENCY_NUM_BUCKETS];
+} latency_histogram_t;
+
+typedef struct
+{
+    uint32_t count;             /* Windows measured since reset */
+    uint32_t p50_us;
+    uint32_t p90_us;
+    uint32_t p99_us;
+    uint32_t max_us;
+} latency_summary_t;
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+#if LATENCY_ENABLE
+#define LATENCY_MARK(stamps, point)     ((stamps)->points[(point)] = LATENCY_NOW())
+#define LATENCY_SET(stamps, point, now) ((stamps)->points[(point)] = (now))
+#define LATENCY_RECORD(stamps)          latency_record(stamps)
+#else
+#define LATENCY_MARK(stamps, point)
+#define LATENCY_SET(stamps, point, now)
+#define LATENCY_RECORD(stamps)
+#endif
+
+/*******************************************************************************
+* Functions
+*******************************************************************************/
+void latency_record(const latency_stamps_t *stamps);
+void latency_reset(void);
+void latency_get_summary(latency_stage_t stage, latency_summary_t *summary);
+const char *latency_stage_name(latency_stage_t stage);
+void latency_histogram_add(latency_histogram_t *histogram, uint64_t ticks);
+void latency_histogram_get_summary(const latency_histogram_t *histogram, latency_summary_t *summary);
+
+#endif /* LATENCY_H */
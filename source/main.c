@@ -41,6 +41,12 @@
 *******************************************************************************/
 
 #include <gesture.h>
+#include "alloc_guard.h"
+#include "output.h"
+#include "stream.h"
+#include "console.h"
+#include "instrument.h"
+#include "pipeline.h"
 #include "cy_pdl.h"
 #include "cyhal.h"
 #include "cybsp.h"
@@ -50,18 +56,22 @@
 #include "task.h"
 
 
-/*******************************************************************************
-* Constants
-*******************************************************************************/
-#define TASK_STACK_SIZE 4096
-#define TASK_PRIORITY   2
-
 /*******************************************************************************
 * Global Variables
 ********************************************************************************/
 /* This enables RTOS aware debugging */
 volatile int uxTopUsedPriority;
 
+#if STATIC_ALLOCATION
+/* Memory of the gesture tasks */
+static StackType_t gesture_task_stack[PIPELINE_ACQUIRE_STACK_SIZE];
+static StaticTask_t gesture_task_tcb;
+#if !GESTURE_DATA_COLLECTION_MODE
+static StackType_t inference_task_stack[PIPELINE_INFERENCE_STACK_SIZE];
+static StaticTask_t inference_task_tcb;
+#endif
+#endif
+
 /*******************************************************************************
 * Function Name: main
 ********************************************************************************
@@ -69,7 +79,7 @@ volatile int uxTopUsedPriority;
 * This is the main function for CM4 CPU. It does...
 *    1. Initializes the BSP.
 *    2. Prints welcome message
-*    3. Initializes the task to run the inference engine
+*    3. Initializes the tasks to pre-process data and run the inference engine
 *    4. Starts the scheduler
 *
 * Parameters:
@@ -96,6 +106,9 @@ int main(void)
     /* Enable global interrupts */
     __enable_irq();
 
+    /* Start the cycle counter of the timers and statistics */
+    instrument_init();
+
     /* Initialize retarget-io to use the debug UART port */
     cy_retarget_io_init(CYBSP_DEBUG_UART_TX, CYBSP_DEBUG_UART_RX, CY_RETARGET_IO_BAUDRATE);
 
@@ -106,8 +119,47 @@ int main(void)
            "Gesture Detection Code Example"
            "****************** \r\n\n");
 
-    /* Create one task, processes all sensor data and feeds it to the inference engine */
-    xTaskCreate(gesture_task, "Gesture task", TASK_STACK_SIZE, NULL, TASK_PRIORITY, NULL);
+    /* From now on, the terminal output is sent in the background */
+    result = output_init();
+    if (result != CY_RSLT_SUCCESS)
+    {
+        CY_ASSERT(0);
+    }
+
+    /* Frames can be sent by any task once their buffer is locked */
+    result = stream_init();
+    if (result != CY_RSLT_SUCCESS)
+    {
+        CY_ASSERT(0);
+    }
+
+#if !GESTURE_REPLAY_MODE
+    /* Answer the metrics commands received on the debug UART, which receives
+     * the windows in replay mode */
+    result = console_init();
+    if (result != CY_RSLT_SUCCESS)
+    {
+        CY_ASSERT(0);
+    }
+#endif
+
+    /* Create the acquisition task, processes all sensor data, and the
+     * inference task, feeds it to the inference engine */
+#if STATIC_ALLOCATION
+    xTaskCreateStatic(gesture_task, "Gesture task", PIPELINE_ACQUIRE_STACK_SIZE, NULL,
+                      PIPELINE_ACQUIRE_PRIORITY, gesture_task_stack, &gesture_task_tcb);
+#if !GESTURE_DATA_COLLECTION_MODE
+    xTaskCreateStatic(gesture_inference_task, "Inference task", PIPELINE_INFERENCE_STACK_SIZE, NULL,
+                      PIPELINE_INFERENCE_PRIORITY, inference_task_stack, &inference_task_tcb);
+#endif
+#else
+    xTaskCreate(gesture_task, "Gesture task", PIPELINE_ACQUIRE_STACK_SIZE, NULL,
+                PIPELINE_ACQUIRE_PRIORITY, NULL);
+#if !GESTURE_DATA_COLLECTION_MODE
+    xTaskCreate(gesture_inference_task, "Inference task", PIPELINE_INFERENCE_STACK_SIZE, NULL,
+                PIPELINE_INFERENCE_PRIORITY, NULL);
+#endif
+#endif
 
     /* Start the FreeRTOS scheduler */
     vTaskStartScheduler();
@@ -135,6 +187,9 @@ void vApplicationDaemonTaskStartupHook(void)
         /* Reset the system on sensor fail */
         NVIC_SystemReset();
     }
+
+    /* Init is done, the steady-state path must not use the heap */
+    alloc_guard_lock();
 }
 
 
@@ -0,0 +1,268 @@
+/******************************************************************************
+* File Name:   model_registry.c
+*
+* Description: This file contains the implementation of the model registry.
+*              Each registered model runs on the shared pre-processed window
+*              with its own schedule, and its latency is accounted separately.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2021-2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "model_registry.h"
+#include "trace.h"
+#include "instrument.h"
+
+#include "cyhal.h"
+
+#include <string.h>
+
+/*******************************************************************************
+* Typedefs
+*******************************************************************************/
+typedef struct
+{
+    const char *name;
+    model_registry_run_t run;
+    void *context;
+    uint32_t period;            /* Runs once every period windows, 0 disables it */
+    uint32_t offset;            /* Window of the period the model runs on */
+    model_registry_stats_t stats;
+} model_registry_entry_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static model_registry_entry_t model_registry_entries[MODEL_REGISTRY_MAX_MODELS];
+static int model_registry_count;
+
+/* Number of windows dispatched since reset */
+static uint32_t model_registry_window;
+
+/*******************************************************************************
+* Function Name: model_registry_init
+********************************************************************************
+* Summary:
+*   Clears the registry. The latency of each model run is counted with the
+*   cycle counter started by instrument_init.
+*
+*******************************************************************************/
+void model_registry_init(void)
+{
+    memset(model_registry_entries, 0, sizeof(model_registry_entries));
+    model_registry_count = 0;
+    model_registry_window = 0;
+}
+
+/*******************************************************************************
+* Function Name: model_registry_add
+********************************************************************************
+* Summary:
+*   Registers a model to run on the pre-processed windows. A model with a period
+*   of 4 and an offset of 1 runs on windows 1, 5, 9... so models with the same
+*   period can be spread over different windows.
+*
+* Parameters:
+*   name: Name of the model, used for reporting
+*   run: Function that runs the model on a window
+*   context: Passed to the run function
+*   period: Runs once every period windows, 0 registers the model disabled
+*   offset: Window of the period the model runs on, lower than period
+*   id: Returns the identifier of the model
+*
+* Return:
+*   The status of the registration.
+*******************************************************************************/
+cy_rslt_t model_registry_add(const char *name, model_registry_run_t run, void *context,
+                             uint32_t period, uint32_t offset, int *id)
+{
+    model_registry_entry_t *entry;
+
+    if ((NULL == run) || ((0 != period) && (offset >= period)))
+    {
+        return MODEL_REGISTRY_RSLT_BAD_ARG;
+    }
+
+    if (model_registry_count >= (int)MODEL_REGISTRY_MAX_MODELS)
+    {
+        return MODEL_REGISTRY_RSLT_FULL;
+    }
+
+    entry = &model_registry_entries[model_registry_count];
+    entry->name = name;
+    entry->run = run;
+    entry->context = context;
+    entry->period = period;
+    entry->offset = offset;
+
+    if (NULL != id)
+    {
+        *id = model_registry_count;
+    }
+    model_registry_count++;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: model_registry_set_schedule
+********************************************************************************
+* Summary:
+*   Changes the duty cycle of a model. Takes effect on the next window.
+*
+* Parameters:
+*   id: The identifier returned by model_registry_add
+*   period: Runs once every period windows, 0 disables the model
+*   offset: Window of the period the model runs on, lower than period
+*
+* Return:
+*   The status of the change.
+*******************************************************************************/
+cy_rslt_t model_registry_set_schedule(int id, uint32_t period, uint32_t offset)
+{
+    uint32_t state;
+
+    if ((id < 0) || (id >= model_registry_count) || ((0 != period) && (offset >= period)))
+    {
+        return MODEL_REGISTRY_RSLT_BAD_ARG;
+    }
+
+    /* Dispatch reads the period and offset together */
+    state = cyhal_system_critical_section_enter();
+    model_registry_entries[id].period = period;
+    model_registry_entries[id].offset = offset;
+    cyhal_system_critical_section_exit(state);
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: model_registry_dispatch
+********************************************************************************
+* Summary:
+*   Runs every model scheduled for this window, in registration order, on the
+*   same pre-processed window.
+*
+* Parameters:
+*   window: Pre-processed data, shared by all models
+*
+*******************************************************************************/
+void model_registry_dispatch(const float *window)
+{
+    uint32_t start;
+    uint32_t cycles;
+
+    for (int id = 0; id < model_registry_count; id++)
+    {
+        model_registry_entry_t *entry = &model_registry_entries[id];
+        uint32_t period;
+        uint32_t offset;
+        uint32_t state;
+
+        /* Read the schedule as set by model_registry_set_schedule */
+        state = cyhal_system_critical_section_enter();
+        period = entry->period;
+        offset = entry->offset;
+        cyhal_system_critical_section_exit(state);
+
+        /* Check if the model is due on this window */
+        if ((0 == period) || ((model_registry_window % period) != offset))
+        {
+            continue;
+        }
+
+        TRACE_BEGIN(TRACE_MODEL_RUN, id);
+        start = INSTRUMENT_NOW();
+        entry->run(window, entry->context);
+        cycles = INSTRUMENT_NOW() - start;
+        TRACE_END(TRACE_MODEL_RUN, id);
+
+        entry->stats.runs++;
+        entry->stats.last_cycles = cycles;
+        entry->stats.total_cycles += cycles;
+        if (cycles > entry->stats.max_cycles)
+        {
+            entry->stats.max_cycles = cycles;
+        }
+    }
+
+    model_registry_window++;
+}
+
+/*******************************************************************************
+* Function Name: model_registry_get_count
+********************************************************************************
+* Summary:
+*   Returns the number of registered models.
+*
+*******************************************************************************/
+int model_registry_get_count(void)
+{
+    return model_registry_count;
+}
+
+/*******************************************************************************
+* Function Name: model_registry_get_name
+********************************************************************************
+* Summary:
+*   Returns the name of a registered model.
+*
+*******************************************************************************/
+const char* model_registry_get_name(int id)
+{
+    return ((id >= 0) && (id < model_registry_count)) ? model_registry_entries[id].name : "";
+}
+
+/*******************************************************************************
+* Function Name: model_registry_get_stats
+********************************************************************************
+* Summary:
+*   Returns the latency of the runs of a registered model.
+*
+* Parameters:
+*   id: The identifier returned by model_registry_add
+*   stats: Structure to store the statistics
+*
+*******************************************************************************/
+void model_registry_get_stats(int id, model_registry_stats_t *stats)
+{
+    if ((id >= 0) && (id < model_registry_count))
+    {
+        *stats = model_registry_entries[id].stats;
+    }
+    else
+    {
+        memset(stats, 0, sizeof(*stats));
+    }
+}
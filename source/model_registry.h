@@ -0,0 +1,86 @@
+/******************************************************************************
+* File Name:   model_registry.h
+*
+* Description: This file contains the function prototypes and constants used
+*   in model_registry.c.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2021-2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef MODEL_REGISTRY_H
+#define MODEL_REGISTRY_H
+
+#include <stdint.h>
+
+#include "cy_result.h"
+
+/******************************************************************************
+ * Constants
+ *****************************************************************************/
+#define MODEL_REGISTRY_MAX_MODELS   4u
+
+#define MODEL_REGISTRY_RSLT_FULL    CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_MIDDLEWARE_BASE, 0x28u)
+#define MODEL_REGISTRY_RSLT_BAD_ARG CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_MIDDLEWARE_BASE, 0x29u)
+
+/******************************************************************************
+ * Typedefs
+ *****************************************************************************/
+/* Runs a model on a pre-processed window, which must not be modified */
+typedef void (*model_registry_run_t)(const float *window, void *context);
+
+/* Latency of the runs of a model, in cycles of the cycle counter. This is
+ * wall-clock time: it includes the time the inference task is preempted by
+ * higher priority tasks, such as the acquisition, and by interrupts. */
+typedef struct
+{
+    uint32_t runs;              /* Number of windows the model ran on */
+    uint32_t last_cycles;       /* Time of the last run */
+    uint32_t max_cycles;        /* Worst time of a run */
+    uint64_t total_cycles;      /* Sum of the time of all runs */
+} model_registry_stats_t;
+
+/*******************************************************************************
+* Functions
+*******************************************************************************/
+void model_registry_init(void);
+cy_rslt_t model_registry_add(const char *name, model_registry_run_t run, void *context,
+                             uint32_t period, uint32_t offset, int *id);
+cy_rslt_t model_registry_set_schedule(int id, uint32_t period, uint32_t offset);
+void model_registry_dispatch(const float *window);
+int model_registry_get_count(void);
+const char* model_registry_get_name(int id);
+void model_registry_get_stats(int id, model_registry_stats_t *stats);
+
+#endif /* MODEL_REGISTRY_H */
@@ -0,0 +1,417 @@
+/******************************************************************************
+* File Name:   output.c
+*
+* Description: This file contains the asynchronous terminal output. Messages
+*              are formatted into a ring buffer and returned immediately. A
+*              low priority task hands the buffered bytes to the debug UART,
+*              which sends them with DMA, so the caller never waits for the
+*              UART. When the ring is full, output is dropped following
+*              OUTPUT_DROP_POLICY and counted.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2021-2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "output.h"
+#include "alloc_guard.h"
+#include "trace.h"
+
+#include "cy_pdl.h"
+#include "cyhal.h"
+#include "cy_retarget_io.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+/*******************************************************************************
+* Constants
+*******************************************************************************/
+#define OUTPUT_TASK_STACK_SIZE      512
+#define OUTPUT_TASK_PRIORITY        1
+
+/* Transfer mode of the UART, CYHAL_ASYNC_DMA or CYHAL_ASYNC_SW */
+#define OUTPUT_ASYNC_MODE           CYHAL_ASYNC_DMA
+#define OUTPUT_UART_IRQ_PRIORITY    7u
+
+/* Notification bits of the output task */
+#define OUTPUT_EVENT_DATA           (1u << 0)
+#define OUTPUT_EVENT_TX_DONE        (1u << 1)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static uint8_t output_ring[OUTPUT_RING_SIZE];
+static uint32_t output_read;        /* Oldest byte not sent yet */
+static uint32_t output_used;        /* Bytes from output_read, including the ones being sent */
+
+/* End of each message in the ring, in bytes from the first byte ever queued,
+ * so the drop policy only discards whole messages */
+static uint32_t output_ends[OUTPUT_MAX_MESSAGES];
+static uint32_t output_ends_head;   /* Oldest message */
+static uint32_t output_ends_count;
+static uint32_t output_position;    /* Position of output_read */
+static uint32_t output_sending;     /* Bytes from output_read handed to the UART */
+static output_stats_t output_stats;
+static output_receive_t output_receive;
+
+static TaskHandle_t output_task_handle;
+
+#if STATIC_ALLOCATION
+/* Memory of the output task */
+static StackType_t output_task_stack[OUTPUT_TASK_STACK_SIZE];
+static StaticTask_t output_task_tcb;
+#endif
+
+/*******************************************************************************
+* Local Functions
+*******************************************************************************/
+static void output_task(void *arg);
+static void output_uart_callback(void *callback_arg, cyhal_uart_event_t event);
+static uint32_t output_get_kept(void);
+
+/*******************************************************************************
+* Function Name: output_init
+********************************************************************************
+* Summary:
+*   Sets the debug UART, already initialized by retarget-io, to asynchronous
+*   transfers and creates the task that drains the ring. After this call, all
+*   terminal output must go through output_write or output_printf.
+*
+* Parameters:
+*     None
+*
+* Return:
+*   The status of the initialization.
+*******************************************************************************/
+cy_rslt_t output_init(void)
+{
+    cy_rslt_t result;
+
+    result = cyhal_uart_set_async_mode(&cy_retarget_io_uart_obj, OUTPUT_ASYNC_MODE, OUTPUT_UART_IRQ_PRIORITY);
+    if (CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+
+    cyhal_uart_register_callback(&cy_retarget_io_uart_obj, output_uart_callback, NULL);
+    cyhal_uart_enable_event(&cy_retarget_io_uart_obj, CYHAL_UART_IRQ_TX_DONE, OUTPUT_UART_IRQ_PRIORITY, true);
+
+#if STATIC_ALLOCATION
+    output_task_handle = xTaskCreateStatic(output_task, "Output task", OUTPUT_TASK_STACK_SIZE, NULL,
+                                           OUTPUT_TASK_PRIORITY, output_task_stack, &output_task_tcb);
+#else
+    xTaskCreate(output_task, "Output task", OUTPUT_TASK_STACK_SIZE, NULL,
+                OUTPUT_TASK_PRIORITY, &output_task_handle);
+#endif
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: output_write
+********************************************************************************
+* Summary:
+*   Copies data to the ring as one message and returns without waiting for
+*   the UART. Can be called from any task.
+*
+* Parameters:
+*   data: Bytes to send
+*   size: Number of bytes
+*
+* Return:
+*   The number of bytes queued, 0 if the data was dropped.
+*******************************************************************************/
+uint32_t output_write(const char *data, uint32_t size)
+{
+    uint32_t interrupt_state = Cy_SysLib_EnterCriticalSection();
+
+#if OUTPUT_DROP_POLICY == OUTPUT_DROP_OLDEST
+    uint32_t kept = output_get_kept();
+
+    if (((size > (OUTPUT_RING_SIZE - output_used)) || (OUTPUT_MAX_MESSAGES == output_ends_count)) &&
+        (size <= (OUTPUT_RING_SIZE - kept)) && (kept < output_used))
+    {
+        /* Discard the queued messages, except the ones the UART is sending */
+        output_stats.dropped_bytes += output_used - kept;
+        output_stats.drops++;
+        output_used = kept;
+        while ((output_ends_count > 0) &&
+               (output_ends[(output_ends_head + output_ends_count - 1u) % OUTPUT_MAX_MESSAGES] - output_position > kept))
+        {
+            output_ends_count--;
+        }
+    }
+#endif
+
+    if ((size > (OUTPUT_RING_SIZE - output_used)) || (OUTPUT_MAX_MESSAGES == output_ends_count))
+    {
+        output_stats.dropped_bytes += size;
+        output_stats.drops++;
+        Cy_SysLib_ExitCriticalSection(interrupt_state);
+        return 0;
+    }
+
+    /* Copy after the queued bytes, wrapping around the end of the ring */
+    uint32_t write = (output_read + output_used) % OUTPUT_RING_SIZE;
+    uint32_t first = OUTPUT_RING_SIZE - write;
+    if (first > size)
+    {
+        first = size;
+    }
+    memcpy(&output_ring[write], data, first);
+    memcpy(&output_ring[0], &data[first], size - first);
+
+    output_used += size;
+    output_ends[(output_ends_head + output_ends_count) % OUTPUT_MAX_MESSAGES] = output_position + output_used;
+    output_ends_count++;
+    output_stats.written_bytes += size;
+    if (output_used > output_stats.peak_bytes)
+    {
+        output_stats.peak_bytes = output_used;
+    }
+
+    Cy_SysLib_ExitCriticalSection(interrupt_state);
+
+    if (NULL != output_task_handle)
+    {
+        xTaskNotify(output_task_handle, OUTPUT_EVENT_DATA, eSetBits);
+    }
+
+    return size;
+}
+
+/*******************************************************************************
+* Function Name: output_printf
+********************************************************************************
+* Summary:
+*   Formats a message on the stack of the caller and queues it with
+*   output_write.
+*
+* Parameters:
+*   format: printf format string, followed by its arguments
+*
+* Return:
+*   The number of bytes queued, 0 if the message was dropped.
+*******************************************************************************/
+uint32_t output_printf(const char *format, ...)
+{
+    char line[OUTPUT_LINE_SIZE];
+    va_list args;
+    int length;
+
+    va_start(args, format);
+    length = vsnprintf(line, sizeof(line), format, args);
+    va_end(args);
+
+    if (length < 0)
+    {
+        return 0;
+    }
+    if (length >= (int)sizeof(line))
+    {
+        length = sizeof(line) - 1;
+    }
+
+    return output_write(line, (uint32_t)length);
+}
+
+/*******************************************************************************
+* Function Name: output_get_stats
+********************************************************************************
+* Summary:
+*   Returns the output counters since reset.
+*
+* Parameters:
+*   stats: Structure to store the statistics
+*
+*******************************************************************************/
+void output_get_stats(output_stats_t *stats)
+{
+    uint32_t interrupt_state = Cy_SysLib_EnterCriticalSection();
+    *stats = output_stats;
+    Cy_SysLib_ExitCriticalSection(interrupt_state);
+}
+
+/*******************************************************************************
+* Function Name: output_set_receive
+********************************************************************************
+* Summary:
+*   Enables the receive interrupt of the debug UART. The bytes are passed to
+*   the function as they arrive, nothing is received until it is set.
+*
+* Parameters:
+*   receive: Function called from the UART interrupt for each byte
+*
+*******************************************************************************/
+void output_set_receive(output_receive_t receive)
+{
+    output_receive = receive;
+    cyhal_uart_enable_event(&cy_retarget_io_uart_obj, CYHAL_UART_IRQ_RX_NOT_EMPTY, OUTPUT_UART_IRQ_PRIORITY, true);
+}
+
+/*******************************************************************************
+* Function Name: output_task
+********************************************************************************
+* Summary:
+*   Hands the oldest contiguous bytes of the ring to the UART, and releases
+*   them once the transfer is done.
+*
+* Parameters:
+*   arg: not used
+*
+*******************************************************************************/
+static void output_task(void *arg)
+{
+    uint32_t events;
+    uint32_t chunk;
+    uint32_t interrupt_state;
+
+    (void)arg;
+
+    for(;;)
+    {
+        xTaskNotifyWait(0, UINT32_MAX, &events, portMAX_DELAY);
+
+        interrupt_state = Cy_SysLib_EnterCriticalSection();
+
+        if ((events & OUTPUT_EVENT_TX_DONE) && (0 != output_sending))
+        {
+            /* Release the bytes sent, and the messages they complete */
+            output_read = (output_read + output_sending) % OUTPUT_RING_SIZE;
+            output_used -= output_sending;
+            output_position += output_sending;
+            output_stats.sent_bytes += output_sending;
+            output_sending = 0;
+            while ((output_ends_count > 0) && ((int32_t)(output_ends[output_ends_head] - output_position) <= 0))
+            {
+                output_ends_head = (output_ends_head + 1u) % OUTPUT_MAX_MESSAGES;
+                output_ends_count--;
+            }
+        }
+
+        /* Send up to the end of the ring, the rest goes with the next transfer */
+        chunk = 0;
+        if (0 == output_sending)
+        {
+            chunk = OUTPUT_RING_SIZE - output_read;
+            if (chunk > output_used)
+            {
+                chunk = output_used;
+            }
+            output_sending = chunk;
+        }
+
+        Cy_SysLib_ExitCriticalSection(interrupt_state);
+
+        if (0 != chunk)
+        {
+            TRACE_BEGIN(TRACE_UART_FLUSH, chunk);
+            if (CY_RSLT_SUCCESS != cyhal_uart_write_async(&cy_retarget_io_uart_obj, &output_ring[output_read], chunk))
+            {
+                /* Retry on the next tick */
+                interrupt_state = Cy_SysLib_EnterCriticalSection();
+                output_sending = 0;
+                Cy_SysLib_ExitCriticalSection(interrupt_state);
+                vTaskDelay(1);
+                xTaskNotify(output_task_handle, OUTPUT_EVENT_DATA, eSetBits);
+            }
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: output_uart_callback
+********************************************************************************
+* Summary:
+*   UART interrupt callback, wakes up the output task when a transfer is done
+*   and passes the received bytes on.
+*
+* Parameters:
+*   callback_arg: not used
+*   event: UART events
+*
+*******************************************************************************/
+static void output_uart_callback(void *callback_arg, cyhal_uart_event_t event)
+{
+    BaseType_t higher_priority_task_woken = pdFALSE;
+
+    (void)callback_arg;
+
+    if (0 != (event & CYHAL_UART_IRQ_TX_DONE))
+    {
+        TRACE_END(TRACE_UART_FLUSH, 0);
+        xTaskNotifyFromISR(output_task_handle, OUTPUT_EVENT_TX_DONE, eSetBits, &higher_priority_task_woken);
+        portYIELD_FROM_ISR(higher_priority_task_woken);
+    }
+
+    if (0 != (event & CYHAL_UART_IRQ_RX_NOT_EMPTY))
+    {
+        uint8_t data;
+
+        /* Empty the receive FIFO, so the interrupt is not raised again */
+        while ((0 != cyhal_uart_readable(&cy_retarget_io_uart_obj)) &&
+               (CY_RSLT_SUCCESS == cyhal_uart_getc(&cy_retarget_io_uart_obj, &data, 0)))
+        {
+            if (NULL != output_receive)
+            {
+                output_receive(data);
+            }
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: output_get_kept
+********************************************************************************
+* Summary:
+*   Returns the bytes from output_read up to the end of the last message the
+*   UART is sending. A transfer stops at the end of the ring, so it can end
+*   in the middle of a message. Must be called in a critical section.
+*
+*******************************************************************************/
+static uint32_t output_get_kept(void)
+{
+    uint32_t kept = 0;
+
+    for (uint32_t i = 0; (i < output_ends_count) && (kept < output_sending); i++)
+    {
+        kept = output_ends[(output_ends_head + i) % OUTPUT_MAX_MESSAGES] - output_position;
+    }
+
+    return kept;
+}
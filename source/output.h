@@ -0,0 +1,92 @@
+/******************************************************************************
+* File Name:   output.h
+*
+* Description: This file contains the function prototypes and constants used
+*   in output.c.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2021-2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef OUTPUT_H
+#define OUTPUT_H
+
+#include <stdint.h>
+
+#include "cy_result.h"
+
+/******************************************************************************
+ * Constants
+ *****************************************************************************/
+/* Bytes of formatted output waiting for the UART */
+#define OUTPUT_RING_SIZE        2048u
+
+/* Longest message formatted by output_printf, longer ones are truncated */
+#define OUTPUT_LINE_SIZE        128u
+
+/* Messages waiting in the ring, a message that does not fit is dropped */
+#define OUTPUT_MAX_MESSAGES     64u
+
+/* Define what is dropped when a message does not fit in the ring */
+/* OUTPUT_DROP_NEWEST - the message being written */
+/* OUTPUT_DROP_OLDEST - the queued messages not yet handed to the UART (default) */
+#define OUTPUT_DROP_NEWEST      0u
+#define OUTPUT_DROP_OLDEST      1u
+#define OUTPUT_DROP_POLICY      OUTPUT_DROP_OLDEST
+
+/******************************************************************************
+ * Typedefs
+ *****************************************************************************/
+/* Called from the UART interrupt for each received byte, must not block */
+typedef void (*output_receive_t)(uint8_t data);
+
+typedef struct
+{
+    uint32_t written_bytes;     /* Bytes queued in the ring */
+    uint32_t sent_bytes;        /* Bytes sent by the UART */
+    uint32_t dropped_bytes;     /* Bytes lost to the drop policy */
+    uint32_t drops;             /* Number of times output was dropped */
+    uint32_t peak_bytes;        /* Highest number of bytes waiting in the ring */
+} output_stats_t;
+
+/*******************************************************************************
+* Functions
+*******************************************************************************/
+cy_rslt_t output_init(void);
+uint32_t output_write(const char *data, uint32_t size);
+uint32_t output_printf(const char *format, ...);
+void output_get_stats(output_stats_t *stats);
+void output_set_receive(output_receive_t receive);
+
+#endif /* OUTPUT_H */
@@ -0,0 +1,247 @@
+/******************************************************************************
+* File Name:   pipeline.c
+*
+* Description: This file contains the queues between the acquisition and the
+*              inference stages. The windows are passed by reference: a fixed
+*              pool of window buffers circulates through a free queue and a
+*              ready queue, so no sample is copied between the stages.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2021-2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "pipeline.h"
+#include "alloc_guard.h"
+
+#include "FreeRTOS.h"
+#include "queue.h"
+#include "task.h"
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static pipeline_window_t pipeline_windows[PIPELINE_NUM_WINDOWS];
+
+/* Both queues hold pointers to pipeline_windows, each deep enough for all of them */
+static QueueHandle_t pipeline_free_queue;
+static QueueHandle_t pipeline_ready_queue;
+
+static uint32_t pipeline_sequence;
+static pipeline_stats_t pipeline_stats;
+
+#if STATIC_ALLOCATION
+/* Memory of the queues */
+static uint8_t pipeline_free_storage[PIPELINE_NUM_WINDOWS * sizeof(pipeline_window_t *)];
+static uint8_t pipeline_ready_storage[PIPELINE_NUM_WINDOWS * sizeof(pipeline_window_t *)];
+static StaticQueue_t pipeline_free_queue_buffer;
+static StaticQueue_t pipeline_ready_queue_buffer;
+#endif
+
+/*******************************************************************************
+* Local Functions
+*******************************************************************************/
+static pipeline_window_t *pipeline_receive(QueueHandle_t queue, pipeline_stage_stats_t *stats);
+
+/*******************************************************************************
+* Function Name: pipeline_init
+********************************************************************************
+* Summary:
+*   Creates the queues between the stages and puts all the window buffers in
+*   the free queue. Must be called before the stage tasks run.
+*
+* Parameters:
+*     None
+*
+* Return:
+*   The status of the initialization.
+*******************************************************************************/
+cy_rslt_t pipeline_init(void)
+{
+#if STATIC_ALLOCATION
+    pipeline_free_queue = xQueueCreateStatic(PIPELINE_NUM_WINDOWS, sizeof(pipeline_window_t *),
+                                             pipeline_free_storage, &pipeline_free_queue_buffer);
+    pipeline_ready_queue = xQueueCreateStatic(PIPELINE_NUM_WINDOWS, sizeof(pipeline_window_t *),
+                                              pipeline_ready_storage, &pipeline_ready_queue_buffer);
+#else
+    pipeline_free_queue = xQueueCreate(PIPELINE_NUM_WINDOWS, sizeof(pipeline_window_t *));
+    pipeline_ready_queue = xQueueCreate(PIPELINE_NUM_WINDOWS, sizeof(pipeline_window_t *));
+#endif
+    if ((NULL == pipeline_free_queue) || (NULL == pipeline_ready_queue))
+    {
+        return PIPELINE_RSLT_NO_MEMORY;
+    }
+
+    for (uint32_t i = 0; i < PIPELINE_NUM_WINDOWS; i++)
+    {
+        pipeline_window_t *window = &pipeline_windows[i];
+        xQueueSend(pipeline_free_queue, &window, 0);
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: pipeline_get_free
+********************************************************************************
+* Summary:
+*   Returns a window buffer for the acquisition stage to fill. Blocks while
+*   the inference stage holds all of them.
+*
+* Return:
+*   The window buffer.
+*******************************************************************************/
+pipeline_window_t *pipeline_get_free(void)
+{
+    return pipeline_receive(pipeline_free_queue, &pipeline_stats.stages[PIPELINE_STAGE_ACQUIRE]);
+}
+
+/*******************************************************************************
+* Function Name: pipeline_submit
+********************************************************************************
+* Summary:
+*   Hands a filled window buffer to the inference stage. Never blocks, the
+*   ready queue has room for every buffer.
+*
+* Parameters:
+*   window: Buffer returned by pipeline_get_free
+*
+*******************************************************************************/
+void pipeline_submit(pipeline_window_t *window)
+{
+    uint32_t depth;
+
+    window->sequence = pipeline_sequence++;
+    xQueueSend(pipeline_ready_queue, &window, 0);
+
+    depth = (uint32_t)uxQueueMessagesWaiting(pipeline_ready_queue);
+    pipeline_stats.stages[PIPELINE_STAGE_ACQUIRE].windows++;
+    if (depth > pipeline_stats.peak_depth)
+    {
+        pipeline_stats.peak_depth = depth;
+    }
+}
+
+/*******************************************************************************
+* Function Name: pipeline_get_ready
+********************************************************************************
+* Summary:
+*   Returns the oldest filled window for the inference stage. Blocks until the
+*   acquisition stage submits one.
+*
+* Return:
+*   The window buffer.
+*******************************************************************************/
+pipeline_window_t *pipeline_get_ready(void)
+{
+    return pipeline_receive(pipeline_ready_queue, &pipeline_stats.stages[PIPELINE_STAGE_INFERENCE]);
+}
+
+/*******************************************************************************
+* Function Name: pipeline_release
+********************************************************************************
+* Summary:
+*   Gives a window buffer back to the acquisition stage once the inference
+*   stage is done with it.
+*
+* Parameters:
+*   window: Buffer returned by pipeline_get_ready
+*
+*******************************************************************************/
+void pipeline_release(pipeline_window_t *window)
+{
+    xQueueSend(pipeline_free_queue, &window, 0);
+    pipeline_stats.stages[PIPELINE_STAGE_INFERENCE].windows++;
+}
+
+/*******************************************************************************
+* Function Name: pipeline_get_depth
+********************************************************************************
+* Summary:
+*   Returns the number of windows waiting for the inference stage.
+*
+*******************************************************************************/
+uint32_t pipeline_get_depth(void)
+{
+    return (uint32_t)uxQueueMessagesWaiting(pipeline_ready_queue);
+}
+
+/*******************************************************************************
+* Function Name: pipeline_get_stats
+********************************************************************************
+* Summary:
+*   Returns the counters of each stage since reset and the current depth of
+*   the ready queue.
+*
+* Parameters:
+*   stats: Structure to store the statistics
+*
+*******************************************************************************/
+void pipeline_get_stats(pipeline_stats_t *stats)
+{
+    *stats = pipeline_stats;
+    stats->depth = pipeline_get_depth();
+}
+
+/*******************************************************************************
+* Function Name: pipeline_receive
+********************************************************************************
+* Summary:
+*   Takes a window buffer from a queue, and accounts the time blocked on it
+*   as a stall of the stage. A stall of the acquisition stage means inference
+*   is falling behind; the inference stage stalls while it waits for data.
+*
+* Parameters:
+*   queue: Queue to take the buffer from
+*   stats: Counters of the stage
+*
+* Return:
+*   The window buffer.
+*******************************************************************************/
+static pipeline_window_t *pipeline_receive(QueueHandle_t queue, pipeline_stage_stats_t *stats)
+{
+    pipeline_window_t *window;
+    TickType_t start;
+
+    if (pdTRUE == xQueueReceive(queue, &window, 0))
+    {
+        return window;
+    }
+
+    start = xTaskGetTickCount();
+    stats->stalls++;
+    xQueueReceive(queue, &window, portMAX_DELAY);
+    stats->stall_ticks += (uint32_t)(xTaskGetTickCount() - start);
+
+    return window;
+}
@@ -0,0 +1,109 @@
+/******************************************************************************
+* File Name:   pipeline.h
+*
+* Description: This file contains the function prototypes and constants used
+*   in pipeline.c.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2021-2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef PIPELINE_H
+#define PIPELINE_H
+
+#include "sensor.h"
+#include "latency.h"
+
+#include "cy_result.h"
+
+#include <stdint.h>
+
+/******************************************************************************
+ * Constants
+ *****************************************************************************/
+/* Window buffers shared by the stages. One is filled by the acquisition stage,
+ * one is read by the inference stage, the others wait in between. */
+#define PIPELINE_NUM_WINDOWS            3u
+
+/* Tasks of the stages. The acquisition stage has the higher priority, so it
+ * pre-processes the next window while the inference stage runs. */
+#define PIPELINE_ACQUIRE_PRIORITY       2
+#define PIPELINE_ACQUIRE_STACK_SIZE     1024
+#define PIPELINE_INFERENCE_PRIORITY     1
+#define PIPELINE_INFERENCE_STACK_SIZE   4096
+
+/* Stages, to index pipeline_stats_t */
+#define PIPELINE_STAGE_ACQUIRE          0u
+#define PIPELINE_STAGE_INFERENCE        1u
+#define PIPELINE_NUM_STAGES             2u
+
+#define PIPELINE_RSLT_NO_MEMORY         CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_MIDDLEWARE_BASE, 0x2Au)
+
+/******************************************************************************
+ * Typedefs
+ *****************************************************************************/
+typedef struct
+{
+    uint32_t sequence;          /* Index of the window since reset */
+    uint32_t timestamp;         /* RTOS tick when the sensor completed the window */
+    latency_stamps_t latency;   /* Time at each stage boundary */
+    float data[SENSOR_BATCH_SIZE][SENSOR_NUM_AXIS];
+} pipeline_window_t;
+
+typedef struct
+{
+    uint32_t windows;           /* Windows the stage handed over */
+    uint32_t stalls;            /* Times the stage blocked on an empty input queue */
+    uint32_t stall_ticks;       /* RTOS ticks spent blocked on the input queue */
+} pipeline_stage_stats_t;
+
+typedef struct
+{
+    pipeline_stage_stats_t stages[PIPELINE_NUM_STAGES];
+    uint32_t depth;             /* Windows waiting for the inference stage */
+    uint32_t peak_depth;        /* Most windows that waited for the inference stage */
+} pipeline_stats_t;
+
+/*******************************************************************************
+* Functions
+*******************************************************************************/
+cy_rslt_t pipeline_init(void);
+pipeline_window_t *pipeline_get_free(void);
+void pipeline_submit(pipeline_window_t *window);
+pipeline_window_t *pipeline_get_ready(void);
+void pipeline_release(pipeline_window_t *window);
+uint32_t pipeline_get_depth(void);
+void pipeline_get_stats(pipeline_stats_t *stats);
+
+#endif /* PIPELINE_H */
@@ -0,0 +1,714 @@
+/******************************************************************************
+* File Name:   precision.c
+*
+* Description: This file contains the implementation to select the precision
+*              of the neural network at run time. Each linked model variant is
+*              initialized once, so switching between windows only changes the
+*              active model and its quantize/dequantize path.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2021-2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "precision.h"
+#include "sensor.h"
+#include "instrument.h"
+
+#include "mtb_ml_utils.h"
+#include "mtb_ml_common.h"
+
+#include <math.h>
+#include <string.h>
+
+#if !PRECISION_RUNTIME_SWITCH
+/* Include model files */
+#include MTB_ML_INCLUDE_MODEL_FILE(MODEL_NAME)
+#endif
+
+/*******************************************************************************
+* Constants
+*******************************************************************************/
+#define PRECISION_INPUT_SIZE    (SENSOR_BATCH_SIZE * SENSOR_NUM_AXIS)
+
+/* Precision selected by NN_TYPE, used after reset */
+#if COMPONENT_ML_FLOAT32
+    #define PRECISION_DEFAULT   PRECISION_FLOAT
+#elif COMPONENT_ML_INT8x8
+    #define PRECISION_DEFAULT   PRECISION_INT8x8
+#elif COMPONENT_ML_INT16x8
+    #define PRECISION_DEFAULT   PRECISION_INT16x8
+#else
+    #define PRECISION_DEFAULT   PRECISION_INT16x16
+#endif
+
+/* Q-format of the input data for the fixed-point variants */
+#define QFORMAT_VALUE_INT8      7
+#define QFORMAT_VALUE_INT16     15
+
+/*******************************************************************************
+* Typedefs
+*******************************************************************************/
+typedef struct
+{
+    const char *name;
+    mtb_ml_model_bin_t *bin;    /* NULL if the variant is not linked */
+    int q_fraction_bits;        /* 0 for the floating-point variant */
+    mtb_ml_model_t *model;
+    MTB_ML_DATA_T *output;
+    int output_size;
+    int32_t thresholds[CONTROL_NUM_CLASSES];    /* CONTROL_THRESHOLDS in the output format */
+    int32_t band_low;           /* Cascade band in the output format */
+    int32_t band_high;
+    precision_stats_t stats;
+} precision_variant_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+#if PRECISION_RUNTIME_SWITCH
+/* Model binaries defined in the source/precision_models wrappers */
+#if PRECISION_HAS_float
+extern mtb_ml_model_bin_t precision_float_bin;
+#endif
+#if PRECISION_HAS_int8x8
+extern mtb_ml_model_bin_t precision_int8x8_bin;
+#endif
+#else
+/* Only the NN_TYPE variant is linked */
+static mtb_ml_model_bin_t precision_default_bin = {MTB_ML_MODEL_BIN_DATA(MODEL_NAME)};
+#endif
+
+static precision_variant_t precision_variants[PRECISION_COUNT] =
+{
+    [PRECISION_FLOAT]    = { .name = "float",    .q_fraction_bits = 0 },
+    [PRECISION_INT8x8]   = { .name = "int8x8",   .q_fraction_bits = QFORMAT_VALUE_INT8 },
+    [PRECISION_INT16x8]  = { .name = "int16x8",  .q_fraction_bits = QFORMAT_VALUE_INT16 },
+    [PRECISION_INT16x16] = { .name = "int16x16", .q_fraction_bits = QFORMAT_VALUE_INT16 },
+};
+
+/* Active variant and the one requested for the next window */
+static precision_variant_t *precision_active;
+static volatile precision_type_t precision_pending;
+
+/* Variant that produced the last output */
+static precision_variant_t *precision_output;
+
+/* Ambiguity band of the cascade, and its cost */
+static float precision_cascade_band = PRECISION_CASCADE_BAND;
+static precision_cascade_stats_t precision_cascade_stats;
+
+#if !COMPONENT_ML_FLOAT32
+/* Quantized input for the fixed-point variants */
+static MTB_ML_DATA_T precision_input[PRECISION_INPUT_SIZE];
+#endif
+
+/*******************************************************************************
+* Local Functions
+*******************************************************************************/
+static bool precision_apply_pending(void);
+static cy_rslt_t precision_run_variant(precision_variant_t *variant, const float *window);
+static int precision_dequantize(precision_variant_t *variant, float *probabilities);
+static int precision_top_class(const precision_variant_t *variant);
+static bool precision_is_ambiguous(const precision_variant_t *variant);
+#if !COMPONENT_ML_FLOAT32
+static void precision_quantize_thresholds(precision_variant_t *variant);
+static void precision_quantize_band(precision_variant_t *variant);
+#endif
+
+/*******************************************************************************
+* Function Name: precision_init
+********************************************************************************
+* Summary:
+*   Initializes every linked model variant and selects the NN_TYPE variant as
+*   the active one. The cycle counter is started by instrument_init.
+*
+* Parameters:
+*     None
+*
+* Return:
+*   The status of the initialization.
+*******************************************************************************/
+cy_rslt_t precision_init(void)
+{
+    cy_rslt_t result;
+
+#if PRECISION_RUNTIME_SWITCH
+#if PRECISION_HAS_float
+    precision_variants[PRECISION_FLOAT].bin = &precision_float_bin;
+#endif
+#if PRECISION_HAS_int8x8
+    precision_variants[PRECISION_INT8x8].bin = &precision_int8x8_bin;
+#endif
+#else
+    precision_variants[PRECISION_DEFAULT].bin = &precision_default_bin;
+#endif
+
+    for (int type = 0; type < PRECISION_COUNT; type++)
+    {
+        precision_variant_t *variant = &precision_variants[type];
+
+        if (NULL == variant->bin)
+        {
+            continue;
+        }
+
+        /* Initialize the Neural Network */
+        result = mtb_ml_model_init(variant->bin, NULL, &variant->model);
+        if(CY_RSLT_SUCCESS != result)
+        {
+            return result;
+        }
+
+#if !COMPONENT_ML_FLOAT32
+        if (PRECISION_FLOAT != type)
+        {
+            /* Set the q-factor */
+            mtb_ml_model_set_input_q_fraction_bits(variant->model, variant->q_fraction_bits);
+        }
+#endif
+
+        mtb_ml_model_get_output(variant->model, &variant->output, &variant->output_size);
+
+#if !COMPONENT_ML_FLOAT32
+        if (PRECISION_FLOAT != type)
+        {
+            /* Decisions are made on the fixed-point output */
+            precision_quantize_thresholds(variant);
+            precision_quantize_band(variant);
+        }
+#endif
+    }
+
+    precision_active = &precision_variants[PRECISION_DEFAULT];
+    precision_pending = PRECISION_DEFAULT;
+    precision_output = precision_active;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: precision_is_linked
+********************************************************************************
+* Summary:
+*   Checks if a model variant is linked in the firmware.
+*
+* Parameters:
+*   type: The precision to check
+*
+* Return:
+*   True if the variant can be selected with precision_set.
+*******************************************************************************/
+bool precision_is_linked(precision_type_t type)
+{
+    return (type < PRECISION_COUNT) && (NULL != precision_variants[type].model);
+}
+
+/*******************************************************************************
+* Function Name: precision_set
+********************************************************************************
+* Summary:
+*   Requests a model variant. The switch is applied before the next window is
+*   processed, so a window is never split between two variants. Can be called
+*   from any task.
+*
+* Parameters:
+*   type: The precision to use for the next windows
+*
+* Return:
+*   PRECISION_RSLT_NOT_LINKED if the variant is not in the firmware.
+*******************************************************************************/
+cy_rslt_t precision_set(precision_type_t type)
+{
+    if (!precision_is_linked(type))
+    {
+        return PRECISION_RSLT_NOT_LINKED;
+    }
+
+    precision_pending = type;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: precision_get
+********************************************************************************
+* Summary:
+*   Returns the precision of the active model variant.
+*
+*******************************************************************************/
+precision_type_t precision_get(void)
+{
+    return (precision_type_t)(precision_active - precision_variants);
+}
+
+/*******************************************************************************
+* Function Name: precision_get_name
+********************************************************************************
+* Summary:
+*   Returns the NN_TYPE name of a precision, e.g. "int8x8".
+*
+*******************************************************************************/
+const char* precision_get_name(precision_type_t type)
+{
+    return (type < PRECISION_COUNT) ? precision_variants[type].name : "";
+}
+
+/*******************************************************************************
+* Function Name: precision_get_model
+********************************************************************************
+* Summary:
+*   Returns the model object of the active variant.
+*
+*******************************************************************************/
+mtb_ml_model_t* precision_get_model(void)
+{
+    return precision_active->model;
+}
+
+/*******************************************************************************
+* Function Name: precision_run
+********************************************************************************
+* Summary:
+*   Applies a pending precision switch, quantizes the window if the active
+*   variant is fixed-point, and feeds it to the model.
+*
+* Parameters:
+*   window: Pre-processed data, SENSOR_BATCH_SIZE x SENSOR_NUM_AXIS floats
+*
+* Return:
+*   The status of the inference.
+*******************************************************************************/
+cy_rslt_t precision_run(const float *window)
+{
+    cy_rslt_t result;
+    bool switched;
+
+    switched = precision_apply_pending();
+
+    result = precision_run_variant(precision_active, window);
+    precision_output = precision_active;
+
+    if (switched)
+    {
+        /* First window after a switch, compare against the average */
+        precision_active->stats.switch_cycles = precision_active->stats.last_cycles;
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: precision_get_output
+********************************************************************************
+* Summary:
+*   Converts the output of the last inference to floating-point probabilities.
+*   Only needed to read the confidence of each class, see precision_decide.
+*
+* Parameters:
+*   probabilities: Buffer to store the model output size number of values
+*
+* Return:
+*   The model output size.
+*******************************************************************************/
+int precision_get_output(float *probabilities)
+{
+    return precision_dequantize(precision_output, probabilities);
+}
+
+/*******************************************************************************
+* Function Name: precision_decide
+********************************************************************************
+* Summary:
+*   Selects the class of the last inference and checks it against the class
+*   threshold. Fixed-point outputs are compared as is against the thresholds
+*   quantized at init, so the output is not dequantized.
+*
+* Parameters:
+*   decision: Structure to store the decision
+*
+* Return:
+*   The model output size.
+*******************************************************************************/
+int precision_decide(control_decision_t *decision)
+{
+    const precision_variant_t *variant = precision_output;
+
+#if !COMPONENT_ML_FLOAT32
+    if (0 != variant->q_fraction_bits)
+    {
+        decision->class_index = precision_top_class(variant);
+        decision->detected = (decision->class_index < CONTROL_NUM_CLASSES) &&
+                             (variant->output[decision->class_index] > variant->thresholds[decision->class_index]);
+
+        /* Only the selected class is dequantized */
+        decision->confidence = (float)(variant->output[decision->class_index] - variant->model->output_zero_point) *
+                               variant->model->output_scale;
+    }
+    else
+#endif
+    {
+        control_decide((const float *) variant->output, variant->output_size, decision);
+    }
+
+    return variant->output_size;
+}
+
+/*******************************************************************************
+* Function Name: precision_get_stats
+********************************************************************************
+* Summary:
+*   Returns the measured cost of a model variant.
+*
+* Parameters:
+*   type: The precision to query
+*   stats: Structure to store the statistics
+*
+*******************************************************************************/
+void precision_get_stats(precision_type_t type, precision_stats_t *stats)
+{
+    if (type < PRECISION_COUNT)
+    {
+        *stats = precision_variants[type].stats;
+    }
+    else
+    {
+        memset(stats, 0, sizeof(*stats));
+    }
+}
+
+/*******************************************************************************
+* Function Name: precision_cascade_set_band
+********************************************************************************
+* Summary:
+*   Sets the ambiguity band of the cascade. A window runs the second variant
+*   when its top confidence is within the band around MIN_CONFIDENCE.
+*
+* Parameters:
+*   band: Half-width of the band, 0 disables the second variant
+*
+*******************************************************************************/
+void precision_cascade_set_band(float band)
+{
+    precision_cascade_band = band;
+
+#if !COMPONENT_ML_FLOAT32
+    for (int type = 0; type < PRECISION_COUNT; type++)
+    {
+        if ((NULL != precision_variants[type].model) && (0 != precision_variants[type].q_fraction_bits))
+        {
+            precision_quantize_band(&precision_variants[type]);
+        }
+    }
+#endif
+}
+
+/*******************************************************************************
+* Function Name: precision_run_cascade
+********************************************************************************
+* Summary:
+*   Runs PRECISION_CASCADE_FIRST on the window. If its top confidence is
+*   ambiguous, also runs PRECISION_CASCADE_SECOND and uses its output instead.
+*   Only the first variant runs if the second one is not linked, and the
+*   active variant runs as with precision_run if the first one is not linked.
+*   The output is read with precision_decide and precision_get_output.
+*
+* Parameters:
+*   window: Pre-processed data, SENSOR_BATCH_SIZE x SENSOR_NUM_AXIS floats
+*
+* Return:
+*   The status of the last inference.
+*******************************************************************************/
+cy_rslt_t precision_run_cascade(const float *window)
+{
+    cy_rslt_t result;
+    uint32_t start;
+    uint32_t cycles;
+    precision_variant_t *first = &precision_variants[PRECISION_CASCADE_FIRST];
+    precision_variant_t *second = &precision_variants[PRECISION_CASCADE_SECOND];
+
+    if (NULL == first->model)
+    {
+        return precision_run(window);
+    }
+
+    start = INSTRUMENT_NOW();
+
+    result = precision_run_variant(first, window);
+    precision_output = first;
+
+    /* Re-run the window with the accurate variant if the decision is close */
+    if ((NULL != second->model) && precision_is_ambiguous(first))
+    {
+        result = precision_run_variant(second, window);
+        precision_output = second;
+        precision_cascade_stats.escalations++;
+    }
+
+    cycles = INSTRUMENT_NOW() - start;
+    precision_cascade_stats.windows++;
+    precision_cascade_stats.total_cycles += cycles;
+    if (cycles > precision_cascade_stats.max_cycles)
+    {
+        precision_cascade_stats.max_cycles = cycles;
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: precision_get_cascade_stats
+********************************************************************************
+* Summary:
+*   Returns the measured cost of the cascade and how often the second variant
+*   ran.
+*
+* Parameters:
+*   stats: Structure to store the statistics
+*
+*******************************************************************************/
+void precision_get_cascade_stats(precision_cascade_stats_t *stats)
+{
+    *stats = precision_cascade_stats;
+}
+
+/*******************************************************************************
+* Function Name: precision_run_variant
+********************************************************************************
+* Summary:
+*   Quantizes the window if the variant is fixed-point, feeds it to the model
+*   and records the time it took.
+*
+* Parameters:
+*   variant: The model variant to run
+*   window: Pre-processed data, SENSOR_BATCH_SIZE x SENSOR_NUM_AXIS floats
+*
+* Return:
+*   The status of the inference.
+*******************************************************************************/
+static cy_rslt_t precision_run_variant(precision_variant_t *variant, const float *window)
+{
+    cy_rslt_t result;
+    uint32_t start;
+    uint32_t cycles;
+    MTB_ML_DATA_T *input_reference;
+
+    start = INSTRUMENT_NOW();
+
+#if !COMPONENT_ML_FLOAT32
+    if (0 != variant->q_fraction_bits)
+    {
+        /* Quantize data before feeding model */
+        mtb_ml_utils_model_quantize(variant->model, window, precision_input);
+        input_reference = precision_input;
+    }
+    else
+#endif
+    {
+        /* The floating-point variant is fed with the window as is, the
+         * inference engine copies it to the model input */
+        input_reference = (MTB_ML_DATA_T *) window;
+    }
+
+    /* Feed the Model */
+    result = mtb_ml_model_run(variant->model, input_reference);
+
+    cycles = INSTRUMENT_NOW() - start;
+    variant->stats.runs++;
+    variant->stats.last_cycles = cycles;
+    variant->stats.total_cycles += cycles;
+    if (cycles > variant->stats.max_cycles)
+    {
+        variant->stats.max_cycles = cycles;
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: precision_dequantize
+********************************************************************************
+* Summary:
+*   Converts the output of the last inference of a variant to floating-point
+*   probabilities.
+*
+* Parameters:
+*   variant: The model variant to read
+*   probabilities: Buffer to store the model output size number of values
+*
+* Return:
+*   The model output size.
+*******************************************************************************/
+static int precision_dequantize(precision_variant_t *variant, float *probabilities)
+{
+#if !COMPONENT_ML_FLOAT32
+    if (0 != variant->q_fraction_bits)
+    {
+        /* Convert fixed-point output to floating-point */
+        mtb_ml_utils_model_dequantize(variant->model, probabilities);
+    }
+    else
+#endif
+    {
+        memcpy(probabilities, variant->output, variant->output_size * sizeof(float));
+    }
+
+    return variant->output_size;
+}
+
+/*******************************************************************************
+* Function Name: precision_apply_pending
+********************************************************************************
+* Summary:
+*   Makes the requested variant the active one.
+*
+* Return:
+*   True if the active variant changed.
+*******************************************************************************/
+static bool precision_apply_pending(void)
+{
+    precision_variant_t *next = &precision_variants[precision_pending];
+
+    if (next == precision_active)
+    {
+        return false;
+    }
+
+    /* All variants are initialized, so only the active path changes */
+    precision_active = next;
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: precision_top_class
+********************************************************************************
+* Summary:
+*   Returns the class with the highest value in the output of a variant, read
+*   in the output format of the variant.
+*
+*******************************************************************************/
+static int precision_top_class(const precision_variant_t *variant)
+{
+    int top = 0;
+
+#if !COMPONENT_ML_FLOAT32
+    if (0 != variant->q_fraction_bits)
+    {
+        for (int i = 1; i < variant->output_size; i++)
+        {
+            if (variant->output[i] > variant->output[top])
+            {
+                top = i;
+            }
+        }
+    }
+    else
+#endif
+    {
+        const float *output = (const float *) variant->output;
+
+        for (int i = 1; i < variant->output_size; i++)
+        {
+            if (output[i] > output[top])
+            {
+                top = i;
+            }
+        }
+    }
+
+    return top;
+}
+
+/*******************************************************************************
+* Function Name: precision_is_ambiguous
+********************************************************************************
+* Summary:
+*   Checks if the top confidence of the last output of a variant is within the
+*   cascade band around MIN_CONFIDENCE.
+*
+*******************************************************************************/
+static bool precision_is_ambiguous(const precision_variant_t *variant)
+{
+    int top = precision_top_class(variant);
+
+#if !COMPONENT_ML_FLOAT32
+    if (0 != variant->q_fraction_bits)
+    {
+        return (variant->output[top] >= variant->band_low) && (variant->output[top] <= variant->band_high);
+    }
+#endif
+
+    return fabsf(((const float *) variant->output)[top] - (float)MIN_CONFIDENCE) <= precision_cascade_band;
+}
+
+#if !COMPONENT_ML_FLOAT32
+/*******************************************************************************
+* Function Name: precision_quantize_thresholds
+********************************************************************************
+* Summary:
+*   Converts CONTROL_THRESHOLDS to the output format of a fixed-point variant.
+*   A probability p = (q - zero_point) * scale is above a threshold t if and
+*   only if q > floor(t / scale) + zero_point, so the comparison gives the same
+*   decision as on the dequantized output.
+*
+*******************************************************************************/
+static void precision_quantize_thresholds(precision_variant_t *variant)
+{
+    const float thresholds[CONTROL_NUM_CLASSES] = CONTROL_THRESHOLDS;
+    float scale = variant->model->output_scale;
+    int32_t zero_point = variant->model->output_zero_point;
+
+    for (int i = 0; i < CONTROL_NUM_CLASSES; i++)
+    {
+        variant->thresholds[i] = (int32_t)floorf(thresholds[i] / scale) + zero_point;
+    }
+}
+
+/*******************************************************************************
+* Function Name: precision_quantize_band
+********************************************************************************
+* Summary:
+*   Converts the cascade band around MIN_CONFIDENCE to the output format of a
+*   fixed-point variant, rounding the bounds inwards.
+*
+*******************************************************************************/
+static void precision_quantize_band(precision_variant_t *variant)
+{
+    float scale = variant->model->output_scale;
+    int32_t zero_point = variant->model->output_zero_point;
+
+    variant->band_low = (int32_t)ceilf(((float)MIN_CONFIDENCE - precision_cascade_band) / scale) + zero_point;
+    variant->band_high = (int32_t)floorf(((float)MIN_CONFIDENCE + precision_cascade_band) / scale) + zero_point;
+}
+#endif
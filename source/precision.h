@@ -0,0 +1,117 @@
+/******************************************************************************
+* File Name:   precision.h
+*
+* Description: This file contains the function prototypes and constants used
+*   in precision.c.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2021-2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef PRECISION_H
+#define PRECISION_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "cy_result.h"
+#include "mtb_ml_model.h"
+#include "control.h"
+
+/******************************************************************************
+ * Constants
+ *****************************************************************************/
+/* Set by the Makefile when NN_RUNTIME_TYPES links more than one variant */
+#ifndef PRECISION_RUNTIME_SWITCH
+#define PRECISION_RUNTIME_SWITCH    0u
+#endif
+
+/* Cascade: the first variant runs on every window, the second one only when
+ * the top confidence is within PRECISION_CASCADE_BAND of MIN_CONFIDENCE */
+#define PRECISION_CASCADE_FIRST     PRECISION_INT8x8
+#define PRECISION_CASCADE_SECOND    PRECISION_FLOAT
+#define PRECISION_CASCADE_BAND      0.15f
+
+#define PRECISION_RSLT_NOT_LINKED   CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_MIDDLEWARE_BASE, 0x26u)
+
+/******************************************************************************
+ * Typedefs
+ *****************************************************************************/
+/* Model precisions, in the same order as the NN_TYPE Makefile options */
+typedef enum
+{
+    PRECISION_FLOAT,
+    PRECISION_INT8x8,
+    PRECISION_INT16x8,
+    PRECISION_INT16x16,
+    PRECISION_COUNT
+} precision_type_t;
+
+/* Cost of a precision variant, measured in CPU cycles */
+typedef struct
+{
+    uint32_t runs;              /* Number of windows run with this variant */
+    uint32_t last_cycles;       /* Quantize + inference time of the last window */
+    uint32_t max_cycles;        /* Worst quantize + inference time */
+    uint64_t total_cycles;      /* Sum of quantize + inference time of all windows */
+    uint32_t switch_cycles;     /* Time of the first window after the last switch */
+} precision_stats_t;
+
+/* Cost of the cascade, measured in CPU cycles */
+typedef struct
+{
+    uint32_t windows;           /* Number of windows run with the cascade */
+    uint32_t escalations;       /* Windows that also ran the second variant */
+    uint32_t max_cycles;        /* Worst time of a window */
+    uint64_t total_cycles;      /* Sum of the time of all windows */
+} precision_cascade_stats_t;
+
+/*******************************************************************************
+* Functions
+*******************************************************************************/
+cy_rslt_t precision_init(void);
+bool precision_is_linked(precision_type_t type);
+cy_rslt_t precision_set(precision_type_t type);
+precision_type_t precision_get(void);
+const char* precision_get_name(precision_type_t type);
+mtb_ml_model_t* precision_get_model(void);
+cy_rslt_t precision_run(const float *window);
+int precision_get_output(float *probabilities);
+int precision_decide(control_decision_t *decision);
+void precision_get_stats(precision_type_t type, precision_stats_t *stats);
+void precision_cascade_set_band(float band);
+cy_rslt_t precision_run_cascade(const float *window);
+void precision_get_cascade_stats(precision_cascade_stats_t *stats);
+
+#endif /* PRECISION_H */
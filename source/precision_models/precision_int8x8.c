@@ -0,0 +1,53 @@
+/******************************************************************************
+* File Name:   precision_int8x8.c
+*
+* Description: This file links the int8x8 TFLM variant of the model for the
+*              run-time precision switch. The generated symbols are renamed so
+*              several variants can be linked in the same firmware.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2021-2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "precision.h"
+
+#if PRECISION_RUNTIME_SWITCH && PRECISION_HAS_int8x8
+
+/* The generated file names use NN_MODEL_NAME, update them if it changes */
+#define MAGIC_WAND_model_bin MAGIC_WAND_int8x8_model_bin
+#include "MAGIC_WAND_tflm_model_int8x8.c"
+
+mtb_ml_model_bin_t precision_int8x8_bin = {MTB_ML_MODEL_BIN_DATA(MODEL_NAME)};
+
+#endif /* PRECISION_RUNTIME_SWITCH && PRECISION_HAS_int8x8 */
@@ -40,6 +40,9 @@
 * so agrees to indemnify Cypress against all liability.
 *******************************************************************************/
 #include "processing.h"
+#include "instrument.h"
+#include "output.h"
+#include "trace.h"
 
 /******************************************************************************
  * Defines
@@ -47,6 +50,22 @@
 #define MAX_NORMALIZATION_VALUE  1
 #define MIN_NORMALIZATION_VALUE -1
 
+/* Order of the butter-worth filter */
+#define PROCESSING_FILTER_ORDER  3
+
+/******************************************************************************
+ * Global Variables
+ *****************************************************************************/
+/* Coefficients of the third order butter-worth filter of processing_window()
+ * and processing_stream_t, whose filters keep pointers to them */
+static const float processing_coeff_b[] = IIR_FILTER_BUTTER_WORTH_COEFF_B;
+static const float processing_coeff_a[] = IIR_FILTER_BUTTER_WORTH_COEFF_A;
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+static void processing_swap_axes(float *window, uint16_t length, uint16_t dimension);
+
 
 /*******************************************************************************
 * Function Name: iir_filter_init
@@ -73,7 +92,7 @@ int iir_filter_init(iir_filter_struct* st, const float* b, const float* a, int n
     /* Check the number of states */
     if (n_order >= MAX_STATES)
     {
-        printf("ERROR: exceeded max states!!\n");
+        output_printf("ERROR: exceeded max states!!\r\n");
         return -1;
     }
 
@@ -104,6 +123,8 @@ int iir_filter_init(iir_filter_struct* st, const float* b, const float* a, int n
 *******************************************************************************/
 void iir_filter(iir_filter_struct *st, float *buf, int length, uint16_t cur_dimension, uint16_t total_dimensions)
 {
+    INSTRUMENT_SCOPE(iir_filter);
+
     /* Store the previous states */
     float* x_states = st->x_states;
     float* y_states = st->y_states;
@@ -150,6 +171,8 @@ void iir_filter(iir_filter_struct *st, float *buf, int length, uint16_t cur_dime
 *******************************************************************************/
 void normalization_min_max(float *buf, uint16_t length, uint16_t dimension, float sensor_min, float sensor_max)
 {
+    INSTRUMENT_SCOPE(normalization);
+
     uint16_t cur_row = 0;
     uint8_t cur_col = 0;
 
@@ -265,3 +288,135 @@ void column_inverse(float *buf, uint16_t length, uint16_t dimension, uint16_t co
     }
 }
 
+/*******************************************************************************
+* Function Name: processing_window
+********************************************************************************
+* Summary:
+*   Pre-processes a window of sensor samples for the model: cast to float,
+*   third order butter-worth filter restarted on each axis, min max
+*   normalization, and the BMI160 axis swap. Used by the gesture task, and by
+*   the replay benchmark of the simulation build.
+*
+* Parameters:
+*   samples: Sensor samples, dimension values per row
+*   window: Buffer to store the pre-processed window, same layout
+*   length: The number of rows in the passed in buffer
+*   dimension: The number of columns in the passed in buffer
+*
+*******************************************************************************/
+void processing_window(int16_t *samples, float *window, uint16_t length, uint16_t dimension)
+{
+    uint16_t cur = 0;
+    iir_filter_struct butter_lp_fil;
+
+    /* Cast the data from an int16 to a float for pre-processing */
+    TRACE_BEGIN(TRACE_PREPROCESS_CAST, 0);
+    cast_int16_to_float(samples, window, length*dimension);
+    TRACE_END(TRACE_PREPROCESS_CAST, 0);
+
+    /* Third order butter-worth filter */
+    TRACE_BEGIN(TRACE_PREPROCESS_FILTER, 0);
+    while(cur < dimension)
+    {
+        /* Initialize and run the filter */
+        iir_filter_init(&butter_lp_fil, processing_coeff_b, processing_coeff_a, PROCESSING_FILTER_ORDER);
+        iir_filter(&butter_lp_fil, window, length, cur, dimension);
+        cur++;
+    }
+    TRACE_END(TRACE_PREPROCESS_FILTER, 0);
+
+    /* A min max normalization to get all data between -1 and 1 */
+    TRACE_BEGIN(TRACE_PREPROCESS_NORMALIZE, 0);
+    normalization_min_max(window, length, dimension, MIN_DATA_SAMPLE, MAX_DATA_SAMPLE);
+    TRACE_END(TRACE_PREPROCESS_NORMALIZE, 0);
+
+#ifdef CY_BMI_160_IMU_I2C
+    /* Swap axis for BMI_160 so board orientation stays the same */
+    TRACE_BEGIN(TRACE_PREPROCESS_AXES, 0);
+    processing_swap_axes(window, length, dimension);
+    TRACE_END(TRACE_PREPROCESS_AXES, 0);
+#endif
+}
+
+/*******************************************************************************
+* Function Name: processing_stream_init
+********************************************************************************
+* Summary:
+*   Restarts the filters of a stream, at its start or after a lost window.
+*
+* Parameters:
+*   stream: State of the stream
+*   dimension: The number of columns of the windows, up to
+*              PROCESSING_MAX_DIMENSION
+*   bmi160_axes: Apply the BMI160 axis swap, as processing_window() does when
+*                built for the BMI160
+*
+*******************************************************************************/
+void processing_stream_init(processing_stream_t *stream, uint16_t dimension, bool bmi160_axes)
+{
+    if (dimension > PROCESSING_MAX_DIMENSION)
+    {
+        dimension = PROCESSING_MAX_DIMENSION;
+    }
+
+    stream->dimension = dimension;
+    stream->bmi160_axes = bmi160_axes;
+    for (uint16_t cur = 0; cur < dimension; cur++)
+    {
+        iir_filter_init(&stream->filters[cur], processing_coeff_b, processing_coeff_a, PROCESSING_FILTER_ORDER);
+    }
+}
+
+/*******************************************************************************
+* Function Name: processing_stream_window
+********************************************************************************
+* Summary:
+*   Pre-processes the next window of a stream as processing_window(), with the
+*   filters continuing from the previous window of the stream.
+*
+* Parameters:
+*   stream: State of the stream, initialized with processing_stream_init()
+*   samples: Sensor samples, stream->dimension values per row
+*   window: Buffer to store the pre-processed window, same layout
+*   length: The number of rows in the passed in buffer
+*
+*******************************************************************************/
+void processing_stream_window(processing_stream_t *stream, int16_t *samples, float *window, uint16_t length)
+{
+    uint16_t dimension = stream->dimension;
+
+    cast_int16_to_float(samples, window, length*dimension);
+
+    for (uint16_t cur = 0; cur < dimension; cur++)
+    {
+        iir_filter(&stream->filters[cur], window, length, cur, dimension);
+    }
+
+    normalization_min_max(window, length, dimension, MIN_DATA_SAMPLE, MAX_DATA_SAMPLE);
+
+    if (stream->bmi160_axes)
+    {
+        processing_swap_axes(window, length, dimension);
+    }
+}
+
+/*******************************************************************************
+* Function Name: processing_swap_axes
+********************************************************************************
+* Summary:
+*   Swaps and inverts the axes of the BMI160 so the board orientation is the
+*   same as with the BMX160.
+*
+* Parameters:
+*   window: Pre-processed window
+*   length: The number of rows in the passed in buffer
+*   dimension: The number of columns in the passed in buffer
+*
+*******************************************************************************/
+static void processing_swap_axes(float *window, uint16_t length, uint16_t dimension)
+{
+    column_inverse(window, length, dimension, 2);
+    column_swap(window, length, dimension, 0, 1);
+    column_inverse(window, length, dimension, 5);
+    column_swap(window, length, dimension, 3, 4);
+}
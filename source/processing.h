@@ -42,6 +42,7 @@
 #ifndef PROCESSING_H
 #define PROCESSING_H
 
+#include <stdbool.h>
 #include <stdio.h>
 #include <stdint.h>
 #include <math.h>
@@ -51,6 +52,13 @@
  *****************************************************************************/
 #define MAX_STATES 10
 
+/* Range of the sensor samples, normalized to -1..1 */
+#define MAX_DATA_SAMPLE 32768
+#define MIN_DATA_SAMPLE -32768
+
+/* Axes of a stream of windows, see processing_stream_t */
+#define PROCESSING_MAX_DIMENSION 6
+
 /******************************************************************************
  * Typedefs
  *****************************************************************************/
@@ -67,6 +75,16 @@ typedef struct iir_filter_struct_t
 #define IIR_FILTER_BUTTER_WORTH_COEFF_B { 0.01809893f, 0.0542968f , 0.0542968f , 0.01809893f }
 #define IIR_FILTER_BUTTER_WORTH_COEFF_A { 1.0f        , -1.76004188f,  1.18289326f, -0.27805992f }
 
+/* Pre-processing of a continuous stream of windows. The filter of each axis
+ * carries its state from one window to the next, instead of restarting on
+ * each window as processing_window() does. */
+typedef struct
+{
+    iir_filter_struct filters[PROCESSING_MAX_DIMENSION];
+    uint16_t dimension;
+    bool bmi160_axes;           /* Apply the BMI160 axis swap and inversion */
+} processing_stream_t;
+
 /*******************************************************************************
 * Functions
 *******************************************************************************/
@@ -76,5 +94,8 @@ void normalization_min_max(float *buf, uint16_t length, uint16_t dimension,float
 void cast_int16_to_float(int16_t *int_buf, float *float_buf, uint16_t length);
 void column_swap(float *buf, uint16_t length, uint16_t dimension, uint16_t column_one, uint16_t column_two);
 void column_inverse(float *buf, uint16_t length, uint16_t dimension, uint16_t column);
+void processing_window(int16_t *samples, float *window, uint16_t length, uint16_t dimension);
+void processing_stream_init(processing_stream_t *stream, uint16_t dimension, bool bmi160_axes);
+void processing_stream_window(processing_stream_t *stream, int16_t *samples, float *window, uint16_t length);
 
 #endif /* PROCESSING_H */
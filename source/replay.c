@@ -0,0 +1,267 @@
+/******************************************************************************
+* File Name:   replay.c
+*
+* Description: This file contains the replay of pre-processed windows sent by
+*   train/variant_bench.py on the debug UART. The windows replace the IMU, so
+*   every model variant is measured on the same data.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2021-2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "replay.h"
+#include "stream.h"
+#include "output.h"
+#include "results.h"
+#include "model_registry.h"
+#include "instrument.h"
+#include "sensor.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include <stdbool.h>
+
+/*******************************************************************************
+* Constants
+*******************************************************************************/
+#define REPLAY_FRAME_SIZE       (STREAM_HEADER_SIZE + STREAM_MAX_PAYLOAD + STREAM_CRC_SIZE)
+#define REPLAY_WINDOW_SIZE      (SENSOR_BATCH_SIZE * SENSOR_NUM_AXIS * sizeof(int16_t))
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Frame being received, owned by the UART interrupt until replay_frame_ready */
+static uint8_t replay_frame[REPLAY_FRAME_SIZE];
+static uint32_t replay_frame_length;
+static volatile bool replay_frame_ready;
+
+/* Task waiting in replay_get_window */
+static TaskHandle_t volatile replay_task_handle;
+
+/* Sequence number of the last window handed to the pipeline */
+static uint16_t replay_window;
+
+static int replay_model_id;
+static replay_stats_t replay_stats;
+
+/*******************************************************************************
+* Local Functions
+*******************************************************************************/
+static void replay_receive(uint8_t data);
+static void replay_send_result(const results_event_t *event, void *context);
+
+/*******************************************************************************
+* Function Name: replay_init
+********************************************************************************
+* Summary:
+*   Starts receiving the windows on the debug UART, instead of the console, and
+*   sends the decision on each of them back to the host. Must be called after
+*   results_init.
+*
+* Parameters:
+*   model_id: Registry identifier of the model whose time is reported
+*
+* Return:
+*   The status of the initialization.
+*******************************************************************************/
+cy_rslt_t replay_init(int model_id)
+{
+    replay_model_id = model_id;
+    output_set_receive(replay_receive);
+
+    return results_subscribe(replay_send_result, NULL, NULL);
+}
+
+/*******************************************************************************
+* Function Name: replay_get_window
+********************************************************************************
+* Summary:
+*   Blocks until the host sends a valid window, and converts it back to
+*   floating point. Frames with a bad CRC, type or length are dropped, the host
+*   sends the window again when no result comes back.
+*
+* Parameters:
+*   window: Buffer of SENSOR_BATCH_SIZE x SENSOR_NUM_AXIS floats
+*
+*******************************************************************************/
+void replay_get_window(float *window)
+{
+    uint32_t size;
+    uint16_t crc;
+
+    replay_task_handle = xTaskGetCurrentTaskHandle();
+
+    for(;;)
+    {
+        while (!replay_frame_ready)
+        {
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        }
+
+        size = replay_frame[6] | ((uint32_t)replay_frame[7] << 8);
+        crc = (uint16_t)(replay_frame[STREAM_HEADER_SIZE + size] |
+                         (replay_frame[STREAM_HEADER_SIZE + size + 1] << 8));
+
+        if ((STREAM_TYPE_WINDOW == replay_frame[2]) && (REPLAY_WINDOW_SIZE == size) &&
+            (crc == stream_crc16(&replay_frame[2], STREAM_HEADER_SIZE - 2 + size)))
+        {
+            const uint8_t *payload = &replay_frame[STREAM_HEADER_SIZE];
+
+            for (uint32_t i = 0; i < SENSOR_BATCH_SIZE * SENSOR_NUM_AXIS; i++)
+            {
+                int16_t value = (int16_t)(payload[2 * i] | (payload[2 * i + 1] << 8));
+                window[i] = (float)value / REPLAY_SCALE;
+            }
+            replay_window = (uint16_t)(replay_frame[4] | (replay_frame[5] << 8));
+            replay_stats.windows++;
+        }
+        else
+        {
+            replay_stats.bad_frames++;
+            size = 0;
+        }
+
+        /* Hand the buffer back to the interrupt */
+        replay_frame_length = 0;
+        replay_frame_ready = false;
+
+        if (0 != size)
+        {
+            return;
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: replay_get_stats
+********************************************************************************
+* Summary:
+*   Returns the window counters since reset.
+*
+* Parameters:
+*   stats: Structure to store the statistics
+*
+*******************************************************************************/
+void replay_get_stats(replay_stats_t *stats)
+{
+    *stats = replay_stats;
+}
+
+/*******************************************************************************
+* Function Name: replay_receive
+********************************************************************************
+* Summary:
+*   Called from the UART interrupt for each received byte. Collects one frame
+*   and wakes up replay_get_window. Bytes received while a frame is pending
+*   are dropped, the host waits for the result before sending the next window.
+*
+* Parameters:
+*   data: Received byte
+*
+*******************************************************************************/
+static void replay_receive(uint8_t data)
+{
+    BaseType_t higher_priority_task_woken = pdFALSE;
+    uint32_t size;
+
+    if (replay_frame_ready)
+    {
+        return;
+    }
+
+    /* Look for the sync bytes before collecting the header */
+    if (((0 == replay_frame_length) && (STREAM_SYNC_0 != data)) ||
+        ((1 == replay_frame_length) && (STREAM_SYNC_1 != data)))
+    {
+        replay_frame_length = (STREAM_SYNC_0 == data) ? 1 : 0;
+        if (1 == replay_frame_length)
+        {
+            replay_frame[0] = data;
+        }
+        return;
+    }
+
+    replay_frame[replay_frame_length++] = data;
+    if (replay_frame_length < STREAM_HEADER_SIZE)
+    {
+        return;
+    }
+
+    size = replay_frame[6] | ((uint32_t)replay_frame[7] << 8);
+    if (size > STREAM_MAX_PAYLOAD)
+    {
+        /* Not a real header, look for the next sync */
+        replay_frame_length = 0;
+    }
+    else if (replay_frame_length == STREAM_HEADER_SIZE + size + STREAM_CRC_SIZE)
+    {
+        replay_frame_ready = true;
+        if (NULL != replay_task_handle)
+        {
+            vTaskNotifyGiveFromISR(replay_task_handle, &higher_priority_task_woken);
+            portYIELD_FROM_ISR(higher_priority_task_woken);
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: replay_send_result
+********************************************************************************
+* Summary:
+*   Results subscriber, sends the decision on the last window to the host with
+*   the time of the model.
+*
+* Parameters:
+*   event: Decision on the window
+*   context: not used
+*
+*******************************************************************************/
+static void replay_send_result(const results_event_t *event, void *context)
+{
+    model_registry_stats_t model;
+    replay_result_t result;
+
+    (void)context;
+
+    model_registry_get_stats(replay_model_id, &model);
+
+    result.window = replay_window;
+    result.class_index = event->class_index;
+    result.confidence = event->confidence;
+    result.model_cycles = model.last_cycles;
+    result.cycles_per_us = instrument_get_cycles_per_us();
+
+    stream_send(STREAM_TYPE_RESULT, &result, sizeof(result));
+}
@@ -0,0 +1,83 @@
+/******************************************************************************
+* File Name:   replay.h
+*
+* Description: This file contains the function prototypes and constants used
+*   in replay.c.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2021-2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include "cy_result.h"
+
+#include <stdint.h>
+
+/******************************************************************************
+ * Constants
+ *****************************************************************************/
+/* The STREAM_TYPE_WINDOW payload is the pre-processed window, SENSOR_BATCH_SIZE
+ * x SENSOR_NUM_AXIS int16 values, each the float value times REPLAY_SCALE */
+#define REPLAY_SCALE            32768.0f
+
+/******************************************************************************
+ * Typedefs
+ *****************************************************************************/
+/* STREAM_TYPE_RESULT payload, sent for each decision on a replayed window.
+ * Laid out without padding, must match train/variant_bench.py */
+typedef struct
+{
+    uint16_t window;            /* Sequence number of the STREAM_TYPE_WINDOW frame */
+    int8_t class_index;         /* Detected class, RESULTS_NO_CLASS if none */
+    uint8_t confidence;         /* Confidence of the most likely class, in percent */
+    uint32_t model_cycles;      /* Time of the gesture model on this window */
+    uint32_t cycles_per_us;     /* To convert model_cycles to microseconds */
+} replay_result_t;
+
+typedef struct
+{
+    uint32_t windows;           /* Windows received and handed to the pipeline */
+    uint32_t bad_frames;        /* Frames dropped for their CRC, type or length */
+} replay_stats_t;
+
+/*******************************************************************************
+* Functions
+*******************************************************************************/
+cy_rslt_t replay_init(int model_id);
+void replay_get_window(float *window);
+void replay_get_stats(replay_stats_t *stats);
+
+#endif /* REPLAY_H */
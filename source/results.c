@@ -0,0 +1,264 @@
+/******************************************************************************
+* File Name:   results.c
+*
+* Description: This file contains the publication of the gesture results.
+*              Each subscriber has its own single-producer single-consumer
+*              ring, filled by the inference task without locks and drained
+*              by the results task, which calls the subscriber. A subscriber
+*              that falls behind only loses its own events.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2021-2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "results.h"
+#include "alloc_guard.h"
+
+#include "cy_pdl.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+/*******************************************************************************
+* Typedefs
+*******************************************************************************/
+typedef struct
+{
+    results_callback_t callback;
+    void *context;
+    TaskHandle_t task;          /* Calls the callback */
+    results_event_t events[RESULTS_QUEUE_SIZE];
+    volatile uint32_t head;     /* Written by the inference task only */
+    volatile uint32_t tail;     /* Written by the task of the subscriber only */
+    results_stats_t stats;
+} results_subscriber_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static results_subscriber_t results_subscribers[RESULTS_MAX_SUBSCRIBERS];
+static volatile uint32_t results_count;
+
+#if STATIC_ALLOCATION
+/* Memory of the task of each subscriber */
+static StackType_t results_task_stacks[RESULTS_MAX_SUBSCRIBERS][RESULTS_TASK_STACK_SIZE];
+static StaticTask_t results_task_tcbs[RESULTS_MAX_SUBSCRIBERS];
+#endif
+
+/*******************************************************************************
+* Local Functions
+*******************************************************************************/
+static void results_task(void *arg);
+
+/*******************************************************************************
+* Function Name: results_init
+********************************************************************************
+* Summary:
+*   Starts with no subscriber. Each subscriber gets the task that delivers
+*   its results from results_subscribe.
+*
+* Parameters:
+*     None
+*
+* Return:
+*   The status of the initialization.
+*******************************************************************************/
+cy_rslt_t results_init(void)
+{
+    results_count = 0;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: results_subscribe
+********************************************************************************
+* Summary:
+*   Registers a callback for the result of each window, called from a task
+*   of its own so a slow callback only delays its own results. Subscribers
+*   cannot be removed. Must be called from a single task at a time.
+*
+* Parameters:
+*   callback: Function called from the task of the subscriber for each result
+*   context: Passed to the callback
+*   id: Set to the subscriber index for results_get_stats, can be NULL
+*
+* Return:
+*   RESULTS_RSLT_FULL if RESULTS_MAX_SUBSCRIBERS are already registered,
+*   RESULTS_RSLT_NO_TASK if the task cannot be created.
+*******************************************************************************/
+cy_rslt_t results_subscribe(results_callback_t callback, void *context, int *id)
+{
+    results_subscriber_t *subscriber;
+
+    if (results_count == RESULTS_MAX_SUBSCRIBERS)
+    {
+        return RESULTS_RSLT_FULL;
+    }
+
+    subscriber = &results_subscribers[results_count];
+    subscriber->callback = callback;
+    subscriber->context = context;
+
+#if STATIC_ALLOCATION
+    subscriber->task = xTaskCreateStatic(results_task, "Results task", RESULTS_TASK_STACK_SIZE, subscriber,
+                                         RESULTS_TASK_PRIORITY, results_task_stacks[results_count],
+                                         &results_task_tcbs[results_count]);
+#else
+    if (pdPASS != xTaskCreate(results_task, "Results task", RESULTS_TASK_STACK_SIZE, subscriber,
+                              RESULTS_TASK_PRIORITY, &subscriber->task))
+    {
+        subscriber->task = NULL;
+    }
+#endif
+    if (NULL == subscriber->task)
+    {
+        return RESULTS_RSLT_NO_TASK;
+    }
+
+    if (NULL != id)
+    {
+        *id = (int)results_count;
+    }
+
+    /* The publisher sees the subscriber only once it is complete */
+    __DMB();
+    results_count++;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: results_publish
+********************************************************************************
+* Summary:
+*   Queues the result of a window for every subscriber and returns without
+*   waiting for them. Must be called from a single task.
+*
+* Parameters:
+*   decision: Decision on the model output
+*   window: Sequence number of the window
+*   timestamp: RTOS tick when the sensor completed the window
+*
+*******************************************************************************/
+void results_publish(const control_decision_t *decision, uint32_t window, uint32_t timestamp)
+{
+    results_event_t event;
+    uint32_t latency_ms = (xTaskGetTickCount() - timestamp) * portTICK_PERIOD_MS;
+    uint32_t count = results_count;
+
+    event.window = window;
+    event.timestamp = timestamp;
+    event.latency_ms = (latency_ms > UINT16_MAX) ? UINT16_MAX : (uint16_t)latency_ms;
+    event.class_index = decision->detected ? (int8_t)decision->class_index : RESULTS_NO_CLASS;
+    event.confidence = (uint8_t)(decision->confidence*100 + 0.5f);
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        results_subscriber_t *subscriber = &results_subscribers[i];
+        uint32_t head = subscriber->head;
+
+        if ((head - subscriber->tail) == RESULTS_QUEUE_SIZE)
+        {
+            subscriber->stats.dropped++;
+            continue;
+        }
+
+        subscriber->events[head & (RESULTS_QUEUE_SIZE - 1)] = event;
+
+        /* The event is written before the task of the subscriber can see it */
+        __DMB();
+        subscriber->head = head + 1;
+
+        xTaskNotifyGive(subscriber->task);
+    }
+}
+
+/*******************************************************************************
+* Function Name: results_get_stats
+********************************************************************************
+* Summary:
+*   Returns the event counters of a subscriber since reset.
+*
+* Parameters:
+*   id: Subscriber index returned by results_subscribe
+*   stats: Structure to store the statistics
+*
+*******************************************************************************/
+void results_get_stats(int id, results_stats_t *stats)
+{
+    if ((id >= 0) && ((uint32_t)id < results_count))
+    {
+        *stats = results_subscribers[id].stats;
+    }
+    else
+    {
+        stats->delivered = 0;
+        stats->dropped = 0;
+    }
+}
+
+/*******************************************************************************
+* Function Name: results_task
+********************************************************************************
+* Summary:
+*   Calls a subscriber with its queued events. Each subscriber has its own
+*   task, so a slow callback fills only its own queue and its drops are
+*   counted in its own statistics.
+*
+* Parameters:
+*     arg: The results_subscriber_t of the task
+*
+*******************************************************************************/
+static void results_task(void *arg)
+{
+    results_subscriber_t *subscriber = arg;
+
+    for (;;)
+    {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        for (uint32_t tail = subscriber->tail; tail != subscriber->head; tail++)
+        {
+            /* The event is read after its head update is seen */
+            __DMB();
+            subscriber->callback(&subscriber->events[tail & (RESULTS_QUEUE_SIZE - 1)], subscriber->context);
+            subscriber->stats.delivered++;
+
+            /* The slot is free again once the callback returns */
+            __DMB();
+            subscriber->tail = tail + 1;
+        }
+    }
+}
@@ -0,0 +1,98 @@
+/******************************************************************************
+* File Name:   results.h
+*
+* Description: This file contains the function prototypes and constants used
+*   in results.c.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2021-2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef RESULTS_H
+#define RESULTS_H
+
+#include "control.h"
+
+#include "cy_result.h"
+
+#include <stdint.h>
+
+/******************************************************************************
+ * Constants
+ *****************************************************************************/
+#define RESULTS_MAX_SUBSCRIBERS     4u
+
+/* Events queued per subscriber, must be a power of two */
+#define RESULTS_QUEUE_SIZE          8u
+
+/* Class of the events where no gesture passed its threshold */
+#define RESULTS_NO_CLASS            (-1)
+
+/* Task of each subscriber, that calls its callback */
+#define RESULTS_TASK_PRIORITY       1
+#define RESULTS_TASK_STACK_SIZE     512
+
+#define RESULTS_RSLT_FULL           CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_MIDDLEWARE_BASE, 0x2Bu)
+#define RESULTS_RSLT_NO_TASK        CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_MIDDLEWARE_BASE, 0x31u)
+
+/******************************************************************************
+ * Typedefs
+ *****************************************************************************/
+typedef struct
+{
+    uint32_t window;            /* Sequence number of the window */
+    uint32_t timestamp;         /* RTOS tick when the sensor completed the window */
+    uint16_t latency_ms;        /* Time from the end of the window to the result */
+    int8_t class_index;         /* Detected class, RESULTS_NO_CLASS if none */
+    uint8_t confidence;         /* Confidence of the most likely class, in percent */
+} results_event_t;
+
+/* Called from the task of the subscriber, must not block */
+typedef void (*results_callback_t)(const results_event_t *event, void *context);
+
+typedef struct
+{
+    uint32_t delivered;         /* Events passed to the callback */
+    uint32_t dropped;           /* Events lost because the queue of the subscriber was full */
+} results_stats_t;
+
+/*******************************************************************************
+* Functions
+*******************************************************************************/
+cy_rslt_t results_init(void);
+cy_rslt_t results_subscribe(results_callback_t callback, void *context, int *id);
+void results_publish(const control_decision_t *decision, uint32_t window, uint32_t timestamp);
+void results_get_stats(int id, results_stats_t *stats);
+
+#endif /* RESULTS_H */
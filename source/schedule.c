@@ -0,0 +1,154 @@
+/******************************************************************************
+* File Name:   schedule.c
+*
+* Description: This file contains the scheduling policy of the windows. It
+*              checks the result of each window against its deadline and,
+*              when processing falls behind the sensor, skips the stale
+*              windows so the latency stays bounded.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2021-2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "schedule.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static schedule_stats_t schedule_stats;
+
+/*******************************************************************************
+* Function Name: schedule_skip_sensor
+********************************************************************************
+* Summary:
+*   Called by the acquisition stage before it reads a window. With
+*   SCHEDULE_SKIP_STALE, discards all but the newest complete window in the
+*   sensor buffer.
+*
+* Return:
+*   The number of windows discarded.
+*******************************************************************************/
+uint32_t schedule_skip_sensor(void)
+{
+    uint32_t skipped = 0;
+
+#if SCHEDULE_POLICY == SCHEDULE_SKIP_STALE
+    uint32_t pending = sensor_get_pending();
+
+    if (pending > 1)
+    {
+        skipped = sensor_skip_windows(pending - 1);
+        schedule_stats.skipped += skipped;
+    }
+#endif
+
+    return skipped;
+}
+
+/*******************************************************************************
+* Function Name: schedule_skip_window
+********************************************************************************
+* Summary:
+*   Called by the inference stage for each window it receives. With
+*   SCHEDULE_SKIP_STALE, a window is skipped when a newer one is already
+*   waiting in the pipeline.
+*
+* Parameters:
+*   window: Window received from the pipeline
+*
+* Return:
+*   True if the window must be released without running the models.
+*******************************************************************************/
+bool schedule_skip_window(const pipeline_window_t *window)
+{
+    (void)window;
+
+#if SCHEDULE_POLICY == SCHEDULE_SKIP_STALE
+    if (pipeline_get_depth() > 0)
+    {
+        schedule_stats.skipped++;
+        return true;
+    }
+#endif
+
+    return false;
+}
+
+/*******************************************************************************
+* Function Name: schedule_complete
+********************************************************************************
+* Summary:
+*   Called by the inference stage once the models ran on a window. Checks the
+*   result time against the deadline of the window.
+*
+* Parameters:
+*   window: Window the models ran on
+*
+*******************************************************************************/
+void schedule_complete(const pipeline_window_t *window)
+{
+    uint32_t now = xTaskGetTickCount();
+    uint32_t deadline = window->timestamp + pdMS_TO_TICKS(SCHEDULE_DEADLINE_MS);
+    int32_t lateness = (int32_t)(now - deadline);
+
+    schedule_stats.windows++;
+    schedule_stats.last_latency_ms = (now - window->timestamp) * portTICK_PERIOD_MS;
+
+    if (lateness > 0)
+    {
+        schedule_stats.misses++;
+        if ((uint32_t)lateness * portTICK_PERIOD_MS > schedule_stats.max_lateness_ms)
+        {
+            schedule_stats.max_lateness_ms = (uint32_t)lateness * portTICK_PERIOD_MS;
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: schedule_get_stats
+********************************************************************************
+* Summary:
+*   Returns the deadline counters since reset.
+*
+* Parameters:
+*   stats: Structure to store the statistics
+*
+*******************************************************************************/
+void schedule_get_stats(schedule_stats_t *stats)
+{
+    *stats = schedule_stats;
+}
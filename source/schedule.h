@@ -0,0 +1,83 @@
+/******************************************************************************
+* File Name:   schedule.h
+*
+* Description: This file contains the function prototypes and constants used
+*   in schedule.c.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2021-2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef SCHEDULE_H
+#define SCHEDULE_H
+
+#include "pipeline.h"
+#include "sensor.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/******************************************************************************
+ * Constants
+ *****************************************************************************/
+/* Policies when the windows come faster than they are processed */
+#define SCHEDULE_PROCESS_ALL    0u      /* Run every window in order, only count the misses */
+#define SCHEDULE_SKIP_STALE     1u      /* Skip to the newest window, to bound the latency */
+#define SCHEDULE_POLICY         SCHEDULE_SKIP_STALE
+
+/* Time after the end of a window by which its result is due. By default, the
+ * result must be ready before the next window is complete. */
+#define SCHEDULE_DEADLINE_MS    SENSOR_WINDOW_PERIOD_MS
+
+/******************************************************************************
+ * Typedefs
+ *****************************************************************************/
+typedef struct
+{
+    uint32_t windows;           /* Windows run through the models */
+    uint32_t misses;            /* Windows with a result after the deadline */
+    uint32_t skipped;           /* Stale windows not run, in the sensor buffer or the pipeline */
+    uint32_t last_latency_ms;   /* Time from the end of the last window to its result */
+    uint32_t max_lateness_ms;   /* Worst time of a result past the deadline */
+} schedule_stats_t;
+
+/*******************************************************************************
+* Functions
+*******************************************************************************/
+uint32_t schedule_skip_sensor(void);
+bool schedule_skip_window(const pipeline_window_t *window);
+void schedule_complete(const pipeline_window_t *window);
+void schedule_get_stats(schedule_stats_t *stats);
+
+#endif /* SCHEDULE_H */
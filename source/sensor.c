@@ -40,6 +40,9 @@
 * so agrees to indemnify Cypress against all liability.
 *******************************************************************************/
 #include "sensor.h"
+#include "latency.h"
+#include "trace.h"
+#include "instrument.h"
 
 #include "mtb_bmx160.h"
 #include "mtb_bmi160.h"
@@ -50,6 +53,9 @@
 #include "cybsp.h"
 #include "cyabs_rtos.h"
 
+#include "FreeRTOS.h"
+#include "task.h"
+
 /*******************************************************************************
 * Constants
 *******************************************************************************/
@@ -71,7 +77,9 @@
 #define SENSOR_FIFO_ITEM_SIZE (SENSOR_SAMPLE_SIZE / 2)
 #define SENSOR_FIFO_POOL_SIZE (2*SENSOR_BATCH_SIZE * SENSOR_SAMPLE_SIZE)
 
-#define SENSOR_SCAN_RATE       128
+/* Each sample is written as two items, accelerometer and gyroscope */
+#define SENSOR_FIFO_WINDOW_ITEMS (SENSOR_BATCH_SIZE * SENSOR_DATA_WIDTH)
+
 #define SENSOR_TIMER_FREQUENCY 100000
 #define SENSOR_TIMER_PERIOD (SENSOR_TIMER_FREQUENCY/SENSOR_SCAN_RATE)
 #define SENSOR_TIMER_PRIORITY  3
@@ -90,6 +98,11 @@ uint32_t sensor_event_bits = SENSOR_EVENT_BIT;
 static cy_fifo_t sensor_fifo;
 int8_t sensor_fifo_pool[SENSOR_FIFO_POOL_SIZE];
 
+/* RTOS tick and LATENCY_NOW() when the newest window in the circle buffer was completed */
+static volatile uint32_t sensor_window_tick;
+static volatile latency_time_t sensor_window_capture;
+static sensor_stats_t sensor_stats;
+
 #ifdef CY_BMX_160_IMU_SPI
     /* BMX160 driver structures */
     mtb_bmx160_data_t data;
@@ -271,26 +284,102 @@ cy_rslt_t sensor_init(void)
 ********************************************************************************
 * Summary:
 *   Return sensor data. This function is blocking. Only returns when data is
-*   available.
+*   available. Returns the oldest window in the circle buffer, without waiting
+*   if one is already complete.
 *
 * Parameters:
-*     None
+*     sensor_data: Buffer to store SENSOR_BATCH_SIZE samples
+*     timestamp: RTOS tick when the window was completed, can be NULL
+*     capture: LATENCY_NOW() when the window was completed, can be NULL
 *
 * Return:
 *   Returns success if data returned.
 *******************************************************************************/
-cy_rslt_t sensor_get_data(void* sensor_data)
+cy_rslt_t sensor_get_data(void* sensor_data, uint32_t *timestamp, latency_time_t *capture)
 {
+    uint32_t pending;
+    uint32_t state;
+
     /* Wait until there is 128 samples from the accelerometer and the
         * gyroscope in the circular buffer */
-    cy_rtos_waitbits_event(&sensor_event, &sensor_event_bits, true, true, CY_RTOS_NEVER_TIMEOUT);
+    while (sensor_get_pending() == 0)
+    {
+        cy_rtos_waitbits_event(&sensor_event, &sensor_event_bits, true, true, CY_RTOS_NEVER_TIMEOUT);
+    }
 
-    /* Read data from the internal sensor FIFO */
-    cy_fifo_read(&sensor_fifo, sensor_data, SENSOR_BATCH_SIZE * SENSOR_DATA_WIDTH);
+    /* Read data from the internal sensor FIFO, the interrupt also updates it */
+    state = cyhal_system_critical_section_enter();
+    pending = sensor_get_pending();
+    cy_fifo_read(&sensor_fifo, sensor_data, SENSOR_FIFO_WINDOW_ITEMS);
+    if (NULL != timestamp)
+    {
+        /* The windows behind the newest one were completed one period apart */
+        *timestamp = sensor_window_tick - (pending - 1) * pdMS_TO_TICKS(SENSOR_WINDOW_PERIOD_MS);
+    }
+    if (NULL != capture)
+    {
+        *capture = sensor_window_capture - (latency_time_t)(pending - 1) * SENSOR_WINDOW_PERIOD_MS * 1000u * LATENCY_TICKS_PER_US;
+    }
+    cyhal_system_critical_section_exit(state);
 
     return CY_RSLT_SUCCESS;
 }
 
+/*******************************************************************************
+* Function Name: sensor_get_pending
+********************************************************************************
+* Summary:
+*   Returns the number of complete windows in the circle buffer.
+*
+*******************************************************************************/
+uint32_t sensor_get_pending(void)
+{
+    return cy_fifo_get_count(&sensor_fifo) / SENSOR_FIFO_WINDOW_ITEMS;
+}
+
+/*******************************************************************************
+* Function Name: sensor_skip_windows
+********************************************************************************
+* Summary:
+*   Discards the oldest complete windows in the circle buffer.
+*
+* Parameters:
+*     count: Number of windows to discard
+*
+* Return:
+*   The number of windows discarded, less than count if fewer were complete.
+*******************************************************************************/
+uint32_t sensor_skip_windows(uint32_t count)
+{
+    uint32_t state;
+
+    state = cyhal_system_critical_section_enter();
+    if (count > sensor_get_pending())
+    {
+        count = sensor_get_pending();
+    }
+    cy_fifo_read_update(&sensor_fifo, count * SENSOR_FIFO_WINDOW_ITEMS);
+    sensor_stats.skipped += count;
+    cyhal_system_critical_section_exit(state);
+
+    return count;
+}
+
+/*******************************************************************************
+* Function Name: sensor_get_stats
+********************************************************************************
+* Summary:
+*   Returns the window counters since reset.
+*
+* Parameters:
+*   stats: Structure to store the statistics
+*
+*******************************************************************************/
+void sensor_get_stats(sensor_stats_t *stats)
+{
+    *stats = sensor_stats;
+}
+
 /*******************************************************************************
 * Function Name: sensor_interrupt_handler
 ********************************************************************************
@@ -310,8 +399,12 @@ void sensor_interrupt_handler(void *callback_arg, cyhal_timer_event_t event)
     (void) event;
     static int location = 0;
 
+    TRACE_BEGIN(TRACE_SENSOR_ISR, 0);
+    INSTRUMENT_SCOPE(sensor_isr);
+
     /* Read data from IMU sensor */
     cy_rslt_t result;
+    INSTRUMENT_BEGIN(imu_read);
 #ifdef CY_BMX_160_IMU_SPI
     result = mtb_bmx160_read(&sensor_bmx160, &data);
 #endif
@@ -321,14 +414,25 @@ void sensor_interrupt_handler(void *callback_arg, cyhal_timer_event_t event)
 #ifdef CY_BMI_160_IMU_I2C
     result = mtb_bmi160_read(&sensor_bmi160, &data);
 #endif
+    INSTRUMENT_END(imu_read);
     if (CY_RSLT_SUCCESS != result)
     {
         CY_ASSERT(0);
     }
 
+    /* If the task fell behind and there is no room for a new window, drop the
+     * oldest one, so the windows stay aligned in the circle buffer */
+    if ((location == 0) &&
+        ((SENSOR_FIFO_POOL_SIZE / SENSOR_FIFO_ITEM_SIZE) - cy_fifo_get_count(&sensor_fifo) < SENSOR_FIFO_WINDOW_ITEMS))
+    {
+        cy_fifo_read_update(&sensor_fifo, SENSOR_FIFO_WINDOW_ITEMS);
+        sensor_stats.overruns++;
+    }
+
     /* Write data to the circle buffer */
     cy_fifo_write(&sensor_fifo, &data.accel, 1);
     cy_fifo_write(&sensor_fifo, &data.gyro, 1);
+    TRACE_INSTANT(TRACE_FIFO_WRITE, cy_fifo_get_count(&sensor_fifo));
 
     /* Once there is enough data to feed the inference, run pre-processing */
     location++;
@@ -336,10 +440,16 @@ void sensor_interrupt_handler(void *callback_arg, cyhal_timer_event_t event)
     {
         /* Reset the counter */
         location = 0;
+        sensor_window_tick = xTaskGetTickCountFromISR();
+        sensor_window_capture = LATENCY_NOW();
+        sensor_stats.windows++;
+        TRACE_INSTANT(TRACE_WINDOW_READY, 0);
 
         /* Once the event is set the data is processed */
         cy_rtos_setbits_event(&sensor_event, SENSOR_EVENT_BIT, true);
     }
+
+    TRACE_END(TRACE_SENSOR_ISR, 0);
 }
 
 /*******************************************************************************
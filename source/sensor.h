@@ -43,6 +43,9 @@
 #define SENSOR_H
 
 #include "cy_result.h"
+#include "latency.h"
+
+#include <stdint.h>
 
 /******************************************************************************
  * Constants
@@ -51,11 +54,28 @@
 #define SENSOR_NUM_AXIS   6
 #define SENSOR_SAMPLE_SIZE (SENSOR_DATA_WIDTH * SENSOR_NUM_AXIS)
 #define SENSOR_BATCH_SIZE  128u
+#define SENSOR_SCAN_RATE   128u
+
+/* Time between two windows */
+#define SENSOR_WINDOW_PERIOD_MS (1000u * SENSOR_BATCH_SIZE / SENSOR_SCAN_RATE)
+
+/******************************************************************************
+ * Typedefs
+ *****************************************************************************/
+typedef struct
+{
+    uint32_t windows;           /* Windows completed by the sensor interrupt */
+    uint32_t overruns;          /* Windows discarded because the buffer was full */
+    uint32_t skipped;           /* Windows discarded with sensor_skip_windows */
+} sensor_stats_t;
 
 /*******************************************************************************
 * Functions
 *******************************************************************************/
 cy_rslt_t sensor_init(void);
-cy_rslt_t sensor_get_data(void* sensor_data);
+cy_rslt_t sensor_get_data(void* sensor_data, uint32_t *timestamp, latency_time_t *capture);
+uint32_t sensor_get_pending(void);
+uint32_t sensor_skip_windows(uint32_t count);
+void sensor_get_stats(sensor_stats_t *stats);
 
 #endif /* SENSOR_H */
\ No newline at end of file
@@ -0,0 +1,450 @@
+/******************************************************************************
+* File Name:   sparse_nn.c
+*
+* Description: This file contains the implementation of a floating-point
+*              inference engine for pruned models. Only the non-zero weights
+*              are stored and multiplied, so flash and compute scale with the
+*              sparsity of the model. The models are generated from Keras
+*              with train/sparse_export.py.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2021-2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "sparse_nn.h"
+#include "trace.h"
+#include "instrument.h"
+
+#include <float.h>
+#include <math.h>
+#include <string.h>
+
+/*******************************************************************************
+* Local Functions
+*******************************************************************************/
+static void sparse_nn_accumulate(const sparse_nn_weights_t *weights, int out_c, int groups,
+                                 const int32_t *offset, const float *input, uint8_t relu, float *output);
+static void sparse_nn_conv2d(const sparse_nn_layer_t *layer, const float *input, float *output);
+static void sparse_nn_dense(const sparse_nn_layer_t *layer, const float *input, float *output);
+static void sparse_nn_affine(const sparse_nn_layer_t *layer, const float *input, float *output);
+static void sparse_nn_maxpool(const sparse_nn_layer_t *layer, const float *input, float *output);
+static void sparse_nn_global_avgpool(const sparse_nn_layer_t *layer, const float *input, float *output);
+static void sparse_nn_softmax(const sparse_nn_layer_t *layer, const float *input, float *output);
+
+/*******************************************************************************
+* Function Name: sparse_nn_run
+********************************************************************************
+* Summary:
+*   Runs a sparse model on one input, with the buffer of the model.
+*
+* Parameters:
+*   model: The model generated by train/sparse_export.py
+*   input: Input of the first layer
+*   output: Buffer to store the output of the last layer
+*
+* Return:
+*   The model output size.
+*******************************************************************************/
+int sparse_nn_run(const sparse_nn_model_t *model, const float *input, float *output)
+{
+    return sparse_nn_run_buffer(model, model->buffer, input, output);
+}
+
+/*******************************************************************************
+* Function Name: sparse_nn_run_buffer
+********************************************************************************
+* Summary:
+*   Runs a sparse model on one input. Even and odd layers write to different
+*   parts of the buffer, so each layer reads the output of the previous one.
+*   Threads that run the same model at the same time pass their own buffer.
+*
+* Parameters:
+*   model: The model generated by train/sparse_export.py
+*   buffer: Activations, sparse_nn_get_buffer_size() floats
+*   input: Input of the first layer
+*   output: Buffer to store the output of the last layer
+*
+* Return:
+*   The model output size.
+*******************************************************************************/
+int sparse_nn_run_buffer(const sparse_nn_model_t *model, float *buffer, const float *input, float *output)
+{
+    const sparse_nn_layer_t *layer = NULL;
+    float *result = NULL;
+
+    for (uint16_t i = 0; i < model->num_layers; i++)
+    {
+        layer = &model->layers[i];
+        result = &buffer[(i & 1u) * model->odd_offset];
+
+        TRACE_BEGIN(TRACE_MODEL_LAYER, i);
+        switch (layer->type)
+        {
+            case SPARSE_NN_CONV2D:
+                sparse_nn_conv2d(layer, input, result);
+                break;
+            case SPARSE_NN_DENSE:
+                sparse_nn_dense(layer, input, result);
+                break;
+            case SPARSE_NN_AFFINE:
+                sparse_nn_affine(layer, input, result);
+                break;
+            case SPARSE_NN_MAXPOOL:
+                sparse_nn_maxpool(layer, input, result);
+                break;
+            case SPARSE_NN_GLOBAL_AVGPOOL:
+                sparse_nn_global_avgpool(layer, input, result);
+                break;
+            case SPARSE_NN_SOFTMAX:
+                sparse_nn_softmax(layer, input, result);
+                break;
+            default:
+                break;
+        }
+        TRACE_END(TRACE_MODEL_LAYER, i);
+
+        input = result;
+    }
+
+    if (NULL == layer)
+    {
+        return 0;
+    }
+
+    int output_size = layer->out_h * layer->out_w * layer->out_c;
+    memcpy(output, result, output_size * sizeof(float));
+
+    return output_size;
+}
+
+/*******************************************************************************
+* Function Name: sparse_nn_get_buffer_size
+********************************************************************************
+* Summary:
+*   Returns the size of the activations of a model, the largest even layer
+*   output before odd_offset and the largest odd layer output after it.
+*
+* Parameters:
+*   model: The model generated by train/sparse_export.py
+*
+* Return:
+*   The number of floats of the buffer passed to sparse_nn_run_buffer().
+*******************************************************************************/
+uint32_t sparse_nn_get_buffer_size(const sparse_nn_model_t *model)
+{
+    uint32_t size = model->odd_offset;
+
+    for (uint16_t i = 0; i < model->num_layers; i++)
+    {
+        const sparse_nn_layer_t *layer = &model->layers[i];
+        uint32_t output_size = (uint32_t)layer->out_h * layer->out_w * layer->out_c;
+
+        if ((i & 1u) != 0)
+        {
+            output_size += model->odd_offset;
+        }
+        if (output_size > size)
+        {
+            size = output_size;
+        }
+    }
+
+    return size;
+}
+
+/*******************************************************************************
+* Function Name: sparse_nn_accumulate
+********************************************************************************
+* Summary:
+*   Computes every output channel of one output position from the non-zero
+*   weights of a layer.
+*
+* Parameters:
+*   weights: Non-zero weights of the layer
+*   out_c: Number of output channels
+*   groups: Number of weight groups per output channel
+*   offset: Position in the input of each group, negative to skip it
+*   input: Layer input
+*   relu: Apply a ReLU activation when not 0
+*   output: Buffer to store out_c values
+*
+*******************************************************************************/
+static void sparse_nn_accumulate(const sparse_nn_weights_t *weights, int out_c, int groups,
+                                 const int32_t *offset, const float *input, uint8_t relu, float *output)
+{
+    const uint16_t *start = weights->start;
+
+    for (int c = 0; c < out_c; c++)
+    {
+        float acc = weights->bias[c];
+
+        for (int g = 0; g < groups; g++, start++)
+        {
+            if (offset[g] < 0)
+            {
+                continue;
+            }
+
+            const float *group_input = &input[offset[g]];
+            for (uint32_t w = start[0]; w < start[1]; w++)
+            {
+                acc += weights->value[w] * group_input[weights->index[w]];
+            }
+        }
+
+        output[c] = (relu && (acc < 0.0f)) ? 0.0f : acc;
+    }
+}
+
+/*******************************************************************************
+* Function Name: sparse_nn_conv2d
+********************************************************************************
+* Summary:
+*   Convolution with stride 1 and "same" padding. Each group of weights is one
+*   tap of the kernel, skipped when it falls in the padding.
+*
+* Parameters:
+*   layer: The layer to run
+*   input: Layer input
+*   output: Buffer to store the layer output
+*
+*******************************************************************************/
+static void sparse_nn_conv2d(const sparse_nn_layer_t *layer, const float *input, float *output)
+{
+    INSTRUMENT_SCOPE(sparse_conv2d);
+
+    int32_t offset[SPARSE_NN_MAX_GROUPS];
+    const int pad_h = (layer->kernel_h - 1) / 2;
+    const int pad_w = (layer->kernel_w - 1) / 2;
+
+    for (int y = 0; y < layer->out_h; y++)
+    {
+        for (int x = 0; x < layer->out_w; x++)
+        {
+            int tap = 0;
+
+            for (int ky = 0; ky < layer->kernel_h; ky++)
+            {
+                for (int kx = 0; kx < layer->kernel_w; kx++, tap++)
+                {
+                    int in_y = y + ky - pad_h;
+                    int in_x = x + kx - pad_w;
+
+                    if ((in_y < 0) || (in_y >= layer->in_h) || (in_x < 0) || (in_x >= layer->in_w))
+                    {
+                        offset[tap] = -1;
+                    }
+                    else
+                    {
+                        offset[tap] = (in_y * layer->in_w + in_x) * layer->in_c;
+                    }
+                }
+            }
+
+            sparse_nn_accumulate(&layer->weights, layer->out_c, tap, offset, input, layer->relu,
+                                 &output[(y * layer->out_w + x) * layer->out_c]);
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: sparse_nn_dense
+********************************************************************************
+* Summary:
+*   Fully connected layer on the flattened input. Each group of weights covers
+*   SPARSE_NN_GROUP_SIZE inputs.
+*
+* Parameters:
+*   layer: The layer to run
+*   input: Layer input
+*   output: Buffer to store the layer output
+*
+*******************************************************************************/
+static void sparse_nn_dense(const sparse_nn_layer_t *layer, const float *input, float *output)
+{
+    INSTRUMENT_SCOPE(sparse_dense);
+
+    int32_t offset[SPARSE_NN_MAX_GROUPS];
+    int inputs = layer->in_h * layer->in_w * layer->in_c;
+    int groups = 0;
+
+    for (int i = 0; i < inputs; i += SPARSE_NN_GROUP_SIZE)
+    {
+        offset[groups++] = i;
+    }
+
+    sparse_nn_accumulate(&layer->weights, layer->out_c, groups, offset, input, layer->relu, output);
+}
+
+/*******************************************************************************
+* Function Name: sparse_nn_affine
+********************************************************************************
+* Summary:
+*   Scales and shifts each channel.
+*
+* Parameters:
+*   layer: The layer to run
+*   input: Layer input
+*   output: Buffer to store the layer output
+*
+*******************************************************************************/
+static void sparse_nn_affine(const sparse_nn_layer_t *layer, const float *input, float *output)
+{
+    int positions = layer->in_h * layer->in_w;
+
+    for (int p = 0; p < positions; p++)
+    {
+        for (int c = 0; c < layer->in_c; c++)
+        {
+            float value = *input++ * layer->scale[c] + layer->shift[c];
+            *output++ = (layer->relu && (value < 0.0f)) ? 0.0f : value;
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: sparse_nn_maxpool
+********************************************************************************
+* Summary:
+*   Max pooling with a stride equal to the pool size and "valid" padding.
+*
+* Parameters:
+*   layer: The layer to run
+*   input: Layer input
+*   output: Buffer to store the layer output
+*
+*******************************************************************************/
+static void sparse_nn_maxpool(const sparse_nn_layer_t *layer, const float *input, float *output)
+{
+    for (int y = 0; y < layer->out_h; y++)
+    {
+        for (int x = 0; x < layer->out_w; x++)
+        {
+            for (int c = 0; c < layer->out_c; c++)
+            {
+                float max = -FLT_MAX;
+
+                for (int ky = 0; ky < layer->kernel_h; ky++)
+                {
+                    for (int kx = 0; kx < layer->kernel_w; kx++)
+                    {
+                        int in_y = y * layer->kernel_h + ky;
+                        int in_x = x * layer->kernel_w + kx;
+                        float value = input[(in_y * layer->in_w + in_x) * layer->in_c + c];
+
+                        if (value > max)
+                        {
+                            max = value;
+                        }
+                    }
+                }
+
+                *output++ = max;
+            }
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: sparse_nn_global_avgpool
+********************************************************************************
+* Summary:
+*   Averages each channel over the height and width of the input.
+*
+* Parameters:
+*   layer: The layer to run
+*   input: Layer input
+*   output: Buffer to store the layer output
+*
+*******************************************************************************/
+static void sparse_nn_global_avgpool(const sparse_nn_layer_t *layer, const float *input, float *output)
+{
+    int positions = layer->in_h * layer->in_w;
+
+    for (int c = 0; c < layer->in_c; c++)
+    {
+        output[c] = 0.0f;
+    }
+
+    for (int p = 0; p < positions; p++)
+    {
+        for (int c = 0; c < layer->in_c; c++)
+        {
+            output[c] += *input++;
+        }
+    }
+
+    for (int c = 0; c < layer->in_c; c++)
+    {
+        output[c] /= (float)positions;
+    }
+}
+
+/*******************************************************************************
+* Function Name: sparse_nn_softmax
+********************************************************************************
+* Summary:
+*   Converts the input of a classification layer into probabilities.
+*
+* Parameters:
+*   layer: The layer to run
+*   input: Layer input
+*   output: Buffer to store the layer output
+*
+*******************************************************************************/
+static void sparse_nn_softmax(const sparse_nn_layer_t *layer, const float *input, float *output)
+{
+    int size = layer->in_h * layer->in_w * layer->in_c;
+    float max = -FLT_MAX;
+    float sum = 0.0f;
+
+    for (int i = 0; i < size; i++)
+    {
+        if (input[i] > max)
+        {
+            max = input[i];
+        }
+    }
+
+    for (int i = 0; i < size; i++)
+    {
+        output[i] = expf(input[i] - max);
+        sum += output[i];
+    }
+
+    for (int i = 0; i < size; i++)
+    {
+        output[i] /= sum;
+    }
+}
@@ -0,0 +1,120 @@
+/******************************************************************************
+* File Name:   sparse_nn.h
+*
+* Description: This file contains the function prototypes and constants used
+*   in sparse_nn.c.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2021-2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef SPARSE_NN_H
+#define SPARSE_NN_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/******************************************************************************
+ * Constants
+ *****************************************************************************/
+/* Maximum number of weight groups of a layer, see sparse_nn_weights_t */
+#define SPARSE_NN_MAX_GROUPS        25u
+
+/* Inputs addressed by the 8-bit index of a weight */
+#define SPARSE_NN_GROUP_SIZE        256u
+
+/* Name of the model generated by train/sparse_export.py */
+#define SPARSE_NN_CONCAT(a, b)      a##b
+#define SPARSE_NN_MODEL(name)       SPARSE_NN_CONCAT(name, _sparse_model)
+
+/******************************************************************************
+ * Typedefs
+ *****************************************************************************/
+typedef enum
+{
+    SPARSE_NN_CONV2D,           /* Stride 1 and "same" padding */
+    SPARSE_NN_DENSE,
+    SPARSE_NN_AFFINE,           /* Per-channel scale and shift, for BatchNormalization that could not be folded */
+    SPARSE_NN_MAXPOOL,          /* Stride equal to the pool size and "valid" padding */
+    SPARSE_NN_GLOBAL_AVGPOOL,
+    SPARSE_NN_SOFTMAX
+} sparse_nn_layer_type_t;
+
+/* Non-zero weights of a layer, sorted by output channel and then by group.
+ * A group is a kernel tap for convolutions and a block of SPARSE_NN_GROUP_SIZE
+ * inputs for dense layers, so each weight only stores its 8-bit input index
+ * within the group. Groups outside the input, the padding of a convolution,
+ * are skipped as a whole. */
+typedef struct
+{
+    const uint16_t *start;      /* First weight of each output channel and group, out_c x groups + 1 entries */
+    const uint8_t *index;       /* Input channel of each weight within its group */
+    const float *value;
+    const float *bias;          /* One per output channel */
+} sparse_nn_weights_t;
+
+/* Activations are stored height x width x channels, as in TensorFlow */
+typedef struct
+{
+    sparse_nn_layer_type_t type;
+    uint16_t in_h;
+    uint16_t in_w;
+    uint16_t in_c;
+    uint16_t out_h;
+    uint16_t out_w;
+    uint16_t out_c;
+    uint8_t kernel_h;           /* Convolution kernel or pooling window */
+    uint8_t kernel_w;
+    uint8_t relu;               /* Fused ReLU activation */
+    sparse_nn_weights_t weights;    /* CONV2D and DENSE */
+    const float *scale;         /* AFFINE */
+    const float *shift;         /* AFFINE */
+} sparse_nn_layer_t;
+
+typedef struct
+{
+    uint16_t num_layers;
+    const sparse_nn_layer_t *layers;
+    uint32_t odd_offset;        /* Even layers write at the start of buffer, odd layers at this offset */
+    float *buffer;              /* Activations of the last two layers */
+} sparse_nn_model_t;
+
+/*******************************************************************************
+* Functions
+*******************************************************************************/
+int sparse_nn_run(const sparse_nn_model_t *model, const float *input, float *output);
+int sparse_nn_run_buffer(const sparse_nn_model_t *model, float *buffer, const float *input, float *output);
+uint32_t sparse_nn_get_buffer_size(const sparse_nn_model_t *model);
+
+#endif /* SPARSE_NN_H */
@@ -0,0 +1,217 @@
+/******************************************************************************
+* File Name:   stream.c
+*
+* Description: This file contains the binary framing used to stream sensor
+*              data in data collection mode. Frames carry a sequence number
+*              and a CRC, so the host can detect lost and corrupted frames,
+*              and are sent through the non-blocking output ring.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2021-2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "stream.h"
+#include "output.h"
+
+#include "cyabs_rtos.h"
+
+#include <string.h>
+
+/*******************************************************************************
+* Constants
+*******************************************************************************/
+#define STREAM_CRC_INIT         0xFFFFu
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Frame being built, shared by the tasks that send frames under stream_lock */
+static cy_mutex_t stream_lock;
+static uint8_t stream_frame[STREAM_HEADER_SIZE + STREAM_MAX_PAYLOAD + STREAM_CRC_SIZE];
+static uint16_t stream_sequence;
+static stream_stats_t stream_stats;
+
+/* CRC of each byte value for the polynomial 0x1021, one table lookup per
+ * byte instead of eight shifts */
+static const uint16_t stream_crc_table[256] =
+{
+    0x0000u, 0x1021u, 0x2042u, 0x3063u, 0x4084u, 0x50A5u, 0x60C6u, 0x70E7u,
+    0x8108u, 0x9129u, 0xA14Au, 0xB16Bu, 0xC18Cu, 0xD1ADu, 0xE1CEu, 0xF1EFu,
+    0x1231u, 0x0210u, 0x3273u, 0x2252u, 0x52B5u, 0x4294u, 0x72F7u, 0x62D6u,
+    0x9339u, 0x8318u, 0xB37Bu, 0xA35Au, 0xD3BDu, 0xC39Cu, 0xF3FFu, 0xE3DEu,
+    0x2462u, 0x3443u, 0x0420u, 0x1401u, 0x64E6u, 0x74C7u, 0x44A4u, 0x5485u,
+    0xA56Au, 0xB54Bu, 0x8528u, 0x9509u, 0xE5EEu, 0xF5CFu, 0xC5ACu, 0xD58Du,
+    0x3653u, 0x2672u, 0x1611u, 0x0630u, 0x76D7u, 0x66F6u, 0x5695u, 0x46B4u,
+    0xB75Bu, 0xA77Au, 0x9719u, 0x8738u, 0xF7DFu, 0xE7FEu, 0xD79Du, 0xC7BCu,
+    0x48C4u, 0x58E5u, 0x6886u, 0x78A7u, 0x0840u, 0x1861u, 0x2802u, 0x3823u,
+    0xC9CCu, 0xD9EDu, 0xE98Eu, 0xF9AFu, 0x8948u, 0x9969u, 0xA90Au, 0xB92Bu,
+    0x5AF5u, 0x4AD4u, 0x7AB7u, 0x6A96u, 0x1A71u, 0x0A50u, 0x3A33u, 0x2A12u,
+    0xDBFDu, 0xCBDCu, 0xFBBFu, 0xEB9Eu, 0x9B79u, 0x8B58u, 0xBB3Bu, 0xAB1Au,
+    0x6CA6u, 0x7C87u, 0x4CE4u, 0x5CC5u, 0x2C22u, 0x3C03u, 0x0C60u, 0x1C41u,
+    0xEDAEu, 0xFD8Fu, 0xCDECu, 0xDDCDu, 0xAD2Au, 0xBD0Bu, 0x8D68u, 0x9D49u,
+    0x7E97u, 0x6EB6u, 0x5ED5u, 0x4EF4u, 0x3E13u, 0x2E32u, 0x1E51u, 0x0E70u,
+    0xFF9Fu, 0xEFBEu, 0xDFDDu, 0xCFFCu, 0xBF1Bu, 0xAF3Au, 0x9F59u, 0x8F78u,
+    0x9188u, 0x81A9u, 0xB1CAu, 0xA1EBu, 0xD10Cu, 0xC12Du, 0xF14Eu, 0xE16Fu,
+    0x1080u, 0x00A1u, 0x30C2u, 0x20E3u, 0x5004u, 0x4025u, 0x7046u, 0x6067u,
+    0x83B9u, 0x9398u, 0xA3FBu, 0xB3DAu, 0xC33Du, 0xD31Cu, 0xE37Fu, 0xF35Eu,
+    0x02B1u, 0x1290u, 0x22F3u, 0x32D2u, 0x4235u, 0x5214u, 0x6277u, 0x7256u,
+    0xB5EAu, 0xA5CBu, 0x95A8u, 0x8589u, 0xF56Eu, 0xE54Fu, 0xD52Cu, 0xC50Du,
+    0x34E2u, 0x24C3u, 0x14A0u, 0x0481u, 0x7466u, 0x6447u, 0x5424u, 0x4405u,
+    0xA7DBu, 0xB7FAu, 0x8799u, 0x97B8u, 0xE75Fu, 0xF77Eu, 0xC71Du, 0xD73Cu,
+    0x26D3u, 0x36F2u, 0x0691u, 0x16B0u, 0x6657u, 0x7676u, 0x4615u, 0x5634u,
+    0xD94Cu, 0xC96Du, 0xF90Eu, 0xE92Fu, 0x99C8u, 0x89E9u, 0xB98Au, 0xA9ABu,
+    0x5844u, 0x4865u, 0x7806u, 0x6827u, 0x18C0u, 0x08E1u, 0x3882u, 0x28A3u,
+    0xCB7Du, 0xDB5Cu, 0xEB3Fu, 0xFB1Eu, 0x8BF9u, 0x9BD8u, 0xABBBu, 0xBB9Au,
+    0x4A75u, 0x5A54u, 0x6A37u, 0x7A16u, 0x0AF1u, 0x1AD0u, 0x2AB3u, 0x3A92u,
+    0xFD2Eu, 0xED0Fu, 0xDD6Cu, 0xCD4Du, 0xBDAAu, 0xAD8Bu, 0x9DE8u, 0x8DC9u,
+    0x7C26u, 0x6C07u, 0x5C64u, 0x4C45u, 0x3CA2u, 0x2C83u, 0x1CE0u, 0x0CC1u,
+    0xEF1Fu, 0xFF3Eu, 0xCF5Du, 0xDF7Cu, 0xAF9Bu, 0xBFBAu, 0x8FD9u, 0x9FF8u,
+    0x6E17u, 0x7E36u, 0x4E55u, 0x5E74u, 0x2E93u, 0x3EB2u, 0x0ED1u, 0x1EF0u
+};
+
+/*******************************************************************************
+* Function Name: stream_init
+********************************************************************************
+* Summary:
+*   Creates the lock of the frame buffer. Must be called before stream_send.
+*
+* Return:
+*   The status of the initialization.
+*******************************************************************************/
+cy_rslt_t stream_init(void)
+{
+    return cy_rtos_init_mutex(&stream_lock);
+}
+
+/*******************************************************************************
+* Function Name: stream_send
+********************************************************************************
+* Summary:
+*   Builds a frame around the payload and queues it for the UART. Returns
+*   without waiting for the frame to be sent. Can be called from any task:
+*   the frames of the tasks are queued one after the other.
+*
+* Parameters:
+*   type: Payload type, one of STREAM_TYPE_*
+*   payload: Payload data
+*   size: Payload size in bytes, up to STREAM_MAX_PAYLOAD
+*
+*******************************************************************************/
+void stream_send(uint8_t type, const void *payload, uint16_t size)
+{
+    uint8_t flags = 0;
+    uint16_t crc;
+
+    cy_rtos_get_mutex(&stream_lock, CY_RTOS_NEVER_TIMEOUT);
+
+    if (size > STREAM_MAX_PAYLOAD)
+    {
+        stream_stats.dropped_frames++;
+        cy_rtos_set_mutex(&stream_lock);
+        return;
+    }
+
+#ifdef CY_BMI_160_IMU_I2C
+    flags |= STREAM_FLAG_BMI160_AXES;
+#endif
+
+    stream_frame[0] = STREAM_SYNC_0;
+    stream_frame[1] = STREAM_SYNC_1;
+    stream_frame[2] = type;
+    stream_frame[3] = flags;
+    stream_frame[4] = (uint8_t)(stream_sequence & 0xFFu);
+    stream_frame[5] = (uint8_t)(stream_sequence >> 8);
+    stream_frame[6] = (uint8_t)(size & 0xFFu);
+    stream_frame[7] = (uint8_t)(size >> 8);
+    memcpy(&stream_frame[STREAM_HEADER_SIZE], payload, size);
+
+    /* The sync bytes are not covered, the host finds them before checking */
+    crc = stream_crc16(&stream_frame[2], STREAM_HEADER_SIZE - 2 + size);
+    stream_frame[STREAM_HEADER_SIZE + size] = (uint8_t)(crc & 0xFFu);
+    stream_frame[STREAM_HEADER_SIZE + size + 1] = (uint8_t)(crc >> 8);
+
+    /* The sequence advances even if the frame is dropped, so the host sees the gap */
+    stream_sequence++;
+    if (0 == output_write((const char *)stream_frame, STREAM_HEADER_SIZE + size + STREAM_CRC_SIZE))
+    {
+        stream_stats.dropped_frames++;
+    }
+    else
+    {
+        stream_stats.frames++;
+    }
+
+    cy_rtos_set_mutex(&stream_lock);
+}
+
+/*******************************************************************************
+* Function Name: stream_get_stats
+********************************************************************************
+* Summary:
+*   Returns the frame counters since reset.
+*
+* Parameters:
+*   stats: Structure to store the statistics
+*
+*******************************************************************************/
+void stream_get_stats(stream_stats_t *stats)
+{
+    *stats = stream_stats;
+}
+
+/*******************************************************************************
+* Function Name: stream_crc16
+********************************************************************************
+* Summary:
+*   Computes the CRC-16/CCITT-FALSE of a buffer, the same as binascii.crc_hqx
+*   with 0xFFFF as initial value in Python. Also checks the received frames.
+*
+* Parameters:
+*   data: Bytes to check
+*   size: Number of bytes
+*
+* Return:
+*   The CRC.
+*******************************************************************************/
+uint16_t stream_crc16(const uint8_t *data, uint32_t size)
+{
+    uint16_t crc = STREAM_CRC_INIT;
+
+    for (uint32_t i = 0; i < size; i++)
+    {
+        crc = (uint16_t)((crc << 8) ^ stream_crc_table[(crc >> 8) ^ data[i]]);
+    }
+
+    return crc;
+}
@@ -0,0 +1,94 @@
+/******************************************************************************
+* File Name:   stream.h
+*
+* Description: This file contains the function prototypes and constants used
+*   in stream.c.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2021-2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef STREAM_H
+#define STREAM_H
+
+#include <stdint.h>
+
+#include "cy_result.h"
+
+/******************************************************************************
+ * Constants
+ *****************************************************************************/
+/* Frame layout, all fields little-endian:
+ *   sync      2 bytes  STREAM_SYNC_0, STREAM_SYNC_1
+ *   type      1 byte   STREAM_TYPE_*
+ *   flags     1 byte   STREAM_FLAG_*
+ *   sequence  2 bytes  incremented for every frame, to detect lost frames
+ *   length    2 bytes  payload size in bytes
+ *   payload   length bytes
+ *   crc       2 bytes  CRC-16/CCITT-FALSE of type to payload
+ * train/stream_protocol.py decodes the frames on the host. */
+#define STREAM_SYNC_0           0xA5u
+#define STREAM_SYNC_1           0x5Au
+#define STREAM_HEADER_SIZE      8u
+#define STREAM_CRC_SIZE         2u
+#define STREAM_MAX_PAYLOAD      1536u
+
+/* Payload types */
+#define STREAM_TYPE_RAW         0x01u   /* Window of int16 samples, SENSOR_NUM_AXIS per sample */
+#define STREAM_TYPE_DELTA       0x02u   /* Window compressed with imu_codec_encode() */
+#define STREAM_TYPE_TRACE       0x03u   /* Chunk of the trace_log_t, see trace.h */
+#define STREAM_TYPE_WINDOW      0x04u   /* Host to device: pre-processed window, see replay.h */
+#define STREAM_TYPE_RESULT      0x05u   /* Decision on a replayed window, replay_result_t */
+
+/* Flags */
+#define STREAM_FLAG_BMI160_AXES 0x01u   /* Samples need the BMI160 axis swap and inversion */
+
+/******************************************************************************
+ * Typedefs
+ *****************************************************************************/
+typedef struct
+{
+    uint32_t frames;            /* Frames queued for the UART */
+    uint32_t dropped_frames;    /* Frames rejected by the output ring */
+} stream_stats_t;
+
+/*******************************************************************************
+* Functions
+*******************************************************************************/
+cy_rslt_t stream_init(void);
+void stream_send(uint8_t type, const void *payload, uint16_t size);
+void stream_get_stats(stream_stats_t *stats);
+uint16_t stream_crc16(const uint8_t *data, uint32_t size);
+
+#endif /* STREAM_H */
@@ -0,0 +1,116 @@
+/******************************************************************************
+* File Name:   trace.c
+*
+* Description: This file contains the trace log, a ring of compact events
+*              with cycle timestamps recorded by the trace points, and its
+*              dump to the host. train/trace_export.py converts a dump to the
+*              Chrome trace format, which can be opened in Perfetto.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2021-2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "trace.h"
+
+#if TRACE_ENABLE
+#include "stream.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+/*******************************************************************************
+* Constants
+*******************************************************************************/
+/* Bytes of the log per frame, and the time for the UART to send them */
+#define TRACE_DUMP_CHUNK        1024u
+#define TRACE_DUMP_DELAY_MS     100u
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+trace_log_t trace_log;
+volatile uint8_t trace_running;
+
+/*******************************************************************************
+* Function Name: trace_init
+********************************************************************************
+* Summary:
+*   Clears the log and starts recording. The cycle counter is started by
+*   instrument_init.
+*
+*******************************************************************************/
+void trace_init(void)
+{
+    trace_log.magic = TRACE_MAGIC;
+    trace_log.clock_hz = instrument_get_cycles_per_us() * 1000000u;
+    trace_log.capacity = TRACE_BUFFER_EVENTS;
+    trace_log.head = 0;
+    trace_running = 1;
+}
+
+/*******************************************************************************
+* Function Name: trace_dump
+********************************************************************************
+* Summary:
+*   Sends the log to the host as STREAM_TYPE_TRACE frames, then clears it.
+*   Recording is paused during the dump, which takes TRACE_DUMP_DELAY_MS per
+*   chunk, under a second for the default log size. The log can also be read
+*   with a debugger, as the trace_log variable.
+*
+*******************************************************************************/
+void trace_dump(void)
+{
+    const uint8_t *data = (const uint8_t *)&trace_log;
+    uint32_t offset = 0;
+
+    trace_running = 0;
+
+    while (offset < sizeof(trace_log))
+    {
+        uint32_t size = sizeof(trace_log) - offset;
+        if (size > TRACE_DUMP_CHUNK)
+        {
+            size = TRACE_DUMP_CHUNK;
+        }
+
+        stream_send(STREAM_TYPE_TRACE, &data[offset], (uint16_t)size);
+        offset += size;
+
+        /* Let the output ring drain, it is smaller than the log */
+        vTaskDelay(pdMS_TO_TICKS(TRACE_DUMP_DELAY_MS));
+    }
+
+    trace_init();
+}
+#endif /* #if TRACE_ENABLE */
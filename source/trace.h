@@ -0,0 +1,151 @@
+/******************************************************************************
+* File Name:   trace.h
+*
+* Description: This file contains the function prototypes and constants used
+*   in trace.c.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2021-2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdint.h>
+
+/******************************************************************************
+ * Constants
+ *****************************************************************************/
+/* Set by the Makefile with TRACE=1. When 0, the trace points compile to
+ * nothing and trace.c is empty. */
+#ifndef TRACE_ENABLE
+#define TRACE_ENABLE            0u
+#endif
+
+/* Events kept in RAM, the oldest are overwritten. Must be a power of two. */
+#define TRACE_BUFFER_EVENTS     1024u
+
+/* Identifies the log in a memory dump, "TRC1" */
+#define TRACE_MAGIC             0x31435254u
+
+/* Event phases, as in the Chrome trace format */
+#define TRACE_PHASE_BEGIN       0u
+#define TRACE_PHASE_END         1u
+#define TRACE_PHASE_INSTANT     2u
+
+/******************************************************************************
+ * Typedefs
+ *****************************************************************************/
+/* Trace points. The names and tracks in train/trace_export.py must match. */
+typedef enum
+{
+    TRACE_SENSOR_ISR,           /* Sensor interrupt */
+    TRACE_FIFO_WRITE,           /* Sample written to the sensor buffer, arg: items in the buffer */
+    TRACE_WINDOW_READY,         /* The interrupt completed a window */
+    TRACE_ACQUIRE_WAKE,         /* The gesture task read a window */
+    TRACE_PREPROCESS_CAST,
+    TRACE_PREPROCESS_FILTER,
+    TRACE_PREPROCESS_NORMALIZE,
+    TRACE_PREPROCESS_AXES,
+    TRACE_INFERENCE_WAKE,       /* The inference task received a window, arg: sequence */
+    TRACE_MODEL_RUN,            /* Model of the registry, arg: model index */
+    TRACE_MODEL_LAYER,          /* Layer of the sparse engine, arg: layer index */
+    TRACE_DECISION,             /* Decision and terminal output */
+    TRACE_UART_FLUSH,           /* Transfer to the debug UART, arg: bytes */
+    TRACE_NUM_IDS
+} trace_id_t;
+
+typedef struct
+{
+    uint32_t cycles;            /* INSTRUMENT_NOW() */
+    uint8_t id;                 /* trace_id_t */
+    uint8_t phase;              /* TRACE_PHASE_* */
+    uint16_t arg;
+} trace_event_t;
+
+/* Layout of the log, in RAM and as dumped by trace_dump */
+typedef struct
+{
+    uint32_t magic;             /* TRACE_MAGIC */
+    uint32_t clock_hz;          /* Frequency of the cycle counter */
+    uint32_t capacity;          /* TRACE_BUFFER_EVENTS */
+    uint32_t head;              /* Events written since reset, the last capacity are kept */
+    trace_event_t events[TRACE_BUFFER_EVENTS];
+} trace_log_t;
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+#if TRACE_ENABLE
+#include "cy_pdl.h"
+#include "instrument.h"
+
+extern trace_log_t trace_log;
+extern volatile uint8_t trace_running;
+
+/* Stores an event, a few cycles with interrupts masked. Can be called from
+ * interrupts. */
+__STATIC_FORCEINLINE void trace_event(uint8_t id, uint8_t phase, uint16_t arg)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    if (trace_running)
+    {
+        trace_event_t *event = &trace_log.events[trace_log.head++ & (TRACE_BUFFER_EVENTS - 1u)];
+        event->cycles = INSTRUMENT_NOW();
+        event->id = id;
+        event->phase = phase;
+        event->arg = arg;
+    }
+    __set_PRIMASK(primask);
+}
+
+#define TRACE_BEGIN(id, arg)    trace_event((id), TRACE_PHASE_BEGIN, (uint16_t)(arg))
+#define TRACE_END(id, arg)      trace_event((id), TRACE_PHASE_END, (uint16_t)(arg))
+#define TRACE_INSTANT(id, arg)  trace_event((id), TRACE_PHASE_INSTANT, (uint16_t)(arg))
+#else
+#define TRACE_BEGIN(id, arg)
+#define TRACE_END(id, arg)
+#define TRACE_INSTANT(id, arg)
+#endif
+
+/*******************************************************************************
+* Functions
+*******************************************************************************/
+#if TRACE_ENABLE
+void trace_init(void);
+void trace_dump(void);
+#endif
+
+#endif /* TRACE_H */
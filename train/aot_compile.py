@@ -0,0 +1,1438 @@
+# (c) 2022, Cypress Semiconductor Corporation (an Infineon company) or an affiliate of Cypress Semiconductor 
+# Corporation.  All rights reserved.
+#
+# This software, including source code, documentation and related materials
+# ("Software") is owned by Cypress Semiconductor Corporation or one of its
+# affiliates ("Cypress") and is protected by and subject to worldwide patent 
+# protection (United States and foreign), United States copyright laws and 
+# international treaty provisions.  Therefore, you may use this Software only
+# as provided in the license agreement accompanying the software package from
+# which you obtained this Software ("EULA").
+#
+# If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+# non-transferable license to copy, modify, and compile the Software source
+# code solely for use in connection with Cypress's integrated circuit products.
+# Any reproduction, modification, translation, compilation, or representation
+# of this Software except as specified above is prohibited without the express 
+# written permission of Cypress.
+#
+# Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+# WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+# reserves the right to make changes to the Software without notice. Cypress
+# does not assume any liability arising out of the application or use of the
+# Software or any product or circuit described in the Software. Cypress does
+# not authorize its products for use in any products where a malfunction or
+# failure of the Cypress product may reasonably be expected to result in
+# significant property damage, injury or death ("High Risk Product"). By
+# including Cypress's product in a High Risk Product, the manufacturer of such 
+# system or application assumes all risk of such use and in doing so agrees to
+# indemnify Cypress against all liability.
+
+"""
+Compile a TensorFlow Lite model to straight-line C, without an interpreter.
+Each group of fused operators becomes a function whose shapes, strides and
+quantization parameters are literals, the activations are placed in one arena
+planned at compile time, and the caller gives the arena:
+
+    static uint8_t arena[MAGIC_WAND_AOT_ARENA_SIZE] __attribute__((aligned(4)));
+
+    MAGIC_WAND_aot_run(input, output, arena);
+
+A convolution or dense layer absorbs its activation and the operators after
+it: a max pooling with strides equal to its size, MUL and ADD by a constant of
+each channel (a BatchNormalization folded by the converter), a MEAN over the
+height and width, and a softmax. The pooled and averaged activations are never
+stored, and the convolution inputs are stored with their padding so that the
+loops need no bounds checks.
+
+The integer arithmetic is that of the TensorFlow Lite Micro (TFLM) kernels with
+CMSIS-NN, and the floating-point sums run in the order of the reference kernels,
+so the outputs match those of the TFLM engine bit for bit; qemu/aot_check.c
+checks it on the device. The script reports the flash, RAM and
+multiply-accumulates (MACs) of each compiled model against the TFLM interpreter
+model of mtb_ml_models, when that model embeds the same .tflite, and the
+accuracy of its numpy reference on the recordings in gesture_data/. With --check, the generated C is built with the host compiler
+and compared with the numpy reference on the recordings.
+
+Usage: python aot_compile.py [--models ../mtb_ml_gen/model_gen_dir/MAGIC_WAND_int8x8.tflite] [--check]
+"""
+
+import argparse
+import binascii
+import ctypes
+import ctypes.util
+import os
+import re
+import struct
+import subprocess
+import tempfile
+import numpy as np
+
+from replay_data import load_windows
+
+# Builtin operator codes of the TensorFlow Lite schema
+OPERATORS = {0: 'ADD', 3: 'CONV_2D', 9: 'FULLY_CONNECTED', 17: 'MAX_POOL_2D', 18: 'MUL', 22: 'RESHAPE',
+             25: 'SOFTMAX', 40: 'MEAN'}
+
+TENSOR_TYPES = {0: np.float32, 2: np.int32, 9: np.int8}
+
+PADDING_SAME = 0
+ACTIVATIONS = {0: 'none', 1: 'relu', 2: 'relu_n1_to_1', 3: 'relu6'}
+
+# Integer kernels of TFLM: left shift of the ADD inputs, integer bits of the
+# softmax input and of its sum of exponentials
+ADD_LEFT_SHIFT = 20
+SOFTMAX_INPUT_BITS = 5
+SOFTMAX_ACCUM_BITS = 12
+
+INT8_MIN = -128
+INT8_MAX = 127
+FLT_MAX = float(np.finfo(np.float32).max)
+
+# The dot products of the int8 kernels take 4 weights at a time
+WEIGHT_GROUP = 4
+
+ARENA_ALIGNMENT = 4
+
+# expf() of the C library, which the float softmax of TFLM and of the generated code calls
+LIBM = ctypes.CDLL(ctypes.util.find_library('m'))
+LIBM.expf.argtypes = [ctypes.c_float]
+LIBM.expf.restype = ctypes.c_float
+
+
+class FlatBuffer:
+    """
+    Table of a FlatBuffer, read through its vtable.
+    """
+    def __init__(self, data, position):
+        self.data = data
+        self.position = position
+
+    def _field(self, index):
+        vtable = self.position - struct.unpack_from('<i', self.data, self.position)[0]
+        if 4 + 2 * index >= struct.unpack_from('<H', self.data, vtable)[0]:
+            return None
+        offset = struct.unpack_from('<H', self.data, vtable + 4 + 2 * index)[0]
+        return self.position + offset if offset else None
+
+    def _vector(self, index):
+        field = self._field(index)
+        if field is None:
+            return None, 0
+        start = field + struct.unpack_from('<I', self.data, field)[0]
+        return start + 4, struct.unpack_from('<I', self.data, start)[0]
+
+    def scalar(self, index, fmt, default=0):
+        field = self._field(index)
+        return default if field is None else struct.unpack_from('<' + fmt, self.data, field)[0]
+
+    def table(self, index):
+        field = self._field(index)
+        return None if field is None else FlatBuffer(self.data, field + struct.unpack_from('<I', self.data, field)[0])
+
+    def array(self, index, dtype):
+        start, length = self._vector(index)
+        return np.frombuffer(self.data, dtype, length, start).copy() if start else np.zeros(0, dtype)
+
+    def tables(self, index):
+        start, length = self._vector(index)
+        return [FlatBuffer(self.data, start + 4 * i + struct.unpack_from('<I', self.data, start + 4 * i)[0])
+                for i in range(length)]
+
+    def string(self, index):
+        return bytes(self.array(index, np.uint8)).decode()
+
+
+def read_options(code, options):
+    """
+    @return: The options of an operator, with the defaults of the schema for the absent fields
+    """
+    if options is None:
+        return {}
+    if code == 'CONV_2D':
+        return {'padding': options.scalar(0, 'b'), 'stride': (options.scalar(2, 'i'), options.scalar(1, 'i')),
+                'activation': ACTIVATIONS[options.scalar(3, 'b')],
+                'dilation': (options.scalar(5, 'i', 1), options.scalar(4, 'i', 1))}
+    if code == 'MAX_POOL_2D':
+        return {'padding': options.scalar(0, 'b'), 'stride': (options.scalar(2, 'i'), options.scalar(1, 'i')),
+                'filter': (options.scalar(4, 'i'), options.scalar(3, 'i')),
+                'activation': ACTIVATIONS[options.scalar(5, 'b')]}
+    if code in ('FULLY_CONNECTED', 'ADD', 'MUL'):
+        return {'activation': ACTIVATIONS[options.scalar(0, 'b')]}
+    if code == 'SOFTMAX':
+        return {'beta': options.scalar(0, 'f', 0.0)}
+    if code == 'MEAN':
+        return {'keep_dims': bool(options.scalar(0, 'B'))}
+    return {}
+
+
+def read_model(path):
+    """
+    Reads the first subgraph of a .tflite file.
+
+    @param path: Path of the model
+    @return: A dictionary with the tensors, the operators and the input and output tensor indexes
+    """
+    with open(path, 'rb') as file:
+        data = file.read()
+    model = FlatBuffer(data, struct.unpack_from('<I', data, 0)[0])
+    codes = [OPERATORS.get(max(code.scalar(0, 'b'), code.scalar(3, 'i')), 'unknown') for code in model.tables(1)]
+    buffers = model.tables(4)
+    subgraph = model.tables(2)[0]
+
+    tensors = []
+    for tensor in subgraph.tables(0):
+        dtype = TENSOR_TYPES.get(tensor.scalar(1, 'b'))
+        if dtype is None:
+            raise Exception(f"{tensor.string(3)}: tensor type {tensor.scalar(1, 'b')} is not supported")
+        shape = tuple(int(dim) for dim in tensor.array(0, np.int32))
+        raw = buffers[tensor.scalar(2, 'I')].array(0, np.uint8)
+        quantization = tensor.table(4)
+        tensors.append({'name': tensor.string(3), 'shape': shape, 'dtype': dtype,
+                        'data': raw.view(dtype).reshape(shape) if len(raw) else None,
+                        'scale': quantization.array(2, np.float32) if quantization else np.zeros(0, np.float32),
+                        'zero_point': quantization.array(3, np.int64) if quantization else np.zeros(0, np.int64)})
+
+    operators = []
+    for operator in subgraph.tables(3):
+        code = codes[operator.scalar(0, 'I')]
+        operators.append({'code': code, 'inputs': [int(i) for i in operator.array(1, np.int32)],
+                          'outputs': [int(i) for i in operator.array(2, np.int32)],
+                          'options': read_options(code, operator.table(4))})
+
+    inputs, outputs = subgraph.array(1, np.int32), subgraph.array(2, np.int32)
+    if len(inputs) != 1 or len(outputs) != 1:
+        raise Exception(f"{path}: only models with one input and one output are supported")
+
+    return {'tensors': tensors, 'operators': operators, 'input': int(inputs[0]), 'output': int(outputs[0])}
+
+
+def fuse_operators(model):
+    """
+    Groups the operators of a chain in stages, each led by a convolution or a dense layer.
+
+    @param model: A model from read_model()
+    @return: A list of stages, with the operators fused into each
+    """
+    tensors = model['tensors']
+    stages = []
+    current = model['input']
+    for operator in model['operators']:
+        code, inputs = operator['code'], operator['inputs']
+        name = tensors[operator['outputs'][0]]['name']
+        if inputs[0] != current or any(i >= 0 and tensors[i]['data'] is None for i in inputs[1:]):
+            raise Exception(f"{name}: only a chain of operators with constant weights is supported")
+        stage = stages[-1] if stages else None
+
+        if code == 'RESHAPE':
+            # The activations keep their order
+            pass
+        elif code in ('CONV_2D', 'FULLY_CONNECTED'):
+            if code == 'CONV_2D' and operator['options']['dilation'] != (1, 1):
+                raise Exception(f"{name}: dilated convolutions are not supported")
+            stages.append({'type': 'conv' if code == 'CONV_2D' else 'dense', 'main': operator, 'pool': None,
+                           'affine': [], 'mean': None, 'softmax': None, 'input': current})
+            stage = stages[-1]
+        elif code == 'MAX_POOL_2D':
+            options = operator['options']
+            if stage is None or stage['type'] != 'conv' or stage['pool'] or stage['affine']:
+                raise Exception(f"{name}: a max pooling must follow a convolution")
+            if options['stride'] != options['filter'] or options['padding'] == PADDING_SAME:
+                raise Exception(f"{name}: only strides equal to the pool size and 'valid' padding are supported")
+            stage['pool'] = operator
+        elif code in ('MUL', 'ADD'):
+            constant = tensors[inputs[1]]
+            if stage is None or stage['type'] != 'conv' or stage['mean'] \
+                    or constant['data'].size not in (1, tensors[current]['shape'][-1]):
+                raise Exception(f"{name}: only MUL and ADD by a constant of each channel after a convolution "
+                                "are supported")
+            stage['affine'].append(operator)
+        elif code == 'MEAN':
+            axes = sorted(int(axis) % 4 for axis in tensors[inputs[1]]['data'].reshape(-1))
+            if stage is None or stage['type'] != 'conv' or stage['mean'] or axes != [1, 2]:
+                raise Exception(f"{name}: only a MEAN over the height and width after a convolution is supported")
+            if operator['options']['keep_dims'] and tensors[current]['dtype'] == np.int8:
+                raise Exception(f"{name}: a quantized MEAN with keep_dims is not supported")
+            stage['mean'] = operator
+        elif code == 'SOFTMAX':
+            if stage is None or stage['type'] != 'dense' or stage['softmax']:
+                raise Exception(f"{name}: a softmax must follow a dense layer")
+            stage['softmax'] = operator
+        else:
+            raise Exception(f"{name}: operator {code} is not supported")
+
+        current = operator['outputs'][0]
+        if stage is not None:
+            stage['output'] = current
+
+    if not stages or current != model['output']:
+        raise Exception("The model must start with a convolution or a dense layer and end with its output")
+
+    return stages
+
+
+def window_shape(shape):
+    """
+    @return: Height, width and channels of a tensor shape of one window
+    """
+    if len(shape) == 4:
+        return shape[1:]
+    return 1, 1, int(np.prod(shape[1:]))
+
+
+def activation_range(activation, tensor):
+    """
+    @return: The clamp of an activation, in the quantized values of the tensor for int8
+    """
+    if tensor['dtype'] == np.float32:
+        return {'none': (-FLT_MAX, FLT_MAX), 'relu': (0.0, FLT_MAX), 'relu6': (0.0, 6.0),
+                'relu_n1_to_1': (-1.0, 1.0)}[activation]
+
+    # CalculateActivationRangeQuantized of TFLM
+    scale, zero_point = np.float32(tensor['scale'][0]), int(tensor['zero_point'][0])
+
+    def quantize(value):
+        # Rounded half away from zero
+        value = np.float32(value) / scale
+        return zero_point + int(np.sign(value) * np.floor(abs(value) + np.float32(0.5)))
+
+    low, high = {'none': (None, None), 'relu': (0.0, None), 'relu6': (0.0, 6.0),
+                 'relu_n1_to_1': (-1.0, 1.0)}[activation]
+    return (INT8_MIN if low is None else max(INT8_MIN, quantize(low)),
+            INT8_MAX if high is None else min(INT8_MAX, quantize(high)))
+
+
+def quantize_multiplier(real):
+    """
+    QuantizeMultiplier of TFLM.
+
+    @return: The Q31 multiplier and the power of two of a real multiplier
+    """
+    if real == 0.0:
+        return 0, 0
+    fraction, shift = np.frexp(real)
+    multiplier = int(np.sign(fraction) * np.floor(abs(fraction) * (1 << 31) + 0.5))
+    if multiplier == 1 << 31:
+        multiplier //= 2
+        shift += 1
+    if shift < -31:
+        return 0, 0
+    return multiplier, int(shift)
+
+
+def high_mul(value, multiplier):
+    """
+    Rounded doubling high multiplication of CMSIS-NN, equal to SaturatingRoundingDoublingHighMul
+    of TFLM but for INT32_MIN x INT32_MIN.
+    """
+    return (np.asarray(value, np.int64) * multiplier + (1 << 30)) >> 31
+
+
+def divide_by_pot(value, exponent):
+    """
+    RoundingDivideByPOT of TFLM.
+    """
+    value = np.asarray(value, np.int64)
+    mask = (np.int64(1) << exponent) - 1
+    threshold = (mask >> 1) + (value < 0)
+    return (value >> exponent) + ((value & mask) > threshold)
+
+
+def requantize(value, multiplier, shift):
+    """
+    MultiplyByQuantizedMultiplier of TFLM and arm_nn_requantize of CMSIS-NN.
+    """
+    shift = np.asarray(shift, np.int64)
+    return divide_by_pot(high_mul(np.asarray(value, np.int64) << np.maximum(shift, 0), multiplier),
+                         np.maximum(-shift, 0))
+
+
+def wrap32(value):
+    """
+    @return: The values as int32 arithmetic leaves them
+    """
+    return ((np.asarray(value, np.int64) + (1 << 31)) & 0xFFFFFFFF) - (1 << 31)
+
+
+def high_mul_saturated(value, multiplier):
+    """
+    arm_nn_doubling_high_mult of CMSIS-NN.
+    """
+    value, multiplier = np.asarray(value, np.int64), np.asarray(multiplier, np.int64)
+    product = value * multiplier + np.where((value < 0) != (multiplier < 0), 1 - (1 << 30), 1 << 30)
+    # Division truncated toward zero
+    result = np.sign(product) * (np.abs(product) >> 31)
+    return np.where((value == multiplier) & (value == -(1 << 31)), (1 << 31) - 1, result)
+
+
+def exp_on_negative_values(value):
+    """
+    arm_nn_exp_on_negative_values of CMSIS-NN: exp() of a Q5.26 value in [-32, 0], in Q0.31.
+    """
+    value = np.asarray(value, np.int64)
+    shift = 24
+    quarter = (value & ((1 << shift) - 1)) - (1 << shift)
+    remainder = quarter - value
+    x = wrap32((quarter << 5) + (1 << 28))
+    x2 = high_mul_saturated(x, x)
+    series = divide_by_pot(high_mul_saturated(divide_by_pot(high_mul_saturated(x2, x2), 2) +
+                                              high_mul_saturated(x2, x), 715827883) + x2, 1)
+    result = wrap32(1895147668 + high_mul_saturated(1895147668, wrap32(x + series)))
+    for multiplier in (1672461947, 1302514674, 790015084, 290630308, 39332535, 720401, 242):
+        result = np.where(remainder & (1 << shift), high_mul_saturated(result, multiplier), result)
+        shift += 1
+    return np.where(value == 0, (1 << 31) - 1, result)
+
+
+def one_over_one_plus_x(value):
+    """
+    arm_nn_one_over_one_plus_x_for_x_in_0_1 of CMSIS-NN: 1 / (1 + x) for x in [0, 1) in Q0.31.
+    """
+    total = np.asarray(value, np.int64) + (1 << 31) - 1
+    half_denominator = np.where(total >= 0, (total + 1) // 2, -((-total + 1) // 2))
+    x = wrap32(1515870810 + high_mul_saturated(half_denominator, -1010580540))
+    for _ in range(3):
+        x = wrap32(x + 4 * high_mul_saturated(x, (1 << 29) - high_mul_saturated(half_denominator, x)))
+    # Saturating multiplication by 2
+    return np.clip(x * 2, -(1 << 31), (1 << 31) - 1)
+
+
+def count_leading_zeros(value):
+    """
+    @return: The leading zeros of positive int32 values
+    """
+    return 32 - np.array([int(v).bit_length() for v in np.asarray(value).reshape(-1)]).reshape(np.shape(value))
+
+
+def softmax_int8(logits, multiplier, shift, diff_min):
+    """
+    arm_softmax_s8 of CMSIS-NN, on rows of int8 logits.
+    """
+    logits = np.asarray(logits, np.int64)
+    diff = logits - logits.max(axis=-1, keepdims=True)
+    valid = diff >= diff_min
+    exps = exp_on_negative_values(high_mul_saturated(diff * (1 << shift), multiplier))
+    total = np.where(valid, divide_by_pot(exps, SOFTMAX_ACCUM_BITS), 0).sum(axis=-1, keepdims=True)
+    headroom = count_leading_zeros(total)
+    scale = one_over_one_plus_x(wrap32((total << headroom) - (1 << 31)))
+    bits_over_unit = SOFTMAX_ACCUM_BITS - headroom + 23
+    output = divide_by_pot(high_mul_saturated(scale, exps), bits_over_unit) + INT8_MIN
+    return np.where(valid, np.clip(output, INT8_MIN, INT8_MAX), INT8_MIN)
+
+
+def mean_mapping(count, input_scale, input_zero_point, output_scale, output_zero_point):
+    """
+    The integer MEAN of TFLM for different input and output quantizations rounds in floating point.
+    Finds an integer multiply and shift of the sum of the inputs that gives the same result for every
+    sum they can reach, so that the generated code has no floating point.
+
+    @return: The multiplier, offset and shift, and the output for every reachable sum
+    """
+    sums = np.arange(INT8_MIN * count, INT8_MAX * count + 1, dtype=np.int64)
+    scale = np.float32(input_scale) / np.float32(output_scale)
+    bias = np.float32(-input_zero_point) * scale
+    mean = sums.astype(np.float32) / np.float32(count)
+    scaled = (mean * scale).astype(np.float32) + bias
+    rounded = np.sign(scaled) * np.floor(np.abs(scaled).astype(np.float64) + 0.5)
+    expected = np.clip(rounded + output_zero_point, INT8_MIN, INT8_MAX).astype(np.int64) - output_zero_point
+
+    # The result must not depend on the TFLM build contracting the multiply-add
+    fused = (mean.astype(np.float64) * float(scale) + float(bias)).astype(np.float32)
+    if not np.array_equal(rounded, np.sign(fused) * np.floor(np.abs(fused).astype(np.float64) + 0.5)):
+        raise Exception("The rounding of the MEAN of TFLM depends on fused multiply-adds")
+
+    # The unclamped values only matter inside the clamp
+    inside = (expected > INT8_MIN - output_zero_point) & (expected < INT8_MAX - output_zero_point)
+    for shift in range(16, 48):
+        ideal = float(scale) / count * (1 << shift)
+        for multiplier in range(max(1, int(ideal) - 64), int(ideal) + 64):
+            low = np.max(expected[inside] * (1 << shift) - sums[inside] * multiplier)
+            high = np.min((expected[inside] + 1) * (1 << shift) - sums[inside] * multiplier) - 1
+            if low <= high:
+                offset = int(low)
+                result = np.clip(((sums * multiplier + offset) >> shift) + output_zero_point, INT8_MIN, INT8_MAX)
+                if np.array_equal(result - output_zero_point, expected):
+                    return multiplier, offset, shift
+    raise Exception("No integer MEAN matches the rounding of TFLM")
+
+
+def stage_parameters(stage, tensors):
+    """
+    Computes the shapes and the quantized parameters of a stage, as the TFLM kernels prepare them.
+    """
+    main = stage['main']
+    source, weights = tensors[main['inputs'][0]], tensors[main['inputs'][1]]
+    bias = tensors[main['inputs'][2]] if len(main['inputs']) > 2 and main['inputs'][2] >= 0 else None
+    main_output = tensors[main['outputs'][0]]
+    quantized = source['dtype'] == np.int8
+    height, width, channels = window_shape(source['shape'])
+    stage.update({'quantized': quantized, 'in_shape': (height, width, channels)})
+
+    if stage['type'] == 'conv':
+        options = main['options']
+        kernel = weights['data']
+        filter_h, filter_w = kernel.shape[1:3]
+        stride_h, stride_w = options['stride']
+        if options['padding'] == PADDING_SAME:
+            out_h, out_w = -(-height // stride_h), -(-width // stride_w)
+            pad_h = max((out_h - 1) * stride_h + filter_h - height, 0)
+            pad_w = max((out_w - 1) * stride_w + filter_w - width, 0)
+        else:
+            out_h, out_w = (height - filter_h) // stride_h + 1, (width - filter_w) // stride_w + 1
+            pad_h = pad_w = 0
+        stage.update({'filter': (filter_h, filter_w), 'stride': (stride_h, stride_w),
+                      'padding': (pad_h // 2, pad_h - pad_h // 2, pad_w // 2, pad_w - pad_w // 2),
+                      'conv_shape': (out_h, out_w, kernel.shape[0])})
+    else:
+        kernel = weights['data'].reshape(weights['shape'][0], -1)
+        if kernel.shape[1] != height * width * channels:
+            raise Exception(f"{main_output['name']}: the input does not match the weights")
+        stage.update({'filter': (1, 1), 'stride': (1, 1), 'padding': (0, 0, 0, 0),
+                      'conv_shape': (1, 1, kernel.shape[0])})
+        stage['in_shape'] = (1, 1, kernel.shape[1])
+
+    # Weights of each output channel in the order of the receptive field
+    stage['weights'] = kernel.reshape(kernel.shape[0], -1)
+    stage['bias'] = bias['data'] if bias is not None else np.zeros(kernel.shape[0], np.int32 if quantized
+                                                                   else np.float32)
+    stage['activation'] = activation_range(main['options']['activation'], main_output)
+
+    out_h, out_w, out_c = stage['conv_shape']
+    pool_h, pool_w = stage['pool']['options']['filter'] if stage['pool'] else (1, 1)
+    stage['pool_size'] = (pool_h, pool_w)
+    stage['pooled_shape'] = (out_h // pool_h, out_w // pool_w, out_c)
+    stage['pool_activation'] = activation_range(stage['pool']['options']['activation'],
+                                                tensors[stage['pool']['outputs'][0]]) if stage['pool'] else None
+    stage['out_shape'] = (1, 1, out_c) if stage['mean'] else stage['pooled_shape']
+
+    if quantized:
+        input_scale = float(source['scale'][0])
+        output_scale = float(main_output['scale'][0])
+        filter_scales = np.broadcast_to(weights['scale'], (out_c,)).astype(np.float64)
+        if stage['type'] == 'conv':
+            # PopulateConvolutionQuantizationParams: products in double
+            reals = [input_scale * s / output_scale for s in filter_scales]
+        else:
+            if len(weights['scale']) != 1:
+                raise Exception(f"{main_output['name']}: per-channel dense weights are not supported")
+            # GetQuantizedConvolutionMultipler: product in float
+            reals = [float(np.float32(input_scale) * np.float32(weights['scale'][0])) / output_scale]
+        stage['input_offset'] = -int(source['zero_point'][0])
+        stage['output_zero_point'] = int(main_output['zero_point'][0])
+        stage['requantize'] = [quantize_multiplier(real) for real in reals]
+
+    previous = tensors[stage['pool']['outputs'][0]] if stage['pool'] else main_output
+    stage['affine_params'] = []
+    for operator in stage['affine']:
+        constant = tensors[operator['inputs'][1]]
+        output = tensors[operator['outputs'][0]]
+        values = np.broadcast_to(constant['data'].reshape(-1), (out_c,))
+        params = {'code': operator['code'], 'values': values,
+                  'activation': activation_range(operator['options']['activation'], output)}
+        if quantized:
+            scale1, scale2, scale_out = (float(np.float32(t['scale'][0])) for t in (previous, constant, output))
+            offset1, offset2 = -int(previous['zero_point'][0]), -int(constant['zero_point'][0])
+            params['offset'] = offset1
+            params['output_zero_point'] = int(output['zero_point'][0])
+            if operator['code'] == 'MUL':
+                params['requantize'] = quantize_multiplier(scale1 * scale2 / scale_out)
+                params['values'] = values.astype(np.int64) + offset2
+            else:
+                twice_max = 2 * max(scale1, scale2)
+                params['input1'] = quantize_multiplier(scale1 / twice_max)
+                input2 = quantize_multiplier(scale2 / twice_max)
+                params['requantize'] = quantize_multiplier(twice_max / ((1 << ADD_LEFT_SHIFT) * scale_out))
+                # The constant operand is scaled at compile time
+                params['values'] = requantize((values.astype(np.int64) + offset2) << ADD_LEFT_SHIFT, *input2)
+        stage['affine_params'].append(params)
+        previous = output
+
+    if stage['mean']:
+        output = tensors[stage['mean']['outputs'][0]]
+        count = stage['pooled_shape'][0] * stage['pooled_shape'][1]
+        stage['mean_count'] = count
+        if quantized:
+            same = previous['zero_point'][0] == output['zero_point'][0] and previous['scale'][0] == output['scale'][0]
+            stage['mean_zero_point'] = int(output['zero_point'][0])
+            stage['mean_mapping'] = None if same else mean_mapping(count, previous['scale'][0],
+                                                                   int(previous['zero_point'][0]), output['scale'][0],
+                                                                   int(output['zero_point'][0]))
+        previous = output
+
+    if stage['softmax']:
+        output = tensors[stage['softmax']['outputs'][0]]
+        beta = stage['softmax']['options']['beta']
+        if quantized:
+            # PreprocessSoftmaxScaling and CalculateInputRadius of TFLM
+            real = min(beta * float(previous['scale'][0]) * (1 << (31 - SOFTMAX_INPUT_BITS)), (1 << 31) - 1.0)
+            multiplier, shift = quantize_multiplier(real)
+            radius = ((1 << SOFTMAX_INPUT_BITS) - 1) * (1 << (31 - SOFTMAX_INPUT_BITS)) / (1 << shift)
+            stage['softmax_params'] = (multiplier, shift, -int(np.floor(radius)))
+            if output['zero_point'][0] != INT8_MIN or output['scale'][0] != np.float32(1.0 / 256):
+                raise Exception(f"{output['name']}: the softmax output must have a scale of 1/256 and a zero point "
+                                "of -128")
+        stage['beta'] = np.float32(beta)
+        previous = output
+
+    stage['output_tensor'] = previous
+
+
+def plan_buffers(stages):
+    """
+    Places the input of each stage in the arena. The input of a convolution is stored with its
+    padding; the model input is copied only if the first stage needs padding. Buffers used by the
+    same stage do not overlap.
+
+    @return: The buffers, with their offset, and the size of the arena
+    """
+    buffers = []
+    for index, stage in enumerate(stages):
+        top, bottom, left, right = stage['padding']
+        height, width, channels = stage['in_shape']
+        if index == 0 and not any(stage['padding']):
+            continue
+        item = 1 if stage['quantized'] else 4
+        size = (height + top + bottom) * (width + left + right) * channels * item
+        buffers.append({'stage': index, 'size': -(-size // ARENA_ALIGNMENT) * ARENA_ALIGNMENT, 'offset': None})
+
+    placed = []
+    for buffer in sorted(buffers, key=lambda b: -b['size']):
+        # Live from the end of the stage before to the end of the stage
+        conflicts = sorted((b['offset'], b['offset'] + b['size']) for b in placed
+                           if abs(b['stage'] - buffer['stage']) <= 1)
+        offset = 0
+        for start, end in conflicts:
+            if offset + buffer['size'] <= start:
+                break
+            offset = max(offset, end)
+        buffer['offset'] = offset
+        placed.append(buffer)
+
+    return {b['stage']: b for b in buffers}, max([b['offset'] + b['size'] for b in buffers] + [0])
+
+
+def float_activation(x, low, high):
+    """
+    ActivationFunctionWithMinMax of TFLM, which keeps a negative zero
+    """
+    x = np.where(x < np.float32(low), np.float32(low), x)
+    return np.where(np.float32(high) < x, np.float32(high), x).astype(np.float32)
+
+
+def run_reference(stages, windows):
+    """
+    Reference implementation of the generated code in numpy, run on a batch. The floating-point
+    operations are made in the order of the C code, without fused multiply-adds.
+
+    @param stages: Stages from fuse_operators(), with their parameters
+    @param windows: Batch of model inputs, quantized for an int8 model
+    @return: The model outputs
+    """
+    x = windows.reshape((len(windows),) + stages[0]['in_shape'])
+
+    for stage in stages:
+        quantized = stage['quantized']
+        height, width, channels = stage['in_shape']
+        x = x.reshape((len(x), height, width, channels))
+        top, bottom, left, right = stage['padding']
+        fill = -stage['input_offset'] if quantized else 0
+        padded = np.pad(x, ((0, 0), (top, bottom), (left, right), (0, 0)), constant_values=fill)
+        (filter_h, filter_w), (stride_h, stride_w) = stage['filter'], stage['stride']
+        (pool_h, pool_w), (pooled_h, pooled_w, out_c) = stage['pool_size'], stage['pooled_shape']
+        out_h, out_w = pooled_h * pool_h, pooled_w * pool_w
+        weights = stage['weights'].reshape(out_c, filter_h, filter_w, channels)
+
+        if quantized:
+            total = np.zeros((len(x), out_h, out_w, out_c), np.int64)
+            padded = padded.astype(np.int64) + stage['input_offset']
+            for ky in range(filter_h):
+                for kx in range(filter_w):
+                    patch = padded[:, ky:ky + out_h * stride_h:stride_h, kx:kx + out_w * stride_w:stride_w]
+                    total += np.einsum('nhwc,oc->nhwo', patch, weights[:, ky, kx].astype(np.int64))
+        else:
+            total = np.zeros((len(x), out_h, out_w, out_c), np.float32)
+            for ky in range(filter_h):
+                for kx in range(filter_w):
+                    patch = padded[:, ky:ky + out_h * stride_h:stride_h, kx:kx + out_w * stride_w:stride_w]
+                    for c in range(channels):
+                        total = total + patch[..., c:c + 1] * weights[:, ky, kx, c]
+
+        # The pooling is taken before the bias and requantization, which do not change the order
+        x = total.reshape((len(x), pooled_h, pool_h, pooled_w, pool_w, out_c)).max(axis=(2, 4))
+        low, high = stage['activation']
+        if quantized:
+            multipliers, shifts = (np.array(p) for p in zip(*stage['requantize']))
+            x = requantize(x + stage['bias'], multipliers, shifts) + stage['output_zero_point']
+            x = np.clip(x, low, high)
+            if stage['pool_activation']:
+                x = np.clip(x, *stage['pool_activation'])
+            for params in stage['affine_params']:
+                if params['code'] == 'MUL':
+                    x = requantize((x + params['offset']) * params['values'], *params['requantize'])
+                else:
+                    x = requantize(requantize((x + params['offset']) << ADD_LEFT_SHIFT, *params['input1']) +
+                                   params['values'], *params['requantize'])
+                x = np.clip(x + params['output_zero_point'], *params['activation'])
+            if stage['mean']:
+                total = x.reshape((len(x), -1, out_c)).sum(axis=1)
+                if stage['mean_mapping'] is None:
+                    # Integer division toward zero
+                    x = np.trunc(total / stage['mean_count']).astype(np.int64)
+                else:
+                    multiplier, offset, shift = stage['mean_mapping']
+                    x = np.clip(((total * multiplier + offset) >> shift) + stage['mean_zero_point'],
+                                INT8_MIN, INT8_MAX)
+            if stage['softmax']:
+                x = softmax_int8(x.reshape(len(x), -1), *stage['softmax_params'])
+        else:
+            x = float_activation(x + stage['bias'], low, high)
+            if stage['pool_activation']:
+                x = float_activation(x, *stage['pool_activation'])
+            for params in stage['affine_params']:
+                x = x * params['values'] if params['code'] == 'MUL' else x + params['values']
+                x = float_activation(x, *params['activation'])
+            if stage['mean']:
+                total = np.zeros((len(x), out_c), np.float32)
+                for position in x.reshape((len(x), -1, out_c)).transpose(1, 0, 2):
+                    total = total + position
+                x = total / np.float32(stage['mean_count'])
+            if stage['softmax']:
+                x = x.reshape(len(x), -1)
+                exps = np.vectorize(LIBM.expf, otypes=[np.float32])((x - x.max(axis=1, keepdims=True)) *
+                                                                     stage['beta'])
+                total = np.zeros(len(x), np.float32)
+                for column in exps.T:
+                    total = total + column
+                x = exps / total[:, None]
+
+        x = x.astype(np.int8 if quantized else np.float32)
+
+    return x.reshape((len(x), -1))
+
+
+def c_array(c_type, name, values, per_line, aligned=False):
+    """
+    @return: The C definition of a constant array
+    """
+    if c_type == 'float':
+        items = [f"{float(value):.9e}f" for value in np.asarray(values).reshape(-1)]
+    else:
+        items = [str(int(value)) for value in np.asarray(values).reshape(-1)]
+    lines = [', '.join(items[i:i + per_line]) for i in range(0, len(items), per_line)]
+    attribute = " __attribute__((aligned(4)))" if aligned else ""
+    return f"static const {c_type} {name}[{len(items)}]{attribute} =\n{{\n    " + ",\n    ".join(lines) + "\n};\n\n"
+
+
+def group_weights(weights):
+    """
+    Pads the weights of each channel to groups of 4 and swaps the middle two of each group, so that
+    SXTB16 splits a word of weights in the pairs of a word of the int16 column.
+
+    @return: The weights as stored, and the padded count of each channel
+    """
+    count = -(-weights.shape[1] // WEIGHT_GROUP) * WEIGHT_GROUP
+    padded = np.zeros((weights.shape[0], count), np.int8)
+    padded[:, :weights.shape[1]] = weights
+    return padded.reshape(-1, WEIGHT_GROUP)[:, [0, 2, 1, 3]].reshape(weights.shape[0], count), count
+
+
+def signed(value):
+    """
+    @return: The C term that adds a constant
+    """
+    return f" + {value}" if value >= 0 else f" - {-value}"
+
+
+def linear(terms, constant=0):
+    """
+    @param terms: Pairs of a C variable and its factor
+    @param constant: Constant term
+    @return: The C index of the sum
+    """
+    parts = [variable if factor == 1 else f"{variable} * {factor}u" for variable, factor in terms if factor]
+    if constant:
+        parts.append(f"{constant}u")
+    return ' + '.join(parts) if parts else '0'
+
+
+INT8_HELPERS = """\
+/* Rounded division by 2^exponent of the TFLM and CMSIS-NN kernels */
+static inline int32_t aot_divide_by_pot(int32_t value, int32_t exponent)
+{
+    int32_t mask = (int32_t)((1u << exponent) - 1u);
+    int32_t threshold = (mask >> 1) + ((value < 0) ? 1 : 0);
+
+    return (value >> exponent) + (((value & mask) > threshold) ? 1 : 0);
+}
+
+/* value x multiplier x 2^shift for a Q31 multiplier, as arm_nn_requantize */
+static inline int32_t aot_requantize(int32_t value, int32_t multiplier, int32_t shift)
+{
+    int32_t high = (int32_t)(((int64_t)(value * (1 << ((shift > 0) ? shift : 0))) * multiplier + (1ll << 30)) >> 31);
+
+    return aot_divide_by_pot(high, (shift > 0) ? 0 : -shift);
+}
+
+static inline int32_t aot_clamp(int32_t value, int32_t low, int32_t high)
+{
+    return (value < low) ? low : ((value > high) ? high : value);
+}
+
+/* Receptive field of an output, rows of length values, with the input offset */
+static inline void aot_im2col(int16_t *col, const int8_t *input, uint32_t rows, uint32_t length, uint32_t stride,
+                              int32_t offset)
+{
+    for (uint32_t row = 0; row < rows; row++)
+    {
+        for (uint32_t i = 0; i < length; i++)
+        {
+            *col++ = (int16_t)(input[i] + offset);
+        }
+        input += stride;
+    }
+}
+
+/* Largest dot product so far of the column with the weights of each channel.
+ * The weights of a channel are count values, in groups of 4 with the middle
+ * two swapped. */
+static void aot_dot_max(const int16_t *col, const int8_t *weights, uint32_t count, uint32_t channels,
+                        int32_t *acc)
+{
+    for (uint32_t c = 0; c < channels; c++)
+    {
+        int32_t sum = 0;
+#if defined(__ARM_FEATURE_SIMD32)
+        for (uint32_t i = 0; i < count; i += 4u)
+        {
+            uint32_t group;
+            uint32_t low;
+            uint32_t high;
+
+            memcpy(&group, &weights[i], sizeof(group));
+            memcpy(&low, &col[i], sizeof(low));
+            memcpy(&high, &col[i + 2u], sizeof(high));
+            sum = __smlad((int16x2_t)low, __sxtb16((int8x4_t)group), sum);
+            sum = __smlad((int16x2_t)high, __sxtb16((int8x4_t)__ror(group, 8u)), sum);
+        }
+#else
+        for (uint32_t i = 0; i < count; i += 4u)
+        {
+            sum += col[i] * weights[i] + col[i + 1u] * weights[i + 2u] +
+                   col[i + 2u] * weights[i + 1u] + col[i + 3u] * weights[i + 3u];
+        }
+#endif
+        if (sum > acc[c])
+        {
+            acc[c] = sum;
+        }
+        weights += count;
+    }
+}
+
+"""
+
+INT8_SOFTMAX_HELPERS = """\
+/* Saturating rounded doubling high multiplication, as arm_nn_doubling_high_mult */
+static inline int32_t aot_high_mul(int32_t a, int32_t b)
+{
+    int64_t product = ((a < 0) != (b < 0)) ? (1 - (1ll << 30)) : (1ll << 30);
+
+    if ((a == b) && (a == INT32_MIN))
+    {
+        return INT32_MAX;
+    }
+    product += (int64_t)a * b;
+
+    return (int32_t)(product / (1ll << 31));
+}
+
+/* exp() of a Q5.26 value in [-32, 0], in Q0.31, as arm_nn_exp_on_negative_values */
+static int32_t aot_exp_on_negative(int32_t value)
+{
+    static const int32_t multipliers[7] = { 1672461947, 1302514674, 790015084, 290630308, 39332535, 720401, 242 };
+    int32_t quarter = (value & ((1 << 24) - 1)) - (1 << 24);
+    int32_t remainder = quarter - value;
+    int32_t x = (int32_t)((uint32_t)quarter << 5) + (1 << 28);
+    int32_t x2 = aot_high_mul(x, x);
+    int32_t result = 1895147668 + aot_high_mul(1895147668, x + aot_divide_by_pot(
+        aot_high_mul(aot_divide_by_pot(aot_high_mul(x2, x2), 2) + aot_high_mul(x2, x), 715827883) + x2, 1));
+
+    for (uint32_t i = 0; i < 7u; i++)
+    {
+        if (0 != (remainder & (1 << (24u + i))))
+        {
+            result = aot_high_mul(result, multipliers[i]);
+        }
+    }
+
+    return (0 == value) ? INT32_MAX : result;
+}
+
+/* 1 / (1 + x) of x in [0, 1) in Q0.31, as arm_nn_one_over_one_plus_x_for_x_in_0_1 */
+static int32_t aot_one_over_one_plus_x(int32_t value)
+{
+    int64_t sum = (int64_t)value + INT32_MAX;
+    int32_t half_denominator = (int32_t)((sum + ((sum >= 0) ? 1 : -1)) / 2);
+    int32_t x = 1515870810 + aot_high_mul(half_denominator, -1010580540);
+
+    for (uint32_t i = 0; i < 3u; i++)
+    {
+        x += 4 * aot_high_mul(x, (1 << 29) - aot_high_mul(half_denominator, x));
+    }
+
+    return (x > INT32_MAX / 2) ? INT32_MAX : ((x < -(INT32_MAX / 2)) ? INT32_MIN : x * 2);
+}
+
+/* Softmax of int8 logits to an output of scale 1/256, as arm_softmax_s8 */
+static void aot_softmax(const int8_t *input, int8_t *output, uint32_t size, int32_t multiplier, int32_t shift,
+                        int32_t diff_min)
+{
+    int32_t max = input[0];
+    int32_t sum = 0;
+    int32_t headroom;
+    int32_t scale;
+
+    for (uint32_t i = 1; i < size; i++)
+    {
+        max = (input[i] > max) ? input[i] : max;
+    }
+    for (uint32_t i = 0; i < size; i++)
+    {
+        int32_t diff = input[i] - max;
+        if (diff >= diff_min)
+        {
+            sum += aot_divide_by_pot(aot_exp_on_negative(aot_high_mul(diff * (1 << shift), multiplier)), """ \
+    + str(SOFTMAX_ACCUM_BITS) + """);
+        }
+    }
+
+    headroom = __builtin_clz((uint32_t)sum);
+    scale = aot_one_over_one_plus_x((int32_t)(((uint32_t)sum << headroom) - (1u << 31)));
+    for (uint32_t i = 0; i < size; i++)
+    {
+        int32_t diff = input[i] - max;
+        int32_t value = INT8_MIN;
+        if (diff >= diff_min)
+        {
+            value = aot_divide_by_pot(aot_high_mul(scale, aot_exp_on_negative(aot_high_mul(diff * (1 << shift),
+                multiplier))), """ + str(SOFTMAX_ACCUM_BITS) + """ - headroom + 23) + INT8_MIN;
+        }
+        output[i] = (int8_t)aot_clamp(value, INT8_MIN, INT8_MAX);
+    }
+}
+
+"""
+
+FLOAT_HELPERS = """\
+/* Largest dot product so far of the receptive field with the weights of each
+ * channel, summed in the order of the TFLM reference kernels */
+static void aot_dot_max(const float *input, uint32_t rows, uint32_t length, uint32_t stride, const float *weights,
+                        uint32_t channels, float *acc)
+{
+    for (uint32_t c = 0; c < channels; c++)
+    {
+        const float *row = input;
+        float total = 0.0f;
+
+        for (uint32_t r = 0; r < rows; r++)
+        {
+            for (uint32_t i = 0; i < length; i++)
+            {
+                total += row[i] * weights[i];
+            }
+            row += stride;
+            weights += length;
+        }
+        if (total > acc[c])
+        {
+            acc[c] = total;
+        }
+    }
+}
+
+"""
+
+FLOAT_SOFTMAX_HELPERS = """\
+/* Softmax in the order of the TFLM reference kernel */
+static void aot_softmax(const float *input, float *output, uint32_t size, float beta)
+{
+    float max = -FLT_MAX;
+    float sum = 0.0f;
+
+    for (uint32_t i = 0; i < size; i++)
+    {
+        max = (max < input[i]) ? input[i] : max;
+    }
+    for (uint32_t i = 0; i < size; i++)
+    {
+        output[i] = expf((input[i] - max) * beta);
+        sum += output[i];
+    }
+    for (uint32_t i = 0; i < size; i++)
+    {
+        output[i] = output[i] / sum;
+    }
+}
+
+"""
+
+
+def float_clamp(variable, low, high):
+    """
+    @return: The C statements of ActivationFunctionWithMinMax, nothing for no activation
+    """
+    lines = []
+    if low != -FLT_MAX:
+        lines.append(f"{variable} = ({variable} < {low:.9e}f) ? {low:.9e}f : {variable};")
+    if high != FLT_MAX:
+        lines.append(f"{variable} = ({high:.9e}f < {variable}) ? {high:.9e}f : {variable};")
+    return lines
+
+
+def emit_stage(stage, number, prefix, output_layout):
+    """
+    @param stage: A stage with its parameters
+    @param number: Index of the stage
+    @param prefix: Prefix of the generated names
+    @param output_layout: Padding (top, left) and padded width of the output buffer, None for the model output
+    @return: The constant data and the function of the stage, and the bytes of constant data
+    """
+    quantized = stage['quantized']
+    name = f"{prefix}_stage{number}"
+    data_type = 'int8_t' if quantized else 'float'
+    height, width, channels = stage['in_shape']
+    _, _, left, right = stage['padding']
+    padded_w = width + left + right
+    (filter_h, filter_w), (stride_h, stride_w) = stage['filter'], stage['stride']
+    (pool_h, pool_w), (pooled_h, pooled_w, out_c) = stage['pool_size'], stage['pooled_shape']
+    length = filter_w * channels
+    row_stride = padded_w * channels
+    data, const_bytes = "", 0
+
+    if quantized:
+        weights, count = group_weights(stage['weights'])
+        data += c_array('int8_t', f"{name}_weights", weights, 16, aligned=True)
+        data += c_array('int32_t', f"{name}_bias", stage['bias'], 8)
+        const_bytes += weights.size + 4 * out_c
+        multipliers, shifts = zip(*stage['requantize'])
+        per_channel = len(set(stage['requantize'])) > 1
+        if per_channel:
+            data += c_array('int32_t', f"{name}_multiplier", multipliers, 8)
+            data += c_array('int8_t', f"{name}_shift", shifts, 16)
+            const_bytes += 5 * out_c
+            requantize = f"{name}_multiplier[c], {name}_shift[c]"
+        else:
+            requantize = f"{multipliers[0]}, {shifts[0]}"
+    else:
+        data += c_array('float', f"{name}_weights", stage['weights'], 4)
+        data += c_array('float', f"{name}_bias", stage['bias'], 4)
+        const_bytes += 4 * (stage['weights'].size + out_c)
+
+    # Operators of the stage, for the comment
+    operators = [stage['main']['code'] + ('' if stage['main']['options']['activation'] == 'none'
+                                          else ' ' + stage['main']['options']['activation'].upper())]
+    if stage['pool']:
+        operators.append(f"MAX_POOL_2D {pool_h}x{pool_w}")
+    operators += [params['code'] for params in stage['affine_params']]
+    if stage['mean']:
+        operators.append('MEAN')
+    if stage['softmax']:
+        operators.append('SOFTMAX')
+    out_h, out_w, _ = stage['out_shape']
+
+    body = [f"/* {', '.join(operators)}: {height}x{width}x{channels} -> {out_h}x{out_w}x{out_c} */",
+            f"static void {name}(const {data_type} *input, {data_type} *output)", "{"]
+    if quantized:
+        body.append(f"    int16_t col[{count}] = {{ 0 }};")
+        body.append(f"    int32_t acc[{out_c}];")
+        if stage['mean']:
+            body.append(f"    int32_t sum[{out_c}] = {{ 0 }};")
+        if stage['softmax']:
+            body.append(f"    int8_t logits[{out_c}];")
+    else:
+        body.append(f"    float acc[{out_c}];")
+        if stage['mean']:
+            body.append(f"    float sum[{out_c}];")
+        if stage['softmax']:
+            body.append(f"    float logits[{out_c}];")
+    body.append("")
+    if stage['mean'] and not quantized:
+        body += [f"    for (uint32_t c = 0; c < {out_c}u; c++)", "    {", "        sum[c] = 0.0f;", "    }"]
+
+    # Loops over the outputs, then over the pool window
+    indent = "    "
+    loops = []
+    if pooled_h > 1:
+        loops.append(('y', pooled_h))
+    if pooled_w > 1:
+        loops.append(('x', pooled_w))
+    for variable, size in loops:
+        body += [f"{indent}for (uint32_t {variable} = 0; {variable} < {size}u; {variable}++)", f"{indent}{{"]
+        indent += "    "
+    minimum = 'INT32_MIN' if quantized else '-FLT_MAX'
+    body += [f"{indent}for (uint32_t c = 0; c < {out_c}u; c++)", f"{indent}{{",
+             f"{indent}    acc[c] = {minimum};", f"{indent}}}"]
+
+    window = []
+    if pool_h > 1:
+        window.append(('dy', pool_h))
+    if pool_w > 1:
+        window.append(('dx', pool_w))
+    inner = indent
+    for variable, size in window:
+        body += [f"{inner}for (uint32_t {variable} = 0; {variable} < {size}u; {variable}++)", f"{inner}{{"]
+        inner += "    "
+    start = linear([('y', pool_h * stride_h * row_stride * (pooled_h > 1)),
+                    ('dy', stride_h * row_stride * (pool_h > 1)),
+                    ('x', pool_w * stride_w * channels * (pooled_w > 1)),
+                    ('dx', stride_w * channels * (pool_w > 1))])
+    if quantized:
+        body.append(f"{inner}aot_im2col(col, &input[{start}], {filter_h}u, {length}u, {row_stride}u, "
+                    f"{stage['input_offset']});")
+        body.append(f"{inner}aot_dot_max(col, {name}_weights, {count}u, {out_c}u, acc);")
+    else:
+        body.append(f"{inner}aot_dot_max(&input[{start}], {filter_h}u, {length}u, {row_stride}u,")
+        body.append(f"{inner}            {name}_weights, {out_c}u, acc);")
+    for _ in window:
+        inner = inner[:-4]
+        body.append(f"{inner}}}")
+
+    # Epilogue of each channel
+    body += [f"{indent}for (uint32_t c = 0; c < {out_c}u; c++)", f"{indent}{{"]
+    line = indent + "    "
+    low, high = stage['activation']
+    if quantized:
+        body.append(f"{line}int32_t value = acc[c] + {name}_bias[c];")
+        body.append(f"{line}value = aot_requantize(value, {requantize});")
+        body.append(f"{line}value = aot_clamp(value{signed(stage['output_zero_point'])}, {low}, {high});")
+        if stage['pool_activation'] and stage['pool_activation'] != (INT8_MIN, INT8_MAX):
+            body.append(f"{line}value = aot_clamp(value, {stage['pool_activation'][0]}, "
+                        f"{stage['pool_activation'][1]});")
+        for i, params in enumerate(stage['affine_params']):
+            constant = f"{name}_{params['code'].lower()}{i}"
+            data += c_array('int32_t', constant, params['values'], 8)
+            const_bytes += 4 * len(params['values'])
+            multiplier, shift = params['requantize']
+            if params['code'] == 'MUL':
+                body.append(f"{line}value = aot_requantize((value{signed(params['offset'])}) * {constant}[c], "
+                            f"{multiplier}, {shift});")
+            else:
+                body.append("{}value = aot_requantize((value{}) * {}, {}, {}) + {}[c];".format(
+                    line, signed(params['offset']), 1 << ADD_LEFT_SHIFT, *params['input1'], constant))
+                body.append(f"{line}value = aot_requantize(value, {multiplier}, {shift});")
+            activation = params['activation']
+            body.append(f"{line}value = aot_clamp(value{signed(params['output_zero_point'])}, "
+                        f"{activation[0]}, {activation[1]});")
+    else:
+        body.append(f"{line}float value = acc[c] + {name}_bias[c];")
+        body += [line + statement for statement in float_clamp('value', low, high)]
+        if stage['pool_activation']:
+            body += [line + statement for statement in float_clamp('value', *stage['pool_activation'])]
+        for i, params in enumerate(stage['affine_params']):
+            constant = f"{name}_{params['code'].lower()}{i}"
+            data += c_array('float', constant, params['values'], 4)
+            const_bytes += 4 * len(params['values'])
+            operator = '*' if params['code'] == 'MUL' else '+'
+            body.append(f"{line}value = value {operator} {constant}[c];")
+            body += [line + statement for statement in float_clamp('value', *params['activation'])]
+
+    if stage['mean']:
+        body.append(f"{line}sum[c] = sum[c] + value;" if not quantized else f"{line}sum[c] += value;")
+    elif stage['softmax']:
+        body.append(f"{line}logits[c] = {'(int8_t)' if quantized else ''}value;")
+    else:
+        pad_top, pad_left, out_padded_w = output_layout or (0, 0, pooled_w)
+        position = linear([('y', out_padded_w * out_c * (pooled_h > 1)), ('x', out_c * (pooled_w > 1)), ('c', 1)],
+                          (pad_top * out_padded_w + pad_left) * out_c)
+        body.append(f"{line}output[{position}] = {'(int8_t)' if quantized else ''}value;")
+    body.append(f"{indent}}}")
+
+    for _ in loops:
+        indent = indent[:-4]
+        body.append(f"{indent}}}")
+
+    if stage['mean']:
+        body += ["", f"    for (uint32_t c = 0; c < {out_c}u; c++)", "    {"]
+        if not quantized:
+            body.append(f"        output[c] = sum[c] / {float(stage['mean_count']):.1f}f;")
+        elif stage['mean_mapping'] is None:
+            body.append(f"        output[c] = (int8_t)(sum[c] / {stage['mean_count']});")
+        else:
+            multiplier, offset, shift = stage['mean_mapping']
+            body.append(f"        int32_t value = (int32_t)(((int64_t)sum[c] * {multiplier} + {offset}) >> {shift});")
+            body.append(f"        output[c] = (int8_t)aot_clamp(value{signed(stage['mean_zero_point'])}, "
+                        f"{INT8_MIN}, {INT8_MAX});")
+        body.append("    }")
+    if stage['softmax']:
+        if quantized:
+            body += ["", "    aot_softmax(logits, output, {}u, {}, {}, {});".format(out_c, *stage['softmax_params'])]
+        else:
+            body += ["", f"    aot_softmax(logits, output, {out_c}u, {float(stage['beta']):.9e}f);"]
+    body += ["}", ""]
+
+    return data, "\n".join(body) + "\n", const_bytes
+
+
+def stage_macs(stage):
+    """
+    @return: Multiply-accumulates of a stage, over the padding included
+    """
+    pooled_h, pooled_w, out_c = stage['pooled_shape']
+    pool_h, pool_w = stage['pool_size']
+    return pooled_h * pool_h * pooled_w * pool_w * out_c * stage['weights'].shape[1]
+
+
+def write_c(stages, model, model_name, type_name, source, folder):
+    """
+    Writes the compiled model to <name>_aot_model_<type>.c and .h.
+
+    @return: The bytes of constant data and of the arena
+    """
+    prefix = f"{model_name}_aot"
+    quantized = stages[0]['quantized']
+    data_type = 'int8_t' if quantized else 'float'
+    buffers, arena_size = plan_buffers(stages)
+    base = f"{model_name}_aot_model_{type_name}"
+    macro = f"{model_name}_AOT"
+
+    data, functions, const_bytes = "", "", 0
+    for number, stage in enumerate(stages):
+        following = buffers.get(number + 1)
+        layout = None
+        if following:
+            top, _, left, right = stages[number + 1]['padding']
+            layout = (top, left, stages[number + 1]['in_shape'][1] + left + right)
+        stage_data, function, stage_bytes = emit_stage(stage, number, prefix, layout)
+        data += stage_data
+        functions += function
+        const_bytes += stage_bytes
+
+    # Statements of the run function: the borders of each padded buffer, then the stage
+    run = []
+    for number, stage in enumerate(stages):
+        buffer = buffers.get(number)
+        source_name = 'input' if number == 0 else f"buffer{number}"
+        if buffer:
+            height, width, channels = stage['in_shape']
+            top, bottom, left, right = stage['padding']
+            padded_w = width + left + right
+            item = f"sizeof({data_type})"
+            fill = -stage['input_offset'] if quantized else 0
+            row = padded_w * channels
+            if any(stage['padding']):
+                run.append(f"    /* Padding of the {stage['main']['code']} input */")
+            if top:
+                run.append(f"    memset(&buffer{number}[0], {fill}, {top * row}u * {item});")
+            if bottom:
+                run.append(f"    memset(&buffer{number}[{(top + height) * row}u], {fill}, {bottom * row}u * {item});")
+            if left or right:
+                run += [f"    for (uint32_t y = {top}u; y < {top + height}u; y++)", "    {"]
+                if left:
+                    run.append(f"        memset(&buffer{number}[y * {row}u], {fill}, {left * channels}u * {item});")
+                if right:
+                    run.append(f"        memset(&buffer{number}[y * {row}u + {(left + width) * channels}u], {fill}, "
+                               f"{right * channels}u * {item});")
+                run.append("    }")
+            if number == 0:
+                run += [f"    for (uint32_t y = 0; y < {height}u; y++)", "    {",
+                        f"        memcpy(&buffer0[(y + {top}u) * {row}u + {left * channels}u], "
+                        f"&input[y * {width * channels}u], {width * channels}u * {item});", "    }"]
+                source_name = 'buffer0'
+        target = f"buffer{number + 1}" if number + 1 < len(stages) else 'output'
+        run.append(f"    {prefix}_stage{number}({source_name}, {target});")
+        run.append("")
+
+    declarations = [f"    {data_type} *buffer{number} = ({data_type} *)&((uint8_t *)arena)[{buffer['offset']}];"
+                    for number, buffer in sorted(buffers.items())]
+
+    input_tensor = model['tensors'][model['input']]
+    output_tensor = model['tensors'][model['output']]
+    input_size = int(np.prod(input_tensor['shape']))
+    output_size = int(np.prod(output_tensor['shape']))
+    macs = sum(stage_macs(stage) for stage in stages)
+    header = f"{base}.h"
+    with open(source, 'rb') as file:
+        source_bytes = file.read()
+
+    with open(os.path.join(folder, f"{base}.c"), 'w') as file:
+        file.write("/***************************************************************************//**\n"
+                   f"* \\file {base}.c\n*\n* \\brief\n"
+                   f"* Autogenerated with train/aot_compile.py from {os.path.basename(source)}, this file\n"
+                   f"* contains the {model_name} model compiled to straight-line C.\n"
+                   "*******************************************************************************/\n\n"
+                   f"#include \"{header}\"\n\n")
+        file.write("#include <stdint.h>\n#include <string.h>\n")
+        if quantized:
+            file.write("#if defined(__ARM_FEATURE_SIMD32)\n#include <arm_acle.h>\n#endif\n\n")
+        else:
+            file.write("#include <float.h>\n#include <math.h>\n\n"
+                       "/* The products and sums are rounded one by one, as in the TFLM kernels */\n"
+                       "#pragma GCC optimize (\"fp-contract=off\")\n\n")
+        file.write(data)
+        file.write(INT8_HELPERS if quantized else FLOAT_HELPERS)
+        if stages[-1]['softmax']:
+            file.write(INT8_SOFTMAX_HELPERS if quantized else FLOAT_SOFTMAX_HELPERS)
+        file.write(functions)
+        file.write(f"void {prefix}_run(const {data_type} *input, {data_type} *output, void *arena)\n{{\n")
+        file.write("\n".join(declarations) + ("\n\n" if declarations else "    (void)arena;\n\n"))
+        file.write("\n".join(run[:-1]) + "\n}\n")
+
+    with open(os.path.join(folder, header), 'w') as file:
+        guard = f"{base.upper()}_H"
+        file.write("/***************************************************************************//**\n"
+                   f"* \\file {header}\n*\n* \\brief\n"
+                   f"* Autogenerated with train/aot_compile.py from {os.path.basename(source)}, this file\n"
+                   f"* contains the interface of the {model_name} model compiled to straight-line C.\n"
+                   "*******************************************************************************/\n\n"
+                   f"#ifndef {guard}\n#define {guard}\n\n#include <stdint.h>\n\n")
+        file.write(f"#define {macro}_QUANTIZED{'':<{16}}{int(quantized)}\n\n"
+                   "/* Values of the input and output */\n"
+                   f"#define {macro}_INPUT_SIZE{'':<{15}}{input_size}\n"
+                   f"#define {macro}_OUTPUT_SIZE{'':<{14}}{output_size}\n\n")
+        if quantized:
+            file.write("/* Quantization of the input and output, real = scale x (value - zero point) */\n"
+                       f"#define {macro}_INPUT_SCALE{'':<{14}}{float(input_tensor['scale'][0]):.9e}f\n"
+                       f"#define {macro}_INPUT_ZERO_POINT{'':<{9}}({int(input_tensor['zero_point'][0])})\n"
+                       f"#define {macro}_OUTPUT_SCALE{'':<{13}}{float(output_tensor['scale'][0]):.9e}f\n"
+                       f"#define {macro}_OUTPUT_ZERO_POINT{'':<{8}}({int(output_tensor['zero_point'][0])})\n\n")
+        file.write("/* Bytes of the arena, given by the caller with an alignment of 4, and of the\n"
+                   " * constant data */\n"
+                   f"#define {macro}_ARENA_SIZE{'':<{15}}{max(arena_size, ARENA_ALIGNMENT)}\n"
+                   f"#define {macro}_CONST_DATA_SIZE{'':<{10}}{const_bytes}\n\n"
+                   "/* Multiply-accumulates of an inference */\n"
+                   f"#define {macro}_MACS{'':<{21}}{macs}\n\n"
+                   "/* Bytes and CRC-16/CCITT-FALSE of the .tflite, to check that another engine\n"
+                   " * runs the same model */\n"
+                   f"#define {macro}_SOURCE_SIZE{'':<{14}}{len(source_bytes)}u\n"
+                   f"#define {macro}_SOURCE_CRC{'':<{15}}0x{binascii.crc_hqx(source_bytes, 0xFFFF):04X}u\n\n"
+                   f"typedef {data_type} {prefix}_data_t;\n\n"
+                   "#ifdef __cplusplus\nextern \"C\" {\n#endif\n\n"
+                   f"void {prefix}_run(const {data_type} *input, {data_type} *output, void *arena);\n\n"
+                   "#ifdef __cplusplus\n}\n#endif\n\n"
+                   f"#endif /* {guard} */\n")
+
+    return const_bytes, arena_size
+
+
+def quantize_input(windows, tensor):
+    """
+    @return: The windows quantized as the input tensor, rounded half away from zero
+    """
+    values = windows / np.float32(tensor['scale'][0])
+    values = np.sign(values) * np.floor(np.abs(values) + 0.5) + tensor['zero_point'][0]
+    return np.clip(values, INT8_MIN, INT8_MAX).astype(np.int8)
+
+
+def tflm_footprint(folder, model_name, type_name, source):
+    """
+    Reads the TFLM interpreter model generated from a .tflite. The other engines
+    of mtb_ml_models may come from another conversion of the model, with other
+    quantization parameters, so only this one is compared.
+
+    @return: Model and arena bytes of the TFLM model, None if absent or if it
+             does not embed the .tflite
+    """
+    base = os.path.join(folder, f"{model_name}_tflm_model_{type_name}")
+    if not (os.path.isfile(base + '.c') and os.path.isfile(base + '.h')):
+        return None
+    with open(base + '.c') as file:
+        text = file.read()
+    match = re.search(rf"{model_name}_model_bin\[[^\]]*\][^=]*=\s*\{{([^}}]*)\}}", text)
+    with open(source, 'rb') as file:
+        if not match or bytes(int(value, 0) for value in match.group(1).replace(',', ' ').split()) != file.read():
+            print(f"[WARNING] {os.path.basename(base)}.c does not embed {os.path.basename(source)}, not compared")
+            return None
+    with open(base + '.h') as file:
+        text = file.read()
+    sizes = []
+    for field in ('MODEL_BIN_LEN', 'ARENA_SIZE'):
+        match = re.search(rf"#define {model_name}_{field}\s+\((\d+)u?\)", text)
+        sizes.append(int(match.group(1)) if match else None)
+    return sizes
+
+
+def check_c(folder, model_name, type_name, inputs, expected, quantized):
+    """
+    Builds the generated C with the host compiler and runs it on the inputs.
+
+    @return: The number of outputs that differ from the expected ones
+    """
+    base = f"{model_name}_aot_model_{type_name}"
+    with tempfile.TemporaryDirectory() as build:
+        library = os.path.join(build, f"{base}.so")
+        subprocess.run(['cc', '-std=gnu11', '-O2', '-Wall', '-Werror', '-ffp-contract=off', '-shared', '-fPIC',
+                        '-I', folder, '-o', library, os.path.join(folder, f"{base}.c"), '-lm'], check=True)
+        run = getattr(ctypes.CDLL(library), f"{model_name}_aot_run")
+        run.argtypes = [ctypes.c_void_p] * 3
+        arena = (ctypes.c_uint32 * (1 << 16))()
+        output = np.zeros(expected.shape[1], expected.dtype)
+        mismatches = 0
+        for window, reference in zip(inputs, expected):
+            window = np.ascontiguousarray(window.reshape(-1), np.int8 if quantized else np.float32)
+            run(window.ctypes.data, output.ctypes.data, arena)
+            mismatches += output.tobytes() != reference.tobytes()
+    return mismatches
+
+
+def compile_model(path, model_name, output_folder, reference_folder, windows, labels, check):
+    """
+    Compiles a model and prints its report.
+    """
+    type_name = re.sub(rf"^{model_name}_", '', os.path.splitext(os.path.basename(path))[0])
+    model = read_model(path)
+    stages = fuse_operators(model)
+    for stage in stages:
+        stage_parameters(stage, model['tensors'])
+    if stages[0]['quantized'] and any(not stage['quantized'] for stage in stages):
+        raise Exception(f"{path}: models mixing float and int8 operators are not supported")
+
+    const_bytes, arena_size = write_c(stages, model, model_name, type_name, path, output_folder)
+
+    print(f"\n{os.path.basename(path)} -> {model_name}_aot_model_{type_name}.c")
+    print(f"{'Stage':<8}{'Operators':<44}{'Output':>12}{'MACs':>10}")
+    for number, stage in enumerate(stages):
+        codes = [stage['main']['code']] + (['MAX_POOL_2D'] if stage['pool'] else []) + \
+            [p['code'] for p in stage['affine_params']] + (['MEAN'] if stage['mean'] else []) + \
+            (['SOFTMAX'] if stage['softmax'] else [])
+        shape = 'x'.join(str(s) for s in stage['out_shape'])
+        print(f"{number:<8}{' + '.join(codes):<44}{shape:>12}{stage_macs(stage):>10}")
+
+    footprint = tflm_footprint(reference_folder, model_name, type_name, path)
+    print(f"\n{'Bytes':<26}{'aot':>10}{'tflm':>12}")
+    print(f"{'Weights and graph':<26}{const_bytes:>10}{footprint[0] if footprint else '-':>12}")
+    print(f"{'Arena':<26}{arena_size:>10}{footprint[1] if footprint else '-':>12}")
+    print("The code of the interpreter and its kernels comes on top of the tflm figures; compare the "
+          "builds with make aot-check in qemu/.")
+
+    input_tensor = model['tensors'][model['input']]
+    inputs = quantize_input(windows, input_tensor) if stages[0]['quantized'] else windows.astype(np.float32)
+    outputs = run_reference(stages, inputs)
+    accuracy = np.mean(np.argmax(outputs, axis=1) == labels)
+    print(f"[INFO] Accuracy of the reference on {len(windows)} windows: {accuracy:.3f}")
+
+    if check:
+        mismatches = check_c(output_folder, model_name, type_name, inputs, outputs, stages[0]['quantized'])
+        print(f"[INFO] Generated C built with the host compiler: {len(windows) - mismatches}/{len(windows)} "
+              "outputs bit-exact with the reference")
+        if mismatches:
+            raise Exception(f"{model_name}_aot_model_{type_name}.c does not match the reference")
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--models", nargs='+', default=["../mtb_ml_gen/model_gen_dir/MAGIC_WAND_float.tflite",
+                                                        "../mtb_ml_gen/model_gen_dir/MAGIC_WAND_int8x8.tflite"],
+                        help="TensorFlow Lite models to compile")
+    parser.add_argument("--name", default="MAGIC_WAND", help="NN_MODEL_NAME of the Makefile")
+    parser.add_argument("--output", default="../mtb_ml_gen/mtb_ml_aot", help="Folder of the generated C files")
+    parser.add_argument("--reference", default="../mtb_ml_gen/mtb_ml_models",
+                        help="Folder of the TFLM interpreter models to compare with")
+    parser.add_argument("--check", action='store_true',
+                        help="Build the generated C with the host compiler and compare it with the reference")
+    args = parser.parse_args()
+
+    os.makedirs(args.output, exist_ok=True)
+    windows, labels, _ = load_windows()
+    for model_path in args.models:
+        compile_model(model_path, args.name, args.output, args.reference, windows, labels, args.check)
@@ -0,0 +1,138 @@
+# (c) 2022, Cypress Semiconductor Corporation (an Infineon company) or an affiliate of Cypress Semiconductor 
+# Corporation.  All rights reserved.
+#
+# This software, including source code, documentation and related materials
+# ("Software") is owned by Cypress Semiconductor Corporation or one of its
+# affiliates ("Cypress") and is protected by and subject to worldwide patent 
+# protection (United States and foreign), United States copyright laws and 
+# international treaty provisions.  Therefore, you may use this Software only
+# as provided in the license agreement accompanying the software package from
+# which you obtained this Software ("EULA").
+#
+# If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+# non-transferable license to copy, modify, and compile the Software source
+# code solely for use in connection with Cypress's integrated circuit products.
+# Any reproduction, modification, translation, compilation, or representation
+# of this Software except as specified above is prohibited without the express 
+# written permission of Cypress.
+#
+# Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+# WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+# reserves the right to make changes to the Software without notice. Cypress
+# does not assume any liability arising out of the application or use of the
+# Software or any product or circuit described in the Software. Cypress does
+# not authorize its products for use in any products where a malfunction or
+# failure of the Cypress product may reasonably be expected to result in
+# significant property damage, injury or death ("High Risk Product"). By
+# including Cypress's product in a High Risk Product, the manufacturer of such 
+# system or application assumes all risk of such use and in doing so agrees to
+# indemnify Cypress against all liability.
+
+"""
+Replay the recordings in gesture_data/ through the int8x8 and float models and
+compare the precision cascade of the firmware (GESTURE_CASCADE_MODE) against
+always running the float model.
+
+Usage: python cascade_eval.py [--band 0.15] [--device_cycles FLOAT_CYCLES INT8_CYCLES]
+"""
+
+import argparse
+import time
+import numpy as np
+import tensorflow as tf
+
+from replay_data import load_windows
+
+# Must match MIN_CONFIDENCE and PRECISION_CASCADE_BAND in the firmware
+MIN_CONFIDENCE = 0.60
+CASCADE_BAND = 0.15
+
+
+class TfliteModel(object):
+    """Runs one window at a time through a TFLite model, like the firmware."""
+
+    def __init__(self, path):
+        self.interpreter = tf.lite.Interpreter(model_path=path)
+        self.interpreter.allocate_tensors()
+        self.input = self.interpreter.get_input_details()[0]
+        self.output = self.interpreter.get_output_details()[0]
+        self.seconds = 0.0
+
+    def predict(self, window):
+        """
+        @param window: Pre-processed window, shape (128, 6)
+        @return: Probabilities of each class, in floating-point
+        """
+        data = window.reshape(self.input['shape'])
+        scale, zero_point = self.input['quantization']
+        if self.input['dtype'] != np.float32:
+            info = np.iinfo(self.input['dtype'])
+            data = np.clip(np.round(data / scale + zero_point), info.min, info.max)
+        start = time.perf_counter()
+        self.interpreter.set_tensor(self.input['index'], data.astype(self.input['dtype']))
+        self.interpreter.invoke()
+        output = self.interpreter.get_tensor(self.output['index'])[0]
+        self.seconds += time.perf_counter() - start
+        scale, zero_point = self.output['quantization']
+        if self.output['dtype'] != np.float32:
+            output = (output.astype(np.float32) - zero_point) * scale
+        return output
+
+
+def decide(probabilities, negative):
+    """Same decision as control(): the top class if confident, else negative."""
+    index = int(np.argmax(probabilities))
+    return index if probabilities[index] > MIN_CONFIDENCE else negative
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--float_model", default="../mtb_ml_gen/model_gen_dir/MAGIC_WAND_float.tflite")
+    parser.add_argument("--int8_model", default="../mtb_ml_gen/model_gen_dir/MAGIC_WAND_int8x8.tflite")
+    parser.add_argument("--band", type=float, default=CASCADE_BAND,
+                        help="Half-width of the ambiguity band around MIN_CONFIDENCE")
+    parser.add_argument("--device_cycles", type=float, nargs=2, metavar=("FLOAT", "INT8"),
+                        help="Average cycles per window from precision_get_stats(), to project the device latency")
+    args = parser.parse_args()
+
+    windows, labels, classes = load_windows()
+    negative = len(classes) - 1
+    float_model = TfliteModel(args.float_model)
+    int8_model = TfliteModel(args.int8_model)
+
+    float_pred = np.zeros(len(windows), dtype=int)
+    int8_pred = np.zeros(len(windows), dtype=int)
+    cascade_pred = np.zeros(len(windows), dtype=int)
+    escalated = np.zeros(len(windows), dtype=bool)
+    for i, window in enumerate(windows):
+        float_prob = float_model.predict(window)
+        int8_prob = int8_model.predict(window)
+        float_pred[i] = decide(float_prob, negative)
+        int8_pred[i] = decide(int8_prob, negative)
+
+        # The float output is reused, as the cascade would run the same model
+        escalated[i] = abs(np.max(int8_prob) - MIN_CONFIDENCE) <= args.band
+        cascade_pred[i] = float_pred[i] if escalated[i] else int8_pred[i]
+
+    count = len(windows)
+    float_ms = 1000 * float_model.seconds / count
+    int8_ms = 1000 * int8_model.seconds / count
+    rate = np.mean(escalated)
+
+    print(f"[INFO] Windows replayed: {count}, ambiguity band: +/-{args.band}")
+    print(f"[INFO] Float model ran on {np.sum(escalated)} windows ({rate:.1%})")
+    print("")
+    print("Mode      | Accuracy | Agreement with float | Host latency (ms)")
+    print("----------|----------|----------------------|------------------")
+    for name, pred, ms in (("float", float_pred, float_ms),
+                           ("int8x8", int8_pred, int8_ms),
+                           ("cascade", cascade_pred, int8_ms + rate * float_ms)):
+        print(f"{name:<9} | {np.mean(pred == labels):8.2%} | {np.mean(pred == float_pred):20.2%} | {ms:17.3f}")
+
+    if args.device_cycles:
+        float_cycles, int8_cycles = args.device_cycles
+        cascade_cycles = int8_cycles + rate * float_cycles
+        print("")
+        print(f"[INFO] Device cycles per window: float {float_cycles:.0f}, cascade {cascade_cycles:.0f} "
+              f"({cascade_cycles / float_cycles:.1%} of float)")
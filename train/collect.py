@@ -37,6 +37,8 @@ import serial
 import threading
 import queue
 
+from stream_protocol import FrameDecoder, decode_samples, preprocess, format_window
+
 # Hardcode the baudrate to match with the firmware
 BAUDRATE = 115200
 
@@ -54,6 +56,7 @@ if (num_args != 4):
 ser = serial.Serial()
 ser.baudrate = BAUDRATE
 ser.port = sys.argv[1]
+ser.timeout = 0.1
 ser.open()
 
 if ser.is_open:
@@ -104,6 +107,7 @@ print("Press 'c' to start capturing and 's' to stop and exit")
 char = 0
 sflag = 0
 char_queue = queue.Queue()
+decoder = FrameDecoder()
 
 # Create a console task to place characters to a queue
 def console(char_queue):
@@ -127,15 +131,17 @@ while char != 's' and sflag < 100:
         sflag = 1
 
     if sflag > 0:
-        line = ser.readline().strip()
-        strline = line.decode('ascii') + "\n"
-        if strline.find("-,-,-,-,-,-") != -1:
-            click.echo('.')
-            sflag = sflag + 1
-
-        if sflag > 1:
-            fileHandler.write(strline)
-            
-    
+        # Decode the binary frames and store each window as text
+        for frame_type, flags, sequence, payload in decoder.feed(ser.read(max(ser.in_waiting, 1))):
+            samples = decode_samples(frame_type, payload)
+            if samples is not None and sflag < 100:
+                click.echo('.')
+                sflag = sflag + 1
+                fileHandler.write(format_window(preprocess(samples, flags)))
+
 ser.close()
-fileHandler.close()
\ No newline at end of file
+fileHandler.close()
+
+print("")
+print("Windows: " + str(decoder.frames) + ", lost: " + str(decoder.lost_frames) +
+      ", CRC errors: " + str(decoder.crc_errors))
\ No newline at end of file
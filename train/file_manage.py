@@ -30,9 +30,10 @@
 # indemnify Cypress against all liability.
 
 import os
-import shutil
 import tensorflow as tf
 
+from fold_model import fold_model_file
+
 all_folders = []
 path = 'logs\\'
 folders = os.listdir(path)
@@ -53,12 +54,12 @@ save_tflite = save + '\\pretrained_models\\' + 'User_generated_model.tflite'
 save_keras = save + '\\pretrained_models\\' + 'User_generated_model.h5'
 save_pruned = save + '\\pretrained_models\\' + 'User_generated_model_pruned.h5'
 
-# Copy the model from logs to pretrained_models folder
-shutil.copyfile(latest, save_keras)
-shutil.copyfile(latest_pruned, save_pruned)
+# Fold BatchNormalization and remove Dropout while copying the model from logs to pretrained_models folder
+fold_model_file(latest, save_keras)
+fold_model_file(latest_pruned, save_pruned)
 
 # Generate a tflite model based on keras model
 model = tf.keras.models.load_model(save_keras)
 converter = tf.lite.TFLiteConverter.from_keras_model(model)
 tflite_model = converter.convert()
-open(save_tflite, "wb").write(tflite_model)
\ No newline at end of file
+open(save_tflite, "wb").write(tflite_model)
\ No newline at end of file
@@ -0,0 +1,175 @@
+# (c) 2022, Cypress Semiconductor Corporation (an Infineon company) or an affiliate of Cypress Semiconductor 
+# Corporation.  All rights reserved.
+#
+# This software, including source code, documentation and related materials
+# ("Software") is owned by Cypress Semiconductor Corporation or one of its
+# affiliates ("Cypress") and is protected by and subject to worldwide patent 
+# protection (United States and foreign), United States copyright laws and 
+# international treaty provisions.  Therefore, you may use this Software only
+# as provided in the license agreement accompanying the software package from
+# which you obtained this Software ("EULA").
+#
+# If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+# non-transferable license to copy, modify, and compile the Software source
+# code solely for use in connection with Cypress's integrated circuit products.
+# Any reproduction, modification, translation, compilation, or representation
+# of this Software except as specified above is prohibited without the express 
+# written permission of Cypress.
+#
+# Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+# WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+# reserves the right to make changes to the Software without notice. Cypress
+# does not assume any liability arising out of the application or use of the
+# Software or any product or circuit described in the Software. Cypress does
+# not authorize its products for use in any products where a malfunction or
+# failure of the Cypress product may reasonably be expected to result in
+# significant property damage, injury or death ("High Risk Product"). By
+# including Cypress's product in a High Risk Product, the manufacturer of such 
+# system or application assumes all risk of such use and in doing so agrees to
+# indemnify Cypress against all liability.
+
+"""
+Prepare a trained Keras model for deployment by removing the layers that only
+matter for training:
+    - BatchNormalization directly after a Conv2D or Dense layer without an
+      activation is folded into the kernel and bias of that layer, and a ReLU
+      that follows is merged into it.
+    - Dropout is removed, it does nothing at inference.
+The folded model is compared against the original one on the recordings in
+gesture_data/ before it is used.
+
+Usage: python fold_model.py <input.h5> <output.h5>
+"""
+
+import sys
+import numpy as np
+import tensorflow as tf
+
+from replay_data import load_windows
+
+# Maximum difference allowed between the outputs of both models
+FOLD_TOLERANCE = 1e-4
+
+# Number of recorded windows used to compare both models
+VERIFY_WINDOWS = 512
+
+
+def is_relu(layer):
+    """
+    @param layer: A Keras layer
+    @return: True if the layer is a plain ReLU activation
+    """
+    if isinstance(layer, tf.keras.layers.Activation):
+        return layer.get_config()['activation'] == 'relu'
+    if isinstance(layer, tf.keras.layers.ReLU):
+        config = layer.get_config()
+        return config.get('max_value') is None and not config.get('negative_slope') and not config.get('threshold')
+    return False
+
+
+def batchnorm_scale_shift(layer):
+    """
+    @param layer: A BatchNormalization layer
+    @return: Per-channel scale and shift equivalent to the layer at inference
+    """
+    config = layer.get_config()
+    weights = list(layer.get_weights())
+    gamma = weights.pop(0) if config['scale'] else 1.0
+    beta = weights.pop(0) if config['center'] else 0.0
+    mean, variance = weights
+    scale = gamma / np.sqrt(variance + config['epsilon'])
+    return scale, beta - mean * scale
+
+
+def fold_batchnorm(model):
+    """
+    @param model: A trained Sequential Keras model
+    @return: An equivalent Sequential model without foldable BatchNormalization and Dropout layers
+    """
+    layers = [layer for layer in model.layers if not isinstance(layer, tf.keras.layers.Dropout)]
+    folded = tf.keras.Sequential(name=model.name + "_folded")
+    folded.add(tf.keras.Input(shape=model.input_shape[1:]))
+    weights = []
+
+    i = 0
+    while i < len(layers):
+        layer = layers[i]
+        config = layer.get_config()
+        following = layers[i + 1] if i + 1 < len(layers) else None
+
+        if isinstance(layer, (tf.keras.layers.Conv2D, tf.keras.layers.Dense)) \
+                and config['activation'] == 'linear' \
+                and isinstance(following, tf.keras.layers.BatchNormalization):
+            # The output channel is the last axis of the kernel for both layer types
+            scale, shift = batchnorm_scale_shift(following)
+            kernel = layer.get_weights()[0]
+            bias = layer.get_weights()[1] if config['use_bias'] else np.zeros(kernel.shape[-1])
+            config['use_bias'] = True
+            i += 2
+
+            # Merge the activation into the layer, as the converter does with fused activations
+            if i < len(layers) and is_relu(layers[i]):
+                config['activation'] = 'relu'
+                i += 1
+
+            print(f"[INFO] Folded {following.name} into {layer.name}")
+            folded.add(layer.__class__.from_config(config))
+            weights.append([kernel * scale, bias * scale + shift])
+            continue
+
+        if isinstance(layer, tf.keras.layers.BatchNormalization):
+            print(f"[WARNING] {layer.name} does not follow a layer without activation, it is kept")
+
+        folded.add(layer.__class__.from_config(config))
+        weights.append(layer.get_weights())
+        i += 1
+
+    for layer, layer_weights in zip(folded.layers, weights):
+        layer.set_weights(layer_weights)
+
+    return folded
+
+
+def verify_fold(model, folded):
+    """
+    Runs both models on the recorded windows and checks that the outputs match.
+
+    @param model: The original model
+    @param folded: The folded model
+    @return: The maximum difference between the outputs
+    """
+    windows, _, _ = load_windows()
+    windows = windows[np.linspace(0, len(windows) - 1, min(VERIFY_WINDOWS, len(windows))).astype(int)]
+    windows = windows.reshape((-1,) + model.input_shape[1:])
+    error = np.max(np.abs(model.predict(windows) - folded.predict(windows)))
+
+    print(f"[INFO] Layers: {len(model.layers)} -> {len(folded.layers)}, "
+          f"parameters: {model.count_params()} -> {folded.count_params()}")
+    print(f"[INFO] Maximum output difference on {len(windows)} windows: {error:.2e}")
+    if error > FOLD_TOLERANCE:
+        raise Exception("Folded model does not match the original model")
+
+    return error
+
+
+def fold_model_file(input_path, output_path):
+    """
+    @param input_path: Path of the trained Keras model
+    @param output_path: Path to save the verified folded model
+    @return: The folded model
+    """
+    model = tf.keras.models.load_model(input_path)
+    folded = fold_batchnorm(model)
+    verify_fold(model, folded)
+    folded.save(output_path)
+    return folded
+
+
+if __name__ == "__main__":
+    if len(sys.argv) != 3:
+        print("Please use the following syntax")
+        print(">>> python fold_model.py <input.h5> <output.h5>")
+        quit()
+
+    fold_model_file(sys.argv[1], sys.argv[2])
@@ -40,22 +40,15 @@ import queue
 
 path = 'gesture_data/'
 classes = os.listdir(path)
-dash = []
 space = []
 
 # Gets all the classes and move the negative class to the back of the list
-for x in range(4):
+for x in range(len(classes)):
     if classes[x] == 'negative':
         del classes[x]
         classes.append("negative")
         break
 
-for x in range(4):
-    total = ''
-    for y in range(16 - len(classes[x])):
-        total += ' '
-    dash.append(total)
-
 with open('gesture_names.h', 'w') as f:
     f.write("/******************************************************************************\n"
             "* (c) 2022, Cypress Semiconductor Corporation (an Infineon company)\n" 
@@ -98,12 +91,9 @@ with open('gesture_names.h', 'w') as f:
             "* Related Document: README.md\n"
             "*\n"
             "*******************************************************************************/\n\n")
-    f.write("const char gesture_one[] = \"" + classes[0] + "\";\n")
-    f.write("const char gesture_two[] = \"" + classes[1] + "\";\n")
-    f.write("const char gesture_three[] = \"" + classes[2] + "\";\n")
-    f.write("const char gesture_four[] = \"" + classes[3] + "\";\n\n")
-
-    f.write("const char dash_ges_one[] = \"" + dash[0] + "\";\n")
-    f.write("const char dash_ges_two[] = \"" + dash[1] + "\";\n")
-    f.write("const char dash_ges_three[] = \"" + dash[2] + "\";\n")
-    f.write("const char dash_ges_four[] = \"" + dash[3] + "\";\n")
+    f.write("/* Names of the classes of the model, in the order of its outputs. The last\n"
+            " * one is no gesture. */\n"
+            "const char* const gesture_names[] = {\n")
+    for name in classes:
+        f.write("    \"" + name + "\",\n")
+    f.write("};\n")
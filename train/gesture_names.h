@@ -41,12 +41,11 @@
 *
 *******************************************************************************/
 
-const char gesture_one[] = "Circle";
-const char gesture_two[] = "Side-to-Side";
-const char gesture_three[] = "Square";
-const char gesture_four[] = "negative";
-
-const char dash_ges_one[] = "          ";
-const char dash_ges_two[] = "    ";
-const char dash_ges_three[] = "          ";
-const char dash_ges_four[] = "        ";
+/* Names of the classes of the model, in the order of its outputs. The last
+ * one is no gesture. */
+const char* const gesture_names[] = {
+    "Circle",
+    "Side-to-Side",
+    "Square",
+    "negative",
+};
@@ -0,0 +1,169 @@
+# (c) 2022, Cypress Semiconductor Corporation (an Infineon company) or an affiliate of Cypress Semiconductor 
+# Corporation.  All rights reserved.
+#
+# This software, including source code, documentation and related materials
+# ("Software") is owned by Cypress Semiconductor Corporation or one of its
+# affiliates ("Cypress") and is protected by and subject to worldwide patent 
+# protection (United States and foreign), United States copyright laws and 
+# international treaty provisions.  Therefore, you may use this Software only
+# as provided in the license agreement accompanying the software package from
+# which you obtained this Software ("EULA").
+#
+# If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+# non-transferable license to copy, modify, and compile the Software source
+# code solely for use in connection with Cypress's integrated circuit products.
+# Any reproduction, modification, translation, compilation, or representation
+# of this Software except as specified above is prohibited without the express 
+# written permission of Cypress.
+#
+# Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+# WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+# reserves the right to make changes to the Software without notice. Cypress
+# does not assume any liability arising out of the application or use of the
+# Software or any product or circuit described in the Software. Cypress does
+# not authorize its products for use in any products where a malfunction or
+# failure of the Cypress product may reasonably be expected to result in
+# significant property damage, injury or death ("High Risk Product"). By
+# including Cypress's product in a High Risk Product, the manufacturer of such 
+# system or application assumes all risk of such use and in doing so agrees to
+# indemnify Cypress against all liability.
+
+"""
+Lossless codec for windows of int16 IMU samples, the same format as
+source/imu_codec.c. Run it to report the compression of the recordings in
+gesture_data/:
+
+    python imu_codec.py [--data gesture_data/]
+"""
+
+import argparse
+import time
+import numpy as np
+
+from replay_data import load_windows, NUM_AXIS
+
+# Must match source/imu_codec.h
+ORDER_DELTA = 1
+ORDER_LINEAR = 2
+ORDER = ORDER_LINEAR
+MAX_VARINT = 3
+
+VARINT_MORE = 0x80
+VARINT_BITS = 7
+
+# Same scale as the min max normalization of the pre-processing
+SENSOR_RANGE = 32768
+
+
+def residuals(samples, order):
+    """
+    @param samples: int16 samples of one window, one row per sample
+    @param order: ORDER_DELTA or ORDER_LINEAR
+    @return: The difference of each value to its prediction, as imu_codec_predict()
+    """
+    x = samples.astype(np.int32)
+    prediction = np.zeros_like(x)
+    prediction[1:] = x[:-1]
+    if order == ORDER_LINEAR:
+        prediction[2:] = 2 * x[1:-1] - x[:-2]
+    return x - prediction
+
+
+def encode(samples, order=ORDER):
+    """
+    @param samples: int16 samples of one window, one row per sample
+    @param order: Predictor, ORDER_DELTA or ORDER_LINEAR
+    @return: The compressed window, as imu_codec_encode()
+    """
+    residual = residuals(samples, order).ravel()
+    value = ((residual << 1) ^ (residual >> 31)).astype(np.uint32)
+
+    # Each value takes 1 to MAX_VARINT bytes of 7 bits, the top bit set when more follow
+    length = np.ones(len(value), np.int32)
+    for i in range(1, MAX_VARINT):
+        length += value >= (1 << (VARINT_BITS * i))
+    shifts = VARINT_BITS * np.arange(MAX_VARINT)
+    groups = (value[:, None] >> shifts) & (VARINT_MORE - 1)
+    groups |= (np.arange(MAX_VARINT) < length[:, None] - 1) * VARINT_MORE
+    used = np.arange(MAX_VARINT) < length[:, None]
+
+    return bytes([order]) + groups[used].astype(np.uint8).tobytes()
+
+
+def decode(payload):
+    """
+    @param payload: Window compressed with encode() or imu_codec_encode()
+    @return: The int16 samples, one row per sample
+    """
+    if len(payload) == 0 or payload[0] not in (ORDER_DELTA, ORDER_LINEAR):
+        raise ValueError("Unknown predictor")
+    order = payload[0]
+    data = np.frombuffer(payload, np.uint8, offset=1).astype(np.uint32)
+
+    # Split the varints at the bytes without the continuation bit
+    last = (data & VARINT_MORE) == 0
+    if len(data) and not last[-1]:
+        raise ValueError("Truncated varint")
+    index = np.concatenate(([0], np.cumsum(last)[:-1])).astype(np.int64)
+    first = np.flatnonzero(np.concatenate(([True], last[:-1])))
+    position = np.arange(len(data)) - first[index]
+    if len(data) and position.max() >= MAX_VARINT:
+        raise ValueError("Varint too long")
+    value = np.zeros(len(first), np.uint32)
+    np.add.at(value, index, (data & (VARINT_MORE - 1)) << (VARINT_BITS * position).astype(np.uint32))
+    if len(value) % NUM_AXIS:
+        raise ValueError("Partial sample")
+
+    residual = ((value >> 1).astype(np.int64) ^ -(value & 1).astype(np.int64)).reshape((-1, NUM_AXIS))
+
+    # Undo the prediction: a running sum per order, the first samples have less history
+    if order == ORDER_LINEAR:
+        residual[1:] = np.cumsum(residual[1:], axis=0)
+    samples = np.cumsum(residual, axis=0)
+    if np.any(samples < -32768) or np.any(samples > 32767):
+        raise ValueError("Sample out of range")
+    return samples.astype(np.int16)
+
+
+def quantize(windows):
+    """
+    The recordings store pre-processed windows. Scale them back to int16 to
+    get samples with the same range as the sensor data.
+
+    @param windows: Windows from load_windows()
+    @return: int16 windows
+    """
+    return np.clip(np.round(windows * SENSOR_RANGE), -32768, 32767).astype(np.int16)
+
+
+def report(path):
+    """
+    Compresses every window of the recordings with each predictor, checks that
+    it decodes back to the same samples and prints the compression ratio
+    """
+    windows, _, _ = load_windows(path)
+    windows = quantize(windows)
+    raw_size = windows[0].nbytes
+
+    print(f"{len(windows)} windows of {raw_size} bytes")
+    print(f"{'predictor':<10}{'mean':>8}{'max':>8}{'ratio':>8}{'us/window':>11}")
+    for name, order in (("delta", ORDER_DELTA), ("linear", ORDER_LINEAR)):
+        start = time.perf_counter()
+        payloads = [encode(window, order) for window in windows]
+        elapsed = time.perf_counter() - start
+        for window, payload in zip(windows, payloads):
+            if not np.array_equal(decode(payload), window):
+                raise RuntimeError(f"{name}: window does not decode losslessly")
+        sizes = np.array([len(payload) for payload in payloads])
+        print(f"{name:<10}{sizes.mean():8.1f}{sizes.max():8d}{raw_size / sizes.mean():8.2f}"
+              f"{1e6 * elapsed / len(windows):11.1f}")
+    print("The recordings are filtered and rescaled, raw sensor data may compress differently.")
+    print("Device cycles per window are in imu_codec_get_stats().")
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description="Report the IMU codec compression on the recordings")
+    parser.add_argument("--data", default="gesture_data/", help="Folder with the recordings")
+    args = parser.parse_args()
+    report(args.data)
@@ -0,0 +1,102 @@
+# (c) 2022, Cypress Semiconductor Corporation (an Infineon company) or an affiliate of Cypress Semiconductor 
+# Corporation.  All rights reserved.
+#
+# This software, including source code, documentation and related materials
+# ("Software") is owned by Cypress Semiconductor Corporation or one of its
+# affiliates ("Cypress") and is protected by and subject to worldwide patent 
+# protection (United States and foreign), United States copyright laws and 
+# international treaty provisions.  Therefore, you may use this Software only
+# as provided in the license agreement accompanying the software package from
+# which you obtained this Software ("EULA").
+#
+# If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+# non-transferable license to copy, modify, and compile the Software source
+# code solely for use in connection with Cypress's integrated circuit products.
+# Any reproduction, modification, translation, compilation, or representation
+# of this Software except as specified above is prohibited without the express 
+# written permission of Cypress.
+#
+# Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+# WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+# reserves the right to make changes to the Software without notice. Cypress
+# does not assume any liability arising out of the application or use of the
+# Software or any product or circuit described in the Software. Cypress does
+# not authorize its products for use in any products where a malfunction or
+# failure of the Cypress product may reasonably be expected to result in
+# significant property damage, injury or death ("High Risk Product"). By
+# including Cypress's product in a High Risk Product, the manufacturer of such 
+# system or application assumes all risk of such use and in doing so agrees to
+# indemnify Cypress against all liability.
+
+"""
+Load the recordings in gesture_data/ as model windows, to replay them through
+the models outside of the device
+"""
+
+import os
+import numpy as np
+
+SEQ_LENGTH = 128
+NUM_AXIS = 6
+SEPARATOR = "-,-,-,-,-,-"
+
+
+def get_classes(path='gesture_data/'):
+    """
+    @param path: Folder with one sub-folder of recordings per gesture
+    @return: The class names in model output order, with negative last
+    """
+    classes = sorted(os.listdir(path))
+    if 'negative' in classes:
+        classes.remove('negative')
+        classes.append('negative')
+    return classes
+
+
+def read_recording(file_path):
+    """
+    Reads a recording and splits it in windows of SEQ_LENGTH samples. Each block
+    between two separators is a continuous capture; a partial window at the end
+    of a block is dropped.
+
+    @param file_path: Path of a TXT recording written by collect.py
+    @return: Array of windows, shape (N, SEQ_LENGTH, NUM_AXIS)
+    """
+    windows = []
+    block = []
+    with open(file_path, "r") as f:
+        for line in f:
+            line = line.strip()
+            if line == SEPARATOR:
+                windows.extend(split_block(block))
+                block = []
+            elif line:
+                block.append([float(i) for i in line.split(',')[0:NUM_AXIS]])
+    windows.extend(split_block(block))
+    return np.array(windows, dtype=np.float32).reshape(-1, SEQ_LENGTH, NUM_AXIS)
+
+
+def split_block(block):
+    """
+    @param block: List of samples captured continuously
+    @return: List of full windows in the block
+    """
+    return [block[i:i + SEQ_LENGTH] for i in range(0, len(block) - SEQ_LENGTH + 1, SEQ_LENGTH)]
+
+
+def load_windows(path='gesture_data/'):
+    """
+    @param path: Folder with one sub-folder of recordings per gesture
+    @return: windows (N, SEQ_LENGTH, NUM_AXIS), labels (N,), class names
+    """
+    classes = get_classes(path)
+    windows = []
+    labels = []
+    for label, name in enumerate(classes):
+        folder = os.path.join(path, name)
+        for file_name in sorted(os.listdir(folder)):
+            data = read_recording(os.path.join(folder, file_name))
+            windows.append(data)
+            labels.append(np.full(len(data), label))
+    return np.concatenate(windows), np.concatenate(labels), classes
@@ -0,0 +1,457 @@
+# (c) 2022, Cypress Semiconductor Corporation (an Infineon company) or an affiliate of Cypress Semiconductor 
+# Corporation.  All rights reserved.
+#
+# This software, including source code, documentation and related materials
+# ("Software") is owned by Cypress Semiconductor Corporation or one of its
+# affiliates ("Cypress") and is protected by and subject to worldwide patent 
+# protection (United States and foreign), United States copyright laws and 
+# international treaty provisions.  Therefore, you may use this Software only
+# as provided in the license agreement accompanying the software package from
+# which you obtained this Software ("EULA").
+#
+# If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+# non-transferable license to copy, modify, and compile the Software source
+# code solely for use in connection with Cypress's integrated circuit products.
+# Any reproduction, modification, translation, compilation, or representation
+# of this Software except as specified above is prohibited without the express 
+# written permission of Cypress.
+#
+# Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+# WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+# reserves the right to make changes to the Software without notice. Cypress
+# does not assume any liability arising out of the application or use of the
+# Software or any product or circuit described in the Software. Cypress does
+# not authorize its products for use in any products where a malfunction or
+# failure of the Cypress product may reasonably be expected to result in
+# significant property damage, injury or death ("High Risk Product"). By
+# including Cypress's product in a High Risk Product, the manufacturer of such 
+# system or application assumes all risk of such use and in doing so agrees to
+# indemnify Cypress against all liability.
+
+"""
+Export a pruned Keras model to the sparse inference engine in source/sparse_nn.c.
+Only the non-zero weights are stored, with an 8-bit input index each, and only
+those are multiplied at inference. BatchNormalization and Dropout are folded
+away first with fold_model.py.
+
+The script reports the flash and multiply-accumulates (MACs) of the dense and
+sparse weights, checks the exported weights against the Keras model on the
+recordings in gesture_data/, and estimates the same figures for other sparsity
+levels by pruning the weights by magnitude. The time of each level is measured
+by building sparse_nn.c with the host compiler, against the same engine storing
+every weight.
+
+Usage: python sparse_export.py --model ../pretrained_models/Magic_wand_model_pruned.h5
+"""
+
+import argparse
+import ctypes
+import os
+import subprocess
+import tempfile
+import time
+import numpy as np
+import tensorflow as tf
+
+from fold_model import batchnorm_scale_shift, fold_batchnorm, is_relu, FOLD_TOLERANCE
+from replay_data import load_windows
+
+# Must match source/sparse_nn.h
+SPARSE_NN_GROUP_SIZE = 256
+SPARSE_NN_MAX_GROUPS = 25
+
+# Bytes of a stored weight, bias, index and group start
+FLOAT_BYTES = 4
+INDEX_BYTES = 1
+START_BYTES = 2
+
+SPARSE_NN_FOLDER = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "source")
+TIME_REPEATS = 10
+
+
+def extract_layers(model):
+    """
+    Converts a Keras model to the list of layers run by sparse_nn.c.
+
+    @param model: A Sequential Keras model, with BatchNormalization folded where possible
+    @return: A list of dictionaries describing each layer
+    """
+    layers = []
+    shape = tuple(model.input_shape[1:])
+    if len(shape) == 1:
+        shape = (1, 1) + shape
+
+    for layer in model.layers:
+        config = layer.get_config()
+
+        if isinstance(layer, (tf.keras.layers.Dropout, tf.keras.layers.Flatten, tf.keras.layers.InputLayer)):
+            # Activations are already stored flat in the order Flatten uses
+            continue
+
+        if is_relu(layer):
+            if not layers or layers[-1]['type'] not in ('conv2d', 'dense', 'affine') or layers[-1]['relu']:
+                raise Exception(f"{layer.name}: ReLU can only follow a convolution, dense or BatchNormalization layer")
+            layers[-1]['relu'] = True
+            continue
+
+        if isinstance(layer, tf.keras.layers.Conv2D):
+            if tuple(config['strides']) != (1, 1) or config['padding'] != 'same' \
+                    or tuple(config['dilation_rate']) != (1, 1):
+                raise Exception(f"{layer.name}: only stride 1 and 'same' padding are supported")
+            weights = layer.get_weights()
+            kernel = weights[0]
+            entry = {'type': 'conv2d', 'kernel': kernel, 'kernel_size': kernel.shape[:2],
+                     'bias': weights[1] if config['use_bias'] else np.zeros(kernel.shape[-1])}
+            out_shape = shape[:2] + (kernel.shape[-1],)
+        elif isinstance(layer, tf.keras.layers.Dense):
+            weights = layer.get_weights()
+            kernel = weights[0]
+            entry = {'type': 'dense', 'kernel': kernel, 'kernel_size': (1, 1),
+                     'bias': weights[1] if config['use_bias'] else np.zeros(kernel.shape[-1])}
+            out_shape = (1, 1, kernel.shape[-1])
+        elif isinstance(layer, tf.keras.layers.BatchNormalization):
+            scale, shift = batchnorm_scale_shift(layer)
+            entry = {'type': 'affine', 'kernel_size': (1, 1), 'scale': scale, 'shift': shift}
+            out_shape = shape
+        elif isinstance(layer, tf.keras.layers.MaxPool2D):
+            pool = tuple(config['pool_size'])
+            if tuple(config['strides']) != pool or config['padding'] != 'valid':
+                raise Exception(f"{layer.name}: only strides equal to the pool size and 'valid' padding are supported")
+            entry = {'type': 'maxpool', 'kernel_size': pool}
+            out_shape = (shape[0] // pool[0], shape[1] // pool[1], shape[2])
+        elif isinstance(layer, tf.keras.layers.GlobalAveragePooling2D):
+            entry = {'type': 'global_avgpool', 'kernel_size': (1, 1)}
+            out_shape = (1, 1, shape[2])
+        else:
+            raise Exception(f"{layer.name}: {layer.__class__.__name__} is not supported by the sparse engine")
+
+        entry.update({'name': layer.name, 'in': shape, 'out': out_shape, 'relu': False})
+        layers.append(entry)
+        shape = out_shape
+
+        activation = config.get('activation', 'linear')
+        if activation == 'relu':
+            entry['relu'] = True
+        elif activation == 'softmax':
+            layers.append({'type': 'softmax', 'name': layer.name + '_softmax', 'kernel_size': (1, 1),
+                           'in': shape, 'out': shape, 'relu': False})
+        elif activation != 'linear':
+            raise Exception(f"{layer.name}: activation {activation} is not supported")
+
+    return layers
+
+
+def encode_weights(layer, dense=False):
+    """
+    Stores the non-zero weights of a layer sorted by output channel and group.
+
+    @param layer: A convolution or dense layer from extract_layers()
+    @param dense: Store the zero weights too, as a dense engine would use them
+    @return: The start, index and value arrays of sparse_nn_weights_t
+    """
+    kernel = layer['kernel']
+    out_c = kernel.shape[-1]
+
+    if layer['type'] == 'conv2d':
+        # One group per kernel tap, indexed by input channel
+        groups = kernel.reshape((-1, kernel.shape[2], out_c))
+        if kernel.shape[2] > SPARSE_NN_GROUP_SIZE:
+            raise Exception(f"{layer['name']}: more than {SPARSE_NN_GROUP_SIZE} input channels")
+    else:
+        # Blocks of SPARSE_NN_GROUP_SIZE inputs
+        padded = np.zeros((-(-kernel.shape[0] // SPARSE_NN_GROUP_SIZE) * SPARSE_NN_GROUP_SIZE, out_c))
+        padded[:kernel.shape[0]] = kernel
+        groups = padded.reshape((-1, SPARSE_NN_GROUP_SIZE, out_c))
+
+    if groups.shape[0] > SPARSE_NN_MAX_GROUPS:
+        raise Exception(f"{layer['name']}: more than {SPARSE_NN_MAX_GROUPS} weight groups")
+
+    start, index, value = [0], [], []
+    for c in range(out_c):
+        for group in groups:
+            nonzero = np.arange(len(group)) if dense else np.flatnonzero(group[:, c])
+            index.extend(nonzero)
+            value.extend(group[nonzero, c])
+            start.append(len(index))
+
+    if start[-1] > np.iinfo(np.uint16).max:
+        raise Exception(f"{layer['name']}: too many non-zero weights")
+
+    return np.array(start, np.uint16), np.array(index, np.uint8), np.array(value, np.float32)
+
+
+def decode_weights(layer, start, index, value):
+    """
+    @return: The dense kernel rebuilt from the arrays of encode_weights()
+    """
+    kernel = layer['kernel']
+    groups = kernel.shape[0] * kernel.shape[1] if layer['type'] == 'conv2d' \
+        else -(-kernel.shape[0] // SPARSE_NN_GROUP_SIZE)
+    group_size = kernel.shape[2] if layer['type'] == 'conv2d' else SPARSE_NN_GROUP_SIZE
+    decoded = np.zeros((groups * group_size, kernel.shape[-1]), np.float32)
+
+    for c in range(kernel.shape[-1]):
+        for g in range(groups):
+            begin, end = start[c * groups + g], start[c * groups + g + 1]
+            decoded[g * group_size + index[begin:end].astype(int), c] = value[begin:end]
+
+    return decoded[:int(np.prod(kernel.shape[:-1]))].reshape(kernel.shape)
+
+
+def valid_taps(layer):
+    """
+    @return: For a convolution, the number of output positions where each tap is inside the input
+    """
+    (kh, kw), (h, w, _) = layer['kernel_size'], layer['in']
+    rows = [sum(0 <= y + ky - (kh - 1) // 2 < h for y in range(h)) for ky in range(kh)]
+    cols = [sum(0 <= x + kx - (kw - 1) // 2 < w for x in range(w)) for kx in range(kw)]
+    return np.outer(rows, cols).reshape(-1)
+
+
+def layer_cost(layer):
+    """
+    @return: Dense MACs, sparse MACs, dense flash bytes and sparse flash bytes of a layer
+    """
+    if layer['type'] not in ('conv2d', 'dense'):
+        return 0, 0, 0, 0
+
+    kernel = layer['kernel']
+    out_c = kernel.shape[-1]
+    start, _, _ = encode_weights(layer)
+
+    if layer['type'] == 'conv2d':
+        positions = valid_taps(layer)
+        nonzero = (kernel != 0).reshape((-1, kernel.shape[2], out_c)).sum(axis=(1, 2))
+        dense_macs = int(np.sum(positions) * kernel.shape[2] * out_c)
+        sparse_macs = int(np.dot(positions, nonzero))
+    else:
+        dense_macs = int(kernel.size)
+        sparse_macs = int(np.count_nonzero(kernel))
+
+    bias_bytes = out_c * FLOAT_BYTES
+    dense_bytes = kernel.size * FLOAT_BYTES + bias_bytes
+    sparse_bytes = int(start[-1]) * (FLOAT_BYTES + INDEX_BYTES) + len(start) * START_BYTES + bias_bytes
+
+    return dense_macs, sparse_macs, dense_bytes, sparse_bytes
+
+
+def run_layers(layers, windows):
+    """
+    Reference implementation of sparse_nn.c in numpy, run on a batch.
+
+    @param layers: Layers from extract_layers()
+    @param windows: Batch of model inputs
+    @return: The model outputs
+    """
+    x = windows.reshape((len(windows),) + layers[0]['in']).astype(np.float32)
+
+    for layer in layers:
+        kind = layer['type']
+        if kind == 'conv2d':
+            (kh, kw), (h, w, _) = layer['kernel_size'], layer['in']
+            padded = np.pad(x, ((0, 0), ((kh - 1) // 2, kh // 2), ((kw - 1) // 2, kw // 2), (0, 0)))
+            y = np.zeros(x.shape[:3] + (layer['kernel'].shape[-1],), np.float32) + layer['bias']
+            for ky in range(kh):
+                for kx in range(kw):
+                    y += np.einsum('nhwc,co->nhwo', padded[:, ky:ky + h, kx:kx + w], layer['kernel'][ky, kx])
+            x = y
+        elif kind == 'dense':
+            x = (x.reshape((len(x), -1)) @ layer['kernel'] + layer['bias']).reshape((len(x), 1, 1, -1))
+        elif kind == 'affine':
+            x = x * layer['scale'] + layer['shift']
+        elif kind == 'maxpool':
+            (ph, pw), (h, w, c) = layer['kernel_size'], layer['out']
+            x = x[:, :h * ph, :w * pw].reshape((len(x), h, ph, w, pw, c)).max(axis=(2, 4))
+        elif kind == 'global_avgpool':
+            x = x.mean(axis=(1, 2), keepdims=True)
+        elif kind == 'softmax':
+            x = np.exp(x - x.max(axis=-1, keepdims=True))
+            x = x / x.sum(axis=-1, keepdims=True)
+
+        if layer['relu']:
+            x = np.maximum(x, 0)
+
+    return x.reshape((len(x), -1))
+
+
+def prune_layers(layers, sparsity):
+    """
+    @param layers: Layers from extract_layers()
+    @param sparsity: Percentage of the weights of each layer to set to zero, by magnitude
+    @return: A copy of the layers with at least the requested sparsity
+    """
+    pruned = []
+    for layer in layers:
+        layer = dict(layer)
+        if 'kernel' in layer:
+            kernel = layer['kernel'].copy()
+            count = int(kernel.size * sparsity / 100)
+            if count > 0:
+                kernel.flat[np.argsort(np.abs(kernel), axis=None)[:count]] = 0
+            layer['kernel'] = kernel
+        pruned.append(layer)
+    return pruned
+
+
+def model_cost(layers):
+    """
+    @return: Sparsity in percent, dense MACs, sparse MACs, dense bytes and sparse bytes of all layers
+    """
+    costs = np.array([layer_cost(layer) for layer in layers]).sum(axis=0)
+    weights = sum(layer['kernel'].size for layer in layers if 'kernel' in layer)
+    nonzero = sum(np.count_nonzero(layer['kernel']) for layer in layers if 'kernel' in layer)
+    return (100.0 * (weights - nonzero) / weights,) + tuple(int(cost) for cost in costs)
+
+
+def time_c(layers, windows, dense=False):
+    """
+    Builds sparse_nn.c and the layers with the host compiler and runs it on the windows.
+
+    @param layers: Layers from extract_layers()
+    @param windows: Model inputs
+    @param dense: Store and multiply the zero weights too
+    @return: The best time of TIME_REPEATS runs over the windows, in microseconds per window
+    """
+    with tempfile.TemporaryDirectory() as build:
+        source = os.path.join(build, "TIMED_sparse_model.c")
+        library = os.path.join(build, "TIMED_sparse_model.so")
+        write_c(layers, "TIMED", source, dense)
+        subprocess.run(['cc', '-std=gnu11', '-O2', '-Wall', '-shared', '-fPIC', '-I', SPARSE_NN_FOLDER, '-o', library,
+                        source, os.path.join(SPARSE_NN_FOLDER, "sparse_nn.c"), '-lm'], check=True)
+        engine = ctypes.CDLL(library)
+        run = engine.sparse_nn_run
+        run.argtypes = [ctypes.c_void_p] * 3
+        model = ctypes.addressof(ctypes.c_char.in_dll(engine, "TIMED_sparse_model"))
+        inputs = np.ascontiguousarray(windows.reshape((len(windows), -1)), np.float32)
+        output = np.zeros(layers[-1]['out'][-1], np.float32)
+
+        best = float('inf')
+        for _ in range(TIME_REPEATS):
+            start = time.perf_counter()
+            for window in inputs:
+                run(model, window.ctypes.data, output.ctypes.data)
+            best = min(best, time.perf_counter() - start)
+
+    return 1e6 * best / len(inputs)
+
+
+def print_report(layers, levels, windows, labels):
+    """
+    Prints the cost of each layer, then the cost, measured time and accuracy for each sparsity level.
+    """
+    print(f"\n{'Layer':<24}{'Non-zero':>10}{'Dense MACs':>12}{'Sparse MACs':>13}{'Dense B':>10}{'Sparse B':>10}")
+    for layer in layers:
+        if 'kernel' in layer:
+            dense_macs, sparse_macs, dense_bytes, sparse_bytes = layer_cost(layer)
+            nonzero = f"{np.count_nonzero(layer['kernel'])}/{layer['kernel'].size}"
+            print(f"{layer['name']:<24}{nonzero:>10}{dense_macs:>12}{sparse_macs:>13}{dense_bytes:>10}{sparse_bytes:>10}")
+
+    _, dense_macs, _, dense_bytes, _ = model_cost(layers)
+    dense_time = time_c(layers, windows, dense=True)
+    print(f"\n{'Level':>6}{'Sparsity':>10}{'Sparse MACs':>13}{'Time us':>10}{'Speedup':>10}{'Sparse B':>10}"
+          f"{'Flash ratio':>13}{'Accuracy':>10}")
+    print(f"{'dense':>6}{0.0:>9.1f}%{dense_macs:>13}{dense_time:>10.2f}{1.0:>9.2f}x"
+          f"{dense_bytes:>10}{1.0:>13.2f}{'-':>10}")
+    for level in levels:
+        pruned = prune_layers(layers, level)
+        sparsity, dense_macs, sparse_macs, dense_bytes, sparse_bytes = model_cost(pruned)
+        accuracy = np.mean(np.argmax(run_layers(pruned, windows), axis=1) == labels)
+        sparse_time = time_c(pruned, windows)
+        print(f"{level:>5}%{sparsity:>9.1f}%{sparse_macs:>13}{sparse_time:>10.2f}{dense_time / sparse_time:>9.2f}x"
+              f"{sparse_bytes:>10}{sparse_bytes / dense_bytes:>13.2f}{accuracy:>10.3f}")
+    print("Times are measured on this host with sparse_nn.c; the dense row stores every weight in the same engine. "
+          "The cycles on the device are returned by model_registry_get_stats().")
+    print("Levels above the sparsity of the model are pruned by magnitude without fine-tuning, "
+          "so their accuracy is a lower bound.\n")
+
+
+def c_array(c_type, name, values, per_line):
+    """
+    @return: The C definition of a constant array
+    """
+    if c_type == 'float':
+        items = [f"{float(value):.9e}f" for value in values]
+    else:
+        items = [str(int(value)) for value in values]
+    if not items:
+        items = ['0']
+    lines = [', '.join(items[i:i + per_line]) for i in range(0, len(items), per_line)]
+    return f"static const {c_type} {name}[] =\n{{\n    " + ",\n    ".join(lines) + "\n};\n\n"
+
+
+def write_c(layers, model_name, path, dense=False):
+    """
+    Writes the sparse_nn_model_t of the layers to a C file, with the zero weights too if dense.
+    """
+    prefix = f"{model_name}_sparse"
+    types = {'conv2d': 'SPARSE_NN_CONV2D', 'dense': 'SPARSE_NN_DENSE', 'affine': 'SPARSE_NN_AFFINE',
+             'maxpool': 'SPARSE_NN_MAXPOOL', 'global_avgpool': 'SPARSE_NN_GLOBAL_AVGPOOL',
+             'softmax': 'SPARSE_NN_SOFTMAX'}
+    data, entries = "", []
+
+    for i, layer in enumerate(layers):
+        name = f"{prefix}_{i}"
+        weights, affine = "{0}", "NULL, NULL"
+        if 'kernel' in layer:
+            start, index, value = encode_weights(layer, dense)
+            data += c_array('uint16_t', f"{name}_start", start, 16)
+            data += c_array('uint8_t', f"{name}_index", index, 16)
+            data += c_array('float', f"{name}_value", value, 4)
+            data += c_array('float', f"{name}_bias", layer['bias'], 4)
+            weights = f"{{ {name}_start, {name}_index, {name}_value, {name}_bias }}"
+        if layer['type'] == 'affine':
+            data += c_array('float', f"{name}_scale", layer['scale'], 4)
+            data += c_array('float', f"{name}_shift", layer['shift'], 4)
+            affine = f"{name}_scale, {name}_shift"
+        (ih, iw, ic), (oh, ow, oc), (kh, kw) = layer['in'], layer['out'], layer['kernel_size']
+        entries.append(f"    /* {layer['name']} */\n"
+                       f"    {{ {types[layer['type']]}, {ih}, {iw}, {ic}, {oh}, {ow}, {oc}, {kh}, {kw}, "
+                       f"{int(layer['relu'])},\n      {weights}, {affine} }},\n")
+
+    even = max(int(np.prod(layer['out'])) for layer in layers[0::2])
+    odd = max([int(np.prod(layer['out'])) for layer in layers[1::2]] + [0])
+
+    with open(path, 'w') as file:
+        file.write("/***************************************************************************//**\n"
+                   f"* \\file {os.path.basename(path)}\n*\n* \\brief\n"
+                   f"* Autogenerated with train/sparse_export.py, this file contains {model_name}\n"
+                   "* sparse model data for source/sparse_nn.c.\n"
+                   "*******************************************************************************/\n\n"
+                   "#include \"sparse_nn.h\"\n\n")
+        file.write(data)
+        file.write(f"static const sparse_nn_layer_t {prefix}_layers[] =\n{{\n" + "".join(entries) + "};\n\n")
+        file.write(f"static float {prefix}_buffer[{even + odd}];\n\n")
+        file.write(f"const sparse_nn_model_t {prefix}_model =\n{{\n"
+                   f"    {len(layers)}, {prefix}_layers, {even}, {prefix}_buffer\n}};\n")
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--model", default="../pretrained_models/Magic_wand_model_pruned.h5",
+                        help="Pruned Keras model to export")
+    parser.add_argument("--name", default="MAGIC_WAND", help="NN_MODEL_NAME of the Makefile")
+    parser.add_argument("--output", default="../mtb_ml_gen/mtb_ml_sparse", help="Folder of the generated C file")
+    parser.add_argument("--levels", type=int, nargs='+', default=[0, 25, 50, 75, 90],
+                        help="Sparsity levels to report, in percent")
+    args = parser.parse_args()
+
+    model = tf.keras.models.load_model(args.model)
+    layers = extract_layers(fold_batchnorm(model))
+
+    # Run the model rebuilt from the stored weights against Keras
+    for layer in layers:
+        if 'kernel' in layer:
+            layer['kernel'] = decode_weights(layer, *encode_weights(layer))
+    windows, labels, _ = load_windows()
+    error = np.max(np.abs(model.predict(windows.reshape((-1,) + model.input_shape[1:])) - run_layers(layers, windows)))
+    print(f"[INFO] Maximum output difference on {len(windows)} windows: {error:.2e}")
+    if error > FOLD_TOLERANCE:
+        raise Exception("Sparse model does not match the Keras model")
+
+    print_report(layers, args.levels, windows, labels)
+
+    os.makedirs(args.output, exist_ok=True)
+    path = os.path.join(args.output, f"{args.name}_sparse_model.c")
+    write_c(layers, args.name, path)
+    print(f"[INFO] Sparse model written to {path}")
@@ -0,0 +1,213 @@
+# (c) 2022, Cypress Semiconductor Corporation (an Infineon company) or an affiliate of Cypress Semiconductor 
+# Corporation.  All rights reserved.
+#
+# This software, including source code, documentation and related materials
+# ("Software") is owned by Cypress Semiconductor Corporation or one of its
+# affiliates ("Cypress") and is protected by and subject to worldwide patent 
+# protection (United States and foreign), United States copyright laws and 
+# international treaty provisions.  Therefore, you may use this Software only
+# as provided in the license agreement accompanying the software package from
+# which you obtained this Software ("EULA").
+#
+# If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+# non-transferable license to copy, modify, and compile the Software source
+# code solely for use in connection with Cypress's integrated circuit products.
+# Any reproduction, modification, translation, compilation, or representation
+# of this Software except as specified above is prohibited without the express 
+# written permission of Cypress.
+#
+# Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+# WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+# reserves the right to make changes to the Software without notice. Cypress
+# does not assume any liability arising out of the application or use of the
+# Software or any product or circuit described in the Software. Cypress does
+# not authorize its products for use in any products where a malfunction or
+# failure of the Cypress product may reasonably be expected to result in
+# significant property damage, injury or death ("High Risk Product"). By
+# including Cypress's product in a High Risk Product, the manufacturer of such 
+# system or application assumes all risk of such use and in doing so agrees to
+# indemnify Cypress against all liability.
+
+"""
+Decode the binary frames streamed by the firmware in data collection mode, see
+source/stream.h for the frame layout, and apply the same pre-processing as
+gesture_task() so the windows can be stored in gesture_data/.
+"""
+
+import binascii
+import struct
+import numpy as np
+
+import imu_codec
+
+# Must match source/stream.h
+SYNC = b'\xa5\x5a'
+HEADER_SIZE = 8
+CRC_SIZE = 2
+MAX_PAYLOAD = 1536
+TYPE_RAW = 0x01
+TYPE_DELTA = 0x02
+TYPE_TRACE = 0x03
+TYPE_WINDOW = 0x04
+TYPE_RESULT = 0x05
+FLAG_BMI160_AXES = 0x01
+
+# Must match source/sensor.h and source/processing.h
+NUM_AXIS = 6
+SENSOR_RANGE = 32768.0
+COEFF_B = np.array([0.01809893, 0.0542968, 0.0542968, 0.01809893], np.float32)
+COEFF_A = np.array([1.0, -1.76004188, 1.18289326, -0.27805992], np.float32)
+
+
+def crc16(data):
+    """
+    @return: CRC-16/CCITT-FALSE of the data, as computed by stream_crc16()
+    """
+    return binascii.crc_hqx(data, 0xFFFF)
+
+
+def encode_frame(frame_type, sequence, payload, flags=0):
+    """
+    Builds a frame as stream_send() does, for the frames sent to the device.
+
+    @return: The frame bytes
+    """
+    header = struct.pack('<BBHH', frame_type, flags, sequence & 0xFFFF, len(payload))
+    crc = crc16(header + payload)
+    return SYNC + header + payload + struct.pack('<H', crc)
+
+
+class FrameDecoder:
+    """
+    Finds the frames in a byte stream. Bytes outside frames, such as the text
+    printed at startup, and frames with a bad CRC are skipped. Sequence gaps are
+    counted as lost frames.
+    """
+
+    def __init__(self):
+        self.buffer = bytearray()
+        self.last_sequence = None
+        self.frames = 0
+        self.lost_frames = 0
+        self.crc_errors = 0
+        self.skipped_bytes = 0
+
+    def feed(self, data):
+        """
+        @param data: Bytes received from the serial port
+        @return: List of (type, flags, sequence, payload) of the complete frames
+        """
+        self.buffer += data
+        frames = []
+
+        while True:
+            start = self.buffer.find(SYNC)
+            if start < 0:
+                # Keep a last byte that may be the first sync byte
+                keep = 1 if self.buffer[-1:] == SYNC[:1] else 0
+                self.skipped_bytes += len(self.buffer) - keep
+                del self.buffer[:len(self.buffer) - keep]
+                break
+
+            self.skipped_bytes += start
+            del self.buffer[:start]
+            if len(self.buffer) < HEADER_SIZE:
+                break
+
+            frame_type, flags, sequence, length = struct.unpack_from('<BBHH', self.buffer, 2)
+            if length > MAX_PAYLOAD:
+                # Not a real header, look for the next sync
+                self.skipped_bytes += 1
+                del self.buffer[:1]
+                continue
+            if len(self.buffer) < HEADER_SIZE + length + CRC_SIZE:
+                break
+
+            payload = bytes(self.buffer[HEADER_SIZE:HEADER_SIZE + length])
+            crc, = struct.unpack_from('<H', self.buffer, HEADER_SIZE + length)
+            if crc != crc16(bytes(self.buffer[2:HEADER_SIZE + length])):
+                self.crc_errors += 1
+                self.skipped_bytes += 1
+                del self.buffer[:1]
+                continue
+
+            del self.buffer[:HEADER_SIZE + length + CRC_SIZE]
+            if self.last_sequence is not None:
+                self.lost_frames += (sequence - self.last_sequence - 1) & 0xFFFF
+            self.last_sequence = sequence
+            self.frames += 1
+            frames.append((frame_type, flags, sequence, payload))
+
+        return frames
+
+
+def decode_raw(payload):
+    """
+    @return: The int16 samples of a TYPE_RAW payload, one row per sample
+    """
+    return np.frombuffer(payload, dtype='<i2').reshape((-1, NUM_AXIS))
+
+
+def decode_samples(frame_type, payload):
+    """
+    @return: The int16 samples of a TYPE_RAW or TYPE_DELTA payload, one row per
+             sample, or None for other frame types
+    """
+    if frame_type == TYPE_RAW:
+        return decode_raw(payload)
+    if frame_type == TYPE_DELTA:
+        return imu_codec.decode(payload)
+    return None
+
+
+def preprocess(samples, flags):
+    """
+    Same pre-processing as gesture_task(), in single precision.
+
+    @param samples: int16 samples of one window, one row per sample
+    @param flags: Frame flags
+    @return: The window as fed to the model
+    """
+    data = samples.astype(np.float32)
+    order = len(COEFF_B) - 1
+
+    # Third order butter-worth filter, restarted on each window
+    for axis in range(NUM_AXIS):
+        x_states = np.zeros(order + 1, np.float32)
+        y_states = np.zeros(order + 1, np.float32)
+        for i in range(len(data)):
+            x_states[0] = data[i, axis]
+            value = COEFF_B[0] * x_states[0]
+            for j in range(1, order + 1):
+                value += COEFF_B[j] * x_states[j]
+                value -= COEFF_A[j] * y_states[j]
+            data[i, axis] = value
+            y_states[0] = value
+            x_states[1:] = x_states[:-1].copy()
+            y_states[1:] = y_states[:-1].copy()
+
+    # Min max normalization between -1 and 1
+    scaler = np.float32(2.0 / (2 * SENSOR_RANGE))
+    data = np.where(data > SENSOR_RANGE, np.float32(1.0),
+                    np.where(data < -SENSOR_RANGE, np.float32(-1.0),
+                             np.float32(1.0) - (np.float32(SENSOR_RANGE) - data) * scaler)).astype(np.float32)
+
+    if flags & FLAG_BMI160_AXES:
+        # Swap axis for BMI_160 so board orientation stays the same
+        data[:, 2] = -data[:, 2]
+        data[:, [0, 1]] = data[:, [1, 0]]
+        data[:, 5] = -data[:, 5]
+        data[:, [3, 4]] = data[:, [4, 3]]
+
+    return data
+
+
+def format_window(window):
+    """
+    @return: The window in the text format of the files in gesture_data/
+    """
+    lines = ["-,-,-,-,-,-\n"]
+    for row in window:
+        lines.append(",".join(f"{value:6f}" for value in row) + "\n")
+    return "".join(lines)
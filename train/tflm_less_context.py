@@ -0,0 +1,398 @@
+# (c) 2022, Cypress Semiconductor Corporation (an Infineon company) or an affiliate of Cypress Semiconductor 
+# Corporation.  All rights reserved.
+#
+# This software, including source code, documentation and related materials
+# ("Software") is owned by Cypress Semiconductor Corporation or one of its
+# affiliates ("Cypress") and is protected by and subject to worldwide patent 
+# protection (United States and foreign), United States copyright laws and 
+# international treaty provisions.  Therefore, you may use this Software only
+# as provided in the license agreement accompanying the software package from
+# which you obtained this Software ("EULA").
+#
+# If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+# non-transferable license to copy, modify, and compile the Software source
+# code solely for use in connection with Cypress's integrated circuit products.
+# Any reproduction, modification, translation, compilation, or representation
+# of this Software except as specified above is prohibited without the express 
+# written permission of Cypress.
+#
+# Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+# WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+# reserves the right to make changes to the Software without notice. Cypress
+# does not assume any liability arising out of the application or use of the
+# Software or any product or circuit described in the Software. Cypress does
+# not authorize its products for use in any products where a malfunction or
+# failure of the Cypress product may reasonably be expected to result in
+# significant property damage, injury or death ("High Risk Product"). By
+# including Cypress's product in a High Risk Product, the manufacturer of such 
+# system or application assumes all risk of such use and in doing so agrees to
+# indemnify Cypress against all liability.
+
+"""
+Makes the model generated by the ML Configurator for the TFLM interpreter-less
+engine (tflm_less) reentrant. The generated code keeps the arena, the tensor
+tables, the nodes and the kernel context in file-scope variables, so only one
+inference can exist in the firmware. The script moves them into a context
+structure, one per instance of the model, with an arena given by the caller:
+
+    MAGIC_WAND_context_t context;
+    static uint8_t arena[MAGIC_WAND_MODEL_ARENA_SIZE] __attribute__((aligned(16)));
+
+    MAGIC_WAND_context_init(&context, arena, sizeof(arena), &lock);
+    MAGIC_WAND_context_invoke(&context);
+
+The constant tensors, the registrations and the precomputed operator data stay
+shared by all the instances. The kernels take the operator data from a cursor
+of the library, so the instances serialize on it with the lock and unlock
+callbacks given by the caller, which the generated code does not depend on an
+RTOS or HAL for. The functions without a context, called by the ML
+middleware, run an instance in the arena of the generated file without a lock.
+
+Run it after each Generate Source of the ML Configurator; files already
+converted are left unchanged.
+
+Usage: python tflm_less_context.py [--models ../mtb_ml_gen/mtb_ml_models] [--name MAGIC_WAND]
+"""
+
+import argparse
+import glob
+import os
+import re
+
+MARKER = "// Made reentrant by train/tflm_less_context.py."
+
+# Pointers reserved in the context for the MicroContext of the kernels, which
+# holds a vtable, the external context, the allocator, model and graph, and
+# the kernel context
+MICRO_CONTEXT_SIZE = 16
+
+
+def replace(text, pattern, repl, count=1, flags=re.MULTILINE):
+    """
+    Replaces a pattern of the generated code, which must be found count times.
+
+    @param text: Generated code
+    @param pattern: Regular expression
+    @param repl: Replacement, as for re.sub
+    @param count: Expected number of matches, None for at least one
+    @return: The code with the replacements
+    """
+    text, found = re.subn(pattern, repl, text, flags=flags)
+    if (found != count) if count is not None else (found == 0):
+        raise ValueError(f"Unexpected generated code: {found} matches of {pattern!r}, expected {count or 'some'}")
+    return text
+
+
+def model_sizes(source):
+    """
+    @param source: Generated C++ code of the model
+    @return: (arena bytes, tensors, nodes)
+    """
+    arena = re.search(r'^constexpr int kTensorArenaSize = (\d+);', source, re.MULTILINE)
+    tensors = re.search(r'^TfLiteEvalTensor evalTensors\[(\d+)\];', source, re.MULTILINE)
+    nodes = re.search(r'^constexpr size_t kOpNodesCount = (\d+);', source, re.MULTILINE)
+    if not (arena and tensors and nodes):
+        raise ValueError("Unexpected generated code: arena, tensor or node count not found")
+    return int(arena.group(1)), int(tensors.group(1)), int(nodes.group(1))
+
+
+def convert_header(header, name, arena, tensors, nodes):
+    """
+    Adds the context structure and the functions of an instance to the
+    generated header.
+    """
+    header = replace(header, r'^(// This file is generated\. Do not edit\.\n)', r'\1' + MARKER + '\n')
+    header = replace(header, r'^(#define ' + name + r'_MODEL_UNINIT_DATA_SIZE \d+\n)', r'''\1
+// Arena of an instance, and tensors and operators of the model
+#define {0}_MODEL_ARENA_SIZE {1}
+#define {0}_MODEL_TENSOR_COUNT {2}
+#define {0}_MODEL_NODE_COUNT {3}
+
+// Pointers reserved for the MicroContext of the kernels
+#define {0}_MODEL_MICRO_CONTEXT_SIZE {4}
+
+// Lock of the state shared by the instances: the registrations, and the
+// cursor of the library over the precomputed operator data. All the instances
+// running concurrently use the same lock.
+typedef struct {{
+  void (*lock)(void *arg);
+  void (*unlock)(void *arg);
+  void *arg;
+}} {0}_lock_t;
+
+// State of one instance of the model. The constant tensors and the operator
+// data are shared by all the instances; the activations and the persistent
+// buffers of the kernels are in the arena of the instance.
+typedef struct {{
+  TfLiteContext ctx;
+  TfLiteTensor tflTensorsWithMinus1[{0}_MODEL_TENSOR_COUNT + 1];
+  TfLiteEvalTensor evalTensors[{0}_MODEL_TENSOR_COUNT];
+  TfLiteNode tflNodes[{0}_MODEL_NODE_COUNT];
+  uint8_t *arena;
+  uint8_t *persistent;      // Last persistent buffer, from the end of the arena
+  int next_scratch_buffer_idx;
+  {0}_lock_t lock;
+  void *micro_context[{0}_MODEL_MICRO_CONTEXT_SIZE];
+}} {0}_context_t;
+'''.format(name, arena, tensors, nodes, MICRO_CONTEXT_SIZE))
+    header = replace(header, r'^(// Sets up the model with init and prepare steps\.\n)',
+                     r'// The functions without a context run an instance in the arena of the\n'
+                     r'// generated file, as used by the ML middleware.\n\n\1')
+    header = replace(header, r'^(TfLiteStatus ' + name + r'_invoke\(\);\n)', r'''\1
+// Sets up an instance of the model in an arena of at least
+// {0}_MODEL_ARENA_SIZE bytes, aligned to 16 bytes. lock may be NULL if
+// no other instance is set up or runs at the same time.
+TfLiteStatus {0}_context_init({0}_context_t *context, uint8_t *arena, size_t arena_size, const {0}_lock_t *lock);
+// Returns the input tensor of an instance with the given index.
+TfLiteTensor *{0}_context_input({0}_context_t *context, int index);
+// Returns the output tensor of an instance with the given index.
+TfLiteTensor *{0}_context_output({0}_context_t *context, int index);
+// Runs inference for an instance. With the precomputed operator data, the
+// instances run one at a time under their lock.
+TfLiteStatus {0}_context_invoke({0}_context_t *context);
+'''.format(name))
+    return header
+
+
+def convert_source(source, name, header_name, tensors):
+    """
+    Moves the arena, tensors, nodes and kernel context of the generated code
+    into the context of an instance.
+    """
+    source = replace(source, r'^(// This file is generated\. Do not edit\.\n)', r'\1' + MARKER + '\n')
+    source = replace(source, r'^(#include "tensorflow/lite/c/builtin_op_data\.h"\n)',
+                     r'#include <new>\n\n\1')
+    source = replace(source, r'^(#include "tensorflow/lite/micro/micro_context\.h"\n)',
+                     r'\1#include "' + header_name + r'"\n')
+
+    # The arena of the generated file is the one of the default instance
+    source = replace(source, r'^(uint8_t tensor_arena\[kTensorArenaSize\] ALIGN\(16\);\n)',
+                     r'// Arena of the instance used by the functions without a context\n\1')
+
+    # Tensors in the arena are stored as offsets, added to the arena of the
+    # instance
+    source = replace(source, r'^(  void\* data;\n)',
+                     r'\1  size_t arena_offset;  // Used if data is nullptr\n')
+    source = replace(source, r'^(  \{ kTfLite\w+, )tensor_arena \+ (\d+),', r'\1nullptr, \2,', count=None)
+    source = replace(source, r'^(  \{ kTfLite\w+, \(void\*\)tensor_data\d+,)', r'\1 0,', count=None)
+
+    # The kernel context, tensors and nodes move to the instance; the
+    # registrations stay shared
+    source = replace(source, r'^TfLiteContext ctx\{\};\n\n'
+                             r'// Tensor table with space for -1-th element used\n'
+                             r'// designate missing optional inputs/outputs\.\n'
+                             r'TfLiteTensor tflTensorsWithMinus1\[\d+\];\n *\n'
+                             r'TfLiteEvalTensor evalTensors\[\d+\];\n\n'
+                             r'TfLiteTensor \* const tflTensors = tflTensorsWithMinus1\+1;\n\n',
+                     '''// Instance used by the functions without a context
+{0}_context_t default_context;
+
+// Dimensions of the -1-th tensor, used to designate missing optional
+// inputs/outputs
+TfLiteIntArray dimsEmptyTensor = {{0}};
+
+'''.format(name).replace('\\', '\\\\'))
+    source = replace(source, r'^TfLiteNode tflNodes\[kOpNodesCount\];\n',
+                     r'static_assert(kOpNodesCount == ' + name + r'_MODEL_NODE_COUNT, "Node count of the context");\n')
+    source = replace(source, r'^  int next_scratch_buffer_idx;\n', '')
+
+    # Callbacks of the kernels, which find the instance from their context
+    source = replace(source, r'^void \*AllocatePersistentBuffer\(.*?^\} // namespace\n', '''{0}_context_t *GetContext(const struct TfLiteContext *ctx) {{
+  return reinterpret_cast<{0}_context_t *>(const_cast<TfLiteContext *>(ctx));
+}}
+
+void *AllocatePersistentBuffer(struct TfLiteContext* ctx,
+                                                 size_t bytes) {{
+  {0}_context_t *context = GetContext(ctx);
+
+  context->persistent -= bytes;
+  return context->persistent;
+}}
+
+TfLiteEvalTensor *GetEvalTensor(const struct TfLiteContext *ctx,
+                                       int tensor_idx) {{
+  return &GetContext(ctx)->evalTensors[tensor_idx];
+}}
+
+TfLiteStatus RequestScratchBufferInArena(TfLiteContext *ctx,
+                                                size_t bytes_ignored,
+                                                int *buffer_idx) {{
+  {0}_context_t *context = GetContext(ctx);
+
+  *buffer_idx = context->next_scratch_buffer_idx;
+  ++context->next_scratch_buffer_idx;
+  return kTfLiteOk;
+}}
+
+void* GetScratchBuffer(struct TfLiteContext *ctx, int buffer_idx) {{
+  return GetContext(ctx)->arena + scratchbuf_offsets[buffer_idx];
+}}
+
+void Lock({0}_context_t *context) {{
+  if (context->lock.lock) {{
+    context->lock.lock(context->lock.arg);
+  }}
+}}
+
+void Unlock({0}_context_t *context) {{
+  if (context->lock.unlock) {{
+    context->lock.unlock(context->lock.arg);
+  }}
+}}
+
+}} // namespace
+'''.format(name).replace('\\', '\\\\'), flags=re.MULTILINE | re.DOTALL)
+
+    # The MicroContext of the kernels calls the callbacks of its instance
+    source = replace(source, r'^(   )' + name + r'_PreinterpretedMicroContext\(\) : *\n'
+                             r'    tflite::MicroContext\(nullptr, nullptr, nullptr\) \{\}\n',
+                     r'\1explicit ' + name + r'_PreinterpretedMicroContext(TfLiteContext *ctx) :\n'
+                     r'    tflite::MicroContext(nullptr, nullptr, nullptr), ctx_(ctx) {}\n')
+    source = replace(source, r'::(AllocatePersistentBuffer|RequestScratchBufferInArena|GetScratchBuffer|GetEvalTensor)\(nullptr, ',
+                     r'::\1(ctx_, ', count=4)
+    source = replace(source, r'&tflTensors\[tensor_idx\]', r'&ctx_->tensors[tensor_idx]')
+    source = replace(source, r'^(  void\* external_context_payload_ = nullptr;\n)', r'\1  TfLiteContext *ctx_;\n')
+
+    # Set up of an instance
+    source = replace(source, r'^extern "C" TfLiteStatus ' + name + r'_init\(\) \{\n',
+                     '''extern "C" TfLiteStatus {0}_context_init({0}_context_t *context, uint8_t *arena, size_t arena_size, const {0}_lock_t *lock) {{
+  static_assert(sizeof({0}_PreinterpretedMicroContext) <= sizeof(context->micro_context),
+                "MicroContext larger than its space in the context");
+
+  if (arena_size < kTensorArenaSize) {{
+    return kTfLiteError;
+  }}
+  *context = {{}};
+  context->arena = arena;
+  context->persistent = arena + arena_size;
+  if (lock) {{
+    context->lock = *lock;
+  }}
+
+  TfLiteContext &ctx = context->ctx;
+  TfLiteTensor * const tflTensors = context->tflTensorsWithMinus1 + 1;
+  TfLiteEvalTensor * const evalTensors = context->evalTensors;
+  TfLiteNode * const tflNodes = context->tflNodes;
+
+'''.format(name).replace('\\', '\\\\'))
+    source = replace(source, r'^  ctx\.tensors_size = ' + str(tensors) + r';\n\n'
+                             r'  static ' + name + r'_PreinterpretedMicroContext u_ctx;\n'
+                             r'  ctx\.impl_ = static_cast<void \*>\(&u_ctx\);\n\n'
+                             r'  TfLiteIntArray dimsEmptyTensor = \{0\};\n',
+                     r'  ctx.tensors_size = ' + str(tensors) + r';\n\n'
+                     r'  ctx.impl_ = static_cast<void *>(new (context->micro_context) ' + name +
+                     r'_PreinterpretedMicroContext(&ctx));\n\n')
+    source = replace(source, r'^(  for\(size_t i = 0; i < \d+; \+\+i\) \{\n)'
+                             r'    tflTensors\[i\]\.data\.data = tensorData\[i\]\.data;\n'
+                             r'    evalTensors\[i\]\.data\.data = tensorData\[i\]\.data;\n',
+                     r'\1    void *data = tensorData[i].data ? tensorData[i].data : arena + tensorData[i].arena_offset;\n'
+                     r'    tflTensors[i].data.data = data;\n'
+                     r'    evalTensors[i].data.data = data;\n')
+    source = replace(source, r'\(tensor_arena <= tensorData\[i\]\.data && tensorData\[i\]\.data < tensor_arena \+ kTensorArenaSize\) '
+                             r'\? kTfLiteArenaRw : kTfLiteMmapRo',
+                     r'tensorData[i].data ? kTfLiteMmapRo : kTfLiteArenaRw')
+    source = replace(source, r'^(    )next_scratch_buffer_idx = ', r'\1context->next_scratch_buffer_idx = ')
+
+    # The kernels take their precomputed operator data from a cursor of the
+    # library, shared by all the instances, in their init and prepare steps,
+    # and possibly when they run. The registrations and the cursor are only
+    # used under the lock of the instance.
+    source = replace(source, r'^((?:  registrations\[OP_\w+\] = .*\n)+)',
+                     r'  // The registrations and the operator data cursor are shared by all the\n'
+                     r'  // instances\n'
+                     r'  Lock(context);\n\1')
+    source = replace(source, r'^(      TfLiteStatus status = registrations\[nodeData\[i\]\.used_op_index\]\.prepare\(&ctx, &tflNodes\[i\]\);\n'
+                             r'      if \(status != kTfLiteOk\) \{\n)',
+                     r'\1        Unlock(context);\n')
+    source = replace(source, r'^(    precomputed_sb_idx_ctr \+= node_scratch_buffer_requests\[i\];\n  \}\n)',
+                     r'\1  Unlock(context);\n')
+
+    # Tensors and inference of an instance, and the functions without a
+    # context on the default instance
+    source = replace(source, r'^extern "C" TfLiteTensor\* ' + name + r'_input\(int index\) \{ *\n',
+                     '''extern "C" TfLiteStatus {0}_init() {{
+  return {0}_context_init(&default_context, tensor_arena, sizeof(tensor_arena), nullptr);
+}}
+
+extern "C" TfLiteTensor* {0}_context_input({0}_context_t *context, int index) {{
+'''.format(name).replace('\\', '\\\\'))
+    source = replace(source, r'^extern "C" TfLiteTensor\* ' + name + r'_output\(int index\) \{\n',
+                     r'extern "C" TfLiteTensor* ' + name + r'_context_output(' + name +
+                     r'_context_t *context, int index) {\n')
+    source = replace(source, r'return &ctx\.tensors\[', r'return &context->ctx.tensors[', count=2)
+    source = replace(source, r'^(    \};\n    return &context->ctx\.tensors\[outTensorIndices\[index\]\];\n  \}\n)',
+                     r'''\1
+extern "C" TfLiteTensor* {0}_input(int index) {{
+  return {0}_context_input(&default_context, index);
+}}
+
+extern "C" TfLiteTensor* {0}_output(int index) {{
+  return {0}_context_output(&default_context, index);
+}}
+'''.format(name))
+    source = replace(source, r'^extern "C" TfLiteStatus ' + name + r'_invoke\(\) \{\n',
+                     '''extern "C" TfLiteStatus {0}_invoke() {{
+  return {0}_context_invoke(&default_context);
+}}
+
+// Runs the operators of an instance, from the first operator data
+static TfLiteStatus Invoke({0}_context_t *context) {{
+  TfLiteContext &ctx = context->ctx;
+  TfLiteNode * const tflNodes = context->tflNodes;
+'''.format(name).replace('\\', '\\\\'))
+    source = replace(source, r'^(  return kTfLiteOk;\n\}\n)(\n*)\Z', r'''\1
+extern "C" TfLiteStatus {0}_context_invoke({0}_context_t *context) {{
+#if TF_LITE_MICRO_USE_OFFLINE_OP_USER_DATA
+  Lock(context);
+  TfLiteStatus status = Invoke(context);
+  Unlock(context);
+  return status;
+#else
+  return Invoke(context);
+#endif  // TF_LITE_MICRO_USE_OFFLINE_OP_USER_DATA
+}}
+\2'''.format(name))
+    return source
+
+
+def convert(source_path, name):
+    """
+    Converts a generated model and its header in place.
+
+    @return: True if converted, False if already converted
+    """
+    header_path = os.path.splitext(source_path)[0] + '.h'
+    files = {}
+    for path in (source_path, header_path):
+        with open(path, 'r', newline='') as f:
+            text = f.read()
+        files[path] = (text.replace('\r\n', '\n'), '\r\n' if '\r\n' in text else '\n')
+
+    source, source_newline = files[source_path]
+    header, header_newline = files[header_path]
+    if MARKER in source:
+        return False
+
+    arena, tensors, nodes = model_sizes(source)
+    source = convert_source(source, name, os.path.basename(header_path), tensors)
+    header = convert_header(header, name, arena, tensors, nodes)
+
+    for path, text, newline in ((source_path, source, source_newline), (header_path, header, header_newline)):
+        with open(path, 'w', newline='') as f:
+            f.write(text.replace('\n', newline))
+    return True
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description="Make the generated tflm_less model reentrant")
+    parser.add_argument("--models", default="../mtb_ml_gen/mtb_ml_models", help="Folder of the generated models")
+    parser.add_argument("--name", default="MAGIC_WAND", help="NN_MODEL_NAME of the Makefile")
+    args = parser.parse_args()
+
+    paths = sorted(glob.glob(os.path.join(args.models, args.name + '_tflm_less_model_*.cpp')))
+    if not paths:
+        print(f"[WARNING] No tflm_less model of {args.name} in {args.models}")
+    for path in paths:
+        status = "converted" if convert(path, args.name) else "already reentrant"
+        print(f"[INFO] {os.path.basename(path)}: {status}")
@@ -0,0 +1,191 @@
+# (c) 2022, Cypress Semiconductor Corporation (an Infineon company) or an affiliate of Cypress Semiconductor 
+# Corporation.  All rights reserved.
+#
+# This software, including source code, documentation and related materials
+# ("Software") is owned by Cypress Semiconductor Corporation or one of its
+# affiliates ("Cypress") and is protected by and subject to worldwide patent 
+# protection (United States and foreign), United States copyright laws and 
+# international treaty provisions.  Therefore, you may use this Software only
+# as provided in the license agreement accompanying the software package from
+# which you obtained this Software ("EULA").
+#
+# If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+# non-transferable license to copy, modify, and compile the Software source
+# code solely for use in connection with Cypress's integrated circuit products.
+# Any reproduction, modification, translation, compilation, or representation
+# of this Software except as specified above is prohibited without the express 
+# written permission of Cypress.
+#
+# Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+# WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+# reserves the right to make changes to the Software without notice. Cypress
+# does not assume any liability arising out of the application or use of the
+# Software or any product or circuit described in the Software. Cypress does
+# not authorize its products for use in any products where a malfunction or
+# failure of the Cypress product may reasonably be expected to result in
+# significant property damage, injury or death ("High Risk Product"). By
+# including Cypress's product in a High Risk Product, the manufacturer of such 
+# system or application assumes all risk of such use and in doing so agrees to
+# indemnify Cypress against all liability.
+
+"""
+Converts the event log of source/trace.c to the Chrome trace format, which
+opens in https://ui.perfetto.dev or chrome://tracing. The log is either a
+memory dump of the trace_log variable, taken with the debugger:
+
+    (gdb) dump binary value trace.bin trace_log
+
+or the serial output of the kit saved while trace_dump() runs:
+
+    python trace_export.py trace.bin [--serial] [--output trace.json]
+"""
+
+import argparse
+import json
+import struct
+
+import stream_protocol
+
+# Must match source/trace.h
+MAGIC = 0x31435254
+HEADER_FORMAT = '<IIII'
+EVENT_FORMAT = '<IBBH'
+PHASE_BEGIN = 0
+PHASE_END = 1
+PHASE_INSTANT = 2
+
+# Name and track of each trace_id_t
+TRACK_ISR = 'sensor isr'
+TRACK_GESTURE = 'gesture task'
+TRACK_INFERENCE = 'inference task'
+TRACK_UART = 'uart'
+TRACKS = [TRACK_ISR, TRACK_GESTURE, TRACK_INFERENCE, TRACK_UART]
+EVENTS = [
+    ('sensor_isr', TRACK_ISR),
+    ('fifo_write', TRACK_ISR),
+    ('window_ready', TRACK_ISR),
+    ('acquire_wake', TRACK_GESTURE),
+    ('preprocess_cast', TRACK_GESTURE),
+    ('preprocess_filter', TRACK_GESTURE),
+    ('preprocess_normalize', TRACK_GESTURE),
+    ('preprocess_axes', TRACK_GESTURE),
+    ('inference_wake', TRACK_INFERENCE),
+    ('model_run', TRACK_INFERENCE),
+    ('model_layer', TRACK_INFERENCE),
+    ('decision', TRACK_INFERENCE),
+    ('uart_flush', TRACK_UART),
+]
+PHASES = {PHASE_BEGIN: 'B', PHASE_END: 'E', PHASE_INSTANT: 'i'}
+
+
+def reassemble(data):
+    """
+    Extracts the log from the TYPE_TRACE frames of a serial capture. The dump
+    starts with the frame holding the magic, the last complete dump is kept.
+
+    @param data: Bytes received from the serial port
+    @return: The bytes of the log
+    """
+    decoder = stream_protocol.FrameDecoder()
+    log = None
+    dump = None
+
+    for frame_type, _, _, payload in decoder.feed(data):
+        if frame_type != stream_protocol.TYPE_TRACE:
+            continue
+        if len(payload) >= 4 and struct.unpack_from('<I', payload)[0] == MAGIC:
+            dump = bytearray()
+        if dump is None:
+            continue
+        dump += payload
+        if len(dump) >= struct.calcsize(HEADER_FORMAT):
+            capacity = struct.unpack_from(HEADER_FORMAT, dump)[2]
+            size = struct.calcsize(HEADER_FORMAT) + capacity * struct.calcsize(EVENT_FORMAT)
+            if len(dump) >= size:
+                log = bytes(dump[:size])
+                dump = None
+
+    if decoder.lost_frames or decoder.crc_errors:
+        print("Warning: %d lost frames, %d CRC errors" % (decoder.lost_frames, decoder.crc_errors))
+    if log is None:
+        raise ValueError("No complete trace in the capture")
+    return log
+
+
+def parse(log):
+    """
+    @param log: Bytes of a trace_log_t
+    @return: Frequency of the cycle counter, and the (cycles, id, phase, arg)
+             of the events, oldest first
+    """
+    magic, clock_hz, capacity, head = struct.unpack_from(HEADER_FORMAT, log)
+    if magic != MAGIC:
+        raise ValueError("Not a trace log")
+
+    offset = struct.calcsize(HEADER_FORMAT)
+    size = struct.calcsize(EVENT_FORMAT)
+    events = []
+    for index in range(max(0, head - capacity), head):
+        events.append(struct.unpack_from(EVENT_FORMAT, log, offset + (index % capacity) * size))
+    return clock_hz, events
+
+
+def export(clock_hz, events):
+    """
+    @param clock_hz: Frequency of the cycle counter
+    @param events: Events from parse()
+    @return: The trace, as a Chrome trace format object
+    """
+    trace = []
+    for tid, name in enumerate(TRACKS):
+        trace.append({'name': 'thread_name', 'ph': 'M', 'pid': 0, 'tid': tid, 'args': {'name': name}})
+
+    # The counter wraps every few tens of seconds, unwrap it
+    time = 0
+    last = events[0][0] if events else 0
+    depth = [0] * len(TRACKS)
+
+    for cycles, event_id, phase, arg in events:
+        time += (cycles - last) & 0xFFFFFFFF
+        last = cycles
+        if event_id >= len(EVENTS) or phase not in PHASES:
+            continue
+
+        name, track = EVENTS[event_id]
+        tid = TRACKS.index(track)
+
+        # The begin of the oldest events may have been overwritten
+        if phase == PHASE_BEGIN:
+            depth[tid] += 1
+        elif phase == PHASE_END:
+            if depth[tid] == 0:
+                continue
+            depth[tid] -= 1
+
+        entry = {'name': name, 'ph': PHASES[phase], 'ts': time * 1e6 / clock_hz,
+                 'pid': 0, 'tid': tid, 'args': {'arg': arg}}
+        if phase == PHASE_INSTANT:
+            entry['s'] = 't'
+        trace.append(entry)
+
+    return {'traceEvents': trace, 'displayTimeUnit': 'ns'}
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description="Convert a trace log to the Chrome trace format")
+    parser.add_argument("input", help="Memory dump of trace_log, or serial capture with --serial")
+    parser.add_argument("--serial", action="store_true", help="The input is a serial capture of trace_dump()")
+    parser.add_argument("--output", default="trace.json", help="Chrome trace file to write")
+    args = parser.parse_args()
+
+    with open(args.input, 'rb') as f:
+        data = f.read()
+    if args.serial:
+        data = reassemble(data)
+
+    clock_hz, events = parse(data)
+    with open(args.output, 'w') as f:
+        json.dump(export(clock_hz, events), f)
+    print("%d events, %.1f ms, written to %s" % (len(events),
+          ((events[-1][0] - events[0][0]) & 0xFFFFFFFF) * 1e3 / clock_hz if events else 0.0, args.output))
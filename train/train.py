@@ -108,10 +108,13 @@ class TrainModel(object):
         @return: a keras ML model
         """
         model = tf.keras.Sequential([
-            tf.keras.layers.Conv2D(16, (3, 3), padding="same", activation="relu", kernel_initializer='glorot_normal',
+            # BatchNormalization sits between the convolution and its activation so that
+            # fold_model.py can fold it into the convolution for deployment
+            tf.keras.layers.Conv2D(16, (3, 3), padding="same", kernel_initializer='glorot_normal',
                                    input_shape=(seq_length, 6, 1)),
-            tf.keras.layers.MaxPool2D((3, 3)),
             tf.keras.layers.BatchNormalization(),
+            tf.keras.layers.ReLU(),
+            tf.keras.layers.MaxPool2D((3, 3)),
             tf.keras.layers.Dropout(0.2),
             tf.keras.layers.Conv2D(32, (3, 3), padding="same", kernel_initializer='glorot_normal', activation="relu"),
             tf.keras.layers.MaxPool2D((3, 1)),
@@ -0,0 +1,308 @@
+# (c) 2022, Cypress Semiconductor Corporation (an Infineon company) or an affiliate of Cypress Semiconductor 
+# Corporation.  All rights reserved.
+#
+# This software, including source code, documentation and related materials
+# ("Software") is owned by Cypress Semiconductor Corporation or one of its
+# affiliates ("Cypress") and is protected by and subject to worldwide patent 
+# protection (United States and foreign), United States copyright laws and 
+# international treaty provisions.  Therefore, you may use this Software only
+# as provided in the license agreement accompanying the software package from
+# which you obtained this Software ("EULA").
+#
+# If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+# non-transferable license to copy, modify, and compile the Software source
+# code solely for use in connection with Cypress's integrated circuit products.
+# Any reproduction, modification, translation, compilation, or representation
+# of this Software except as specified above is prohibited without the express 
+# written permission of Cypress.
+#
+# Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+# WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+# reserves the right to make changes to the Software without notice. Cypress
+# does not assume any liability arising out of the application or use of the
+# Software or any product or circuit described in the Software. Cypress does
+# not authorize its products for use in any products where a malfunction or
+# failure of the Cypress product may reasonably be expected to result in
+# significant property damage, injury or death ("High Risk Product"). By
+# including Cypress's product in a High Risk Product, the manufacturer of such 
+# system or application assumes all risk of such use and in doing so agrees to
+# indemnify Cypress against all liability.
+
+"""
+Benchmarks every model variant generated in mtb_ml_gen/mtb_ml_models/, one per
+combination of NN_INFERENCE_ENGINE and NN_TYPE, to choose the deployment
+variant from data. For each variant it reports:
+
+- the flash and RAM of the model, from the generated header
+- the flash and RAM of the application, from the ELF, with --build
+- the model latency, the accuracy and the agreement with the float reference,
+  measured on the kit with --port. Each variant is programmed with REPLAY=1,
+  and the recorded windows of gesture_data/ are sent to source/replay.c, so
+  every variant classifies the same windows.
+
+The inference engines only run on the kit, so without --port the accuracy is
+estimated on the host with the TFLite models of model_gen_dir/, for the
+precisions that have one.
+
+    python variant_bench.py [--port COM5] [--build] [--windows 200] [--output variants.json]
+"""
+
+import argparse
+import json
+import os
+import re
+import struct
+import subprocess
+import sys
+import time
+import numpy as np
+
+import stream_protocol
+from replay_data import load_windows
+
+# Must match source/replay.h
+REPLAY_SCALE = 32768.0
+RESULT_FORMAT = '<HbBII'
+NO_CLASS = -1
+
+APP_DIR = '..'
+MODELS_DIR = '../mtb_ml_gen/mtb_ml_models'
+TFLITE_DIR = '../mtb_ml_gen/model_gen_dir'
+APP_NAME = 'mtb-example-ml-gesture-classification'
+TARGET = 'CY8CKIT-062S2-43012'
+CONFIG = 'Release'
+BAUDRATE = 115200
+
+# Order of the table, the float reference first
+ENGINES = ('tflm', 'tflm_less', 'ifx')
+TYPES = ('float', 'int8x8', 'int16x8', 'int16x16')
+
+# Time to wait for the result of a window before sending it again
+RESULT_TIMEOUT = 1.0
+RETRIES = 3
+
+
+def find_variants(model_name):
+    """
+    @return: List of (engine, type) of the generated models, in table order
+    """
+    pattern = re.compile(re.escape(model_name) + r'_(tflm_less|tflm|ifx)_model_(\w+)\.h$')
+    found = set()
+    for file_name in os.listdir(MODELS_DIR):
+        match = pattern.match(file_name)
+        if match:
+            found.add((match.group(1), match.group(2)))
+    return sorted(found, key=lambda v: (TYPES.index(v[1]) if v[1] in TYPES else len(TYPES),
+                                        ENGINES.index(v[0])))
+
+
+def model_footprint(model_name, engine, nn_type):
+    """
+    Reads the sizes of the model from its generated header. The flash holds the
+    model and parameters, the RAM is the arena or scratch memory.
+
+    @return: (flash, ram) in bytes
+    """
+    path = os.path.join(MODELS_DIR, f'{model_name}_{engine}_model_{nn_type}.h')
+    with open(path, 'r') as f:
+        text = f.read()
+
+    def size(name):
+        match = re.search(r'#define\s+' + re.escape(model_name) + r'_' + name + r'\s+\(?(\d+)u?\)?', text)
+        return int(match.group(1)) if match else 0
+
+    if engine == 'ifx':
+        return size('MODEL_BIN_LEN') + size('MODEL_PRMS_BIN_LEN'), size('MODEL_SCRATCH_MEM_SIZE')
+    if engine == 'tflm_less':
+        return (size('MODEL_CONST_DATA_SIZE') + size('MODEL_INIT_DATA_SIZE'),
+                size('MODEL_INIT_DATA_SIZE') + size('MODEL_UNINIT_DATA_SIZE'))
+    return size('MODEL_BIN_LEN'), size('ARENA_SIZE')
+
+
+def make(goal, engine, nn_type):
+    """
+    Builds, or builds and programs, the application for one variant in replay
+    mode.
+    """
+    command = ['make', goal, f'NN_INFERENCE_ENGINE={engine}', f'NN_TYPE={nn_type}',
+               'NN_RUNTIME_TYPES=', 'NN_SPARSE=0', 'REPLAY=1', f'CONFIG={CONFIG}']
+    print(f"[INFO] {' '.join(command)}")
+    subprocess.run(command, cwd=APP_DIR, check=True, stdout=subprocess.DEVNULL)
+
+
+def app_footprint():
+    """
+    @return: (flash, ram) of the last build in bytes, from arm-none-eabi-size
+    """
+    elf = os.path.join(APP_DIR, 'build', TARGET, CONFIG, APP_NAME + '.elf')
+    output = subprocess.run(['arm-none-eabi-size', elf], check=True,
+                            capture_output=True, text=True).stdout
+    text, data, bss = (int(i) for i in output.splitlines()[1].split()[0:3])
+    return text + data, data + bss
+
+
+def replay_device(port, windows, negative):
+    """
+    Sends the windows one at a time to the kit and waits for each decision.
+
+    @return: predictions (N,), model time of each window in us (N,); -1 for the
+             windows that got no result
+    """
+    import serial
+
+    predictions = np.full(len(windows), -1, dtype=int)
+    latency_us = np.full(len(windows), -1.0)
+    decoder = stream_protocol.FrameDecoder()
+
+    with serial.Serial(port, BAUDRATE, timeout=0.05) as ser:
+        # Skip the text printed at startup
+        time.sleep(2.0)
+        ser.reset_input_buffer()
+
+        for i, window in enumerate(windows):
+            sequence = i & 0xFFFF
+            payload = np.clip(np.round(window * REPLAY_SCALE), -32768, 32767).astype('<i2').tobytes()
+            frame = stream_protocol.encode_frame(stream_protocol.TYPE_WINDOW, sequence, payload)
+
+            for _ in range(RETRIES):
+                ser.write(frame)
+                deadline = time.monotonic() + RESULT_TIMEOUT
+                while predictions[i] < 0 and time.monotonic() < deadline:
+                    for frame_type, _, _, data in decoder.feed(ser.read(256)):
+                        if frame_type != stream_protocol.TYPE_RESULT:
+                            continue
+                        window_sequence, class_index, _, cycles, cycles_per_us = struct.unpack(RESULT_FORMAT, data)
+                        if window_sequence == sequence:
+                            predictions[i] = negative if class_index == NO_CLASS else class_index
+                            latency_us[i] = cycles / max(cycles_per_us, 1)
+                if predictions[i] >= 0:
+                    break
+
+            if (i + 1) % 100 == 0:
+                print(f"[INFO] {i + 1}/{len(windows)} windows")
+
+    return predictions, latency_us
+
+
+def replay_host(nn_type, model_name, windows, negative):
+    """
+    Runs the windows through the TFLite model of the precision, if there is
+    one, with the decision of control().
+
+    @return: predictions (N,), or None
+    """
+    path = os.path.join(TFLITE_DIR, f'{model_name}_{nn_type}.tflite')
+    if not os.path.exists(path):
+        return None
+    from cascade_eval import TfliteModel, decide
+
+    model = TfliteModel(path)
+    return np.array([decide(model.predict(window), negative) for window in windows])
+
+
+def latency_stats(latency_us):
+    """
+    @return: Average, median, 99th percentile and maximum in us, or None
+    """
+    valid = latency_us[latency_us >= 0]
+    if len(valid) == 0:
+        return None
+    return {
+        'avg': float(np.mean(valid)),
+        'p50': float(np.percentile(valid, 50)),
+        'p99': float(np.percentile(valid, 99)),
+        'max': float(np.max(valid)),
+    }
+
+
+def print_table(results):
+    def cell(value, fmt):
+        width = int(re.match(r'\+?(\d+)', fmt).group(1))
+        return format(value, fmt) if value is not None else '-'.rjust(width)
+
+    print("")
+    print("Engine    | Type     | Model flash | Model RAM | App flash | App RAM | "
+          "Avg (us) | p99 (us) | Accuracy | Delta vs float | Agreement")
+    print("----------|----------|-------------|-----------|-----------|---------|"
+          "----------|----------|----------|----------------|----------")
+    for r in results:
+        latency = r['latency_us'] or {}
+        print(f"{r['engine']:<9} | {r['type']:<8} | {r['model_flash']:11d} | {r['model_ram']:9d} | "
+              f"{cell(r['app_flash'], '9d')} | {cell(r['app_ram'], '7d')} | "
+              f"{cell(latency.get('avg'), '8.0f')} | {cell(latency.get('p99'), '8.0f')} | "
+              f"{cell(r['accuracy'], '8.2%')} | {cell(r['accuracy_delta'], '+14.2%')} | "
+              f"{cell(r['agreement'], '9.2%')}")
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description="Benchmark every generated model variant")
+    parser.add_argument("--model", default="MAGIC_WAND", help="NN_MODEL_NAME of the generated models")
+    parser.add_argument("--port", help="Serial port of the kit, to measure each variant on the device")
+    parser.add_argument("--build", action="store_true", help="Build each variant to measure the application size")
+    parser.add_argument("--windows", type=int, default=0,
+                        help="Replay this many windows, evenly spread, instead of all of them")
+    parser.add_argument("--output", default="variants.json", help="JSON file to write")
+    args = parser.parse_args()
+
+    windows, labels, classes = load_windows()
+    if 0 < args.windows < len(windows):
+        keep = np.linspace(0, len(windows) - 1, args.windows).astype(int)
+        windows, labels = windows[keep], labels[keep]
+    negative = len(classes) - 1
+
+    variants = find_variants(args.model)
+    if not variants:
+        sys.exit(f"[ERROR] No {args.model} model in {MODELS_DIR}")
+
+    results = []
+    reference = None
+    for engine, nn_type in variants:
+        model_flash, model_ram = model_footprint(args.model, engine, nn_type)
+        result = {
+            'engine': engine, 'type': nn_type,
+            'model_flash': model_flash, 'model_ram': model_ram,
+            'app_flash': None, 'app_ram': None,
+            'source': None, 'windows': int(len(windows)), 'lost_windows': 0,
+            'latency_us': None, 'accuracy': None, 'accuracy_delta': None, 'agreement': None,
+        }
+
+        if args.build or args.port:
+            make('program' if args.port else 'build', engine, nn_type)
+            result['app_flash'], result['app_ram'] = app_footprint()
+
+        predictions = None
+        if args.port:
+            predictions, latency_us = replay_device(args.port, windows, negative)
+            result['source'] = 'device'
+            result['latency_us'] = latency_stats(latency_us)
+            result['lost_windows'] = int(np.sum(predictions < 0))
+        else:
+            try:
+                predictions = replay_host(nn_type, args.model, windows, negative)
+                result['source'] = 'host' if predictions is not None else None
+            except ImportError:
+                predictions = None
+
+        if predictions is not None:
+            result['accuracy'] = float(np.mean(predictions == labels))
+            # The first float variant is the reference of the others
+            if reference is None and nn_type == 'float':
+                reference = (predictions, result['accuracy'])
+            if reference is not None:
+                result['accuracy_delta'] = result['accuracy'] - reference[1]
+                result['agreement'] = float(np.mean(predictions == reference[0]))
+            result['predictions'] = predictions.tolist()
+
+        results.append(result)
+
+    print(f"[INFO] Windows replayed: {len(windows)}, classes: {', '.join(classes)}")
+    print_table(results)
+
+    for r in results:
+        r.pop('predictions', None)
+    with open(args.output, 'w') as f:
+        json.dump({'model': args.model, 'classes': classes, 'windows': int(len(windows)),
+                   'variants': results}, f, indent=2)
+    print("")
+    print(f"[INFO] Results written to {args.output}")